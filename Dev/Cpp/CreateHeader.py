@@ -71,6 +71,13 @@ effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Vec4f.h')
 effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Mat43f.h')
 effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Mat44f.h')
 effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Utils.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Float8_Gen.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Float8_AVX.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Int8_Gen.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Int8_AVX.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Bridge8_Gen.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Bridge8_AVX.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Mat43f8.h')
 effekseerSimdHeader.output('Effekseer/Effekseer.SIMD.h')
 
 effekseerModulesHeader = CreateHeader()
@@ -90,6 +97,7 @@ effekseerModulesHeader.readLines('Effekseer/Effekseer/Effekseer.EffectLoader.h')
 effekseerModulesHeader.readLines('Effekseer/Effekseer/Effekseer.TextureLoader.h')
 effekseerModulesHeader.readLines('Effekseer/Effekseer/Model/Model.h')
 effekseerModulesHeader.readLines('Effekseer/Effekseer/Model/ModelLoader.h')
+effekseerModulesHeader.readLines('Effekseer/Effekseer/Model/ProcedualModelGenerator.h')
 effekseerModulesHeader.readLines('Effekseer/Effekseer/Effekseer.MaterialLoader.h')
 effekseerModulesHeader.readLines('Effekseer/Effekseer/Model/Model.h')
 effekseerModulesHeader.readLines('Effekseer/Effekseer/Effekseer.Curve.h')
@@ -133,3 +141,9 @@ effekseerRendererMetalHeader.readLines('EffekseerRendererMetal/EffekseerRenderer
 effekseerRendererMetalHeader.readLines('EffekseerRendererCommon/EffekseerRenderer.Renderer.h')
 effekseerRendererMetalHeader.readLines('EffekseerRendererMetal/EffekseerRenderer/EffekseerRendererMetal.Renderer.h')
 effekseerRendererMetalHeader.output('EffekseerRendererMetal/EffekseerRendererMetal.h')
+
+effekseerRendererNullHeader = CreateHeader()
+effekseerRendererNullHeader.readLines('EffekseerRendererNull/EffekseerRenderer/EffekseerRendererNull.Base.Pre.h')
+effekseerRendererNullHeader.readLines('EffekseerRendererCommon/EffekseerRenderer.Renderer.h')
+effekseerRendererNullHeader.readLines('EffekseerRendererNull/EffekseerRenderer/EffekseerRendererNull.Renderer.h')
+effekseerRendererNullHeader.output('EffekseerRendererNull/EffekseerRendererNull.h')
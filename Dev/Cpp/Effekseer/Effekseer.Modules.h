@@ -100,6 +100,9 @@ public:
 
 		bool EnableViewOffset = false;
 
+		//! whether have all corners of each sprite in an effect the same color and are placed at a parallelogram
+		bool HasUniformCorners = false;
+
 		RefPtr<RenderingUserData> UserData;
 	};
 
@@ -155,6 +158,33 @@ public:
 	virtual void EndRendering(const NodeParameter& parameter, void* userData)
 	{
 	}
+
+	/**
+		@brief	write vertices of instances which are drawn between BeginRendering and EndRendering into a buffer
+		@param	parameter	[in]	a parameter of a node
+		@param	instanceParameters	[in]	parameters of instances in the order of Rendering
+		@param	count	[in]	the number of instances
+		@param	vertices	[in,out]	a buffer which vertices are appended to
+		@return	a stride of written vertices. 0 if vertices are not written
+		@note
+		It is called on worker threads while a manager draws in parallel. It must not change this renderer.
+	*/
+	virtual int32_t WriteVertices(const NodeParameter& parameter,
+								  const InstanceParameter* instanceParameters,
+								  int32_t count,
+								  CustomAlignedVector<uint8_t>& vertices) const
+	{
+		return 0;
+	}
+
+	/**
+		@brief	draw vertices written by WriteVertices instead of calling Rendering for each instance
+		@return	false if vertices cannot be drawn and Rendering must be called for each instance
+	*/
+	virtual bool RenderingVertices(const NodeParameter& parameter, const void* vertices, int32_t size, int32_t stride, void* userData)
+	{
+		return false;
+	}
 };
 
 //----------------------------------------------------------------------------------
@@ -677,6 +707,19 @@ public:
 		::Effekseer::Effect::Create実行終了時に使用される。
 	*/
 	virtual void Unload(void* data, int32_t size) = 0;
+
+	/**
+		@brief
+		\~English	Get whether loaded data can be kept by an effect until Unload is called instead of being released after loading.
+		\~Japanese	読み込まれたデータを読み込み後に破棄せずに、Unloadが呼ばれるまでエフェクトが保持できるか取得する。
+		@note
+		\~English	Keys of curves in kept data are referenced instead of being copied. It should be true only if keeping data costs little memory, e.g. data is mapped from a file.
+		\~Japanese	保持されたデータのカーブのキーはコピーされずに参照される。ファイルがマッピングされている場合など、データの保持にほとんどメモリが必要ない場合のみtrueにするべきである。
+	*/
+	virtual bool CanKeepData(const void*, int32_t)
+	{
+		return false;
+	}
 };
 
 //----------------------------------------------------------------------------------
@@ -762,6 +805,47 @@ public:
 		return nullptr;
 	}
 
+	/**
+		@brief
+		\~English	decode a texture into parameters to create it without a graphics device
+		\~Japanese	グラフィックスデバイスを使わずに、テクスチャを生成するためのパラメーターにデコードする。
+		@param	path
+		\~English	a path of a texture
+		\~Japanese	読み込み元パス
+		@param	textureType
+		\~English	a kind of texture
+		\~Japanese	テクスチャの種類
+		@param	param
+		\~English	decoded parameters
+		\~Japanese	デコードされたパラメーター
+		@return
+		\~English	whether it is decoded. If it is false, Load is used instead of Create.
+		\~Japanese	デコードされたかどうか。falseの場合、Createの代わりにLoadが使用される。
+		@note
+		\~English	It is called on worker threads when an effect is loaded with Effect::CreateAsync, so it must be thread-safe.
+		\~Japanese	Effect::CreateAsyncでエフェクトが読み込まれる時にワーカースレッドで呼ばれるため、スレッドセーフである必要がある。
+	*/
+	virtual bool Decode(const char16_t* path, TextureType textureType, Backend::TextureParameter& param)
+	{
+		return false;
+	}
+
+	/**
+		@brief
+		\~English	create a texture from parameters which are decoded with Decode
+		\~Japanese	Decodeでデコードされたパラメーターからテクスチャを生成する。
+		@param	param
+		\~English	decoded parameters
+		\~Japanese	デコードされたパラメーター
+		@return
+		\~English	a pointer of created texture
+		\~Japanese	生成されたテクスチャのポインタ
+	*/
+	virtual TextureRef Create(const Backend::TextureParameter& param)
+	{
+		return nullptr;
+	}
+
 	/**
 		@brief	テクスチャを破棄する。
 		@param	data	[in]	テクスチャ
@@ -807,6 +891,9 @@ class Model : public Resource
 public:
 	static const int32_t Version = 1;
 
+	//! a version of efkmodel which is written by Save
+	static const int32_t SavedVersion = 5;
+
 	struct Vertex
 	{
 		Vector3D Position;
@@ -817,6 +904,22 @@ public:
 		Color VColor;
 	};
 
+	/**
+		@brief	a vertex which is stored on GPU by StoreBufferToGPU with isPacked
+		@note
+		A normal, a binormal and a tangent are signed normalized 10:10:10:2 integers whose x is in the lowest bits.
+		An uv is stored in half floats. They are decoded when vertices are fetched.
+	*/
+	struct PackedVertex
+	{
+		Vector3D Position;
+		uint32_t Normal;
+		uint32_t Binormal;
+		uint32_t Tangent;
+		std::array<uint16_t, 2> UV;
+		Color VColor;
+	};
+
 	struct Face
 	{
 		std::array<int32_t, 3> Indexes;
@@ -843,7 +946,11 @@ protected:
 	int32_t version_ = 0;
 	CustomVector<InternalModel> models_;
 	bool isBufferStoredOnGPU_ = false;
+	bool isBufferPacked_ = false;
 	bool isWireIndexBufferGenerated_ = false;
+	float boundingRadius_ = 0.0f;
+
+	void CalculateBoundingRadius();
 
 public:
 	Model(const CustomVector<Vertex>& vertecies, const CustomVector<Face>& faces);
@@ -868,6 +975,29 @@ public:
 
 	int32_t GetFrameCount() const;
 
+	/**
+		@brief
+		\~English	get a radius of a sphere around the origin which contains vertices of all frames
+		\~Japanese	全てのフレームの頂点を含む原点中心の球の半径を取得する。
+	*/
+	float GetBoundingRadius() const;
+
+	/**
+		@brief
+		\~English	write vertices and faces of all frames in the format which is read by the constructor, and a key after them
+		\~Japanese	全てのフレームの頂点と面をコンストラクタで読み込める形式で書き込み、その後にキーを書き込む。
+		@param	key	\~English	a value which identifies how the model was made. The constructor ignores it.
+					\~Japanese	モデルの作り方を識別する値。コンストラクタでは無視される。
+	*/
+	void Save(CustomVector<uint8_t>& data, uint64_t key) const;
+
+	/**
+		@brief
+		\~English	check whether data written by Save with the key can be read by the constructor without reading out of the data
+		\~Japanese	指定したキーでSaveで書き込まれたデータがデータ外を読まずにコンストラクタで読み込めるか確認する。
+	*/
+	static bool IsValidSavedData(const void* data, int32_t size, uint64_t key);
+
 	Emitter GetEmitter(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
 
 	Emitter GetEmitterFromVertex(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
@@ -878,10 +1008,25 @@ public:
 
 	Emitter GetEmitterFromFace(int32_t index, int32_t time, CoordinateSystem coordinate, float magnification);
 
-	bool StoreBufferToGPU(Backend::GraphicsDevice* graphicsDevice);
+	/**
+		@brief
+		\~English	store vertices and faces of all frames on GPU
+		\~Japanese	全てのフレームの頂点と面をGPUに格納する。
+		@param	graphicsDevice	[in]	\~English	a graphics device	\~Japanese	グラフィックスデバイス
+		@param	isPacked	[in]	\~English	whether vertices are stored as PackedVertex and indexes are stored in 16bit integers if possible. It is lossy.
+		\~Japanese	頂点をPackedVertexとして格納し、可能ならインデックスを16bit整数で格納するか。非可逆である。
+	*/
+	bool StoreBufferToGPU(Backend::GraphicsDevice* graphicsDevice, bool isPacked = false);
 
 	bool GetIsBufferStoredOnGPU() const;
 
+	/**
+		@brief
+		\~English	get a size of a vertex in a vertex buffer on GPU
+		\~Japanese	GPU上の頂点バッファの頂点のサイズを取得する。
+	*/
+	int32_t GetVertexBufferStride() const;
+
 	bool GenerateWireIndexBuffer(Backend::GraphicsDevice* graphicsDevice);
 
 	bool GetIsWireIndexBufferGenerated() const;
@@ -957,6 +1102,61 @@ public:
 //
 //----------------------------------------------------------------------------------
 #endif // __EFFEKSEER_MODELLOADER_H__
+#ifndef __EFFEKSEER_PROCEDUAL_MODEL_GENERATOR_H__
+#define __EFFEKSEER_PROCEDUAL_MODEL_GENERATOR_H__
+
+#include <atomic>
+#include <memory>
+
+namespace Effekseer
+{
+
+class ProcedualModelWorkers;
+
+class ProcedualModelGenerator : public ReferenceObject
+{
+	//! the maximum number of threads by default
+	static const int32_t MaxDefaultThreadCount = 4;
+
+	std::unique_ptr<ProcedualModelWorkers> workers_;
+	std::atomic<int32_t> threadCount_;
+
+public:
+	ProcedualModelGenerator();
+	virtual ~ProcedualModelGenerator();
+
+	virtual ModelRef Generate(const ProcedualModelParameter* parameter);
+
+	virtual void Ungenerate(ModelRef model);
+
+	int32_t GetThreadCount() const
+	{
+		return threadCount_;
+	}
+
+	/**
+		@brief
+		\~English	specify the number of threads which generate a model
+		\~Japanese	モデルを生成するスレッド数を設定する。
+		@note
+		\~English
+		Vertices of a large model are generated in parallel. A generated model doesn't depend on the number of threads.
+		The default is the number of hardware threads, up to 4. Threads are launched when a large model is generated first and are reused.
+		A model which is generated while another model is generated is generated on the calling thread.
+		\~Japanese
+		大きなモデルの頂点は並列に生成される。生成されるモデルはスレッド数に依存しない。
+		既定値はハードウェアスレッド数(最大4)である。スレッドは大きなモデルが最初に生成される時に起動され、再利用される。
+		他のモデルの生成中に生成されるモデルは呼び出し元のスレッドで生成される。
+	*/
+	void SetThreadCount(int32_t threadCount)
+	{
+		threadCount_ = Max(threadCount, 1);
+	}
+};
+
+} // namespace Effekseer
+
+#endif
 
 #ifndef __EFFEKSEER_MATERIALLOADER_H__
 #define __EFFEKSEER_MATERIALLOADER_H__
@@ -1066,6 +1266,9 @@ class Model : public Resource
 public:
 	static const int32_t Version = 1;
 
+	//! a version of efkmodel which is written by Save
+	static const int32_t SavedVersion = 5;
+
 	struct Vertex
 	{
 		Vector3D Position;
@@ -1076,6 +1279,22 @@ public:
 		Color VColor;
 	};
 
+	/**
+		@brief	a vertex which is stored on GPU by StoreBufferToGPU with isPacked
+		@note
+		A normal, a binormal and a tangent are signed normalized 10:10:10:2 integers whose x is in the lowest bits.
+		An uv is stored in half floats. They are decoded when vertices are fetched.
+	*/
+	struct PackedVertex
+	{
+		Vector3D Position;
+		uint32_t Normal;
+		uint32_t Binormal;
+		uint32_t Tangent;
+		std::array<uint16_t, 2> UV;
+		Color VColor;
+	};
+
 	struct Face
 	{
 		std::array<int32_t, 3> Indexes;
@@ -1102,7 +1321,11 @@ protected:
 	int32_t version_ = 0;
 	CustomVector<InternalModel> models_;
 	bool isBufferStoredOnGPU_ = false;
+	bool isBufferPacked_ = false;
 	bool isWireIndexBufferGenerated_ = false;
+	float boundingRadius_ = 0.0f;
+
+	void CalculateBoundingRadius();
 
 public:
 	Model(const CustomVector<Vertex>& vertecies, const CustomVector<Face>& faces);
@@ -1127,6 +1350,29 @@ public:
 
 	int32_t GetFrameCount() const;
 
+	/**
+		@brief
+		\~English	get a radius of a sphere around the origin which contains vertices of all frames
+		\~Japanese	全てのフレームの頂点を含む原点中心の球の半径を取得する。
+	*/
+	float GetBoundingRadius() const;
+
+	/**
+		@brief
+		\~English	write vertices and faces of all frames in the format which is read by the constructor, and a key after them
+		\~Japanese	全てのフレームの頂点と面をコンストラクタで読み込める形式で書き込み、その後にキーを書き込む。
+		@param	key	\~English	a value which identifies how the model was made. The constructor ignores it.
+					\~Japanese	モデルの作り方を識別する値。コンストラクタでは無視される。
+	*/
+	void Save(CustomVector<uint8_t>& data, uint64_t key) const;
+
+	/**
+		@brief
+		\~English	check whether data written by Save with the key can be read by the constructor without reading out of the data
+		\~Japanese	指定したキーでSaveで書き込まれたデータがデータ外を読まずにコンストラクタで読み込めるか確認する。
+	*/
+	static bool IsValidSavedData(const void* data, int32_t size, uint64_t key);
+
 	Emitter GetEmitter(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
 
 	Emitter GetEmitterFromVertex(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
@@ -1137,10 +1383,25 @@ public:
 
 	Emitter GetEmitterFromFace(int32_t index, int32_t time, CoordinateSystem coordinate, float magnification);
 
-	bool StoreBufferToGPU(Backend::GraphicsDevice* graphicsDevice);
+	/**
+		@brief
+		\~English	store vertices and faces of all frames on GPU
+		\~Japanese	全てのフレームの頂点と面をGPUに格納する。
+		@param	graphicsDevice	[in]	\~English	a graphics device	\~Japanese	グラフィックスデバイス
+		@param	isPacked	[in]	\~English	whether vertices are stored as PackedVertex and indexes are stored in 16bit integers if possible. It is lossy.
+		\~Japanese	頂点をPackedVertexとして格納し、可能ならインデックスを16bit整数で格納するか。非可逆である。
+	*/
+	bool StoreBufferToGPU(Backend::GraphicsDevice* graphicsDevice, bool isPacked = false);
 
 	bool GetIsBufferStoredOnGPU() const;
 
+	/**
+		@brief
+		\~English	get a size of a vertex in a vertex buffer on GPU
+		\~Japanese	GPU上の頂点バッファの頂点のサイズを取得する。
+	*/
+	int32_t GetVertexBufferStride() const;
+
 	bool GenerateWireIndexBuffer(Backend::GraphicsDevice* graphicsDevice);
 
 	bool GetIsWireIndexBufferGenerated() const;
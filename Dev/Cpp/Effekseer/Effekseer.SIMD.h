@@ -25,6 +25,10 @@
 #if defined(__AVX2__)
 #define EFK_SIMD_AVX2
 #endif
+// FMA is not a part of AVX2 on GCC and Clang (MSVC enables it with /arch:AVX2)
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(EFK_SIMD_AVX2))
+#define EFK_SIMD_FMA
+#endif
 #if defined(__AVX__) || defined(EFK_SIMD_AVX2)
 #define EFK_SIMD_AVX
 #endif
@@ -62,6 +66,14 @@
 
 #endif
 
+// Types with 8 lanes are declared in a namespace which depends on a backend
+// so that a translation unit compiled with AVX2 can be linked with ones compiled without it.
+#if defined(EFK_SIMD_AVX2)
+#define EFK_SIMD_WIDE_NAMESPACE AVX2
+#else
+#define EFK_SIMD_WIDE_NAMESPACE Gen
+#endif
+
 const float DefaultEpsilon = 1e-6f;
 
 #endif // __EFFEKSEER_SIMD_BASE_H__
@@ -1431,7 +1443,7 @@ inline Float4 Float4::Ceil(const Float4& in)
 
 inline Float4 Float4::MulAdd(const Float4& a, const Float4& b, const Float4& c)
 {
-#if defined(EFK_SIMD_AVX2)
+#if defined(EFK_SIMD_FMA)
 	return Float4{_mm_fmadd_ps(b.s, c.s, a.s)};
 #else
 	return Float4{_mm_add_ps(a.s, _mm_mul_ps(b.s, c.s))};
@@ -1440,7 +1452,7 @@ inline Float4 Float4::MulAdd(const Float4& a, const Float4& b, const Float4& c)
 
 inline Float4 Float4::MulSub(const Float4& a, const Float4& b, const Float4& c)
 {
-#if defined(EFK_SIMD_AVX2)
+#if defined(EFK_SIMD_FMA)
 	return Float4{_mm_fnmadd_ps(b.s, c.s, a.s)};
 #else
 	return Float4{_mm_sub_ps(a.s, _mm_mul_ps(b.s, c.s))};
@@ -1458,7 +1470,7 @@ template<size_t LANE>
 Float4 Float4::MulAddLane(const Float4& a, const Float4& b, const Float4& c)
 {
 	static_assert(LANE < 4, "LANE is must be less than 4.");
-#if defined(EFK_SIMD_AVX2)
+#if defined(EFK_SIMD_FMA)
 	return _mm_fmadd_ps(b.s, Swizzle<LANE,LANE,LANE,LANE>(c).s, a.s);
 #else
 	return _mm_add_ps(a.s, _mm_mul_ps(b.s, Swizzle<LANE,LANE,LANE,LANE>(c).s));
@@ -1469,7 +1481,7 @@ template<size_t LANE>
 Float4 Float4::MulSubLane(const Float4& a, const Float4& b, const Float4& c)
 {
 	static_assert(LANE < 4, "LANE is must be less than 4.");
-#if defined(EFK_SIMD_AVX2)
+#if defined(EFK_SIMD_FMA)
 	return _mm_fnmadd_ps(b.s, Swizzle<LANE,LANE,LANE,LANE>(c).s, a.s);
 #else
 	return _mm_sub_ps(a.s, _mm_mul_ps(b.s, Swizzle<LANE,LANE,LANE,LANE>(c).s));
@@ -3922,8 +3934,1632 @@ inline Matrix44 ToStruct(const Mat44f& o)
 	return ret;
 }
 
+/**
+	@brief	4 lanes version of ::Effekseer::NormalizeAngle
+*/
+inline Float4 NormalizeAngle(const Float4& angle)
+{
+	const Float4 signMask = Float4::SetUInt(0x80000000, 0x80000000, 0x80000000, 0x80000000);
+	const Float4 ofs = (angle & signMask) | Float4(0.5f);
+	const Float4 x = angle * 0.159154943f + ofs;
+
+	// truncate toward zero like a cast to int (adding zero turns -0 into +0 as int does)
+	const Float4 truncated = Float4::Select(Float4::GreaterEqual(x, Float4::SetZero()), Float4::Floor(x), Float4::Ceil(x)) + Float4::SetZero();
+	return angle - truncated * 6.283185307f;
+}
+
+/**
+	@brief	4 lanes version of ::Effekseer::SinCos
+	@note
+	Operations are the same order as the scalar version so that results are the same.
+*/
+inline void SinCos(const Float4& in, Float4& s, Float4& c)
+{
+	const Float4 x = NormalizeAngle(in);
+	const Float4 x2 = x * x;
+	const Float4 x4 = x * x * x * x;
+	const Float4 x6 = x * x * x * x * x * x;
+	const Float4 x8 = x * x * x * x * x * x * x * x;
+	const Float4 x10 = x * x * x * x * x * x * x * x * x * x;
+	s = x * (Float4(1.0f) - x2 / 6.0f + x4 / 120.0f - x6 / 5040.0f + x8 / 362880.0f - x10 / 39916800.0f);
+	c = Float4(1.0f) - x2 / 2.0f + x4 / 24.0f - x6 / 720.0f + x8 / 40320.0f - x10 / 3628800.0f;
+}
+
+/**
+	@brief	whether can types with 8 lanes for AVX2 be used on a running CPU
+	@note
+	It is always false except x86/x86-64.
+*/
+bool IsAVX2Supported();
+
 } // namespace SIMD
 
 } // namespace Effekseer
 
 #endif // __EFFEKSEER_SIMD_UTILS_H__
+
+#ifndef __EFFEKSEER_SIMD_FLOAT8_GEN_H__
+#define __EFFEKSEER_SIMD_FLOAT8_GEN_H__
+
+
+#if !defined(EFK_SIMD_AVX2)
+
+#include <algorithm>
+#include <cstring>
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+struct Int8;
+
+/**
+	@brief	simd class with 8 lanes for generic
+*/
+struct alignas(32) Float8
+{
+	union {
+		float vf[8];
+		int32_t vi[8];
+		uint32_t vu[8];
+	};
+
+	Float8() = default;
+	Float8(const Float8& rhs) = default;
+	Float8(float x0, float x1, float x2, float x3, float x4, float x5, float x6, float x7)
+	{
+		vf[0] = x0;
+		vf[1] = x1;
+		vf[2] = x2;
+		vf[3] = x3;
+		vf[4] = x4;
+		vf[5] = x5;
+		vf[6] = x6;
+		vf[7] = x7;
+	}
+	Float8(float i)
+	{
+		for (size_t i_ = 0; i_ < 8; i_++)
+		{
+			vf[i_] = i;
+		}
+	}
+
+	Int8 Convert8i() const;
+	Int8 Cast8i() const;
+
+	Float8& operator+=(const Float8& rhs);
+	Float8& operator-=(const Float8& rhs);
+	Float8& operator*=(const Float8& rhs);
+	Float8& operator*=(float rhs);
+	Float8& operator/=(const Float8& rhs);
+	Float8& operator/=(float rhs);
+
+	static Float8 Load8(const void* mem);
+	static void Store8(void* mem, const Float8& i);
+
+	static Float8 SetZero();
+	static Float8 Sqrt(const Float8& in);
+	static Float8 Rsqrt(const Float8& in);
+	static Float8 Abs(const Float8& in);
+	static Float8 Min(const Float8& lhs, const Float8& rhs);
+	static Float8 Max(const Float8& lhs, const Float8& rhs);
+	static Float8 Floor(const Float8& in);
+	static Float8 Ceil(const Float8& in);
+	static Float8 MulAdd(const Float8& a, const Float8& b, const Float8& c);
+	static Float8 MulSub(const Float8& a, const Float8& b, const Float8& c);
+
+	static uint32_t MoveMask(const Float8& in);
+	static Float8 Select(const Float8& mask, const Float8& sel1, const Float8& sel2);
+	static Float8 Equal(const Float8& lhs, const Float8& rhs);
+	static Float8 NotEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 LessThan(const Float8& lhs, const Float8& rhs);
+	static Float8 LessEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterThan(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 NearEqual(const Float8& lhs, const Float8& rhs, float epsilon = DefaultEpsilon);
+};
+
+inline Float8 operator+(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] + rhs.vf[i];
+	}
+	return ret;
+}
+
+inline Float8 operator-(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] - rhs.vf[i];
+	}
+	return ret;
+}
+
+inline Float8 operator*(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] * rhs.vf[i];
+	}
+	return ret;
+}
+
+inline Float8 operator*(const Float8& lhs, float rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] * rhs;
+	}
+	return ret;
+}
+
+inline Float8 operator/(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] / rhs.vf[i];
+	}
+	return ret;
+}
+
+inline Float8 operator/(const Float8& lhs, float rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] / rhs;
+	}
+	return ret;
+}
+
+inline Float8 operator&(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] & rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Float8 operator|(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] | rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Float8 operator^(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] ^ rhs.vu[i];
+	}
+	return ret;
+}
+
+inline bool operator==(const Float8& lhs, const Float8& rhs)
+{
+	bool ret = true;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret &= lhs.vf[i] == rhs.vf[i];
+	}
+	return ret;
+}
+
+inline bool operator!=(const Float8& lhs, const Float8& rhs)
+{
+	return !(lhs == rhs);
+}
+
+inline Float8& Float8::operator+=(const Float8& rhs) { return *this = *this + rhs; }
+inline Float8& Float8::operator-=(const Float8& rhs) { return *this = *this - rhs; }
+inline Float8& Float8::operator*=(const Float8& rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator*=(float rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator/=(const Float8& rhs) { return *this = *this / rhs; }
+inline Float8& Float8::operator/=(float rhs) { return *this = *this / rhs; }
+
+inline Float8 Float8::Load8(const void* mem)
+{
+	Float8 ret;
+	memcpy(ret.vf, mem, sizeof(float) * 8);
+	return ret;
+}
+
+inline void Float8::Store8(void* mem, const Float8& i)
+{
+	memcpy(mem, i.vf, sizeof(float) * 8);
+}
+
+inline Float8 Float8::SetZero()
+{
+	return Float8(0.0f);
+}
+
+inline Float8 Float8::Sqrt(const Float8& in)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::sqrt(in.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Rsqrt(const Float8& in)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = 1.0f / std::sqrt(in.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Abs(const Float8& in)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::abs(in.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Min(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::fmin(lhs.vf[i], rhs.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Max(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::fmax(lhs.vf[i], rhs.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Floor(const Float8& in)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::floor(in.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Ceil(const Float8& in)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::ceil(in.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::MulAdd(const Float8& a, const Float8& b, const Float8& c)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = a.vf[i] + b.vf[i] * c.vf[i];
+	}
+	return ret;
+}
+
+inline Float8 Float8::MulSub(const Float8& a, const Float8& b, const Float8& c)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = a.vf[i] - b.vf[i] * c.vf[i];
+	}
+	return ret;
+}
+
+inline uint32_t Float8::MoveMask(const Float8& in)
+{
+	uint32_t ret = 0;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret |= (in.vu[i] >> 31) << i;
+	}
+	return ret;
+}
+
+inline Float8 Float8::Select(const Float8& mask, const Float8& sel1, const Float8& sel2)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (mask.vu[i] & sel1.vu[i]) | (~mask.vu[i] & sel2.vu[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Equal(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] == rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::NotEqual(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] != rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::LessThan(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] < rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::LessEqual(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] <= rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::GreaterThan(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] > rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::GreaterEqual(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] >= rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::NearEqual(const Float8& lhs, const Float8& rhs, float epsilon)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (std::abs(lhs.vf[i] - rhs.vf[i]) <= epsilon) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_FLOAT8_GEN_H__
+
+#ifndef __EFFEKSEER_SIMD_FLOAT8_AVX_H__
+#define __EFFEKSEER_SIMD_FLOAT8_AVX_H__
+
+
+#if defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+struct Int8;
+
+/**
+	@brief	simd class with 8 lanes for avx
+*/
+struct alignas(32) Float8
+{
+	__m256 s;
+
+	Float8() = default;
+	Float8(const Float8& rhs) = default;
+	Float8(__m256 rhs) { s = rhs; }
+	Float8(__m256i rhs) { s = _mm256_castsi256_ps(rhs); }
+	Float8(float x0, float x1, float x2, float x3, float x4, float x5, float x6, float x7) { s = _mm256_setr_ps(x0, x1, x2, x3, x4, x5, x6, x7); }
+	Float8(float i) { s = _mm256_set1_ps(i); }
+
+	Int8 Convert8i() const;
+	Int8 Cast8i() const;
+
+	Float8& operator+=(const Float8& rhs);
+	Float8& operator-=(const Float8& rhs);
+	Float8& operator*=(const Float8& rhs);
+	Float8& operator*=(float rhs);
+	Float8& operator/=(const Float8& rhs);
+	Float8& operator/=(float rhs);
+
+	static Float8 Load8(const void* mem);
+	static void Store8(void* mem, const Float8& i);
+
+	static Float8 SetZero();
+	static Float8 Sqrt(const Float8& in);
+	static Float8 Rsqrt(const Float8& in);
+	static Float8 Abs(const Float8& in);
+	static Float8 Min(const Float8& lhs, const Float8& rhs);
+	static Float8 Max(const Float8& lhs, const Float8& rhs);
+	static Float8 Floor(const Float8& in);
+	static Float8 Ceil(const Float8& in);
+	static Float8 MulAdd(const Float8& a, const Float8& b, const Float8& c);
+	static Float8 MulSub(const Float8& a, const Float8& b, const Float8& c);
+
+	static uint32_t MoveMask(const Float8& in);
+	static Float8 Select(const Float8& mask, const Float8& sel1, const Float8& sel2);
+	static Float8 Equal(const Float8& lhs, const Float8& rhs);
+	static Float8 NotEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 LessThan(const Float8& lhs, const Float8& rhs);
+	static Float8 LessEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterThan(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 NearEqual(const Float8& lhs, const Float8& rhs, float epsilon = DefaultEpsilon);
+};
+
+inline Float8 operator+(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_add_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator-(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_sub_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator*(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_mul_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator*(const Float8& lhs, float rhs)
+{
+	return Float8{_mm256_mul_ps(lhs.s, _mm256_set1_ps(rhs))};
+}
+
+inline Float8 operator/(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_div_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator/(const Float8& lhs, float rhs)
+{
+	return Float8{_mm256_div_ps(lhs.s, _mm256_set1_ps(rhs))};
+}
+
+inline Float8 operator&(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_and_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator|(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_or_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator^(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_xor_ps(lhs.s, rhs.s)};
+}
+
+inline bool operator==(const Float8& lhs, const Float8& rhs)
+{
+	return Float8::MoveMask(Float8::Equal(lhs, rhs)) == 0xff;
+}
+
+inline bool operator!=(const Float8& lhs, const Float8& rhs)
+{
+	return Float8::MoveMask(Float8::Equal(lhs, rhs)) != 0xff;
+}
+
+inline Float8& Float8::operator+=(const Float8& rhs) { return *this = *this + rhs; }
+inline Float8& Float8::operator-=(const Float8& rhs) { return *this = *this - rhs; }
+inline Float8& Float8::operator*=(const Float8& rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator*=(float rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator/=(const Float8& rhs) { return *this = *this / rhs; }
+inline Float8& Float8::operator/=(float rhs) { return *this = *this / rhs; }
+
+inline Float8 Float8::Load8(const void* mem)
+{
+	return _mm256_loadu_ps((const float*)mem);
+}
+
+inline void Float8::Store8(void* mem, const Float8& i)
+{
+	_mm256_storeu_ps((float*)mem, i.s);
+}
+
+inline Float8 Float8::SetZero()
+{
+	return _mm256_setzero_ps();
+}
+
+inline Float8 Float8::Sqrt(const Float8& in)
+{
+	return Float8{_mm256_sqrt_ps(in.s)};
+}
+
+inline Float8 Float8::Rsqrt(const Float8& in)
+{
+	return Float8{_mm256_rsqrt_ps(in.s)};
+}
+
+inline Float8 Float8::Abs(const Float8& in)
+{
+	return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), in.s);
+}
+
+inline Float8 Float8::Min(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_min_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 Float8::Max(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_max_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 Float8::Floor(const Float8& in)
+{
+	return _mm256_floor_ps(in.s);
+}
+
+inline Float8 Float8::Ceil(const Float8& in)
+{
+	return _mm256_ceil_ps(in.s);
+}
+
+inline Float8 Float8::MulAdd(const Float8& a, const Float8& b, const Float8& c)
+{
+#if defined(EFK_SIMD_FMA)
+	return Float8{_mm256_fmadd_ps(b.s, c.s, a.s)};
+#else
+	return Float8{_mm256_add_ps(a.s, _mm256_mul_ps(b.s, c.s))};
+#endif
+}
+
+inline Float8 Float8::MulSub(const Float8& a, const Float8& b, const Float8& c)
+{
+#if defined(EFK_SIMD_FMA)
+	return Float8{_mm256_fnmadd_ps(b.s, c.s, a.s)};
+#else
+	return Float8{_mm256_sub_ps(a.s, _mm256_mul_ps(b.s, c.s))};
+#endif
+}
+
+inline uint32_t Float8::MoveMask(const Float8& in)
+{
+	return (uint32_t)_mm256_movemask_ps(in.s);
+}
+
+inline Float8 Float8::Select(const Float8& mask, const Float8& sel1, const Float8& sel2)
+{
+	return _mm256_or_ps(_mm256_and_ps(mask.s, sel1.s), _mm256_andnot_ps(mask.s, sel2.s));
+}
+
+inline Float8 Float8::Equal(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_EQ_OQ)};
+}
+
+inline Float8 Float8::NotEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_NEQ_UQ)};
+}
+
+inline Float8 Float8::LessThan(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_LT_OQ)};
+}
+
+inline Float8 Float8::LessEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_LE_OQ)};
+}
+
+inline Float8 Float8::GreaterThan(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_GT_OQ)};
+}
+
+inline Float8 Float8::GreaterEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_GE_OQ)};
+}
+
+inline Float8 Float8::NearEqual(const Float8& lhs, const Float8& rhs, float epsilon)
+{
+	return LessEqual(Abs(lhs - rhs), Float8(epsilon));
+}
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_FLOAT8_AVX_H__
+
+#ifndef __EFFEKSEER_SIMD_INT8_GEN_H__
+#define __EFFEKSEER_SIMD_INT8_GEN_H__
+
+
+#if !defined(EFK_SIMD_AVX2)
+
+#include <cstdlib>
+#include <cstring>
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+struct Float8;
+
+/**
+	@brief	simd class with 8 lanes for generic
+*/
+struct alignas(32) Int8
+{
+	union {
+		float vf[8];
+		int32_t vi[8];
+		uint32_t vu[8];
+	};
+
+	Int8() = default;
+	Int8(const Int8& rhs) = default;
+	Int8(int32_t x0, int32_t x1, int32_t x2, int32_t x3, int32_t x4, int32_t x5, int32_t x6, int32_t x7)
+	{
+		vi[0] = x0;
+		vi[1] = x1;
+		vi[2] = x2;
+		vi[3] = x3;
+		vi[4] = x4;
+		vi[5] = x5;
+		vi[6] = x6;
+		vi[7] = x7;
+	}
+	Int8(int32_t i)
+	{
+		for (size_t i_ = 0; i_ < 8; i_++)
+		{
+			vi[i_] = i;
+		}
+	}
+
+	Float8 Convert8f() const;
+	Float8 Cast8f() const;
+
+	Int8& operator+=(const Int8& rhs);
+	Int8& operator-=(const Int8& rhs);
+	Int8& operator*=(const Int8& rhs);
+	Int8& operator*=(int32_t rhs);
+
+	static Int8 Load8(const void* mem);
+	static void Store8(void* mem, const Int8& i);
+
+	static Int8 SetZero();
+	static Int8 Abs(const Int8& in);
+	static Int8 Min(const Int8& lhs, const Int8& rhs);
+	static Int8 Max(const Int8& lhs, const Int8& rhs);
+	static Int8 MulAdd(const Int8& a, const Int8& b, const Int8& c);
+	static Int8 MulSub(const Int8& a, const Int8& b, const Int8& c);
+
+	template <int COUNT>
+	static Int8 ShiftL(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftR(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftRA(const Int8& in);
+
+	static uint32_t MoveMask(const Int8& in);
+	static Int8 Select(const Int8& mask, const Int8& sel1, const Int8& sel2);
+	static Int8 Equal(const Int8& lhs, const Int8& rhs);
+	static Int8 NotEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 LessThan(const Int8& lhs, const Int8& rhs);
+	static Int8 LessEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterThan(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterEqual(const Int8& lhs, const Int8& rhs);
+};
+
+inline Int8 operator+(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] + rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Int8 operator-(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] - rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Int8 operator*(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] * rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Int8 operator*(const Int8& lhs, int32_t rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] * (uint32_t)rhs;
+	}
+	return ret;
+}
+
+inline Int8 operator&(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] & rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Int8 operator|(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] | rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Int8 operator^(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] ^ rhs.vu[i];
+	}
+	return ret;
+}
+
+inline bool operator==(const Int8& lhs, const Int8& rhs)
+{
+	bool ret = true;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret &= lhs.vi[i] == rhs.vi[i];
+	}
+	return ret;
+}
+
+inline bool operator!=(const Int8& lhs, const Int8& rhs)
+{
+	return !(lhs == rhs);
+}
+
+inline Int8& Int8::operator+=(const Int8& rhs) { return *this = *this + rhs; }
+inline Int8& Int8::operator-=(const Int8& rhs) { return *this = *this - rhs; }
+inline Int8& Int8::operator*=(const Int8& rhs) { return *this = *this * rhs; }
+inline Int8& Int8::operator*=(int32_t rhs) { return *this = *this * rhs; }
+
+inline Int8 Int8::Load8(const void* mem)
+{
+	Int8 ret;
+	memcpy(ret.vi, mem, sizeof(int32_t) * 8);
+	return ret;
+}
+
+inline void Int8::Store8(void* mem, const Int8& i)
+{
+	memcpy(mem, i.vi, sizeof(int32_t) * 8);
+}
+
+inline Int8 Int8::SetZero()
+{
+	return Int8(0);
+}
+
+inline Int8 Int8::Abs(const Int8& in)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vi[i] = std::abs(in.vi[i]);
+	}
+	return ret;
+}
+
+inline Int8 Int8::Min(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vi[i] = (lhs.vi[i] < rhs.vi[i]) ? lhs.vi[i] : rhs.vi[i];
+	}
+	return ret;
+}
+
+inline Int8 Int8::Max(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vi[i] = (lhs.vi[i] > rhs.vi[i]) ? lhs.vi[i] : rhs.vi[i];
+	}
+	return ret;
+}
+
+inline Int8 Int8::MulAdd(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a + b * c;
+}
+
+inline Int8 Int8::MulSub(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a - b * c;
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftL(const Int8& lhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] << COUNT;
+	}
+	return ret;
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftR(const Int8& lhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] >> COUNT;
+	}
+	return ret;
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftRA(const Int8& lhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vi[i] = lhs.vi[i] >> COUNT;
+	}
+	return ret;
+}
+
+inline uint32_t Int8::MoveMask(const Int8& in)
+{
+	uint32_t ret = 0;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret |= (in.vu[i] >> 31) << i;
+	}
+	return ret;
+}
+
+inline Int8 Int8::Select(const Int8& mask, const Int8& sel1, const Int8& sel2)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (mask.vu[i] & sel1.vu[i]) | (~mask.vu[i] & sel2.vu[i]);
+	}
+	return ret;
+}
+
+inline Int8 Int8::Equal(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] == rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Int8 Int8::NotEqual(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] != rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Int8 Int8::LessThan(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] < rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Int8 Int8::LessEqual(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] <= rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Int8 Int8::GreaterThan(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] > rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Int8 Int8::GreaterEqual(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] >= rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_INT8_GEN_H__
+
+#ifndef __EFFEKSEER_SIMD_INT8_AVX_H__
+#define __EFFEKSEER_SIMD_INT8_AVX_H__
+
+
+#if defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+struct Float8;
+
+/**
+	@brief	simd class with 8 lanes for avx
+*/
+struct alignas(32) Int8
+{
+	__m256i s;
+
+	Int8() = default;
+	Int8(const Int8& rhs) = default;
+	Int8(__m256i rhs) { s = rhs; }
+	Int8(__m256 rhs) { s = _mm256_castps_si256(rhs); }
+	Int8(int32_t x0, int32_t x1, int32_t x2, int32_t x3, int32_t x4, int32_t x5, int32_t x6, int32_t x7) { s = _mm256_setr_epi32(x0, x1, x2, x3, x4, x5, x6, x7); }
+	Int8(int32_t i) { s = _mm256_set1_epi32(i); }
+
+	Float8 Convert8f() const;
+	Float8 Cast8f() const;
+
+	Int8& operator+=(const Int8& rhs);
+	Int8& operator-=(const Int8& rhs);
+	Int8& operator*=(const Int8& rhs);
+	Int8& operator*=(int32_t rhs);
+
+	static Int8 Load8(const void* mem);
+	static void Store8(void* mem, const Int8& i);
+
+	static Int8 SetZero();
+	static Int8 Abs(const Int8& in);
+	static Int8 Min(const Int8& lhs, const Int8& rhs);
+	static Int8 Max(const Int8& lhs, const Int8& rhs);
+	static Int8 MulAdd(const Int8& a, const Int8& b, const Int8& c);
+	static Int8 MulSub(const Int8& a, const Int8& b, const Int8& c);
+
+	template <int COUNT>
+	static Int8 ShiftL(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftR(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftRA(const Int8& in);
+
+	static uint32_t MoveMask(const Int8& in);
+	static Int8 Select(const Int8& mask, const Int8& sel1, const Int8& sel2);
+	static Int8 Equal(const Int8& lhs, const Int8& rhs);
+	static Int8 NotEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 LessThan(const Int8& lhs, const Int8& rhs);
+	static Int8 LessEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterThan(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterEqual(const Int8& lhs, const Int8& rhs);
+};
+
+inline Int8 operator+(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_add_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 operator-(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_sub_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 operator*(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_mullo_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 operator*(const Int8& lhs, int32_t rhs)
+{
+	return Int8{_mm256_mullo_epi32(lhs.s, _mm256_set1_epi32(rhs))};
+}
+
+inline Int8 operator&(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_and_si256(lhs.s, rhs.s)};
+}
+
+inline Int8 operator|(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_or_si256(lhs.s, rhs.s)};
+}
+
+inline Int8 operator^(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_xor_si256(lhs.s, rhs.s)};
+}
+
+inline bool operator==(const Int8& lhs, const Int8& rhs)
+{
+	return Int8::MoveMask(Int8::Equal(lhs, rhs)) == 0xff;
+}
+
+inline bool operator!=(const Int8& lhs, const Int8& rhs)
+{
+	return Int8::MoveMask(Int8::Equal(lhs, rhs)) != 0xff;
+}
+
+inline Int8& Int8::operator+=(const Int8& rhs) { return *this = *this + rhs; }
+inline Int8& Int8::operator-=(const Int8& rhs) { return *this = *this - rhs; }
+inline Int8& Int8::operator*=(const Int8& rhs) { return *this = *this * rhs; }
+inline Int8& Int8::operator*=(int32_t rhs) { return *this = *this * rhs; }
+
+inline Int8 Int8::Load8(const void* mem)
+{
+	return _mm256_loadu_si256((const __m256i*)mem);
+}
+
+inline void Int8::Store8(void* mem, const Int8& i)
+{
+	_mm256_storeu_si256((__m256i*)mem, i.s);
+}
+
+inline Int8 Int8::SetZero()
+{
+	return _mm256_setzero_si256();
+}
+
+inline Int8 Int8::Abs(const Int8& in)
+{
+	return _mm256_abs_epi32(in.s);
+}
+
+inline Int8 Int8::Min(const Int8& lhs, const Int8& rhs)
+{
+	return _mm256_min_epi32(lhs.s, rhs.s);
+}
+
+inline Int8 Int8::Max(const Int8& lhs, const Int8& rhs)
+{
+	return _mm256_max_epi32(lhs.s, rhs.s);
+}
+
+inline Int8 Int8::MulAdd(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a + b * c;
+}
+
+inline Int8 Int8::MulSub(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a - b * c;
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftL(const Int8& lhs)
+{
+	return _mm256_slli_epi32(lhs.s, COUNT);
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftR(const Int8& lhs)
+{
+	return _mm256_srli_epi32(lhs.s, COUNT);
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftRA(const Int8& lhs)
+{
+	return _mm256_srai_epi32(lhs.s, COUNT);
+}
+
+inline uint32_t Int8::MoveMask(const Int8& in)
+{
+	return (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(in.s));
+}
+
+inline Int8 Int8::Select(const Int8& mask, const Int8& sel1, const Int8& sel2)
+{
+	return _mm256_or_si256(_mm256_and_si256(mask.s, sel1.s), _mm256_andnot_si256(mask.s, sel2.s));
+}
+
+inline Int8 Int8::Equal(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_cmpeq_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 Int8::NotEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_andnot_si256(_mm256_cmpeq_epi32(lhs.s, rhs.s), _mm256_set1_epi32(-1))};
+}
+
+inline Int8 Int8::LessThan(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_cmpgt_epi32(rhs.s, lhs.s)};
+}
+
+inline Int8 Int8::LessEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_andnot_si256(_mm256_cmpgt_epi32(lhs.s, rhs.s), _mm256_set1_epi32(-1))};
+}
+
+inline Int8 Int8::GreaterThan(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_cmpgt_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 Int8::GreaterEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_andnot_si256(_mm256_cmpgt_epi32(rhs.s, lhs.s), _mm256_set1_epi32(-1))};
+}
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_INT8_AVX_H__
+
+#ifndef __EFFEKSEER_SIMD_BRIDGE8_GEN_H__
+#define __EFFEKSEER_SIMD_BRIDGE8_GEN_H__
+
+
+#if !defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+inline Int8 Float8::Convert8i() const
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vi[i] = (int32_t)vf[i];
+	}
+	return ret;
+}
+
+inline Int8 Float8::Cast8i() const
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = vu[i];
+	}
+	return ret;
+}
+
+inline Float8 Int8::Convert8f() const
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = (float)vi[i];
+	}
+	return ret;
+}
+
+inline Float8 Int8::Cast8f() const
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = vu[i];
+	}
+	return ret;
+}
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_BRIDGE8_GEN_H__
+
+#ifndef __EFFEKSEER_SIMD_BRIDGE8_AVX_H__
+#define __EFFEKSEER_SIMD_BRIDGE8_AVX_H__
+
+
+#if defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+inline Int8 Float8::Convert8i() const { return _mm256_cvtps_epi32(s); }
+
+inline Int8 Float8::Cast8i() const { return _mm256_castps_si256(s); }
+
+inline Float8 Int8::Convert8f() const { return _mm256_cvtepi32_ps(s); }
+
+inline Float8 Int8::Cast8f() const { return _mm256_castsi256_ps(s); }
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_BRIDGE8_AVX_H__
+
+#ifndef __EFFEKSEER_SIMD_MAT43F8_H__
+#define __EFFEKSEER_SIMD_MAT43F8_H__
+
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+/**
+	@brief	8 lanes version of ::Effekseer::NormalizeAngle
+*/
+inline Float8 NormalizeAngle(const Float8& angle)
+{
+	const Float8 signMask = Float8(-0.0f);
+	const Float8 ofs = (angle & signMask) | Float8(0.5f);
+	const Float8 x = angle * 0.159154943f + ofs;
+
+	// truncate toward zero like a cast to int (adding zero turns -0 into +0 as int does)
+	const Float8 truncated = Float8::Select(Float8::GreaterEqual(x, Float8::SetZero()), Float8::Floor(x), Float8::Ceil(x)) + Float8::SetZero();
+	return angle - truncated * 6.283185307f;
+}
+
+/**
+	@brief	8 lanes version of ::Effekseer::SinCos
+	@note
+	Operations are the same order as the scalar version so that results are the same.
+*/
+inline void SinCos(const Float8& in, Float8& s, Float8& c)
+{
+	const Float8 x = NormalizeAngle(in);
+	const Float8 x2 = x * x;
+	const Float8 x4 = x * x * x * x;
+	const Float8 x6 = x * x * x * x * x * x;
+	const Float8 x8 = x * x * x * x * x * x * x * x;
+	const Float8 x10 = x * x * x * x * x * x * x * x * x * x;
+	s = x * (Float8(1.0f) - x2 / 6.0f + x4 / 120.0f - x6 / 5040.0f + x8 / 362880.0f - x10 / 39916800.0f);
+	c = Float8(1.0f) - x2 / 2.0f + x4 / 24.0f - x6 / 720.0f + x8 / 40320.0f - x10 / 3628800.0f;
+}
+
+struct Mat43f8;
+
+/**
+	@brief	8 vectors stored as structure of arrays
+*/
+struct Vec3f8
+{
+	Float8 X;
+	Float8 Y;
+	Float8 Z;
+
+	Vec3f8() = default;
+	Vec3f8(const Vec3f8& rhs) = default;
+	Vec3f8(const Float8& x, const Float8& y, const Float8& z)
+		: X(x)
+		, Y(y)
+		, Z(z)
+	{
+	}
+
+	static Vec3f8 Transform(const Vec3f8& lhs, const Mat43f8& rhs);
+};
+
+/**
+	@brief	8 matrices stored as structure of arrays
+	@note
+	Lanes of X[i], Y[i] and Z[i] are the same as X, Y and Z of Mat43f so that results are the same as Mat43f.
+*/
+struct Mat43f8
+{
+	Float8 X[4];
+	Float8 Y[4];
+	Float8 Z[4];
+
+	//! load 8 matrices which are laid out like Matrix43
+	static Mat43f8 LoadMatrix43(const void* mem);
+
+	//! store 8 matrices which are laid out like Matrix43
+	static void StoreMatrix43(void* mem, const Mat43f8& m);
+
+	static Mat43f8 Identity();
+
+	static Mat43f8 SRT(const Vec3f8& s, const Mat43f8& r, const Vec3f8& t);
+
+	static Mat43f8 RotationZXY(const Float8& rz, const Float8& rx, const Float8& ry);
+};
+
+inline Mat43f8 operator*(const Mat43f8& lhs, const Mat43f8& rhs)
+{
+	const Float8 zero = Float8::SetZero();
+
+	Mat43f8 res;
+	for (int i = 0; i < 4; i++)
+	{
+		const Float8 x = (i == 3) ? rhs.X[3] : zero;
+		const Float8 y = (i == 3) ? rhs.Y[3] : zero;
+		const Float8 z = (i == 3) ? rhs.Z[3] : zero;
+		res.X[i] = x + lhs.X[i] * rhs.X[0] + lhs.Y[i] * rhs.X[1] + lhs.Z[i] * rhs.X[2];
+		res.Y[i] = y + lhs.X[i] * rhs.Y[0] + lhs.Y[i] * rhs.Y[1] + lhs.Z[i] * rhs.Y[2];
+		res.Z[i] = z + lhs.X[i] * rhs.Z[0] + lhs.Y[i] * rhs.Z[1] + lhs.Z[i] * rhs.Z[2];
+	}
+	return res;
+}
+
+inline Vec3f8 Vec3f8::Transform(const Vec3f8& lhs, const Mat43f8& rhs)
+{
+	Vec3f8 res;
+	res.X = rhs.X[3] + rhs.X[0] * lhs.X + rhs.X[1] * lhs.Y + rhs.X[2] * lhs.Z;
+	res.Y = rhs.Y[3] + rhs.Y[0] * lhs.X + rhs.Y[1] * lhs.Y + rhs.Y[2] * lhs.Z;
+	res.Z = rhs.Z[3] + rhs.Z[0] * lhs.X + rhs.Z[1] * lhs.Y + rhs.Z[2] * lhs.Z;
+	return res;
+}
+
+inline Mat43f8 Mat43f8::LoadMatrix43(const void* mem)
+{
+	const float* src = static_cast<const float*>(mem);
+	alignas(32) float transposed[12][8];
+
+	for (int i = 0; i < 8; i++)
+	{
+		for (int e = 0; e < 12; e++)
+		{
+			transposed[e][i] = src[i * 12 + e];
+		}
+	}
+
+	Mat43f8 ret;
+	for (int r = 0; r < 4; r++)
+	{
+		ret.X[r] = Float8::Load8(transposed[r * 3 + 0]);
+		ret.Y[r] = Float8::Load8(transposed[r * 3 + 1]);
+		ret.Z[r] = Float8::Load8(transposed[r * 3 + 2]);
+	}
+	return ret;
+}
+
+inline void Mat43f8::StoreMatrix43(void* mem, const Mat43f8& m)
+{
+	float* dst = static_cast<float*>(mem);
+	alignas(32) float transposed[12][8];
+
+	for (int r = 0; r < 4; r++)
+	{
+		Float8::Store8(transposed[r * 3 + 0], m.X[r]);
+		Float8::Store8(transposed[r * 3 + 1], m.Y[r]);
+		Float8::Store8(transposed[r * 3 + 2], m.Z[r]);
+	}
+
+	for (int i = 0; i < 8; i++)
+	{
+		for (int e = 0; e < 12; e++)
+		{
+			dst[i * 12 + e] = transposed[e][i];
+		}
+	}
+}
+
+inline Mat43f8 Mat43f8::Identity()
+{
+	const Float8 zero = Float8::SetZero();
+	const Float8 one = Float8(1.0f);
+
+	Mat43f8 ret;
+	ret.X[0] = one;
+	ret.X[1] = zero;
+	ret.X[2] = zero;
+	ret.X[3] = zero;
+	ret.Y[0] = zero;
+	ret.Y[1] = one;
+	ret.Y[2] = zero;
+	ret.Y[3] = zero;
+	ret.Z[0] = zero;
+	ret.Z[1] = zero;
+	ret.Z[2] = one;
+	ret.Z[3] = zero;
+	return ret;
+}
+
+inline Mat43f8 Mat43f8::SRT(const Vec3f8& s, const Mat43f8& r, const Vec3f8& t)
+{
+	Mat43f8 ret;
+	ret.X[0] = r.X[0] * s.X;
+	ret.X[1] = r.X[1] * s.Y;
+	ret.X[2] = r.X[2] * s.Z;
+	ret.X[3] = t.X;
+	ret.Y[0] = r.Y[0] * s.X;
+	ret.Y[1] = r.Y[1] * s.Y;
+	ret.Y[2] = r.Y[2] * s.Z;
+	ret.Y[3] = t.Y;
+	ret.Z[0] = r.Z[0] * s.X;
+	ret.Z[1] = r.Z[1] * s.Y;
+	ret.Z[2] = r.Z[2] * s.Z;
+	ret.Z[3] = t.Z;
+	return ret;
+}
+
+inline Mat43f8 Mat43f8::RotationZXY(const Float8& rz, const Float8& rx, const Float8& ry)
+{
+	const Float8 zero = Float8::SetZero();
+	const Float8 one = Float8(1.0f);
+	const Float8 signMask = Float8(-0.0f);
+
+	// Mat43f::RotationZXY does not calculate sin and cos of 0
+	auto sinCos = [&](const Float8& angle, Float8& s, Float8& c) {
+		SinCos(angle, s, c);
+		const Float8 isZero = Float8::Equal(angle, zero);
+		s = Float8::Select(isZero, zero, s);
+		c = Float8::Select(isZero, one, c);
+	};
+
+	Float8 sx, cx, sy, cy, sz, cz;
+	sinCos(rx, sx, cx);
+	sinCos(ry, sy, cy);
+	sinCos(rz, sz, cz);
+
+	const Float8 negSy = sy ^ signMask;
+	const Float8 negSz = sz ^ signMask;
+
+	// X, Y and Z are {m00, m10, m20}, {m01, m11, m21} and {m02, m12, m22} of Mat43f::RotationZXY
+	Mat43f8 ret;
+	ret.X[0] = cz * cy + sz * sx * sy;
+	ret.Y[0] = sz * cx;
+	ret.Z[0] = cz * negSy + sz * sx * cy;
+
+	ret.X[1] = negSz * cy + cz * sx * sy;
+	ret.Y[1] = cz * cx;
+	ret.Z[1] = negSz * negSy + cz * sx * cy;
+
+	ret.X[2] = cx * sy;
+	ret.Y[2] = sx ^ signMask;
+	ret.Z[2] = cx * cy;
+
+	ret.X[3] = zero;
+	ret.Y[3] = zero;
+	ret.Z[3] = zero;
+	return ret;
+}
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif // __EFFEKSEER_SIMD_MAT43F8_H__
@@ -67,6 +67,7 @@ class Setting;
 class Manager;
 class Effect;
 class EffectNode;
+class EffectLoadingTask;
 
 class SpriteRenderer;
 class RibbonRenderer;
@@ -807,6 +808,7 @@ RefPtr<T> MakeRefPtr(Arg&&... args)
 using SettingRef = RefPtr<Setting>;
 using ManagerRef = RefPtr<Manager>;
 using EffectRef = RefPtr<Effect>;
+using EffectLoadingTaskRef = RefPtr<EffectLoadingTask>;
 using TextureRef = RefPtr<Texture>;
 using SoundDataRef = RefPtr<SoundData>;
 using ModelRef = RefPtr<Model>;
@@ -2185,6 +2187,24 @@ public:
 	FileWriter* OpenWrite(const char16_t* path);
 };
 
+/**
+	@brief
+	\~English	A read-only memory mapping of a file
+	\~Japanese	ファイルの読み込み専用のメモリマッピング
+	@note
+	\~English	Pages are read when they are accessed, so that a file is not copied into a heap.
+	A mapping fails on platforms which don't support it and a caller must read the file instead.
+	\~Japanese	ページはアクセスされた時に読み込まれるため、ファイルはヒープにコピーされない。
+	対応していないプラットフォームではマッピングは失敗するため、呼び出し側はファイルを読み込む必要がある。
+*/
+class DefaultFileMapping
+{
+public:
+	static bool Map(const char16_t* path, void*& data, size_t& size);
+
+	static void Unmap(void* data, size_t size);
+};
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -3105,6 +3125,26 @@ public:
 	*/
 	virtual void OnLoadingResource(Effect* effect, const void* data, int32_t size, const char16_t* materialPath);
 
+	/**
+		@brief
+		\~English this method is called on a worker thread before OnLoadingResource when an effect is loaded with Effect::CreateAsync
+		\~Japanese	Effect::CreateAsyncでエフェクトを読み込む時に、OnLoadingResourceの前にワーカースレッドでこのメソッドが呼ばれる。
+		@note
+		\~English Resources which don't need a graphics device (models, curves and procedural models) are loaded and textures are decoded by default. OnLoadingResource doesn't load models and curves again and only creates decoded textures.
+		\~Japanese	デフォルトではグラフィックスデバイスが不要なリソース(モデル、カーブ、プロシージャルモデル)が読み込まれ、テクスチャがデコードされる。OnLoadingResourceはモデルとカーブを再度読み込まず、デコードされたテクスチャを生成するだけである。
+	*/
+	virtual void OnLoadingResourceAsync(Effect* effect, const void* data, int32_t size, const char16_t* materialPath);
+
+	/**
+		@brief
+		\~English this method is called instead of OnLoadingResource when a task of Effect::CreateAsync is released without EffectLoadingTask::Commit
+		\~Japanese	Effect::CreateAsyncのタスクがEffectLoadingTask::Commitされずに解放された時に、OnLoadingResourceの代わりにこのメソッドが呼ばれる。
+		@note
+		\~English Textures which are decoded with OnLoadingResourceAsync are discarded by default.
+		\~Japanese	デフォルトではOnLoadingResourceAsyncでデコードされたテクスチャが破棄される。
+	*/
+	virtual void OnDiscardingResourceAsync(Effect* effect, const char16_t* materialPath);
+
 	/**
 	@brief
 	\~English this method is called when unload resources
@@ -3123,6 +3163,43 @@ public:
 	\~Japanese	バイナリを読み込んだときに自動的にリソースを読み込むか取得する。
 	*/
 	virtual bool GetIsResourcesLoadedAutomatically() const;
+
+private:
+	//! load resources which don't need a graphics device if they are not loaded
+	void LoadResourcesWithoutGraphicsDevice(Effect* effect, const char16_t* materialPath);
+};
+
+/**
+	@brief
+	\~English	A task which loads an effect asynchronously
+	\~Japanese	エフェクトを非同期に読み込むタスク
+*/
+class EffectLoadingTask : public ReferenceObject
+{
+public:
+	EffectLoadingTask() = default;
+
+	virtual ~EffectLoadingTask() = default;
+
+	/**
+		@brief
+		\~English	Get whether loading on a worker thread has finished. If it is true, Commit doesn't wait for the worker thread.
+		\~Japanese	ワーカースレッドでの読み込みが終了したか取得する。trueの場合、Commitはワーカースレッドを待機しない。
+	*/
+	virtual bool IsReady() const = 0;
+
+	/**
+		@brief
+		\~English	Load resources which need a graphics device on the calling thread and get the loaded effect.
+		\~Japanese	グラフィックスデバイスが必要なリソースを呼び出したスレッドで読み込み、読み込まれたエフェクトを取得する。
+		@return
+		\~English	An effect. nullptr is returned if loading failed or Commit was already called.
+		\~Japanese	エフェクト。読み込みに失敗した場合、もしくは既にCommitが呼ばれている場合はnullptrを返す。
+		@note
+		\~English	It waits for the worker thread if loading has not finished yet.
+		\~Japanese	読み込みが終了していない場合、ワーカースレッドを待機する。
+	*/
+	virtual EffectRef Commit() = 0;
 };
 
 /**
@@ -3183,10 +3260,41 @@ public:
 	*/
 	static EffectRef Create(const SettingRef& setting, const char16_t* path, float magnification = 1.0f, const char16_t* materialPath = nullptr);
 
+	/**
+		@brief
+		\~English	Start to load an effect asynchronously.
+		\~Japanese	エフェクトの非同期読み込みを開始する。
+		@param	setting			[in]	\~English a setting \~Japanese 設定クラス
+		@param	path			[in]	\~English a path of an effect \~Japanese 読込元のパス
+		@param	magnification	[in]	\~English magnification when loading \~Japanese 読み込み時の拡大率
+		@param	materialPath	[in]	\~English a base path of resources \~Japanese 素材ロード時の基準パス
+		@return
+		\~English	A task. An effect is obtained with EffectLoadingTask::Commit.
+		\~Japanese	タスク。エフェクトはEffectLoadingTask::Commitで取得される。
+		@note
+		\~English	A file of an effect and resources which don't need a graphics device are loaded and textures are decoded on threads of Setting::GetLoadingThreadPool.
+		Decoded textures are created and other resources are loaded when EffectLoadingTask::Commit is called.
+		Tasks run in parallel, so loaders of models and curves and TextureLoader::Decode must be thread-safe.
+		\~Japanese	エフェクトのファイルとグラフィックスデバイスが不要なリソースはSetting::GetLoadingThreadPoolのスレッドで読み込まれ、テクスチャはデコードされる。
+		デコードされたテクスチャの生成とその他のリソースの読み込みはEffectLoadingTask::Commitが呼ばれた時に行われる。
+		タスクは並列に実行されるため、モデルとカーブの読込クラスとTextureLoader::Decodeはスレッドセーフである必要がある。
+	*/
+	static EffectLoadingTaskRef CreateAsync(const SettingRef& setting, const char16_t* path, float magnification = 1.0f, const char16_t* materialPath = nullptr);
+
 	/**
 	@brief	標準のエフェクト読込インスタンスを生成する。
+	@param	fileInterface	[in]	\~English	An interface to open files. A default one is used if it is null.
+	\~Japanese	ファイルを開くインターフェース。nullの場合は標準のものが使用される。
+	@param	isMemoryMapped	[in]	\~English	Whether files are mapped into memory instead of being read into a heap.
+	It is used only with a default file interface. A file is read if it cannot be mapped.
+	A mapping is kept while an effect loaded from it is alive, and aligned keys of curves are referenced in it.
+	Keys which are converted for the coordinate system or magnification are copied.
+	\~Japanese	ファイルをヒープに読み込む代わりに、メモリにマッピングするかどうか。
+	標準のファイルインターフェースの場合のみ使用される。マッピングできない場合はファイルが読み込まれる。
+	マッピングはそこから読み込まれたエフェクトが存在する間保持され、アラインされたカーブのキーはその中で参照される。
+	座標系や拡大率に合わせて変換されるキーはコピーされる。
 	*/
-	static ::Effekseer::EffectLoaderRef CreateEffectLoader(::Effekseer::FileInterface* fileInterface = nullptr);
+	static ::Effekseer::EffectLoaderRef CreateEffectLoader(::Effekseer::FileInterface* fileInterface = nullptr, bool isMemoryMapped = false);
 
 	/**
 	@brief
@@ -3757,6 +3865,16 @@ public:
 		*/
 		int32_t CameraCullingMask;
 
+		/**
+			@brief
+			\~English An index of a view specified with CalcCulling
+			\~Japanese CalcCullingで指定された視点の番号
+			@note
+			\~English Only effects in the view are drawn after CalcCulling. It is ignored when CalcCulling is not called.
+			\~Japanese CalcCullingの後、視点に含まれるエフェクトのみ描画される。CalcCullingが呼ばれていない場合は無視される。
+		*/
+		int32_t ViewIndex;
+
 		DrawParameter();
 	};
 
@@ -3791,6 +3909,29 @@ public:
 	*/
 	virtual ThreadNativeHandleType GetWorkerThreadHandle(uint32_t threadID) = 0;
 
+	/**
+		@brief
+		\~English Specify whether rendering parameters of effects are generated on worker threads when effects are drawn
+		\~Japanese エフェクトの描画時に描画用のパラメーターをワーカースレッドで生成するかどうかを指定する。
+		@note
+		\~English
+		Parameters are recorded on each worker thread and they are passed to renderers on the calling thread in the same order as usual.
+		It is valid only if two or more worker threads are launched. Only SpriteRenderer::WriteVertices is called from worker threads,
+		and vertices written by it are drawn with SpriteRenderer::RenderingVertices on the calling thread.
+		\~Japanese
+		パラメーターは各ワーカースレッドで記録され、呼び出したスレッドで通常と同じ順番でレンダラーに渡される。
+		2つ以上のワーカースレッドが起動している場合のみ有効である。ワーカースレッドからは SpriteRenderer::WriteVertices のみが呼ばれ、
+		書き込まれた頂点は呼び出したスレッドで SpriteRenderer::RenderingVertices により描画される。
+	*/
+	virtual void SetParallelDrawingEnabled(bool enabled) = 0;
+
+	/**
+		@brief
+		\~English Get whether rendering parameters of effects are generated on worker threads when effects are drawn
+		\~Japanese エフェクトの描画時に描画用のパラメーターをワーカースレッドで生成するかどうかを取得する。
+	*/
+	virtual bool GetParallelDrawingEnabled() const = 0;
+
 	/**
 		@brief
 		\~English get an allocator
@@ -4076,6 +4217,19 @@ public:
 	*/
 	virtual void SetMatrix(Handle handle, const Matrix43& mat) = 0;
 
+	/**
+		@brief
+		\~English Set transform matrices of many effects at once
+		\~Japanese 複数のエフェクトのインスタンスに変換行列を一度に設定する。
+		@param	handles		[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	matrices	[in]	\~English matrices for each handle \~Japanese ハンドルごとの変換行列
+		@param	count		[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetMatrices(const Handle* handles, const Matrix43* matrices, int32_t count) = 0;
+
 	/**
 		@brief	エフェクトのインスタンスの位置を取得する。
 		@param	handle	[in]	インスタンスのハンドル
@@ -4097,6 +4251,19 @@ public:
 	*/
 	virtual void SetLocation(Handle handle, const Vector3D& location) = 0;
 
+	/**
+		@brief
+		\~English Set locations of many effects at once
+		\~Japanese 複数のエフェクトのインスタンスに位置を一度に設定する。
+		@param	handles		[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	locations	[in]	\~English locations for each handle \~Japanese ハンドルごとの位置
+		@param	count		[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetLocations(const Handle* handles, const Vector3D* locations, int32_t count) = 0;
+
 	/**
 		@brief	エフェクトのインスタンスの位置に加算する。
 		@param	location	[in]	加算する値
@@ -4160,6 +4327,20 @@ public:
 	*/
 	virtual void SetDynamicInput(Handle handle, int32_t index, float value) = 0;
 
+	/**
+		@brief
+		\~English Specify a dynamic parameter of many effects at once
+		\~Japanese 複数のエフェクトの動的パラメーターを一度に設定する。
+		@param	handles	[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	index	[in]	\~English an index of the dynamic parameter \~Japanese 動的パラメーターのインデックス
+		@param	values	[in]	\~English values for each handle \~Japanese ハンドルごとの値
+		@param	count	[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetDynamicInputs(const Handle* handles, int32_t index, const float* values, int32_t count) = 0;
+
 	/**
 		@brief	エフェクトのベース行列を取得する。
 		@param	handle	[in]	インスタンスのハンドル
@@ -4176,6 +4357,19 @@ public:
 	*/
 	virtual void SetBaseMatrix(Handle handle, const Matrix43& mat) = 0;
 
+	/**
+		@brief
+		\~English Set base matrices of many effects at once
+		\~Japanese 複数のエフェクトのベース行列を一度に設定する。
+		@param	handles		[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	matrices	[in]	\~English matrices for each handle \~Japanese ハンドルごとのベース行列
+		@param	count		[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetBaseMatrices(const Handle* handles, const Matrix43* matrices, int32_t count) = 0;
+
 	/**
 		@brief	エフェクトのインスタンスに廃棄時のコールバックを設定する。
 		@param	handle	[in]	インスタンスのハンドル
@@ -4199,6 +4393,19 @@ public:
 	*/
 	virtual void SetShown(Handle handle, bool shown) = 0;
 
+	/**
+		@brief
+		\~English Specify whether many effects are drawn at once
+		\~Japanese 複数のエフェクトのインスタンスをDraw時に描画するか一度に設定する。
+		@param	handles	[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	shown	[in]	\~English whether each handle is drawn \~Japanese ハンドルごとの描画するか?
+		@param	count	[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetShownFlags(const Handle* handles, const bool* shown, int32_t count) = 0;
+
 	/**
 	@brief	\~English	Get status that a particle of effect specified is paused.
 	\~Japanese	指定したエフェクトのパーティクルが一時停止されているか取得する。
@@ -4276,6 +4483,19 @@ public:
 	*/
 	virtual void SetSpeed(Handle handle, float speed) = 0;
 
+	/**
+		@brief
+		\~English Set playing speeds of many effects at once
+		\~Japanese 複数のエフェクトのインスタンスの再生スピードを一度に設定する。
+		@param	handles	[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	speeds	[in]	\~English speeds for each handle \~Japanese ハンドルごとのスピード
+		@param	count	[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetSpeeds(const Handle* handles, const float* speeds, int32_t count) = 0;
+
 	/**
 		@brief
 		\~English	Specify a rate of scale in relation to manager's time  by a group.
@@ -4483,6 +4703,21 @@ public:
 	*/
 	virtual void CalcCulling(const Matrix44& cameraProjMat, bool isOpenGL) = 0;
 
+	/**
+		@brief
+		\~English	Cull effects for multiple views at once, and draw only culled effects in a view specified with DrawParameter::ViewIndex.
+		\~Japanese	複数の視点に対して一度にカリングを行い、DrawParameter::ViewIndexで指定された視点でカリングされたオブジェクトのみを描画するようにする。
+		@param	cameraProjMats	[in]	\~English camera projection matrices of views \~Japanese 視点ごとのカメラプロジェクション行列
+		@param	viewCount		[in]	\~English the number of views (1 to 32). It is ignored if it is less than 1. \~Japanese 視点の数(1以上32以下)。1未満の場合は無視される。
+		@param	isOpenGL		[in]	\~English whether is it drawn with OpenGL \~Japanese OpenGLによる描画か?
+		@note
+		\~English	It is faster than culling each view because the culling space is scanned once. It is useful for split screens and VR.
+		Only culling is shared. Vertices are still generated in each Draw call for each view.
+		\~Japanese	カリングの空間を一度だけ走査するため、視点ごとにカリングするより高速である。画面分割やVRに有用である。
+		共有されるのはカリングのみで、頂点は視点ごとのDrawで生成される。
+	*/
+	virtual void CalcCulling(const Matrix44* cameraProjMats, int32_t viewCount, bool isOpenGL) = 0;
+
 	/**
 		@brief	現在存在するエフェクトのハンドルからカリングの空間を配置しなおす。
 	*/
@@ -4505,6 +4740,8 @@ public:
 //----------------------------------------------------------------------------------
 // Include
 //----------------------------------------------------------------------------------
+#include <memory>
+#include <mutex>
 
 //----------------------------------------------------------------------------------
 //
@@ -4517,6 +4754,7 @@ namespace Effekseer
 
 class EffectFactory;
 class ResourceManager;
+class ThreadPool;
 
 /**
 	@brief	設定クラス
@@ -4534,6 +4772,10 @@ private:
 	std::vector<RefPtr<EffectFactory>> effectFactories_;
 	RefPtr<ResourceManager> resourceManager_;
 
+	//! threads which load effects with Effect::CreateAsync
+	std::unique_ptr<ThreadPool> loadingThreadPool_;
+	std::mutex loadingThreadPoolMutex_;
+
 protected:
 	Setting();
 
@@ -4692,6 +4934,22 @@ public:
 	*/
 	void SetProcedualMeshGenerator(ProcedualModelGeneratorRef generator);
 
+	/**
+		@brief
+		\~English	specify a directory where generated procedual models are saved and loaded
+		\~Japanese	生成されたプロシージャルモデルを保存、読み込みするディレクトリを設定する。
+		@param	directory
+		\~English	a directory. Models are not saved if it is null or empty
+		\~Japanese	ディレクトリ。nullか空の場合はモデルは保存されない。
+		@param	fileInterface
+		\~English	an interface to open files. A default one is used if it is null
+		\~Japanese	ファイルを開くインターフェース。nullの場合は標準のものが使用される。
+		@note
+		\~English	Files are named with hashes of parameters, so that models are not generated again when the same parameters are loaded in next time.
+		\~Japanese	ファイルはパラメーターのハッシュで命名されるため、次回以降に同じパラメーターが読み込まれた時にモデルは再生成されない。
+	*/
+	void SetProcedualModelCacheDirectory(const char16_t* directory, FileInterface* fileInterface = nullptr);
+
 	/**
 		@brief
 		\~English	Add effect factory
@@ -4726,6 +4984,16 @@ public:
 		\~Japanese Resource Managerを取得する。
 	*/
 	const RefPtr<ResourceManager>& GetResourceManager() const;
+
+	/**
+		@brief
+		\~English	Get threads which load effects with Effect::CreateAsync
+		\~Japanese Effect::CreateAsyncでエフェクトを読み込むスレッドを取得する。
+		@note
+		\~English	Threads are launched when an effect is loaded asynchronously first. The number of threads is up to 2 so that loading doesn't occupy all cores.
+		\~Japanese スレッドは最初にエフェクトが非同期に読み込まれる時に起動される。読み込みが全てのコアを占有しないように、スレッド数は最大2である。
+	*/
+	ThreadPool* GetLoadingThreadPool();
 };
 
 //----------------------------------------------------------------------------------
@@ -2,6 +2,8 @@
 #include "Culling3D.WorldInternal.h"
 #include "Culling3D.ObjectInternal.h"
 
+#include "../SIMD/Float4.h"
+
 #include <complex>
 #include <cstring>
 #include <fstream>
@@ -13,14 +15,23 @@ const int32_t viewCullingXDiv = 2;
 const int32_t viewCullingYDiv = 2;
 const int32_t viewCullingZDiv = 3;
 
-bool IsInView(Vector3DF position, float radius, Vector3DF facePositions[6], Vector3DF faceDir[6])
+static bool IsInView(Vector3DF position, float radius, const float planeXs[8], const float planeYs[8], const float planeZs[8], const float planeWs[8])
 {
-	for (int32_t i = 0; i < 6; i++)
+	using Effekseer::SIMD::Float4;
+
+	const Float4 x(position.X);
+	const Float4 y(position.Y);
+	const Float4 z(position.Z);
+	const Float4 r(radius);
+
+	for (int32_t i = 0; i < 8; i += 4)
 	{
-		Vector3DF diff = position - facePositions[i];
-		float distance = Vector3DF::Dot(diff, faceDir[i]);
+		Float4 distance = Float4::Load4(&planeXs[i]) * x;
+		distance = Float4::MulAdd(distance, Float4::Load4(&planeYs[i]), y);
+		distance = Float4::MulAdd(distance, Float4::Load4(&planeZs[i]), z);
+		distance = distance + Float4::Load4(&planeWs[i]);
 
-		if (distance > radius)
+		if (Float4::MoveMask(Float4::GreaterThan(distance, r)) != 0)
 			return false;
 	}
 
@@ -215,6 +226,7 @@ void WorldInternal::RemoveObjectInternal(Object* o)
 void WorldInternal::CastRay(Vector3DF from, Vector3DF to)
 {
 	objs.clear();
+	objViewMasks.clear();
 
 	Vector3DF aabb_max;
 	Vector3DF aabb_min;
@@ -360,230 +372,249 @@ void WorldInternal::CastRay(Vector3DF from, Vector3DF to)
 }
 
 void WorldInternal::Culling(const Matrix44& cameraProjMat, bool isOpenGL)
+{
+	Culling(&cameraProjMat, 1, isOpenGL);
+}
+
+void WorldInternal::Culling(const Matrix44* cameraProjMats, int32_t viewCount, bool isOpenGL)
 {
 	objs.clear();
+	objViewMasks.clear();
 
-	if (!std::isinf(cameraProjMat.Values[2][2]) && cameraProjMat.Values[0][0] != 0.0f && cameraProjMat.Values[1][1] != 0.0f)
+	viewCount = Min(viewCount, MaxViewCount);
+	views.resize(viewCount);
+
+	/* 全ての視点の範囲内に含まれるグリッドを取得 */
+	for (int32_t v = 0; v < viewCount; v++)
 	{
+		AddGridsInView(cameraProjMats[v], isOpenGL, views[v]);
+	}
 
-		Matrix44 cameraProjMatInv = cameraProjMat;
-		cameraProjMatInv.SetInverted();
+	/* 外領域追加 */
+	grids.push_back(&outofLayers);
+	grids.push_back(&allLayers);
 
-		float maxx = 1.0f;
-		float minx = -1.0f;
+	/* グリッドからオブジェクト取得 */
+	for (size_t i = 0; i < grids.size(); i++)
+	{
+		for (size_t j = 0; j < grids[i]->GetObjects().size(); j++)
+		{
+			Object* o = grids[i]->GetObjects()[j];
+			ObjectInternal* o_ = (ObjectInternal*)o;
 
-		float maxy = 1.0f;
-		float miny = -1.0f;
+			uint32_t viewMask = 0;
 
-		float maxz = 1.0f;
-		float minz = 0.0f;
-		if (isOpenGL)
-			minz = -1.0f;
+			for (int32_t v = 0; v < viewCount; v++)
+			{
+				if (o_->GetNextStatus().Type == OBJECT_SHAPE_TYPE_ALL ||
+					(views[v].IsValid && IsInView(o_->GetPosition(), o_->GetNextStatus().GetRadius(), views[v].PlaneXs, views[v].PlaneYs, views[v].PlaneZs, views[v].PlaneWs)))
+				{
+					viewMask |= 1u << v;
+				}
+			}
 
-		Vector3DF eyebox[8];
+			if (viewMask != 0)
+			{
+				objs.push_back(o);
+				objViewMasks.push_back(viewMask);
+			}
+		}
+	}
 
-		eyebox[0 + 0] = Vector3DF(minx, miny, maxz);
-		eyebox[1 + 0] = Vector3DF(maxx, miny, maxz);
-		eyebox[2 + 0] = Vector3DF(minx, maxy, maxz);
-		eyebox[3 + 0] = Vector3DF(maxx, maxy, maxz);
+	/* 取得したグリッドを破棄 */
+	for (size_t i = 0; i < grids.size(); i++)
+	{
+		grids[i]->IsScanned = false;
+	}
 
-		eyebox[0 + 4] = Vector3DF(minx, miny, minz);
-		eyebox[1 + 4] = Vector3DF(maxx, miny, minz);
-		eyebox[2 + 4] = Vector3DF(minx, maxy, minz);
-		eyebox[3 + 4] = Vector3DF(maxx, maxy, minz);
+	grids.clear();
+}
 
-		for (int32_t i = 0; i < 8; i++)
-		{
-			eyebox[i] = cameraProjMatInv.Transform3D(eyebox[i]);
-		}
+void WorldInternal::AddGridsInView(const Matrix44& cameraProjMat, bool isOpenGL, ViewFrustum& view)
+{
+	view.IsValid = !std::isinf(cameraProjMat.Values[2][2]) && cameraProjMat.Values[0][0] != 0.0f && cameraProjMat.Values[1][1] != 0.0f;
 
-		// 0-right 1-left 2-top 3-bottom 4-front 5-back
-		Vector3DF facePositions[6];
-		facePositions[0] = eyebox[5];
-		facePositions[1] = eyebox[4];
-		facePositions[2] = eyebox[6];
-		facePositions[3] = eyebox[4];
-		facePositions[4] = eyebox[4];
-		facePositions[5] = eyebox[0];
+	if (!view.IsValid)
+	{
+		return;
+	}
 
-		Vector3DF faceDir[6];
-		faceDir[0] = Vector3DF::Cross(eyebox[1] - eyebox[5], eyebox[7] - eyebox[5]);
-		faceDir[1] = Vector3DF::Cross(eyebox[6] - eyebox[4], eyebox[0] - eyebox[4]);
+	Matrix44 cameraProjMatInv = cameraProjMat;
+	cameraProjMatInv.SetInverted();
 
-		faceDir[2] = Vector3DF::Cross(eyebox[7] - eyebox[6], eyebox[2] - eyebox[6]);
-		faceDir[3] = Vector3DF::Cross(eyebox[0] - eyebox[4], eyebox[5] - eyebox[4]);
+	float maxx = 1.0f;
+	float minx = -1.0f;
 
-		faceDir[4] = Vector3DF::Cross(eyebox[5] - eyebox[4], eyebox[6] - eyebox[4]);
-		faceDir[5] = Vector3DF::Cross(eyebox[2] - eyebox[0], eyebox[1] - eyebox[5]);
+	float maxy = 1.0f;
+	float miny = -1.0f;
 
-		for (int32_t i = 0; i < 6; i++)
-		{
-			faceDir[i].Normalize();
-		}
+	float maxz = 1.0f;
+	float minz = 0.0f;
+	if (isOpenGL)
+		minz = -1.0f;
 
-		for (int32_t z = 0; z < viewCullingZDiv; z++)
-		{
-			for (int32_t y = 0; y < viewCullingYDiv; y++)
-			{
-				for (int32_t x = 0; x < viewCullingXDiv; x++)
-				{
-					Vector3DF eyebox_[8];
+	Vector3DF eyebox[8];
 
-					float xsize = 1.0f / (float)viewCullingXDiv;
-					float ysize = 1.0f / (float)viewCullingYDiv;
-					float zsize = 1.0f / (float)viewCullingZDiv;
+	eyebox[0 + 0] = Vector3DF(minx, miny, maxz);
+	eyebox[1 + 0] = Vector3DF(maxx, miny, maxz);
+	eyebox[2 + 0] = Vector3DF(minx, maxy, maxz);
+	eyebox[3 + 0] = Vector3DF(maxx, maxy, maxz);
 
-					for (int32_t e = 0; e < 8; e++)
-					{
-						float x_ = 0.0f, y_ = 0.0f, z_ = 0.0f;
-						if (e == 0)
-						{
-							x_ = xsize * x;
-							y_ = ysize * y;
-							z_ = zsize * z;
-						}
-						if (e == 1)
-						{
-							x_ = xsize * (x + 1);
-							y_ = ysize * y;
-							z_ = zsize * z;
-						}
-						if (e == 2)
-						{
-							x_ = xsize * x;
-							y_ = ysize * (y + 1);
-							z_ = zsize * z;
-						}
-						if (e == 3)
-						{
-							x_ = xsize * (x + 1);
-							y_ = ysize * (y + 1);
-							z_ = zsize * z;
-						}
-						if (e == 4)
-						{
-							x_ = xsize * x;
-							y_ = ysize * y;
-							z_ = zsize * (z + 1);
-						}
-						if (e == 5)
-						{
-							x_ = xsize * (x + 1);
-							y_ = ysize * y;
-							z_ = zsize * (z + 1);
-						}
-						if (e == 6)
-						{
-							x_ = xsize * x;
-							y_ = ysize * (y + 1);
-							z_ = zsize * (z + 1);
-						}
-						if (e == 7)
-						{
-							x_ = xsize * (x + 1);
-							y_ = ysize * (y + 1);
-							z_ = zsize * (z + 1);
-						}
+	eyebox[0 + 4] = Vector3DF(minx, miny, minz);
+	eyebox[1 + 4] = Vector3DF(maxx, miny, minz);
+	eyebox[2 + 4] = Vector3DF(minx, maxy, minz);
+	eyebox[3 + 4] = Vector3DF(maxx, maxy, minz);
 
-						Vector3DF yzMid[4];
-						yzMid[0] = eyebox[0] * x_ + eyebox[1] * (1.0f - x_);
-						yzMid[1] = eyebox[2] * x_ + eyebox[3] * (1.0f - x_);
-						yzMid[2] = eyebox[4] * x_ + eyebox[5] * (1.0f - x_);
-						yzMid[3] = eyebox[6] * x_ + eyebox[7] * (1.0f - x_);
+	for (int32_t i = 0; i < 8; i++)
+	{
+		eyebox[i] = cameraProjMatInv.Transform3D(eyebox[i]);
+	}
 
-						Vector3DF zMid[2];
-						zMid[0] = yzMid[0] * y_ + yzMid[1] * (1.0f - y_);
-						zMid[1] = yzMid[2] * y_ + yzMid[3] * (1.0f - y_);
+	// 0-right 1-left 2-top 3-bottom 4-front 5-back
+	Vector3DF* facePositions = view.FacePositions;
+	facePositions[0] = eyebox[5];
+	facePositions[1] = eyebox[4];
+	facePositions[2] = eyebox[6];
+	facePositions[3] = eyebox[4];
+	facePositions[4] = eyebox[4];
+	facePositions[5] = eyebox[0];
 
-						eyebox_[e] = zMid[0] * z_ + zMid[1] * (1.0f - z_);
-					}
+	Vector3DF* faceDir = view.FaceDirections;
+	faceDir[0] = Vector3DF::Cross(eyebox[1] - eyebox[5], eyebox[7] - eyebox[5]);
+	faceDir[1] = Vector3DF::Cross(eyebox[6] - eyebox[4], eyebox[0] - eyebox[4]);
 
-					Vector3DF max_(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-					Vector3DF min_(FLT_MAX, FLT_MAX, FLT_MAX);
+	faceDir[2] = Vector3DF::Cross(eyebox[7] - eyebox[6], eyebox[2] - eyebox[6]);
+	faceDir[3] = Vector3DF::Cross(eyebox[0] - eyebox[4], eyebox[5] - eyebox[4]);
 
-					for (int32_t i = 0; i < 8; i++)
-					{
-						if (eyebox_[i].X > max_.X)
-							max_.X = eyebox_[i].X;
-						if (eyebox_[i].Y > max_.Y)
-							max_.Y = eyebox_[i].Y;
-						if (eyebox_[i].Z > max_.Z)
-							max_.Z = eyebox_[i].Z;
-
-						if (eyebox_[i].X < min_.X)
-							min_.X = eyebox_[i].X;
-						if (eyebox_[i].Y < min_.Y)
-							min_.Y = eyebox_[i].Y;
-						if (eyebox_[i].Z < min_.Z)
-							min_.Z = eyebox_[i].Z;
-					}
+	faceDir[4] = Vector3DF::Cross(eyebox[5] - eyebox[4], eyebox[6] - eyebox[4]);
+	faceDir[5] = Vector3DF::Cross(eyebox[2] - eyebox[0], eyebox[1] - eyebox[5]);
 
-					/* 範囲内に含まれるグリッドを取得 */
-					for (size_t i = 0; i < layers.size(); i++)
-					{
-						layers[i]->AddGrids(max_, min_, grids);
-					}
-				}
-			}
-		}
+	for (int32_t i = 0; i < 6; i++)
+	{
+		faceDir[i].Normalize();
 
-		/* 外領域追加 */
-		grids.push_back(&outofLayers);
-		grids.push_back(&allLayers);
+		view.PlaneXs[i] = faceDir[i].X;
+		view.PlaneYs[i] = faceDir[i].Y;
+		view.PlaneZs[i] = faceDir[i].Z;
+		view.PlaneWs[i] = -Vector3DF::Dot(facePositions[i], faceDir[i]);
+	}
+
+	for (int32_t i = 6; i < 8; i++)
+	{
+		view.PlaneXs[i] = 0.0f;
+		view.PlaneYs[i] = 0.0f;
+		view.PlaneZs[i] = 0.0f;
+		view.PlaneWs[i] = -FLT_MAX;
+	}
 
-		/* グリッドからオブジェクト取得 */
-		for (size_t i = 0; i < grids.size(); i++)
+	for (int32_t z = 0; z < viewCullingZDiv; z++)
+	{
+		for (int32_t y = 0; y < viewCullingYDiv; y++)
 		{
-			for (size_t j = 0; j < grids[i]->GetObjects().size(); j++)
+			for (int32_t x = 0; x < viewCullingXDiv; x++)
 			{
-				Object* o = grids[i]->GetObjects()[j];
-				ObjectInternal* o_ = (ObjectInternal*)o;
+				Vector3DF eyebox_[8];
 
-				if (o_->GetNextStatus().Type == OBJECT_SHAPE_TYPE_ALL ||
-					IsInView(o_->GetPosition(), o_->GetNextStatus().GetRadius(), facePositions, faceDir))
+				float xsize = 1.0f / (float)viewCullingXDiv;
+				float ysize = 1.0f / (float)viewCullingYDiv;
+				float zsize = 1.0f / (float)viewCullingZDiv;
+
+				for (int32_t e = 0; e < 8; e++)
 				{
-					objs.push_back(o);
+					float x_ = 0.0f, y_ = 0.0f, z_ = 0.0f;
+					if (e == 0)
+					{
+						x_ = xsize * x;
+						y_ = ysize * y;
+						z_ = zsize * z;
+					}
+					if (e == 1)
+					{
+						x_ = xsize * (x + 1);
+						y_ = ysize * y;
+						z_ = zsize * z;
+					}
+					if (e == 2)
+					{
+						x_ = xsize * x;
+						y_ = ysize * (y + 1);
+						z_ = zsize * z;
+					}
+					if (e == 3)
+					{
+						x_ = xsize * (x + 1);
+						y_ = ysize * (y + 1);
+						z_ = zsize * z;
+					}
+					if (e == 4)
+					{
+						x_ = xsize * x;
+						y_ = ysize * y;
+						z_ = zsize * (z + 1);
+					}
+					if (e == 5)
+					{
+						x_ = xsize * (x + 1);
+						y_ = ysize * y;
+						z_ = zsize * (z + 1);
+					}
+					if (e == 6)
+					{
+						x_ = xsize * x;
+						y_ = ysize * (y + 1);
+						z_ = zsize * (z + 1);
+					}
+					if (e == 7)
+					{
+						x_ = xsize * (x + 1);
+						y_ = ysize * (y + 1);
+						z_ = zsize * (z + 1);
+					}
+
+					Vector3DF yzMid[4];
+					yzMid[0] = eyebox[0] * x_ + eyebox[1] * (1.0f - x_);
+					yzMid[1] = eyebox[2] * x_ + eyebox[3] * (1.0f - x_);
+					yzMid[2] = eyebox[4] * x_ + eyebox[5] * (1.0f - x_);
+					yzMid[3] = eyebox[6] * x_ + eyebox[7] * (1.0f - x_);
+
+					Vector3DF zMid[2];
+					zMid[0] = yzMid[0] * y_ + yzMid[1] * (1.0f - y_);
+					zMid[1] = yzMid[2] * y_ + yzMid[3] * (1.0f - y_);
+
+					eyebox_[e] = zMid[0] * z_ + zMid[1] * (1.0f - z_);
 				}
-			}
-		}
 
-		/* 取得したグリッドを破棄 */
-		for (size_t i = 0; i < grids.size(); i++)
-		{
-			grids[i]->IsScanned = false;
-		}
+				Vector3DF max_(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+				Vector3DF min_(FLT_MAX, FLT_MAX, FLT_MAX);
 
-		grids.clear();
-	}
-	else
-	{
-		grids.push_back(&allLayers);
+				for (int32_t i = 0; i < 8; i++)
+				{
+					if (eyebox_[i].X > max_.X)
+						max_.X = eyebox_[i].X;
+					if (eyebox_[i].Y > max_.Y)
+						max_.Y = eyebox_[i].Y;
+					if (eyebox_[i].Z > max_.Z)
+						max_.Z = eyebox_[i].Z;
 
-		/* グリッドからオブジェクト取得 */
-		for (size_t i = 0; i < grids.size(); i++)
-		{
-			for (size_t j = 0; j < grids[i]->GetObjects().size(); j++)
-			{
-				Object* o = grids[i]->GetObjects()[j];
-				ObjectInternal* o_ = (ObjectInternal*)o;
+					if (eyebox_[i].X < min_.X)
+						min_.X = eyebox_[i].X;
+					if (eyebox_[i].Y < min_.Y)
+						min_.Y = eyebox_[i].Y;
+					if (eyebox_[i].Z < min_.Z)
+						min_.Z = eyebox_[i].Z;
+				}
 
-				if (o_->GetNextStatus().Type == OBJECT_SHAPE_TYPE_ALL)
+				/* 範囲内に含まれるグリッドを取得 */
+				for (size_t i = 0; i < layers.size(); i++)
 				{
-					objs.push_back(o);
+					layers[i]->AddGrids(max_, min_, grids);
 				}
 			}
 		}
-
-		/* 取得したグリッドを破棄 */
-		for (size_t i = 0; i < grids.size(); i++)
-		{
-			grids[i]->IsScanned = false;
-		}
-
-		grids.clear();
 	}
 }
 
+
 bool WorldInternal::Reassign()
 {
 	/* 数が少ない */
@@ -591,6 +622,7 @@ bool WorldInternal::Reassign()
 		return false;
 
 	objs.clear();
+	objViewMasks.clear();
 
 	for (size_t i = 0; i < layers.size(); i++)
 	{
@@ -27,12 +27,32 @@ private:
 	Grid outofLayers;
 	Grid allLayers;
 
+	struct ViewFrustum
+	{
+		bool IsValid = false;
+		Vector3DF FacePositions[6];
+		Vector3DF FaceDirections[6];
+
+		/*
+			平面の各成分を4平面ずつSIMDで判定するために並べたもの
+			6平面の後に常に内側と判定される平面が2つ追加される
+		*/
+		float PlaneXs[8];
+		float PlaneYs[8];
+		float PlaneZs[8];
+		float PlaneWs[8];
+	};
+
 	std::vector<Object*> objs;
+	std::vector<uint32_t> objViewMasks;
+	std::vector<ViewFrustum> views;
 
 	std::vector<Grid*> grids;
 
 	std::set<Object*> containedObjects;
 
+	void AddGridsInView(const Matrix44& cameraProjMat, bool isOpenGL, ViewFrustum& view);
+
 public:
 	WorldInternal(float xSize, float ySize, float zSize, int32_t layerCount);
 	virtual ~WorldInternal();
@@ -47,6 +67,8 @@ public:
 
 	void Culling(const Matrix44& cameraProjMat, bool isOpenGL) override;
 
+	void Culling(const Matrix44* cameraProjMats, int32_t viewCount, bool isOpenGL) override;
+
 	bool Reassign() override;
 
 	void Dump(const char* path, const Matrix44& cameraProjMat, bool isOpenGL) override;
@@ -59,6 +81,10 @@ public:
 	{
 		return objs[index];
 	}
+	uint32_t GetObjectViewMask(int32_t index) override
+	{
+		return objViewMasks[index];
+	}
 
 	virtual int32_t GetRef() override
 	{
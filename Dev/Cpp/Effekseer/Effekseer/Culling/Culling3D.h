@@ -333,10 +333,27 @@ public:
 
 	virtual void CastRay(Vector3DF from, Vector3DF to) = 0;
 
+	//! the maximum number of views which are culled at once
+	static const int32_t MaxViewCount = 32;
+
 	virtual void Culling(const Matrix44& cameraProjMat, bool isOpenGL) = 0;
+
+	/**
+	@brief	複数の視点に対して一度にカリングを行う。いずれかの視点に含まれるオブジェクトが取得される。
+	@param	cameraProjMats	視点ごとのカメラプロジェクション行列
+	@param	viewCount		視点の数(MaxViewCount以下)
+	@param	isOpenGL		OpenGLによる描画か?
+	*/
+	virtual void Culling(const Matrix44* cameraProjMats, int32_t viewCount, bool isOpenGL) = 0;
+
 	virtual int32_t GetObjectCount() = 0;
 	virtual Object* GetObject(int32_t index) = 0;
 
+	/**
+	@brief	オブジェクトが含まれる視点のビットマスクを取得する。
+	*/
+	virtual uint32_t GetObjectViewMask(int32_t index) = 0;
+
 	virtual bool Reassign() = 0;
 
 	virtual void Dump(const char* path, const Matrix44& cameraProjMat, bool isOpenGL) = 0;
@@ -67,6 +67,7 @@ class Setting;
 class Manager;
 class Effect;
 class EffectNode;
+class EffectLoadingTask;
 
 class SpriteRenderer;
 class RibbonRenderer;
@@ -807,6 +808,7 @@ RefPtr<T> MakeRefPtr(Arg&&... args)
 using SettingRef = RefPtr<Setting>;
 using ManagerRef = RefPtr<Manager>;
 using EffectRef = RefPtr<Effect>;
+using EffectLoadingTaskRef = RefPtr<EffectLoadingTask>;
 using TextureRef = RefPtr<Texture>;
 using SoundDataRef = RefPtr<SoundData>;
 using ModelRef = RefPtr<Model>;
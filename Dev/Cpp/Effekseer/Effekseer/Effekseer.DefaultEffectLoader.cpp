@@ -14,13 +14,19 @@ namespace Effekseer
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
-DefaultEffectLoader::DefaultEffectLoader(FileInterface* fileInterface)
+DefaultEffectLoader::DefaultEffectLoader(FileInterface* fileInterface, bool isMemoryMapped)
 	: m_fileInterface(fileInterface)
+	, m_isMemoryMapped(isMemoryMapped)
 {
 	if (m_fileInterface == nullptr)
 	{
 		m_fileInterface = &m_defaultFileInterface;
 	}
+	else
+	{
+		// a custom file interface must be used to open files
+		m_isMemoryMapped = false;
+	}
 }
 
 //----------------------------------------------------------------------------------
@@ -40,6 +46,21 @@ bool DefaultEffectLoader::Load(const char16_t* path, void*& data, int32_t& size)
 	data = nullptr;
 	size = 0;
 
+	if (m_isMemoryMapped)
+	{
+		size_t mappedSize = 0;
+		if (DefaultFileMapping::Map(path, data, mappedSize))
+		{
+			size = (int32_t)mappedSize;
+
+			std::lock_guard<std::mutex> lock(m_mappedDataMutex);
+			m_mappedData.insert(data);
+			return true;
+		}
+
+		// read a file if it cannot be mapped
+	}
+
 	std::unique_ptr<FileReader> reader(m_fileInterface->OpenRead(path));
 	if (reader.get() == nullptr)
 		return false;
@@ -56,10 +77,32 @@ bool DefaultEffectLoader::Load(const char16_t* path, void*& data, int32_t& size)
 //----------------------------------------------------------------------------------
 void DefaultEffectLoader::Unload(void* data, int32_t size)
 {
+	if (m_isMemoryMapped)
+	{
+		std::lock_guard<std::mutex> lock(m_mappedDataMutex);
+		auto it = m_mappedData.find(data);
+		if (it != m_mappedData.end())
+		{
+			m_mappedData.erase(it);
+			DefaultFileMapping::Unmap(data, (size_t)size);
+			return;
+		}
+	}
+
 	uint8_t* data8 = (uint8_t*)data;
 	ES_SAFE_DELETE_ARRAY(data8);
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+bool DefaultEffectLoader::CanKeepData(const void* data, int32_t)
+{
+	// mapped pages are backed by a file and can be discarded by the system
+	std::lock_guard<std::mutex> lock(m_mappedDataMutex);
+	return m_mappedData.find(const_cast<void*>(data)) != m_mappedData.end();
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
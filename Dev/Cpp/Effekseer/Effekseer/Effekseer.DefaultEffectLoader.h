@@ -8,6 +8,8 @@
 #include "Effekseer.Base.h"
 #include "Effekseer.DefaultFile.h"
 #include "Effekseer.EffectLoader.h"
+#include "Utils/Effekseer.CustomAllocator.h"
+#include <mutex>
 
 //----------------------------------------------------------------------------------
 //
@@ -25,14 +27,23 @@ class DefaultEffectLoader : public EffectLoader
 	DefaultFileInterface m_defaultFileInterface;
 	FileInterface* m_fileInterface;
 
+	//! whether files are mapped into memory and kept by effects instead of being read into a buffer which is released after parsing
+	bool m_isMemoryMapped;
+
+	//! data which is mapped. It is accessed from multiple threads when effects are loaded asynchronously
+	std::mutex m_mappedDataMutex;
+	CustomSet<void*> m_mappedData;
+
 public:
-	DefaultEffectLoader(FileInterface* fileInterface = nullptr);
+	DefaultEffectLoader(FileInterface* fileInterface = nullptr, bool isMemoryMapped = false);
 
 	virtual ~DefaultEffectLoader();
 
 	bool Load(const char16_t* path, void*& data, int32_t& size);
 
 	void Unload(void* data, int32_t size);
+
+	bool CanKeepData(const void* data, int32_t size) override;
 };
 
 //----------------------------------------------------------------------------------
@@ -6,6 +6,17 @@
 #include <assert.h>
 #include <stdio.h>
 
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(_PSVITA) || defined(_PS4) || defined(_SWITCH) || defined(_XBOXONE)
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define EFFEKSEER_FILE_MAPPING_POSIX
+#endif
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -169,6 +180,96 @@ FileWriter* DefaultFileInterface::OpenWrite(const char16_t* path)
 	return new DefaultFileWriter(filePtr);
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+bool DefaultFileMapping::Map(const char16_t* path, void*& data, size_t& size)
+{
+	data = nullptr;
+	size = 0;
+
+#if defined(_WIN32)
+	HANDLE file = CreateFileW((const wchar_t*)path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER length;
+	if (!GetFileSizeEx(file, &length) || length.QuadPart <= 0 || length.QuadPart > INT32_MAX)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (mapping == nullptr)
+	{
+		return false;
+	}
+
+	// a view keeps the mapping alive after its handle is closed
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (view == nullptr)
+	{
+		return false;
+	}
+
+	data = view;
+	size = (size_t)length.QuadPart;
+	return true;
+#elif defined(EFFEKSEER_FILE_MAPPING_POSIX)
+	int8_t path8[256];
+	ConvertUtf16ToUtf8(path8, 256, (const int16_t*)path);
+
+	int fd = open((const char*)path8, O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	struct stat status;
+	if (fstat(fd, &status) != 0 || status.st_size <= 0 || status.st_size > INT32_MAX)
+	{
+		close(fd);
+		return false;
+	}
+
+	// a mapping is kept after the descriptor is closed
+	void* view = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED)
+	{
+		return false;
+	}
+
+	data = view;
+	size = (size_t)status.st_size;
+	return true;
+#else
+	return false;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void DefaultFileMapping::Unmap(void* data, size_t size)
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+
+#if defined(_WIN32)
+	UnmapViewOfFile(data);
+#elif defined(EFFEKSEER_FILE_MAPPING_POSIX)
+	munmap(data, size);
+#endif
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -69,6 +69,24 @@ public:
 	FileWriter* OpenWrite(const char16_t* path);
 };
 
+/**
+	@brief
+	\~English	A read-only memory mapping of a file
+	\~Japanese	ファイルの読み込み専用のメモリマッピング
+	@note
+	\~English	Pages are read when they are accessed, so that a file is not copied into a heap.
+	A mapping fails on platforms which don't support it and a caller must read the file instead.
+	\~Japanese	ページはアクセスされた時に読み込まれるため、ファイルはヒープにコピーされない。
+	対応していないプラットフォームではマッピングは失敗するため、呼び出し側はファイルを読み込む必要がある。
+*/
+class DefaultFileMapping
+{
+public:
+	static bool Map(const char16_t* path, void*& data, size_t& size);
+
+	static void Unmap(void* data, size_t size);
+};
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
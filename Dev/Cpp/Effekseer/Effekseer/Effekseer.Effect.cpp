@@ -8,6 +8,8 @@
 #include "Effekseer.EffectImplemented.h"
 #include "Effekseer.EffectLoader.h"
 #include "Effekseer.EffectNode.h"
+#include "Effekseer.EffectNodeSprite.h"
+#include "Effekseer.FCurves.h"
 #include "Effekseer.Manager.h"
 #include "Effekseer.ManagerImplemented.h"
 #include "Effekseer.MaterialLoader.h"
@@ -15,6 +17,7 @@
 #include "Effekseer.SoundLoader.h"
 #include "Effekseer.TextureLoader.h"
 #include "Effekseer.ResourceManager.h"
+#include "Effekseer.WorkerThread.h"
 #include "Backend/GraphicsDevice.h"
 #include "Effekseer.Resource.h"
 #include "Model/Model.h"
@@ -24,7 +27,10 @@
 #include "Utils/Effekseer.BinaryReader.h"
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 
 //----------------------------------------------------------------------------------
 //
@@ -84,6 +90,26 @@ static void GetParentDir(char16_t* dst, const char16_t* src)
 	}
 }
 
+static bool HasUniformSpriteCorners(EffectNode* node)
+{
+	auto nodeImpl = static_cast<EffectNodeImplemented*>(node);
+	if (nodeImpl->GetType() == EFFECT_NODE_TYPE_SPRITE && nodeImpl->IsRendered &&
+		!static_cast<EffectNodeSprite*>(nodeImpl)->HasUniformCorners())
+	{
+		return false;
+	}
+
+	for (int i = 0; i < node->GetChildrenCount(); i++)
+	{
+		if (!HasUniformSpriteCorners(node->GetChild(i)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 static std::u16string getFilenameWithoutExt(const char16_t* path)
 {
 	int start = 0;
@@ -247,26 +273,95 @@ void EffectFactory::OnLoadingResource(Effect* effect, const void* data, int32_t
 		SetSound(effect, i, resource);
 	}
 
-	for (auto i = 0; i < effect->GetModelCount(); i++)
+	for (auto i = 0; i < effect->GetMaterialCount(); i++)
 	{
 		char16_t fullPath[512];
-		PathCombine(fullPath, materialPath, effect->GetModelPath(i));
+		PathCombine(fullPath, materialPath, effect->GetMaterialPath(i));
 
-		auto resource = resourceMgr->LoadModel(fullPath);
-		SetModel(effect, i, resource);
+		auto resource = resourceMgr->LoadMaterial(fullPath);
+		SetMaterial(effect, i, resource);
 	}
 
-	for (auto i = 0; i < effect->GetMaterialCount(); i++)
+	// they may be loaded with OnLoadingResourceAsync
+	LoadResourcesWithoutGraphicsDevice(effect, materialPath);
+}
+
+void EffectFactory::OnLoadingResourceAsync(Effect* effect, const void* data, int32_t size, const char16_t* materialPath)
+{
+	auto resourceMgr = effect->GetSetting()->GetResourceManager();
+
+	// textures are only created in OnLoadingResource
+	for (auto i = 0; i < effect->GetColorImageCount(); i++)
 	{
 		char16_t fullPath[512];
-		PathCombine(fullPath, materialPath, effect->GetMaterialPath(i));
+		PathCombine(fullPath, materialPath, effect->GetColorImagePath(i));
+		resourceMgr->PrepareTexture(fullPath, TextureType::Color);
+	}
 
-		auto resource = resourceMgr->LoadMaterial(fullPath);
-		SetMaterial(effect, i, resource);
+	for (auto i = 0; i < effect->GetNormalImageCount(); i++)
+	{
+		char16_t fullPath[512];
+		PathCombine(fullPath, materialPath, effect->GetNormalImagePath(i));
+		resourceMgr->PrepareTexture(fullPath, TextureType::Normal);
+	}
+
+	for (auto i = 0; i < effect->GetDistortionImageCount(); i++)
+	{
+		char16_t fullPath[512];
+		PathCombine(fullPath, materialPath, effect->GetDistortionImagePath(i));
+		resourceMgr->PrepareTexture(fullPath, TextureType::Distortion);
+	}
+
+	LoadResourcesWithoutGraphicsDevice(effect, materialPath);
+}
+
+void EffectFactory::OnDiscardingResourceAsync(Effect* effect, const char16_t* materialPath)
+{
+	auto resourceMgr = effect->GetSetting()->GetResourceManager();
+
+	for (auto i = 0; i < effect->GetColorImageCount(); i++)
+	{
+		char16_t fullPath[512];
+		PathCombine(fullPath, materialPath, effect->GetColorImagePath(i));
+		resourceMgr->DiscardPreparedTexture(fullPath);
+	}
+
+	for (auto i = 0; i < effect->GetNormalImageCount(); i++)
+	{
+		char16_t fullPath[512];
+		PathCombine(fullPath, materialPath, effect->GetNormalImagePath(i));
+		resourceMgr->DiscardPreparedTexture(fullPath);
+	}
+
+	for (auto i = 0; i < effect->GetDistortionImageCount(); i++)
+	{
+		char16_t fullPath[512];
+		PathCombine(fullPath, materialPath, effect->GetDistortionImagePath(i));
+		resourceMgr->DiscardPreparedTexture(fullPath);
+	}
+}
+
+void EffectFactory::LoadResourcesWithoutGraphicsDevice(Effect* effect, const char16_t* materialPath)
+{
+	auto resourceMgr = effect->GetSetting()->GetResourceManager();
+
+	for (auto i = 0; i < effect->GetModelCount(); i++)
+	{
+		if (effect->GetModel(i) != nullptr)
+			continue;
+
+		char16_t fullPath[512];
+		PathCombine(fullPath, materialPath, effect->GetModelPath(i));
+
+		auto resource = resourceMgr->LoadModel(fullPath);
+		SetModel(effect, i, resource);
 	}
 
 	for (auto i = 0; i < effect->GetCurveCount(); i++)
 	{
+		if (effect->GetCurve(i) != nullptr)
+			continue;
+
 		char16_t fullPath[512];
 		PathCombine(fullPath, materialPath, effect->GetCurvePath(i));
 
@@ -276,6 +371,9 @@ void EffectFactory::OnLoadingResource(Effect* effect, const void* data, int32_t
 
 	for (int32_t ind = 0; ind < effect->GetProcedualModelCount(); ind++)
 	{
+		if (effect->GetProcedualModel(ind) != nullptr)
+			continue;
+
 		auto model = resourceMgr->GenerateProcedualModel(effect->GetProcedualModelParameter(ind));
 		SetProcedualModel(effect, ind, model);
 	}
@@ -353,6 +451,33 @@ EffectFactory::~EffectFactory()
 {
 }
 
+//! create an effect from data loaded by a loader. Data is kept by the effect if the loader allows it
+template <typename T>
+static EffectRef CreateFromLoadedData(const T& managerOrSetting, const EffectLoaderRef& loader, void* data, int32_t size, float magnification, const char16_t* materialPath)
+{
+	if (data == nullptr || size == 0)
+	{
+		loader->Unload(data, size);
+		return nullptr;
+	}
+
+	auto effect = MakeRefPtr<EffectImplemented>(managerOrSetting, data, size);
+	const auto isDataKept = effect->KeepData(loader, data, size);
+
+	// kept data is unloaded when the effect is released
+	if (!effect->Load(data, size, magnification, materialPath, ReloadingThreadType::Main))
+	{
+		effect.Reset();
+	}
+
+	if (!isDataKept)
+	{
+		loader->Unload(data, size);
+	}
+
+	return effect;
+}
+
 EffectRef Effect::Create(const ManagerRef& manager, const void* data, int32_t size, float magnification, const char16_t* materialPath)
 {
 	return EffectImplemented::Create(manager, data, size, magnification, materialPath);
@@ -380,9 +505,9 @@ EffectRef Effect::Create(const ManagerRef& manager, const char16_t* path, float
 		materialPath = parentDir;
 	}
 
-	auto effect = EffectImplemented::Create(manager, data, size, magnification, materialPath);
-
-	eLoader->Unload(data, size);
+	auto effect = CreateFromLoadedData(manager, eLoader, data, size, magnification, materialPath);
+	if (effect == nullptr)
+		return nullptr;
 
 	effect->SetName(getFilenameWithoutExt(path).c_str());
 
@@ -391,6 +516,8 @@ EffectRef Effect::Create(const ManagerRef& manager, const char16_t* path, float
 
 bool EffectImplemented::LoadBody(const uint8_t* data, int32_t size, float mag)
 {
+	FCurveKeyReferenceScope keyReferenceScope(keptData_, keptDataSize_);
+
 	// TODO share with an editor
 	const int32_t elementCountMax = 1024;
 	const int32_t dynamicBinaryCountMax = 102400;
@@ -670,6 +797,9 @@ bool EffectImplemented::LoadBody(const uint8_t* data, int32_t size, float mag)
 	auto nodeData = pos + binaryReader.GetOffset();
 	m_pRoot = EffectNodeImplemented::Create(this, nullptr, nodeData);
 
+	// sprites of an effect are written as the same type so that they are drawn together
+	spriteCornersUniform_ = HasUniformSpriteCorners(m_pRoot);
+
 	return true;
 }
 
@@ -755,15 +885,156 @@ EffectRef Effect::Create(const SettingRef& setting, const char16_t* path, float
 		materialPath = parentDir;
 	}
 
-	auto effect = EffectImplemented::Create(setting, data, size, magnification, materialPath);
-
-	eLoader->Unload(data, size);
+	auto effect = CreateFromLoadedData(setting, eLoader, data, size, magnification, materialPath);
+	if (effect == nullptr)
+		return nullptr;
 
 	effect->SetName(getFilenameWithoutExt(path).c_str());
 
 	return effect;
 }
 
+/**
+	@brief	a task which loads an effect on a loading thread and loads the rest in Commit
+*/
+class EffectLoadingTaskImplemented : public EffectLoadingTask
+{
+private:
+	SettingRef setting_;
+	RefPtr<EffectImplemented> effect_;
+	std::u16string materialPath_;
+
+	//! data of a file which is kept until Commit instead of being copied. It may be mapped by the loader
+	EffectLoaderRef loader_;
+	void* data_ = nullptr;
+	int32_t size_ = 0;
+
+	//! whether data is kept by the effect and unloaded when the effect is released
+	bool isDataKept_ = false;
+
+	std::mutex mutex_;
+	std::condition_variable loadedCV_;
+	std::atomic<bool> isLoaded_;
+	bool isCommitted_ = false;
+
+	void Load(const std::u16string& path, float magnification)
+	{
+		loader_ = setting_->GetEffectLoader();
+		if (loader_ == nullptr)
+			return;
+
+		if (!loader_->Load(path.c_str(), data_, size_))
+		{
+			data_ = nullptr;
+			size_ = 0;
+			return;
+		}
+
+		if (size_ == 0)
+			return;
+
+		auto effect = MakeRefPtr<EffectImplemented>(setting_, data_, size_);
+		isDataKept_ = effect->KeepData(loader_, data_, size_);
+
+		if (!effect->LoadWithoutResources(data_, size_, magnification, materialPath_.c_str()))
+			return;
+
+		effect->SetName(getFilenameWithoutExt(path.c_str()).c_str());
+		effect->LoadResourcesAsync(data_, size_, materialPath_.c_str());
+		effect_ = effect;
+	}
+
+	void UnloadData()
+	{
+		if (data_ != nullptr && !isDataKept_)
+		{
+			loader_->Unload(data_, size_);
+		}
+
+		data_ = nullptr;
+		size_ = 0;
+	}
+
+	void WaitForLoaded()
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		loadedCV_.wait(lock, [this]() { return isLoaded_.load(); });
+	}
+
+public:
+	EffectLoadingTaskImplemented(const SettingRef& setting, const char16_t* path, float magnification, const char16_t* materialPath)
+		: setting_(setting)
+		, isLoaded_(false)
+	{
+		char16_t parentDir[512];
+		if (materialPath == nullptr)
+		{
+			GetParentDir(parentDir, path);
+			materialPath = parentDir;
+		}
+
+		materialPath_ = materialPath;
+
+		// the task is not released until the loading thread finishes it
+		const std::u16string pathStr = path;
+		setting_->GetLoadingThreadPool()->Enqueue([this, pathStr, magnification]() {
+			Load(pathStr, magnification);
+
+			// notify while locking because the task may be released just after waking up
+			std::lock_guard<std::mutex> lock(mutex_);
+			isLoaded_.store(true);
+			loadedCV_.notify_all();
+		});
+	}
+
+	~EffectLoadingTaskImplemented() override
+	{
+		WaitForLoaded();
+
+		if (effect_ != nullptr)
+		{
+			effect_->DiscardResourcesAsync(materialPath_.c_str());
+		}
+
+		UnloadData();
+	}
+
+	bool IsReady() const override
+	{
+		return isLoaded_.load();
+	}
+
+	EffectRef Commit() override
+	{
+		if (isCommitted_)
+			return nullptr;
+
+		isCommitted_ = true;
+		WaitForLoaded();
+
+		if (effect_ == nullptr)
+		{
+			UnloadData();
+			return nullptr;
+		}
+
+		effect_->LoadRemainingResources(data_, size_, materialPath_.c_str());
+		UnloadData();
+
+		EffectRef effect = effect_;
+		effect_.Reset();
+		return effect;
+	}
+};
+
+EffectLoadingTaskRef Effect::CreateAsync(const SettingRef& setting, const char16_t* path, float magnification, const char16_t* materialPath)
+{
+	if (setting == nullptr || path == nullptr)
+		return nullptr;
+
+	return MakeRefPtr<EffectLoadingTaskImplemented>(setting, path, magnification, materialPath);
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -783,9 +1054,9 @@ EffectRef EffectImplemented::Create(const SettingRef& setting, const void* pData
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
-::Effekseer::EffectLoaderRef Effect::CreateEffectLoader(::Effekseer::FileInterface* fileInterface)
+::Effekseer::EffectLoaderRef Effect::CreateEffectLoader(::Effekseer::FileInterface* fileInterface, bool isMemoryMapped)
 {
-	return EffectLoaderRef(new ::Effekseer::DefaultEffectLoader(fileInterface));
+	return EffectLoaderRef(new ::Effekseer::DefaultEffectLoader(fileInterface, isMemoryMapped));
 }
 
 //----------------------------------------------------------------------------------
@@ -830,6 +1101,11 @@ EffectNode* EffectImplemented::GetRoot() const
 	return m_pRoot;
 }
 
+bool EffectImplemented::AreSpriteCornersUniform() const
+{
+	return spriteCornersUniform_;
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -842,6 +1118,23 @@ float EffectImplemented::GetMaginification() const
 //
 //----------------------------------------------------------------------------------
 bool EffectImplemented::Load(const void* pData, int size, float mag, const char16_t* materialPath, ReloadingThreadType reloadingThreadType)
+{
+	// if reladingThreadType == ReloadingThreadType::Main, this function was regarded as loading function actually
+
+	if (!LoadWithoutResources(pData, size, mag, materialPath))
+	{
+		return false;
+	}
+
+	if (factory->GetIsResourcesLoadedAutomatically())
+	{
+		ReloadResources(pData, size, materialPath);
+	}
+
+	return true;
+}
+
+bool EffectImplemented::LoadWithoutResources(const void* pData, int size, float mag, const char16_t* materialPath)
 {
 	factory.Reset();
 
@@ -862,8 +1155,6 @@ bool EffectImplemented::Load(const void* pData, int size, float mag, const char1
 	if (factory == nullptr)
 		return false;
 
-	// if reladingThreadType == ReloadingThreadType::Main, this function was regarded as loading function actually
-
 	if (!factory->OnCheckIsBinarySupported(pData, size))
 	{
 		return false;
@@ -880,11 +1171,44 @@ bool EffectImplemented::Load(const void* pData, int size, float mag, const char1
 	if (materialPath != nullptr)
 		materialPath_ = materialPath;
 
+	return true;
+}
+
+void EffectImplemented::LoadResourcesAsync(const void* data, int32_t size, const char16_t* materialPath)
+{
 	if (factory->GetIsResourcesLoadedAutomatically())
 	{
-		ReloadResources(pData, size, materialPath);
+		factory->OnLoadingResourceAsync(this, data, size, materialPath);
+	}
+}
+
+void EffectImplemented::LoadRemainingResources(const void* data, int32_t size, const char16_t* materialPath)
+{
+	if (factory->GetIsResourcesLoadedAutomatically())
+	{
+		factory->OnLoadingResource(this, data, size, materialPath);
+	}
+}
+
+void EffectImplemented::DiscardResourcesAsync(const char16_t* materialPath)
+{
+	if (factory->GetIsResourcesLoadedAutomatically())
+	{
+		factory->OnDiscardingResourceAsync(this, materialPath);
 	}
+}
 
+bool EffectImplemented::KeepData(const EffectLoaderRef& loader, void* data, int32_t size)
+{
+	if (loader == nullptr || !loader->CanKeepData(data, size))
+	{
+		return false;
+	}
+
+	assert(keptData_ == nullptr);
+	keptDataLoader_ = loader;
+	keptData_ = data;
+	keptDataSize_ = size;
 	return true;
 }
 
@@ -911,6 +1235,15 @@ void EffectImplemented::Reset()
 	curves_.clear();
 
 	ES_SAFE_DELETE(m_pRoot);
+
+	// curves which reference kept data are released with nodes
+	if (keptData_ != nullptr)
+	{
+		keptDataLoader_->Unload(keptData_, keptDataSize_);
+		keptDataLoader_.Reset();
+		keptData_ = nullptr;
+		keptDataSize_ = 0;
+	}
 }
 
 bool EffectImplemented::IsDyanamicMagnificationValid() const
@@ -1332,6 +1665,7 @@ bool EffectImplemented::Reload(
 
 	isReloadingOnRenderingThread = true;
 	Reset();
+	const auto isDataKept = KeepData(eLoader, data, size);
 	Load(data, size, m_maginificationExternal, materialPath, reloadingThreadType);
 	isReloadingOnRenderingThread = false;
 
@@ -1342,7 +1676,10 @@ bool EffectImplemented::Reload(
 		manager->EndReloadEffect(EffectRef::FromPinned(this), true);
 	}
 
-	eLoader->Unload(data, size);
+	if (!isDataKept)
+	{
+		eLoader->Unload(data, size);
+	}
 
 	return false;
 }
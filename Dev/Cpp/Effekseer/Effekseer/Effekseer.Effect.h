@@ -200,6 +200,26 @@ public:
 	*/
 	virtual void OnLoadingResource(Effect* effect, const void* data, int32_t size, const char16_t* materialPath);
 
+	/**
+		@brief
+		\~English this method is called on a worker thread before OnLoadingResource when an effect is loaded with Effect::CreateAsync
+		\~Japanese	Effect::CreateAsyncでエフェクトを読み込む時に、OnLoadingResourceの前にワーカースレッドでこのメソッドが呼ばれる。
+		@note
+		\~English Resources which don't need a graphics device (models, curves and procedural models) are loaded and textures are decoded by default. OnLoadingResource doesn't load models and curves again and only creates decoded textures.
+		\~Japanese	デフォルトではグラフィックスデバイスが不要なリソース(モデル、カーブ、プロシージャルモデル)が読み込まれ、テクスチャがデコードされる。OnLoadingResourceはモデルとカーブを再度読み込まず、デコードされたテクスチャを生成するだけである。
+	*/
+	virtual void OnLoadingResourceAsync(Effect* effect, const void* data, int32_t size, const char16_t* materialPath);
+
+	/**
+		@brief
+		\~English this method is called instead of OnLoadingResource when a task of Effect::CreateAsync is released without EffectLoadingTask::Commit
+		\~Japanese	Effect::CreateAsyncのタスクがEffectLoadingTask::Commitされずに解放された時に、OnLoadingResourceの代わりにこのメソッドが呼ばれる。
+		@note
+		\~English Textures which are decoded with OnLoadingResourceAsync are discarded by default.
+		\~Japanese	デフォルトではOnLoadingResourceAsyncでデコードされたテクスチャが破棄される。
+	*/
+	virtual void OnDiscardingResourceAsync(Effect* effect, const char16_t* materialPath);
+
 	/**
 	@brief
 	\~English this method is called when unload resources
@@ -218,6 +238,43 @@ public:
 	\~Japanese	バイナリを読み込んだときに自動的にリソースを読み込むか取得する。
 	*/
 	virtual bool GetIsResourcesLoadedAutomatically() const;
+
+private:
+	//! load resources which don't need a graphics device if they are not loaded
+	void LoadResourcesWithoutGraphicsDevice(Effect* effect, const char16_t* materialPath);
+};
+
+/**
+	@brief
+	\~English	A task which loads an effect asynchronously
+	\~Japanese	エフェクトを非同期に読み込むタスク
+*/
+class EffectLoadingTask : public ReferenceObject
+{
+public:
+	EffectLoadingTask() = default;
+
+	virtual ~EffectLoadingTask() = default;
+
+	/**
+		@brief
+		\~English	Get whether loading on a worker thread has finished. If it is true, Commit doesn't wait for the worker thread.
+		\~Japanese	ワーカースレッドでの読み込みが終了したか取得する。trueの場合、Commitはワーカースレッドを待機しない。
+	*/
+	virtual bool IsReady() const = 0;
+
+	/**
+		@brief
+		\~English	Load resources which need a graphics device on the calling thread and get the loaded effect.
+		\~Japanese	グラフィックスデバイスが必要なリソースを呼び出したスレッドで読み込み、読み込まれたエフェクトを取得する。
+		@return
+		\~English	An effect. nullptr is returned if loading failed or Commit was already called.
+		\~Japanese	エフェクト。読み込みに失敗した場合、もしくは既にCommitが呼ばれている場合はnullptrを返す。
+		@note
+		\~English	It waits for the worker thread if loading has not finished yet.
+		\~Japanese	読み込みが終了していない場合、ワーカースレッドを待機する。
+	*/
+	virtual EffectRef Commit() = 0;
 };
 
 /**
@@ -279,9 +336,40 @@ public:
 	static EffectRef Create(const SettingRef& setting, const char16_t* path, float magnification = 1.0f, const char16_t* materialPath = nullptr);
 
 	/**
-	@brief	標準のエフェクト読込インスタンスを生成する。
+		@brief
+		\~English	Start to load an effect asynchronously.
+		\~Japanese	エフェクトの非同期読み込みを開始する。
+		@param	setting			[in]	\~English a setting \~Japanese 設定クラス
+		@param	path			[in]	\~English a path of an effect \~Japanese 読込元のパス
+		@param	magnification	[in]	\~English magnification when loading \~Japanese 読み込み時の拡大率
+		@param	materialPath	[in]	\~English a base path of resources \~Japanese 素材ロード時の基準パス
+		@return
+		\~English	A task. An effect is obtained with EffectLoadingTask::Commit.
+		\~Japanese	タスク。エフェクトはEffectLoadingTask::Commitで取得される。
+		@note
+		\~English	A file of an effect and resources which don't need a graphics device are loaded and textures are decoded on threads of Setting::GetLoadingThreadPool.
+		Decoded textures are created and other resources are loaded when EffectLoadingTask::Commit is called.
+		Tasks run in parallel, so loaders of models and curves and TextureLoader::Decode must be thread-safe.
+		\~Japanese	エフェクトのファイルとグラフィックスデバイスが不要なリソースはSetting::GetLoadingThreadPoolのスレッドで読み込まれ、テクスチャはデコードされる。
+		デコードされたテクスチャの生成とその他のリソースの読み込みはEffectLoadingTask::Commitが呼ばれた時に行われる。
+		タスクは並列に実行されるため、モデルとカーブの読込クラスとTextureLoader::Decodeはスレッドセーフである必要がある。
 	*/
-	static ::Effekseer::EffectLoaderRef CreateEffectLoader(::Effekseer::FileInterface* fileInterface = nullptr);
+	static EffectLoadingTaskRef CreateAsync(const SettingRef& setting, const char16_t* path, float magnification = 1.0f, const char16_t* materialPath = nullptr);
+
+	/**
+	@brief	標準のエフェクト読込インスタンスを生成する。
+	@param	fileInterface	[in]	\~English	An interface to open files. A default one is used if it is null.
+	\~Japanese	ファイルを開くインターフェース。nullの場合は標準のものが使用される。
+	@param	isMemoryMapped	[in]	\~English	Whether files are mapped into memory instead of being read into a heap.
+	It is used only with a default file interface. A file is read if it cannot be mapped.
+	A mapping is kept while an effect loaded from it is alive, and aligned keys of curves are referenced in it.
+	Keys which are converted for the coordinate system or magnification are copied.
+	\~Japanese	ファイルをヒープに読み込む代わりに、メモリにマッピングするかどうか。
+	標準のファイルインターフェースの場合のみ使用される。マッピングできない場合はファイルが読み込まれる。
+	マッピングはそこから読み込まれたエフェクトが存在する間保持され、アラインされたカーブのキーはその中で参照される。
+	座標系や拡大率に合わせて変換されるキーはコピーされる。
+	*/
+	static ::Effekseer::EffectLoaderRef CreateEffectLoader(::Effekseer::FileInterface* fileInterface = nullptr, bool isMemoryMapped = false);
 
 	/**
 	@brief
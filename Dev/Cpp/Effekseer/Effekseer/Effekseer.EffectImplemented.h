@@ -7,6 +7,7 @@
 //----------------------------------------------------------------------------------
 #include "Effekseer.Base.h"
 #include "Effekseer.Effect.h"
+#include "Effekseer.EffectLoader.h"
 #include "Effekseer.InternalScript.h"
 #include "Effekseer.Vector3D.h"
 #include "Model/ProcedualModelParameter.h"
@@ -162,6 +163,9 @@ protected:
 	//! child root node
 	EffectNode* m_pRoot = nullptr;
 
+	//! whether have all corners of each sprite the same color and are placed at a parallelogram
+	bool spriteCornersUniform_ = true;
+
 	// culling
 	struct
 	{
@@ -190,6 +194,11 @@ protected:
 
 	ReferenceObject* loadingObject = nullptr;
 
+	//! data of a file which is kept while nodes loaded from it are alive. Keys of curves in it are referenced
+	EffectLoaderRef keptDataLoader_;
+	void* keptData_ = nullptr;
+	int32_t keptDataSize_ = 0;
+
 	bool LoadBody(const uint8_t* data, int32_t size, float mag);
 
 	void ResetReloadingBackup();
@@ -208,10 +217,35 @@ public:
 
 	EffectNode* GetRoot() const override;
 
+	/**
+		@brief	whether have all corners of each sprite in this effect the same color and are placed at a parallelogram
+	*/
+	bool AreSpriteCornersUniform() const;
+
 	float GetMaginification() const override;
 
 	bool Load(const void* pData, int size, float mag, const char16_t* materialPath, ReloadingThreadType reloadingThreadType);
 
+	//! load parameters without resources
+	bool LoadWithoutResources(const void* pData, int size, float mag, const char16_t* materialPath);
+
+	//! load resources which don't need a graphics device on a worker thread
+	void LoadResourcesAsync(const void* data, int32_t size, const char16_t* materialPath);
+
+	//! load resources which are not loaded with LoadResourcesAsync
+	void LoadRemainingResources(const void* data, int32_t size, const char16_t* materialPath);
+
+	//! discard resources which are loaded with LoadResourcesAsync when LoadRemainingResources is not called
+	void DiscardResourcesAsync(const char16_t* materialPath);
+
+	/**
+		@brief	keep data loaded by a loader while nodes loaded from it are alive if the loader allows it
+		@return	whether data is kept. Otherwise a caller must unload data after loading
+		@note
+		It must be called before loading. Kept data is unloaded by Reset.
+	*/
+	bool KeepData(const EffectLoaderRef& loader, void* data, int32_t size);
+
 	/**
 		@breif	何も読み込まれていない状態に戻す
 	*/
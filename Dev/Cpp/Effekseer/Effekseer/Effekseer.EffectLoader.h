@@ -57,6 +57,19 @@ public:
 		::Effekseer::Effect::Create実行終了時に使用される。
 	*/
 	virtual void Unload(void* data, int32_t size) = 0;
+
+	/**
+		@brief
+		\~English	Get whether loaded data can be kept by an effect until Unload is called instead of being released after loading.
+		\~Japanese	読み込まれたデータを読み込み後に破棄せずに、Unloadが呼ばれるまでエフェクトが保持できるか取得する。
+		@note
+		\~English	Keys of curves in kept data are referenced instead of being copied. It should be true only if keeping data costs little memory, e.g. data is mapped from a file.
+		\~Japanese	保持されたデータのカーブのキーはコピーされずに参照される。ファイルがマッピングされている場合など、データの保持にほとんどメモリが必要ない場合のみtrueにするべきである。
+	*/
+	virtual bool CanKeepData(const void*, int32_t)
+	{
+		return false;
+	}
 };
 
 //----------------------------------------------------------------------------------
@@ -1583,6 +1583,28 @@ public:
 		return EFFECT_NODE_TYPE_NONE;
 	}
 
+	/**
+		@brief	get a radius of a sphere around an instance which contains its drawn shape when the instance is not scaled
+		@return	a negative value if the shape cannot be bounded and the node must not be culled
+	*/
+	virtual float GetCullingRadius() const
+	{
+		return -1.0f;
+	}
+
+	//! get a FCurve of all colors which InstanceChunk evaluates for instances at once. nullptr if it is not used
+	virtual const FCurveVectorColor* GetAllColorFCurve() const
+	{
+		return nullptr;
+	}
+
+	//! whether aren't vertices moved by parameters which cannot be bounded by a shape
+	bool IsCullingRadiusAvailable() const
+	{
+		return DepthValues.DepthParameter.DepthOffset == 0.0f && DepthValues.DepthParameter.SuppressionOfScalingByDepth >= 1.0f &&
+			   RendererCommon.MaterialType != RendererMaterialType::File;
+	}
+
 	RefPtr<RenderingUserData> GetRenderingUserData() override
 	{
 		return renderingUserData_;
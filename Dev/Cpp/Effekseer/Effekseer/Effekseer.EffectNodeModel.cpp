@@ -7,8 +7,10 @@
 #include "SIMD/Utils.h"
 
 #include "Effekseer.Instance.h"
+#include "Effekseer.InstanceChunk.h"
 #include "Effekseer.InstanceContainer.h"
 #include "Effekseer.InstanceGlobal.h"
+#include "Model/Model.h"
 #include "Renderer/Effekseer.ModelRenderer.h"
 
 #include "Effekseer.Setting.h"
@@ -274,6 +276,44 @@ void EffectNodeModel::EndRendering(Manager* manager)
 	}
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+const FCurveVectorColor* EffectNodeModel::GetAllColorFCurve() const
+{
+	if (AllColor.type != StandardColorParameter::FCurve_RGBA)
+	{
+		return nullptr;
+	}
+
+	return AllColor.fcurve_rgba.FCurve;
+}
+
+float EffectNodeModel::GetCullingRadius() const
+{
+	if (!IsCullingRadiusAvailable())
+	{
+		return -1.0f;
+	}
+
+	ModelRef model;
+	if (Mode == ModelReferenceType::Procedual)
+	{
+		model = m_effect->GetProcedualModel(ModelIndex);
+	}
+	else
+	{
+		model = m_effect->GetModel(ModelIndex);
+	}
+
+	if (model == nullptr)
+	{
+		return -1.0f;
+	}
+
+	return model->GetBoundingRadius() * m_effect->GetMaginification();
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -348,7 +388,12 @@ void EffectNodeModel::UpdateRenderedInstance(Instance& instance, Manager* manage
 	}
 	else if (AllColor.type == StandardColorParameter::FCurve_RGBA)
 	{
-		auto fcurveColors = AllColor.fcurve_rgba.FCurve->GetValues(instance.m_LivingTime, instance.m_LivedTime);
+		// it is usually evaluated for all instances in the chunk in advance
+		std::array<float, 4> fcurveColors;
+		if (!instance.ownChunk_->GetEvaluatedColorFCurve(instance.chunkIndex_, instance.m_LivingTime, fcurveColors))
+		{
+			fcurveColors = AllColor.fcurve_rgba.FCurve->GetValues(instance.m_LivingTime, instance.m_LivedTime);
+		}
 		instValues._original.R = (uint8_t)Clamp((instValues.allColorValues.fcurve_rgba.offset[0] + fcurveColors[0]), 255, 0);
 		instValues._original.G = (uint8_t)Clamp((instValues.allColorValues.fcurve_rgba.offset[1] + fcurveColors[1]), 255, 0);
 		instValues._original.B = (uint8_t)Clamp((instValues.allColorValues.fcurve_rgba.offset[2] + fcurveColors[2]), 255, 0);
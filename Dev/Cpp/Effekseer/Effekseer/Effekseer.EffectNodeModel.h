@@ -102,6 +102,10 @@ public:
 	{
 		return EFFECT_NODE_TYPE_MODEL;
 	}
+
+	float GetCullingRadius() const override;
+
+	const FCurveVectorColor* GetAllColorFCurve() const override;
 };
 
 //----------------------------------------------------------------------------------
@@ -8,6 +8,7 @@
 #include "SIMD/Utils.h"
 
 #include "Effekseer.Instance.h"
+#include "Effekseer.InstanceChunk.h"
 #include "Effekseer.InstanceContainer.h"
 #include "Effekseer.InstanceGlobal.h"
 
@@ -169,6 +170,7 @@ void EffectNodeSprite::BeginRendering(int32_t count, Manager* manager)
 
 		nodeParameter.UserData = GetRenderingUserData();
 		nodeParameter.Maginification = GetEffect()->GetMaginification();
+		nodeParameter.HasUniformCorners = static_cast<EffectImplemented*>(m_effect)->AreSpriteCornersUniform();
 
 		renderer->BeginRendering(nodeParameter, count, nullptr);
 	}
@@ -199,6 +201,7 @@ void EffectNodeSprite::Rendering(const Instance& instance, const Instance* next_
 
 		nodeParameter.EnableViewOffset = (TranslationType == ParameterTranslationType_ViewOffset);
 		nodeParameter.Maginification = GetEffect()->GetMaginification();
+		nodeParameter.HasUniformCorners = static_cast<EffectImplemented*>(m_effect)->AreSpriteCornersUniform();
 
 		SpriteRenderer::InstanceParameter instanceParameter;
 		instanceParameter.AllColor = instValues._color;
@@ -309,11 +312,62 @@ void EffectNodeSprite::EndRendering(Manager* manager)
 
 		nodeParameter.UserData = GetRenderingUserData();
 		nodeParameter.Maginification = GetEffect()->GetMaginification();
+		nodeParameter.HasUniformCorners = static_cast<EffectImplemented*>(m_effect)->AreSpriteCornersUniform();
 
 		renderer->EndRendering(nodeParameter, nullptr);
 	}
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+bool EffectNodeSprite::HasUniformCorners() const
+{
+	if (SpriteColor.type != SpriteColorParameter::Default)
+	{
+		return false;
+	}
+
+	if (SpritePosition.type == SpritePosition.Default)
+	{
+		return true;
+	}
+
+	// the same term as a renderer which places a corner (u, v) with u * v
+	const auto& f = SpritePosition.fixed;
+	const auto uv = f.ur - f.ul - f.lr + f.ll;
+	return uv.GetX() == 0.0f && uv.GetY() == 0.0f;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+const FCurveVectorColor* EffectNodeSprite::GetAllColorFCurve() const
+{
+	if (SpriteAllColor.type != StandardColorParameter::FCurve_RGBA)
+	{
+		return nullptr;
+	}
+
+	return SpriteAllColor.fcurve_rgba.FCurve;
+}
+
+float EffectNodeSprite::GetCullingRadius() const
+{
+	if (!IsCullingRadiusAvailable())
+	{
+		return -1.0f;
+	}
+
+	float radiusSquared = 0.0f;
+	for (const auto& position : {SpritePosition.fixed.ll, SpritePosition.fixed.lr, SpritePosition.fixed.ul, SpritePosition.fixed.ur})
+	{
+		radiusSquared = Max(radiusSquared, position.LengthSq());
+	}
+
+	return sqrtf(radiusSquared);
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -388,7 +442,12 @@ void EffectNodeSprite::UpdateRenderedInstance(Instance& instance, Manager* manag
 	}
 	else if (SpriteAllColor.type == StandardColorParameter::FCurve_RGBA)
 	{
-		auto fcurveColor = SpriteAllColor.fcurve_rgba.FCurve->GetValues(instance.m_LivingTime, instance.m_LivedTime);
+		// it is usually evaluated for all instances in the chunk in advance
+		std::array<float, 4> fcurveColor;
+		if (!instance.ownChunk_->GetEvaluatedColorFCurve(instance.chunkIndex_, instance.m_LivingTime, fcurveColor))
+		{
+			fcurveColor = SpriteAllColor.fcurve_rgba.FCurve->GetValues(instance.m_LivingTime, instance.m_LivedTime);
+		}
 		instValues._originalColor.R = (uint8_t)Clamp((instValues.allColorValues.fcurve_rgba.offset[0] + fcurveColor[0]), 255, 0);
 		instValues._originalColor.G = (uint8_t)Clamp((instValues.allColorValues.fcurve_rgba.offset[1] + fcurveColor[1]), 255, 0);
 		instValues._originalColor.B = (uint8_t)Clamp((instValues.allColorValues.fcurve_rgba.offset[2] + fcurveColor[2]), 255, 0);
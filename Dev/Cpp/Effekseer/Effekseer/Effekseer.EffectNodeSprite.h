@@ -147,6 +147,13 @@ public:
 	{
 		return EFFECT_NODE_TYPE_SPRITE;
 	}
+
+	float GetCullingRadius() const override;
+
+	const FCurveVectorColor* GetAllColorFCurve() const override;
+
+	//! whether have all corners the same color and are placed at a parallelogram
+	bool HasUniformCorners() const;
 };
 
 //----------------------------------------------------------------------------------
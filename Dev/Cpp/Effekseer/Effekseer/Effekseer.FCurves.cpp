@@ -2,13 +2,51 @@
 
 #include "Effekseer.FCurves.h"
 #include "Effekseer.InstanceGlobal.h"
+#include <algorithm>
 #include <cmath>
 
 namespace Effekseer
 {
 
+namespace
+{
+
+//! fmodf for positive integral divisors. Results are the same as fmodf while frames are less than 2^24.
+SIMD::Float4 ModIntegral(const SIMD::Float4& x, const SIMD::Float4& y)
+{
+	using SIMD::Float4;
+
+	auto r = x - Float4::Floor(x / y) * y;
+
+	// a quotient may be rounded up or down
+	r = Float4::Select(Float4::LessThan(r, Float4::SetZero()), r + y, r);
+	r = Float4::Select(Float4::GreaterEqual(r, y), r - y, r);
+	return r;
+}
+
+//! data in which keys are referenced. It is set by FCurveKeyReferenceScope
+thread_local const uint8_t* g_referencedDataBegin = nullptr;
+thread_local const uint8_t* g_referencedDataEnd = nullptr;
+
+} // namespace
+
+FCurveKeyReferenceScope::FCurveKeyReferenceScope(const void* data, int32_t size)
+	: previousBegin_(g_referencedDataBegin)
+	, previousEnd_(g_referencedDataEnd)
+{
+	g_referencedDataBegin = static_cast<const uint8_t*>(data);
+	g_referencedDataEnd = data != nullptr ? g_referencedDataBegin + size : nullptr;
+}
+
+FCurveKeyReferenceScope::~FCurveKeyReferenceScope()
+{
+	g_referencedDataBegin = previousBegin_;
+	g_referencedDataEnd = previousEnd_;
+}
+
 FCurve::FCurve(float defaultValue)
 	: defaultValue_(defaultValue)
+	, getValues4_(&GetValues4<FCurveEdge::Constant, FCurveEdge::Constant>)
 {
 }
 
@@ -50,43 +88,69 @@ int32_t FCurve::Load(const void* data, int32_t version)
 	p += sizeof(int32_t);
 	size += sizeof(int32_t);
 
-	for (int32_t i = 0; i < count; i++)
+	const auto isReferenced = g_referencedDataBegin != nullptr && g_referencedDataBegin <= p && p + sizeof(float) * count <= g_referencedDataEnd &&
+							  reinterpret_cast<uintptr_t>(p) % alignof(float) == 0;
+
+	if (isReferenced)
+	{
+		referencedKeys_ = reinterpret_cast<const float*>(p);
+		keys_.clear();
+	}
+	else
 	{
-		float value = 0;
+		referencedKeys_ = nullptr;
+		keys_.resize(count);
+		memcpy(keys_.data(), p, sizeof(float) * count);
+	}
 
-		memcpy(&value, p, sizeof(float));
-		p += sizeof(float);
-		size += sizeof(float);
+	keyCount_ = count;
+	p += sizeof(float) * count;
+	size += sizeof(float) * count;
 
-		keys_.push_back(value);
-	}
+	static const GetValues4Func kernels[3][3] = {
+		{
+			&GetValues4<FCurveEdge::Constant, FCurveEdge::Constant>,
+			&GetValues4<FCurveEdge::Constant, FCurveEdge::Loop>,
+			&GetValues4<FCurveEdge::Constant, FCurveEdge::LoopInversely>,
+		},
+		{
+			&GetValues4<FCurveEdge::Loop, FCurveEdge::Constant>,
+			&GetValues4<FCurveEdge::Loop, FCurveEdge::Loop>,
+			&GetValues4<FCurveEdge::Loop, FCurveEdge::LoopInversely>,
+		},
+		{
+			&GetValues4<FCurveEdge::LoopInversely, FCurveEdge::Constant>,
+			&GetValues4<FCurveEdge::LoopInversely, FCurveEdge::Loop>,
+			&GetValues4<FCurveEdge::LoopInversely, FCurveEdge::LoopInversely>,
+		},
+	};
+
+	const auto startIndex = Clamp(static_cast<int32_t>(start_), 2, 0);
+	const auto endIndex = Clamp(static_cast<int32_t>(end_), 2, 0);
+	getValues4_ = kernels[startIndex][endIndex];
 
 	return size;
 }
 
-float FCurve::GetValue(float living, float life, FCurveTimelineType type) const
+void FCurve::CopyReferencedKeys()
 {
-	if (keys_.size() == 0)
-		return defaultValue_;
-
-	float frame = 0;
-	if (type == FCurveTimelineType::Time)
-	{
-		frame = living;
-	}
-	else
+	if (referencedKeys_ != nullptr)
 	{
-		frame = living / life * 100.0f;
+		keys_.assign(referencedKeys_, referencedKeys_ + keyCount_);
+		referencedKeys_ = nullptr;
 	}
+}
 
-	frame -= offset_;
+float FCurve::GetValueAtFrame(float frame) const
+{
+	const auto keys = GetKeys();
 	auto flen = static_cast<float>(len_);
 
 	if (frame < 0)
 	{
 		if (start_ == FCurveEdge::Constant)
 		{
-			return keys_[0];
+			return keys[0];
 		}
 		else if (start_ == FCurveEdge::Loop)
 		{
@@ -102,7 +166,7 @@ float FCurve::GetValue(float living, float life, FCurveTimelineType type) const
 	{
 		if (end_ == FCurveEdge::Constant)
 		{
-			return keys_[keys_.size() - 1];
+			return keys[keyCount_ - 1];
 		}
 		else if (end_ == FCurveEdge::Loop)
 		{
@@ -115,23 +179,158 @@ float FCurve::GetValue(float living, float life, FCurveTimelineType type) const
 	}
 
 	assert(frame / freq_ >= 0.0f);
-	uint32_t ind = static_cast<uint32_t>(frame / freq_);
+	const auto lastIndex = static_cast<uint32_t>(keyCount_ - 1);
+	uint32_t ind = Min(static_cast<uint32_t>(frame / freq_), lastIndex);
 	auto ep = 0.0001f;
 	if (std::abs(frame - flen) < ep)
 	{
-		return keys_[keys_.size() - 1];
+		return keys[keyCount_ - 1];
 	}
-	else if (ind == keys_.size() - 1)
+	else if (ind == lastIndex)
 	{
 		float subF = (float)(len_ - ind * freq_);
-		float subV = keys_[ind + 1] - keys_[ind];
-		return subV / (float)(subF) * (float)(frame - ind * freq_) + keys_[ind];
+		float subV = keys[Min(ind + 1, lastIndex)] - keys[ind];
+		return subV / (float)(subF) * (float)(frame - ind * freq_) + keys[ind];
 	}
 	else
 	{
 		float subF = (float)(freq_);
-		float subV = keys_[ind + 1] - keys_[ind];
-		return subV / (float)(subF) * (float)(frame - ind * freq_) + keys_[ind];
+		float subV = keys[ind + 1] - keys[ind];
+		return subV / (float)(subF) * (float)(frame - ind * freq_) + keys[ind];
+	}
+}
+
+float FCurve::GetValue(float living, float life, FCurveTimelineType type) const
+{
+	if (keyCount_ == 0)
+		return defaultValue_;
+
+	float frame = 0;
+	if (type == FCurveTimelineType::Time)
+	{
+		frame = living;
+	}
+	else
+	{
+		frame = living / life * 100.0f;
+	}
+
+	return GetValueAtFrame(frame - offset_);
+}
+
+template <FCurve::FCurveEdge START, FCurve::FCurveEdge END>
+SIMD::Float4 FCurve::GetValues4(const FCurve& curve, const SIMD::Float4& frames)
+{
+	using SIMD::Float4;
+
+	// the same steps as GetValueAtFrame. Results of lanes on edges are selected at last.
+	const auto keys = curve.GetKeys();
+	const auto lastIndex = curve.keyCount_ - 1;
+	const auto zero = Float4::SetZero();
+	const auto flen = Float4(static_cast<float>(curve.len_));
+	const auto freq = Float4(static_cast<float>(curve.freq_));
+	auto frame = frames;
+
+	const auto isBeforeStart = Float4::LessThan(frame, zero);
+	if (START == FCurveEdge::Loop)
+	{
+		frame = Float4::Select(isBeforeStart, flen - ModIntegral(zero - frame, flen), frame);
+	}
+	else if (START == FCurveEdge::LoopInversely)
+	{
+		frame = Float4::Select(isBeforeStart, ModIntegral(zero - frame, flen), frame);
+	}
+
+	const auto isAfterEnd = Float4::LessThan(flen, frame);
+	if (END == FCurveEdge::Loop)
+	{
+		frame = Float4::Select(isAfterEnd, ModIntegral(frame - flen, flen), frame);
+	}
+	else if (END == FCurveEdge::LoopInversely)
+	{
+		frame = Float4::Select(isAfterEnd, flen - ModIntegral(frame - flen, flen), frame);
+	}
+
+	// lanes on constant edges are clamped to read keys safely
+	const auto flastIndex = Float4(static_cast<float>(lastIndex));
+	const auto index = Float4::Min(Float4::Max(Float4::Floor(frame / freq), zero), flastIndex);
+
+	alignas(16) float indexes[4];
+	alignas(16) float keys0[4];
+	alignas(16) float keys1[4];
+	Float4::Store4(indexes, index);
+
+	for (int32_t i = 0; i < 4; i++)
+	{
+		const auto ind = static_cast<int32_t>(indexes[i]);
+		keys0[i] = keys[ind];
+		keys1[i] = keys[Min(ind + 1, lastIndex)];
+	}
+
+	const auto key0 = Float4::Load4(keys0);
+	const auto key1 = Float4::Load4(keys1);
+	const auto indexFrame = index * freq;
+	const auto subF = Float4::Select(Float4::Equal(index, flastIndex), flen - indexFrame, freq);
+	auto value = (key1 - key0) / subF * (frame - indexFrame) + key0;
+
+	const auto lastKey = Float4(keys[lastIndex]);
+	value = Float4::Select(Float4::LessThan(Float4::Abs(frame - flen), Float4(0.0001f)), lastKey, value);
+
+	if (END == FCurveEdge::Constant)
+	{
+		value = Float4::Select(isAfterEnd, lastKey, value);
+	}
+
+	if (START == FCurveEdge::Constant)
+	{
+		value = Float4::Select(isBeforeStart, Float4(keys[0]), value);
+	}
+
+	return value;
+}
+
+void FCurve::GetValues(const float* livings, const float* lifes, int32_t count, FCurveTimelineType type, float* values) const
+{
+	if (keyCount_ == 0)
+	{
+		std::fill(values, values + count, defaultValue_);
+		return;
+	}
+
+	const auto offset = SIMD::Float4(static_cast<float>(offset_));
+
+	for (int32_t i = 0; i < count; i += 4)
+	{
+		const auto laneCount = Min(count - i, 4);
+
+		// padded lanes are calculated and discarded
+		alignas(16) float livings4[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+		alignas(16) float lifes4[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+		alignas(16) float values4[4];
+
+		for (int32_t j = 0; j < laneCount; j++)
+		{
+			livings4[j] = livings[i + j];
+		}
+
+		auto frames = SIMD::Float4::Load4(livings4);
+
+		if (type == FCurveTimelineType::Percent)
+		{
+			for (int32_t j = 0; j < laneCount; j++)
+			{
+				lifes4[j] = lifes[i + j];
+			}
+
+			frames = frames / SIMD::Float4::Load4(lifes4) * SIMD::Float4(100.0f);
+		}
+
+		SIMD::Float4::Store4(values4, getValues4_(*this, frames - offset));
+
+		for (int32_t j = 0; j < laneCount; j++)
+		{
+			values[i + j] = values4[j];
+		}
 	}
 }
 
@@ -145,6 +344,8 @@ void FCurve::ChangeCoordinate()
 	offsetMax_ *= -1.0f;
 	offsetMin_ *= -1.0f;
 
+	CopyReferencedKeys();
+
 	for (size_t i = 0; i < keys_.size(); i++)
 	{
 		keys_[i] *= -1.0f;
@@ -153,9 +354,17 @@ void FCurve::ChangeCoordinate()
 
 void FCurve::Maginify(float value)
 {
+	// referenced keys are kept if they are not changed
+	if (value == 1.0f)
+	{
+		return;
+	}
+
 	offsetMax_ *= value;
 	offsetMin_ *= value;
 
+	CopyReferencedKeys();
+
 	for (size_t i = 0; i < keys_.size(); i++)
 	{
 		keys_[i] *= value;
@@ -186,6 +395,11 @@ float FCurveScalar::GetValues(float living, float life) const
 	return S.GetValue(living, life, Timeline);
 }
 
+void FCurveScalar::GetValues(const float* livings, const float* lifes, int32_t count, float* values) const
+{
+	S.GetValues(livings, lifes, count, Timeline, values);
+}
+
 float FCurveScalar::GetOffsets(IRandObject& g) const
 {
 	return S.GetOffset(g);
@@ -263,6 +477,13 @@ SIMD::Vec3f FCurveVector3D::GetValues(float living, float life) const
 	return {x, y, z};
 }
 
+void FCurveVector3D::GetValues(const float* livings, const float* lifes, int32_t count, float* xs, float* ys, float* zs) const
+{
+	X.GetValues(livings, lifes, count, Timeline, xs);
+	Y.GetValues(livings, lifes, count, Timeline, ys);
+	Z.GetValues(livings, lifes, count, Timeline, zs);
+}
+
 SIMD::Vec3f FCurveVector3D::GetOffsets(IRandObject& g) const
 {
 	auto x = X.GetOffset(g);
@@ -312,6 +533,14 @@ std::array<float, 4> FCurveVectorColor::GetValues(float living, float life) cons
 	return std::array<float, 4>{r, g, b, a};
 }
 
+void FCurveVectorColor::GetValues(const float* livings, const float* lifes, int32_t count, float* rs, float* gs, float* bs, float* as) const
+{
+	R.GetValues(livings, lifes, count, Timeline, rs);
+	G.GetValues(livings, lifes, count, Timeline, gs);
+	B.GetValues(livings, lifes, count, Timeline, bs);
+	A.GetValues(livings, lifes, count, Timeline, as);
+}
+
 std::array<float, 4> FCurveVectorColor::GetOffsets(IRandObject& gl) const
 {
 	auto r = R.GetOffset(gl);
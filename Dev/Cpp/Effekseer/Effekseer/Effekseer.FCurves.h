@@ -5,6 +5,7 @@
 #include "Effekseer.Base.h"
 #include "Effekseer.InternalStruct.h"
 #include "Effekseer.Random.h"
+#include "SIMD/Float4.h"
 #include "SIMD/Vec2f.h"
 #include "SIMD/Vec3f.h"
 
@@ -33,18 +34,51 @@ private:
 	int32_t freq_ = 0;
 	FCurveEdge start_ = FCurveEdge::Constant;
 	FCurveEdge end_ = FCurveEdge::Constant;
+	//! keys which are copied. It is empty if keys are referenced in data of a file
 	std::vector<float> keys_;
 
+	//! keys in data of a file which is kept by an effect
+	const float* referencedKeys_ = nullptr;
+
+	int32_t keyCount_ = 0;
+
 	float defaultValue_ = 0;
 	float offsetMax_ = 0;
 	float offsetMin_ = 0;
 
+	using GetValues4Func = SIMD::Float4 (*)(const FCurve& curve, const SIMD::Float4& frames);
+
+	//! a kernel which gets four values at once. It is selected by edges when a curve is loaded.
+	GetValues4Func getValues4_ = nullptr;
+
+	const float* GetKeys() const
+	{
+		return referencedKeys_ != nullptr ? referencedKeys_ : keys_.data();
+	}
+
+	//! copy keys which are referenced in data of a file to modify them
+	void CopyReferencedKeys();
+
+	//! get a value at a frame which an offset is subtracted from
+	float GetValueAtFrame(float frame) const;
+
+	//! get four values at frames which an offset is subtracted from
+	template <FCurveEdge START, FCurveEdge END>
+	static SIMD::Float4 GetValues4(const FCurve& curve, const SIMD::Float4& frames);
+
 public:
 	FCurve(float defaultValue);
 	int32_t Load(const void* data, int32_t version);
 
 	float GetValue(float living, float life, FCurveTimelineType type) const;
 
+	/**
+		@brief	get values at multiple times at once
+		@note
+		Results are the same as GetValue. Four values are calculated at once with a kernel for edges of the curve.
+	*/
+	void GetValues(const float* livings, const float* lifes, int32_t count, FCurveTimelineType type, float* values) const;
+
 	float GetOffset(IRandObject& g) const;
 
 	void SetDefaultValue(float value)
@@ -57,6 +91,26 @@ public:
 	void Maginify(float value);
 };
 
+/**
+	@brief	a scope in which keys of curves are referenced in data instead of being copied
+	@note
+	Data must be kept while the curves are alive. Keys are copied if they are not aligned or out of data.
+	A scope is valid on the thread which creates it because effects are loaded on multiple threads.
+*/
+class FCurveKeyReferenceScope
+{
+private:
+	const uint8_t* previousBegin_ = nullptr;
+	const uint8_t* previousEnd_ = nullptr;
+
+public:
+	FCurveKeyReferenceScope(const void* data, int32_t size);
+	~FCurveKeyReferenceScope();
+
+	FCurveKeyReferenceScope(const FCurveKeyReferenceScope&) = delete;
+	FCurveKeyReferenceScope& operator=(const FCurveKeyReferenceScope&) = delete;
+};
+
 class FCurveScalar
 {
 public:
@@ -66,6 +120,7 @@ public:
 	int32_t Load(const void* data, int32_t version);
 
 	float GetValues(float living, float life) const;
+	void GetValues(const float* livings, const float* lifes, int32_t count, float* values) const;
 	float GetOffsets(IRandObject& g) const;
 };
 
@@ -93,6 +148,10 @@ public:
 	int32_t Load(const void* data, int32_t version);
 
 	SIMD::Vec3f GetValues(float living, float life) const;
+
+	//! get values at multiple times at once as structure of arrays
+	void GetValues(const float* livings, const float* lifes, int32_t count, float* xs, float* ys, float* zs) const;
+
 	SIMD::Vec3f GetOffsets(IRandObject& g) const;
 };
 
@@ -108,6 +167,10 @@ public:
 	int32_t Load(const void* data, int32_t version);
 
 	std::array<float, 4> GetValues(float living, float life) const;
+
+	//! get values at multiple times at once as structure of arrays
+	void GetValues(const float* livings, const float* lifes, int32_t count, float* rs, float* gs, float* bs, float* as) const;
+
 	std::array<float, 4> GetOffsets(IRandObject& g) const;
 };
 
@@ -9,6 +9,7 @@
 #include "Effekseer.EffectNode.h"
 #include "Effekseer.InstanceContainer.h"
 #include "Effekseer.InstanceGlobal.h"
+#include "Effekseer.InstanceChunk.h"
 #include "Effekseer.InstanceGroup.h"
 #include "Effekseer.Manager.h"
 #include "Effekseer.ManagerImplemented.h"
@@ -23,12 +24,16 @@ namespace Effekseer
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
-Instance::Instance(ManagerImplemented* pManager, EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGroup* pGroup)
+Instance::Instance(ManagerImplemented* pManager,
+				   EffectNodeImplemented* pEffectNode,
+				   InstanceContainer* pContainer,
+				   InstanceGroup* pGroup,
+				   InstanceGroup* childrenGroups)
 	: m_pManager(pManager)
 	, m_pEffectNode(pEffectNode)
 	, m_pContainer(pContainer)
 	, ownGroup_(pGroup)
-	, childrenGroups_(nullptr)
+	, childrenGroups_(childrenGroups)
 	, m_pParent(nullptr)
 	, m_State(INSTANCE_STATE_ACTIVE)
 	, m_LivedTime(0)
@@ -49,11 +54,20 @@ Instance::Instance(ManagerImplemented* pManager, EffectNodeImplemented* pEffectN
 	ColorInheritance = Color(255, 255, 255, 255);
 	ColorParent = Color(255, 255, 255, 255);
 
+	for (auto& it : uvTimeOffsets)
+	{
+		it = 0;
+	}
+}
+
+InstanceGroup* Instance::CreateChildrenGroups(EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer)
+{
+	InstanceGroup* first = nullptr;
 	InstanceGroup* group = nullptr;
 
-	for (int i = 0; i < m_pEffectNode->GetChildrenCount(); i++)
+	for (int i = 0; i < pEffectNode->GetChildrenCount(); i++)
 	{
-		InstanceContainer* childContainer = m_pContainer->GetChild(i);
+		InstanceContainer* childContainer = pContainer->GetChild(i);
 
 		auto allocated = childContainer->CreateInstanceGroup();
 
@@ -71,14 +85,11 @@ Instance::Instance(ManagerImplemented* pManager, EffectNodeImplemented* pEffectN
 		else
 		{
 			group = allocated;
-			childrenGroups_ = group;
+			first = group;
 		}
 	}
 
-	for (auto& it : uvTimeOffsets)
-	{
-		it = 0;
-	}
+	return first;
 }
 
 //----------------------------------------------------------------------------------
@@ -106,7 +117,7 @@ Instance::~Instance()
 	}
 }
 
-void Instance::GenerateChildrenInRequired()
+void Instance::CollectChildrenInRequired(CustomVector<ChildGenerationRequest>& requests)
 {
 	if (m_State == INSTANCE_STATE_REMOVED)
 	{
@@ -133,50 +144,58 @@ void Instance::GenerateChildrenInRequired()
 			return;
 		}
 
-		while (true)
-		{
-			// GenerationTimeOffset can be minus value.
-			// Minus frame particles is generated simultaniously at frame 0.
-			if (maxGenerationChildrenCount[i] > m_generatedChildrenCount[i] && m_nextGenerationTime[i] <= currentTime)
-			{
-				// Create a particle
-				auto newInstance = group->CreateInstance();
-				if (newInstance != nullptr)
-				{
-					SIMD::Mat43f rootMatrix = SIMD::Mat43f::Identity;
-
-					newInstance->Initialize(this, m_generatedChildrenCount[i], rootMatrix);
-				}
-
-				m_generatedChildrenCount[i]++;
-
-				auto gt = ApplyEq(effect, instanceGlobal, m_pParent, &rand, node->CommonValues.RefEqGenerationTime, node->CommonValues.GenerationTime);
-				m_nextGenerationTime[i] += Max(0.0f, gt.getValue(rand));
-			}
-			else
-			{
-				break;
-			}
-		}
-
-		/*int32_t instanceNumberOffset = m_generatedChildrenCount[i];
-
 		// GenerationTimeOffset can be minus value.
 		// Minus frame particles is generated simultaniously at frame 0.
-		while (maxGenerationChildrenCount[i] > m_generatedChildrenCount[i] &&
-			m_nextGenerationTime[i] <= currentTime)
+		while (maxGenerationChildrenCount[i] > m_generatedChildrenCount[i] && m_nextGenerationTime[i] <= currentTime)
 		{
+			// Request a particle
+			ChildGenerationRequest request;
+			request.Parent = this;
+			request.Group = group;
+			request.InstanceNumber = m_generatedChildrenCount[i];
+			requests.push_back(request);
+
 			m_generatedChildrenCount[i]++;
 
-			auto gt = ApplyEq(node->CommonValues.RefEqGenerationTime, node->CommonValues.GenerationTime);
+			auto gt = ApplyEq(effect, instanceGlobal, m_pParent, &rand, node->CommonValues.RefEqGenerationTime, node->CommonValues.GenerationTime);
 			m_nextGenerationTime[i] += Max(0.0f, gt.getValue(rand));
 		}
+	}
+}
+
+void Instance::GenerateChild(const ChildGenerationRequest& request)
+{
+	// Create a particle
+	auto newInstance = request.Group->CreateInstance();
+	if (newInstance != nullptr)
+	{
+		newInstance->Initialize(request.Parent, request.InstanceNumber, SIMD::Mat43f::Identity);
+	}
+}
 
-		int32_t generatingCount = m_generatedChildrenCount[i] - instanceNumberOffset;
+bool Instance::ReserveChild(ChildGenerationRequest& request)
+{
+	request.Chunk = nullptr;
 
-		// Create instances
-		group->CreateInstances(instanceNumberOffset, generatingCount, m_LivingTime, m_GlobalMatrix43);*/
+	if (!request.Group->ReserveInstance(request.Chunk, request.ChunkIndex, request.ChildrenGroups))
+	{
+		return false;
 	}
+
+	// a seed is taken in the same order as GenerateChild
+	request.RandomSeed = request.Parent->GetInstanceGlobal()->GetRandObject().GetRandInt();
+	return true;
+}
+
+void Instance::GenerateReservedChild(const ChildGenerationRequest& request)
+{
+	if (request.Chunk == nullptr)
+	{
+		return;
+	}
+
+	auto newInstance = request.Group->ConstructReservedInstance(request.Chunk, request.ChunkIndex, request.ChildrenGroups);
+	newInstance->Initialize(request.Parent, request.InstanceNumber, SIMD::Mat43f::Identity, request.RandomSeed);
 }
 
 void Instance::UpdateChildrenGroupMatrix()
@@ -218,6 +237,14 @@ void Instance::Initialize(Instance* parent, int32_t instanceNumber, const SIMD::
 {
 	assert(this->m_pContainer != nullptr);
 
+	// Set random seed from InstanceGlobal's randomizer
+	Initialize(parent, instanceNumber, globalMatrix, this->m_pContainer->GetRootInstance()->GetRandObject().GetRandInt());
+}
+
+void Instance::Initialize(Instance* parent, int32_t instanceNumber, const SIMD::Mat43f& globalMatrix, int32_t randomSeed)
+{
+	assert(this->m_pContainer != nullptr);
+
 	// 状態の初期化
 	m_State = INSTANCE_STATE_ACTIVE;
 
@@ -235,10 +262,7 @@ void Instance::Initialize(Instance* parent, int32_t instanceNumber, const SIMD::
 
 	m_IsFirstTime = true;
 
-	auto instanceGlobal = this->m_pContainer->GetRootInstance();
-
-	// Set random seed from InstanceGlobal's randomizer
-	m_randObject.SetSeed(instanceGlobal->GetRandObject().GetRandInt());
+	m_randObject.SetSeed(randomSeed);
 
 	auto parameter = (EffectNodeImplemented*)m_pEffectNode;
 
@@ -376,7 +400,7 @@ void Instance::FirstUpdate()
 						   m_pEffectNode->TranslationPVA.location,
 						   m_pEffectNode->DynamicFactor.Tra,
 						   m_pEffectNode->DynamicFactor.TraInv);
-		translation_values.random.location = rvl.getValue(rand);
+		const auto location = rvl.getValue(rand);
 
 		auto rvv = ApplyEq(effect,
 						   instanceGlobal,
@@ -386,7 +410,7 @@ void Instance::FirstUpdate()
 						   m_pEffectNode->TranslationPVA.velocity,
 						   m_pEffectNode->DynamicFactor.Tra,
 						   m_pEffectNode->DynamicFactor.TraInv);
-		translation_values.random.velocity = rvv.getValue(rand);
+		const auto velocity = rvv.getValue(rand);
 
 		auto rva = ApplyEq(effect,
 						   instanceGlobal,
@@ -396,11 +420,13 @@ void Instance::FirstUpdate()
 						   m_pEffectNode->TranslationPVA.acceleration,
 						   m_pEffectNode->DynamicFactor.Tra,
 						   m_pEffectNode->DynamicFactor.TraInv);
-		translation_values.random.acceleration = rva.getValue(rand);
+		const auto acceleration = rva.getValue(rand);
+
+		ownChunk_->SetPVA(InstanceChunk::PVAType::Translation, chunkIndex_, location, velocity, acceleration);
 
-		prevPosition_ = translation_values.random.location;
+		prevPosition_ = location;
 
-		steeringVec_ = translation_values.random.velocity;
+		steeringVec_ = velocity;
 	}
 	else if (m_pEffectNode->TranslationType == ParameterTranslationType_Easing)
 	{
@@ -513,9 +539,10 @@ void Instance::FirstUpdate()
 						   m_pEffectNode->DynamicFactor.Rot,
 						   m_pEffectNode->DynamicFactor.RotInv);
 
-		rotation_values.random.rotation = rvl.getValue(rand);
-		rotation_values.random.velocity = rvv.getValue(rand);
-		rotation_values.random.acceleration = rva.getValue(rand);
+		const auto rotation = rvl.getValue(rand);
+		const auto velocity = rvv.getValue(rand);
+		const auto acceleration = rva.getValue(rand);
+		ownChunk_->SetPVA(InstanceChunk::PVAType::Rotation, chunkIndex_, rotation, velocity, acceleration);
 	}
 	else if (m_pEffectNode->RotationType == ParameterRotationType_Easing)
 	{
@@ -607,9 +634,10 @@ void Instance::FirstUpdate()
 						   m_pEffectNode->DynamicFactor.Scale,
 						   m_pEffectNode->DynamicFactor.ScaleInv);
 
-		scaling_values.random.scale = rvl.getValue(rand);
-		scaling_values.random.velocity = rvv.getValue(rand);
-		scaling_values.random.acceleration = rva.getValue(rand);
+		const auto scale = rvl.getValue(rand);
+		const auto velocity = rvv.getValue(rand);
+		const auto acceleration = rva.getValue(rand);
+		ownChunk_->SetPVA(InstanceChunk::PVAType::Scaling, chunkIndex_, scale, velocity, acceleration);
 	}
 	else if (m_pEffectNode->ScalingType == ParameterScalingType_Easing)
 	{
@@ -1286,20 +1314,29 @@ void Instance::CalculateMatrix(float deltaFrame)
 		}
 		else if (m_pEffectNode->TranslationType == ParameterTranslationType_PVA)
 		{
-			/* 現在位置 = 初期座標 + (初期速度 * t) + (初期加速度 * t * t * 0.5)*/
-			localPosition = translation_values.random.location + (translation_values.random.velocity * m_LivingTime) +
-							(translation_values.random.acceleration * (m_LivingTime * m_LivingTime * 0.5f));
+			// it is usually evaluated for all instances in the chunk in advance
+			localPosition = ownChunk_->GetPVA(InstanceChunk::PVAType::Translation, chunkIndex_, m_LivingTime);
 		}
 		else if (m_pEffectNode->TranslationType == ParameterTranslationType_Easing)
 		{
-			localPosition = m_pEffectNode->TranslationEasing.GetValue(translation_values.easing, m_LivingTime / m_LivedTime);
+			// it is usually evaluated for all instances in the chunk in advance
+			if (!ownChunk_->GetEvaluatedEasing(InstanceChunk::PVAType::Translation, chunkIndex_, m_LivingTime, localPosition))
+			{
+				localPosition = m_pEffectNode->TranslationEasing.GetValue(translation_values.easing, m_LivingTime / m_LivedTime);
+			}
 			//localPosition = m_pEffectNode->TranslationEasing.location.getValue(
 			//	translation_values.easing.start, translation_values.easing.end, m_LivingTime / m_LivedTime);
 		}
 		else if (m_pEffectNode->TranslationType == ParameterTranslationType_FCurve)
 		{
 			assert(m_pEffectNode->TranslationFCurve != nullptr);
-			auto fcurve = m_pEffectNode->TranslationFCurve->GetValues(m_LivingTime, m_LivedTime);
+
+			// it is usually evaluated for all instances in the chunk in advance
+			SIMD::Vec3f fcurve;
+			if (!ownChunk_->GetEvaluatedFCurve(InstanceChunk::PVAType::Translation, chunkIndex_, m_LivingTime, fcurve))
+			{
+				fcurve = m_pEffectNode->TranslationFCurve->GetValues(m_LivingTime, m_LivedTime);
+			}
 			localPosition = fcurve + translation_values.fcruve.offset;
 		}
 		else if (m_pEffectNode->TranslationType == ParameterTranslationType_NurbsCurve)
@@ -1386,96 +1423,99 @@ void Instance::CalculateMatrix(float deltaFrame)
 			localPosition += m_GenerationLocation.GetTranslation();
 		}
 
-		/* 回転の更新(時間から直接求めれるよう対応済み) */
-		if (m_pEffectNode->RotationType == ParameterRotationType_None)
-		{
-			localAngle = {0, 0, 0};
-		}
-		else if (m_pEffectNode->RotationType == ParameterRotationType_Fixed)
-		{
-			ApplyDynamicParameterToFixedRotation();
+		// rotations and scalings of common types are evaluated for all instances in the chunk in advance
+		SIMD::Mat43f rotationScaling;
+		const bool isRotationScalingEvaluated = ownChunk_->GetEvaluatedRotationScaling(chunkIndex_, m_LivingTime, rotationScaling);
 
-			localAngle = rotation_values.fixed.rotation;
-		}
-		else if (m_pEffectNode->RotationType == ParameterRotationType_PVA)
-		{
-			/* 現在位置 = 初期座標 + (初期速度 * t) + (初期加速度 * t * t * 0.5)*/
-			localAngle = rotation_values.random.rotation + (rotation_values.random.velocity * m_LivingTime) +
-						 (rotation_values.random.acceleration * (m_LivingTime * m_LivingTime * 0.5f));
-		}
-		else if (m_pEffectNode->RotationType == ParameterRotationType_Easing)
+		if (!isRotationScalingEvaluated)
 		{
-			localAngle = m_pEffectNode->RotationEasing.GetValue(rotation_values.easing, m_LivingTime / m_LivedTime);
-			/*
-			localAngle = m_pEffectNode->RotationEasing.rotation.getValue(
-				rotation_values.easing.start, rotation_values.easing.end, m_LivingTime / m_LivedTime);
-			*/
-		}
-		else if (m_pEffectNode->RotationType == ParameterRotationType_AxisPVA)
-		{
-			rotation_values.axis.rotation = rotation_values.axis.random.rotation + rotation_values.axis.random.velocity * m_LivingTime +
-											rotation_values.axis.random.acceleration * (m_LivingTime * m_LivingTime * 0.5f);
-		}
-		else if (m_pEffectNode->RotationType == ParameterRotationType_AxisEasing)
-		{
-			rotation_values.axis.rotation = m_pEffectNode->RotationAxisEasing.easing.getValue(
-				rotation_values.axis.easing.start, rotation_values.axis.easing.end, m_LivingTime / m_LivedTime);
-		}
-		else if (m_pEffectNode->RotationType == ParameterRotationType_FCurve)
-		{
-			assert(m_pEffectNode->RotationFCurve != nullptr);
-			auto fcurve = m_pEffectNode->RotationFCurve->GetValues(m_LivingTime, m_LivedTime);
-			localAngle = fcurve + rotation_values.fcruve.offset;
-		}
+			/* 回転の更新(時間から直接求めれるよう対応済み) */
+			if (m_pEffectNode->RotationType == ParameterRotationType_None)
+			{
+				localAngle = {0, 0, 0};
+			}
+			else if (m_pEffectNode->RotationType == ParameterRotationType_Fixed)
+			{
+				ApplyDynamicParameterToFixedRotation();
 
-		/* 拡大の更新(時間から直接求めれるよう対応済み) */
-		if (m_pEffectNode->ScalingType == ParameterScalingType_None)
-		{
-			localScaling = {1.0f, 1.0f, 1.0f};
-		}
-		else if (m_pEffectNode->ScalingType == ParameterScalingType_Fixed)
-		{
-			ApplyDynamicParameterToFixedScaling();
+				localAngle = rotation_values.fixed.rotation;
+			}
+			else if (m_pEffectNode->RotationType == ParameterRotationType_PVA)
+			{
+				localAngle = ownChunk_->GetPVA(InstanceChunk::PVAType::Rotation, chunkIndex_, m_LivingTime);
+			}
+			else if (m_pEffectNode->RotationType == ParameterRotationType_Easing)
+			{
+				localAngle = m_pEffectNode->RotationEasing.GetValue(rotation_values.easing, m_LivingTime / m_LivedTime);
+				/*
+				localAngle = m_pEffectNode->RotationEasing.rotation.getValue(
+					rotation_values.easing.start, rotation_values.easing.end, m_LivingTime / m_LivedTime);
+				*/
+			}
+			else if (m_pEffectNode->RotationType == ParameterRotationType_AxisPVA)
+			{
+				rotation_values.axis.rotation = rotation_values.axis.random.rotation + rotation_values.axis.random.velocity * m_LivingTime +
+												rotation_values.axis.random.acceleration * (m_LivingTime * m_LivingTime * 0.5f);
+			}
+			else if (m_pEffectNode->RotationType == ParameterRotationType_AxisEasing)
+			{
+				rotation_values.axis.rotation = m_pEffectNode->RotationAxisEasing.easing.getValue(
+					rotation_values.axis.easing.start, rotation_values.axis.easing.end, m_LivingTime / m_LivedTime);
+			}
+			else if (m_pEffectNode->RotationType == ParameterRotationType_FCurve)
+			{
+				assert(m_pEffectNode->RotationFCurve != nullptr);
+				auto fcurve = m_pEffectNode->RotationFCurve->GetValues(m_LivingTime, m_LivedTime);
+				localAngle = fcurve + rotation_values.fcruve.offset;
+			}
 
-			localScaling = scaling_values.fixed.scale;
-		}
-		else if (m_pEffectNode->ScalingType == ParameterScalingType_PVA)
-		{
-			/* 現在位置 = 初期座標 + (初期速度 * t) + (初期加速度 * t * t * 0.5)*/
-			localScaling = scaling_values.random.scale + (scaling_values.random.velocity * m_LivingTime) +
-						   (scaling_values.random.acceleration * (m_LivingTime * m_LivingTime * 0.5f));
-		}
-		else if (m_pEffectNode->ScalingType == ParameterScalingType_Easing)
-		{
-			localScaling = m_pEffectNode->ScalingEasing.GetValue(scaling_values.easing, m_LivingTime / m_LivedTime);
-			/*
-			localScaling = m_pEffectNode->ScalingEasing.Position.getValue(
-				scaling_values.easing.start, scaling_values.easing.end, m_LivingTime / m_LivedTime);
-			*/
-		}
-		else if (m_pEffectNode->ScalingType == ParameterScalingType_SinglePVA)
-		{
-			float s = scaling_values.single_random.scale + scaling_values.single_random.velocity * m_LivingTime +
-					  scaling_values.single_random.acceleration * m_LivingTime * m_LivingTime * 0.5f;
-			localScaling = {s, s, s};
-		}
-		else if (m_pEffectNode->ScalingType == ParameterScalingType_SingleEasing)
-		{
-			float s = m_pEffectNode->ScalingSingleEasing.getValue(
-				scaling_values.single_easing.start, scaling_values.single_easing.end, m_LivingTime / m_LivedTime);
-			localScaling = {s, s, s};
-		}
-		else if (m_pEffectNode->ScalingType == ParameterScalingType_FCurve)
-		{
-			assert(m_pEffectNode->ScalingFCurve != nullptr);
-			auto fcurve = m_pEffectNode->ScalingFCurve->GetValues(m_LivingTime, m_LivedTime);
-			localScaling = fcurve + scaling_values.fcruve.offset;
-		}
-		else if (m_pEffectNode->ScalingType == ParameterScalingType_SingleFCurve)
-		{
-			assert(m_pEffectNode->ScalingSingleFCurve != nullptr);
-			auto s = m_pEffectNode->ScalingSingleFCurve->GetValues(m_LivingTime, m_LivedTime) + scaling_values.single_fcruve.offset;
-			localScaling = {s, s, s};
+			/* 拡大の更新(時間から直接求めれるよう対応済み) */
+			if (m_pEffectNode->ScalingType == ParameterScalingType_None)
+			{
+				localScaling = {1.0f, 1.0f, 1.0f};
+			}
+			else if (m_pEffectNode->ScalingType == ParameterScalingType_Fixed)
+			{
+				ApplyDynamicParameterToFixedScaling();
+
+				localScaling = scaling_values.fixed.scale;
+			}
+			else if (m_pEffectNode->ScalingType == ParameterScalingType_PVA)
+			{
+				localScaling = ownChunk_->GetPVA(InstanceChunk::PVAType::Scaling, chunkIndex_, m_LivingTime);
+			}
+			else if (m_pEffectNode->ScalingType == ParameterScalingType_Easing)
+			{
+				localScaling = m_pEffectNode->ScalingEasing.GetValue(scaling_values.easing, m_LivingTime / m_LivedTime);
+				/*
+				localScaling = m_pEffectNode->ScalingEasing.Position.getValue(
+					scaling_values.easing.start, scaling_values.easing.end, m_LivingTime / m_LivedTime);
+				*/
+			}
+			else if (m_pEffectNode->ScalingType == ParameterScalingType_SinglePVA)
+			{
+				float s = scaling_values.single_random.scale + scaling_values.single_random.velocity * m_LivingTime +
+						  scaling_values.single_random.acceleration * m_LivingTime * m_LivingTime * 0.5f;
+				localScaling = {s, s, s};
+			}
+			else if (m_pEffectNode->ScalingType == ParameterScalingType_SingleEasing)
+			{
+				float s = m_pEffectNode->ScalingSingleEasing.getValue(
+					scaling_values.single_easing.start, scaling_values.single_easing.end, m_LivingTime / m_LivedTime);
+				localScaling = {s, s, s};
+			}
+			else if (m_pEffectNode->ScalingType == ParameterScalingType_FCurve)
+			{
+				assert(m_pEffectNode->ScalingFCurve != nullptr);
+				auto fcurve = m_pEffectNode->ScalingFCurve->GetValues(m_LivingTime, m_LivedTime);
+				localScaling = fcurve + scaling_values.fcruve.offset;
+			}
+			else if (m_pEffectNode->ScalingType == ParameterScalingType_SingleFCurve)
+			{
+				assert(m_pEffectNode->ScalingSingleFCurve != nullptr);
+				auto s = m_pEffectNode->ScalingSingleFCurve->GetValues(m_LivingTime, m_LivedTime) + scaling_values.single_fcruve.offset;
+				localScaling = {s, s, s};
+			}
 		}
 
 		// update local fields
@@ -1501,29 +1541,35 @@ void Instance::CalculateMatrix(float deltaFrame)
 		/* 描画部分の更新 */
 		m_pEffectNode->UpdateRenderedInstance(*this, m_pManager);
 
-		// 回転行列の作成
-		SIMD::Mat43f MatRot;
-		if (m_pEffectNode->RotationType == ParameterRotationType_Fixed || m_pEffectNode->RotationType == ParameterRotationType_PVA ||
-			m_pEffectNode->RotationType == ParameterRotationType_Easing || m_pEffectNode->RotationType == ParameterRotationType_FCurve)
-		{
-			MatRot = SIMD::Mat43f::RotationZXY(localAngle.GetZ(), localAngle.GetX(), localAngle.GetY());
-		}
-		else if (m_pEffectNode->RotationType == ParameterRotationType_AxisPVA ||
-				 m_pEffectNode->RotationType == ParameterRotationType_AxisEasing)
+		if (!isRotationScalingEvaluated)
 		{
-			SIMD::Vec3f axis = rotation_values.axis.axis;
+			// 回転行列の作成
+			SIMD::Mat43f MatRot;
+			if (m_pEffectNode->RotationType == ParameterRotationType_Fixed || m_pEffectNode->RotationType == ParameterRotationType_PVA ||
+				m_pEffectNode->RotationType == ParameterRotationType_Easing || m_pEffectNode->RotationType == ParameterRotationType_FCurve)
+			{
+				MatRot = SIMD::Mat43f::RotationZXY(localAngle.GetZ(), localAngle.GetX(), localAngle.GetY());
+			}
+			else if (m_pEffectNode->RotationType == ParameterRotationType_AxisPVA ||
+					 m_pEffectNode->RotationType == ParameterRotationType_AxisEasing)
+			{
+				SIMD::Vec3f axis = rotation_values.axis.axis;
 
-			MatRot = SIMD::Mat43f::RotationAxis(axis, rotation_values.axis.rotation);
-		}
-		else
-		{
-			MatRot = SIMD::Mat43f::Identity;
+				MatRot = SIMD::Mat43f::RotationAxis(axis, rotation_values.axis.rotation);
+			}
+			else
+			{
+				MatRot = SIMD::Mat43f::Identity;
+			}
+
+			rotationScaling = SIMD::Mat43f::SRT(localScaling, MatRot, SIMD::Vec3f(0.0f, 0.0f, 0.0f));
 		}
 
 		// Update matrix
 		if (m_pEffectNode->GenerationLocation.EffectsRotation)
 		{
-			m_GlobalMatrix43 = SIMD::Mat43f::SRT(localScaling, MatRot, localPosition);
+			m_GlobalMatrix43 = rotationScaling;
+			m_GlobalMatrix43.SetTranslation(localPosition);
 			assert(m_GlobalMatrix43.IsValid());
 
 			m_GlobalMatrix43 *= m_GenerationLocation;
@@ -1535,7 +1581,8 @@ void Instance::CalculateMatrix(float deltaFrame)
 		{
 			localPosition += forceField_.ModifyLocation;
 
-			m_GlobalMatrix43 = SIMD::Mat43f::SRT(localScaling, MatRot, localPosition);
+			m_GlobalMatrix43 = rotationScaling;
+			m_GlobalMatrix43.SetTranslation(localPosition);
 			assert(m_GlobalMatrix43.IsValid());
 		}
 
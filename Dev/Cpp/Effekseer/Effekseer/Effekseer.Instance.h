@@ -25,6 +25,7 @@
 #include "Effekseer.EffectNodeSprite.h"
 #include "Effekseer.EffectNodeTrack.h"
 #include "ForceField/ForceFields.h"
+#include "Utils/Effekseer.CustomAllocator.h"
 
 //----------------------------------------------------------------------------------
 //
@@ -59,6 +60,32 @@ struct InstanceCustomData
 	};
 };
 
+/**
+	@brief	a request to generate a child
+	@note
+	Requests are collected on worker threads. Memory, children groups and a random seed of a child
+	are reserved on one thread in order because they consume shared pools and a random sequence of InstanceGlobal.
+	Then children are constructed and initialized on worker threads.
+*/
+struct ChildGenerationRequest
+{
+	Instance* Parent;
+	InstanceGroup* Group;
+	int32_t InstanceNumber;
+
+	//! a chunk where a child is constructed (null if it is not reserved)
+	InstanceChunk* Chunk;
+
+	//! an index of a child in Chunk
+	int32_t ChunkIndex;
+
+	//! groups of children of a child
+	InstanceGroup* ChildrenGroups;
+
+	//! a random seed of a child
+	int32_t RandomSeed;
+};
+
 /**
 	@brief	エフェクトの実体
 */
@@ -94,6 +121,10 @@ public:
 	// 自分が所属するグループ
 	InstanceGroup* ownGroup_;
 
+	//! a chunk which the instance is allocated in and an index in it
+	InstanceChunk* ownChunk_ = nullptr;
+	int32_t chunkIndex_ = 0;
+
 	// a head of list in children group
 	// 子グループの連結リストの先頭
 	InstanceGroup* childrenGroups_;
@@ -125,12 +156,7 @@ public:
 			SIMD::Vec3f location;
 		} fixed;
 
-		struct
-		{
-			SIMD::Vec3f location;
-			SIMD::Vec3f velocity;
-			SIMD::Vec3f acceleration;
-		} random;
+		// PVA is stored in InstanceChunk as structure of arrays
 
 		InstanceEasing<SIMD::Vec3f> easing;
 		/*
@@ -160,12 +186,7 @@ public:
 			SIMD::Vec3f rotation;
 		} fixed;
 
-		struct
-		{
-			SIMD::Vec3f rotation;
-			SIMD::Vec3f velocity;
-			SIMD::Vec3f acceleration;
-		} random;
+		// PVA is stored in InstanceChunk as structure of arrays
 
 		InstanceEasing<SIMD::Vec3f> easing;
 		/*
@@ -212,12 +233,7 @@ public:
 			SIMD::Vec3f scale;
 		} fixed;
 
-		struct
-		{
-			SIMD::Vec3f scale;
-			SIMD::Vec3f velocity;
-			SIMD::Vec3f acceleration;
-		} random;
+		// PVA is stored in InstanceChunk as structure of arrays
 
 		InstanceEasing<SIMD::Vec3f> easing;
 
@@ -370,13 +386,42 @@ public:
 
 	float m_AlphaThreshold;
 
-	// コンストラクタ
-	Instance(ManagerImplemented* pManager, EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGroup* pGroup);
+	/**
+		@brief	コンストラクタ
+		@param	childrenGroups	[in]	groups of children which are created with CreateChildrenGroups
+	*/
+	Instance(ManagerImplemented* pManager,
+			 EffectNodeImplemented* pEffectNode,
+			 InstanceContainer* pContainer,
+			 InstanceGroup* pGroup,
+			 InstanceGroup* childrenGroups);
+
+	//! create groups of children in containers of children and return the first group
+	static InstanceGroup* CreateChildrenGroups(EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer);
 
 	// デストラクタ
 	virtual ~Instance();
 
-	void GenerateChildrenInRequired();
+	//! collect requests to generate children whose generation time has come
+	void CollectChildrenInRequired(CustomVector<ChildGenerationRequest>& requests);
+
+	//! generate a child which is requested
+	static void GenerateChild(const ChildGenerationRequest& request);
+
+	/**
+		@brief	reserve memory, children groups and a random seed of a child which is requested
+		@return	false if memory is lacked
+		@note
+		Requests must be reserved in order on one thread.
+	*/
+	static bool ReserveChild(ChildGenerationRequest& request);
+
+	/**
+		@brief	construct and initialize a child which is reserved with ReserveChild
+		@note
+		Children of the same group must be generated on the same thread in order of reserving.
+	*/
+	static void GenerateReservedChild(const ChildGenerationRequest& request);
 
 	void UpdateChildrenGroupMatrix();
 
@@ -403,6 +448,9 @@ public:
 	*/
 	void Initialize(Instance* parent, int32_t instanceNumber, const SIMD::Mat43f& globalMatrix);
 
+	//! initialize with a random seed instead of a random sequence of InstanceGlobal
+	void Initialize(Instance* parent, int32_t instanceNumber, const SIMD::Mat43f& globalMatrix, int32_t randomSeed);
+
 	/**
 		@brief	初回の更新
 	*/
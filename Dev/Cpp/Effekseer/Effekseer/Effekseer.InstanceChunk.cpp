@@ -1,7 +1,9 @@
 ﻿
 
 #include "Effekseer.InstanceChunk.h"
+#include "Effekseer.EffectNode.h"
 #include "Effekseer.InstanceGlobal.h"
+#include "SIMD/Utils.h"
 #include <assert.h>
 
 namespace Effekseer
@@ -10,6 +12,45 @@ namespace Effekseer
 InstanceChunk::InstanceChunk()
 {
 	std::fill(instancesAlive_.begin(), instancesAlive_.end(), false);
+
+	for (auto& pva : pvas_)
+	{
+		pva.Value.Fill(0.0f);
+		pva.Velocity.Fill(0.0f);
+		pva.Acceleration.Fill(0.0f);
+	}
+
+	for (auto& evaluated : evaluatedPVAs_)
+	{
+		evaluated.Fill(0.0f);
+	}
+
+	for (auto& evaluated : evaluatedFCurves_)
+	{
+		evaluated.Fill(0.0f);
+	}
+
+	for (auto& evaluated : evaluatedColorFCurves_)
+	{
+		evaluated.fill(0.0f);
+	}
+
+	for (auto& evaluated : evaluatedEasings_)
+	{
+		evaluated.Fill(0.0f);
+	}
+
+	evaluatedTimes_.fill(-1.0f);
+	rotationScalings_.Angle.Fill(0.0f);
+	rotationScalings_.Scaling.Fill(0.0f);
+	std::fill(rotationScalings_.IdentityMask, rotationScalings_.IdentityMask + InstancesOfChunk, 0);
+
+	for (auto& row : rotationScalings_.Rows)
+	{
+		row.Fill(0.0f);
+	}
+
+	rotationScalingEvaluated_.fill(false);
 }
 
 InstanceChunk::~InstanceChunk()
@@ -18,6 +59,8 @@ InstanceChunk::~InstanceChunk()
 
 void InstanceChunk::UpdateInstances()
 {
+	EvaluateLocalMatrices(nullptr);
+
 	for (int32_t i = 0; i < InstancesOfChunk; i++)
 	{
 		if (instancesAlive_[i])
@@ -45,7 +88,7 @@ void InstanceChunk::UpdateInstances()
 	}
 }
 
-void InstanceChunk::GenerateChildrenInRequired()
+void InstanceChunk::CollectChildrenInRequired(CustomVector<ChildGenerationRequest>& requests)
 {
 	for (int32_t i = 0; i < InstancesOfChunk; i++)
 	{
@@ -53,13 +96,15 @@ void InstanceChunk::GenerateChildrenInRequired()
 		{
 			Instance* instance = reinterpret_cast<Instance*>(instances_[i]);
 
-			instance->GenerateChildrenInRequired();
+			instance->CollectChildrenInRequired(requests);
 		}
 	}
 }
 
 void InstanceChunk::UpdateInstancesByInstanceGlobal(const InstanceGlobal* global)
 {
+	EvaluateLocalMatrices(global);
+
 	for (int32_t i = 0; i < InstancesOfChunk; i++)
 	{
 		if (instancesAlive_[i])
@@ -91,7 +136,7 @@ void InstanceChunk::UpdateInstancesByInstanceGlobal(const InstanceGlobal* global
 	}
 }
 
-void InstanceChunk::GenerateChildrenInRequiredByInstanceGlobal(const InstanceGlobal* global)
+void InstanceChunk::CollectChildrenInRequiredByInstanceGlobal(const InstanceGlobal* global, CustomVector<ChildGenerationRequest>& requests)
 {
 	for (int32_t i = 0; i < InstancesOfChunk; i++)
 	{
@@ -104,12 +149,23 @@ void InstanceChunk::GenerateChildrenInRequiredByInstanceGlobal(const InstanceGlo
 				continue;
 			}
 
-			instance->GenerateChildrenInRequired();
+			instance->CollectChildrenInRequired(requests);
 		}
 	}
 }
 
 Instance* InstanceChunk::CreateInstance(ManagerImplemented* pManager, EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGroup* pGroup)
+{
+	const auto index = ReserveInstance();
+	if (index < 0)
+	{
+		return nullptr;
+	}
+
+	return ConstructInstance(index, pManager, pEffectNode, pContainer, pGroup, Instance::CreateChildrenGroups(pEffectNode, pContainer));
+}
+
+int32_t InstanceChunk::ReserveInstance()
 {
 	for (int32_t i = 0; i < InstancesOfChunk; i++)
 	{
@@ -117,10 +173,480 @@ Instance* InstanceChunk::CreateInstance(ManagerImplemented* pManager, EffectNode
 		{
 			instancesAlive_[i] = true;
 			aliveCount_++;
-			return new (instances_[i]) Instance(pManager, pEffectNode, pContainer, pGroup);
+			return i;
+		}
+	}
+	return -1;
+}
+
+Instance* InstanceChunk::ConstructInstance(int32_t index,
+										   ManagerImplemented* pManager,
+										   EffectNodeImplemented* pEffectNode,
+										   InstanceContainer* pContainer,
+										   InstanceGroup* pGroup,
+										   InstanceGroup* childrenGroups)
+{
+	assert(instancesAlive_[index]);
+
+	evaluatedTimes_[index] = -1.0f;
+	rotationScalingEvaluated_[index] = false;
+
+	auto instance = new (instances_[index]) Instance(pManager, pEffectNode, pContainer, pGroup, childrenGroups);
+	instance->ownChunk_ = this;
+	instance->chunkIndex_ = index;
+	return instance;
+}
+
+void InstanceChunk::SetPVA(PVAType type, int32_t index, const SIMD::Vec3f& value, const SIMD::Vec3f& velocity, const SIMD::Vec3f& acceleration)
+{
+	auto& pva = pvas_[static_cast<int32_t>(type)];
+	pva.Value.Set(index, value);
+	pva.Velocity.Set(index, velocity);
+	pva.Acceleration.Set(index, acceleration);
+	evaluatedTimes_[index] = -1.0f;
+	rotationScalingEvaluated_[index] = false;
+}
+
+SIMD::Vec3f InstanceChunk::GetPVA(PVAType type, int32_t index, float livingTime) const
+{
+	if (evaluatedTimes_[index] == livingTime)
+	{
+		return evaluatedPVAs_[static_cast<int32_t>(type)].Get(index);
+	}
+
+	// 現在値 = 初期値 + (初期速度 * t) + (初期加速度 * t * t * 0.5)
+	const auto& pva = pvas_[static_cast<int32_t>(type)];
+	return pva.Value.Get(index) + (pva.Velocity.Get(index) * livingTime) +
+		   (pva.Acceleration.Get(index) * (livingTime * livingTime * 0.5f));
+}
+
+bool InstanceChunk::GetEvaluatedRotationScaling(int32_t index, float livingTime, SIMD::Mat43f& matrix) const
+{
+	if (!rotationScalingEvaluated_[index] || evaluatedTimes_[index] != livingTime)
+	{
+		return false;
+	}
+
+	const auto& rows = rotationScalings_.Rows;
+	matrix.X = SIMD::Float4(rows[0].X[index], rows[0].Y[index], rows[0].Z[index], 0.0f);
+	matrix.Y = SIMD::Float4(rows[1].X[index], rows[1].Y[index], rows[1].Z[index], 0.0f);
+	matrix.Z = SIMD::Float4(rows[2].X[index], rows[2].Y[index], rows[2].Z[index], 0.0f);
+	return true;
+}
+
+bool InstanceChunk::GetEvaluatedFCurve(PVAType type, int32_t index, float livingTime, SIMD::Vec3f& value) const
+{
+	if (evaluatedTimes_[index] != livingTime)
+	{
+		return false;
+	}
+
+	value = evaluatedFCurves_[static_cast<int32_t>(type)].Get(index);
+	return true;
+}
+
+bool InstanceChunk::GetEvaluatedColorFCurve(int32_t index, float livingTime, std::array<float, 4>& value) const
+{
+	if (evaluatedTimes_[index] != livingTime)
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < value.size(); i++)
+	{
+		value[i] = evaluatedColorFCurves_[i][index];
+	}
+	return true;
+}
+
+bool InstanceChunk::GetEvaluatedEasing(PVAType type, int32_t index, float livingTime, SIMD::Vec3f& value) const
+{
+	if (evaluatedTimes_[index] != livingTime)
+	{
+		return false;
+	}
+
+	value = evaluatedEasings_[static_cast<int32_t>(type)].Get(index);
+	return true;
+}
+
+void InstanceChunk::EvaluateLocalMatrices(const InstanceGlobal* global)
+{
+	bool hasEvaluated = false;
+
+	// predict times which instances are going to have in Instance::Update
+	for (int32_t i = 0; i < InstancesOfChunk; i++)
+	{
+		evaluatedTimes_[i] = -1.0f;
+		rotationScalingEvaluated_[i] = false;
+
+		if (!instancesAlive_[i])
+		{
+			continue;
+		}
+
+		Instance* instance = reinterpret_cast<Instance*>(instances_[i]);
+
+		if (instance->m_State != INSTANCE_STATE_ACTIVE || instance->IsFirstTime() ||
+			instance->m_pEffectNode->GetType() == EFFECT_NODE_TYPE_ROOT)
+		{
+			continue;
+		}
+
+		if (global != nullptr && global != instance->GetInstanceGlobal())
+		{
+			continue;
+		}
+
+		float livingTime = instance->m_LivingTime;
+
+		if (instance->is_time_step_allowed)
+		{
+			livingTime += instance->GetInstanceGlobal()->GetNextDeltaFrame();
+		}
+
+		evaluatedTimes_[i] = livingTime;
+		hasEvaluated = true;
+	}
+
+	if (!hasEvaluated)
+	{
+		return;
+	}
+
+	for (int32_t i = 0; i < static_cast<int32_t>(PVAType::Max); i++)
+	{
+		InstanceChunkKernel::EvaluatePVA(pvas_[i], evaluatedTimes_.data(), evaluatedPVAs_[i]);
+	}
+
+	EvaluateFCurves();
+
+	EvaluateEasings();
+
+	bool hasRotationScaling = false;
+
+	for (int32_t i = 0; i < InstancesOfChunk; i++)
+	{
+		if (evaluatedTimes_[i] < 0.0f)
+		{
+			continue;
+		}
+
+		Instance* instance = reinterpret_cast<Instance*>(instances_[i]);
+		SIMD::Vec3f angle;
+		SIMD::Vec3f scaling;
+
+		if (GetLocalRotationScaling(instance, i, evaluatedTimes_[i], angle, scaling))
+		{
+			rotationScalings_.Angle.Set(i, angle);
+			rotationScalings_.Scaling.Set(i, scaling);
+			rotationScalings_.IdentityMask[i] = instance->m_pEffectNode->RotationType == ParameterRotationType_None ? 0xFFFFFFFF : 0;
+			rotationScalingEvaluated_[i] = true;
+			hasRotationScaling = true;
+		}
+	}
+
+	if (hasRotationScaling)
+	{
+		InstanceChunkKernel::EvaluateRotationScaling(rotationScalings_);
+	}
+}
+
+/**
+	@brief	call a function for each group of instances which share the same curve or easing
+	@param	curves	[in,out]	curves of instances. nullptr if an instance doesn't use a curve. They are cleared
+	@param	func	[in]	a function which is called with a curve, indexes of instances and the number of them
+*/
+template <typename CURVE, typename FUNC>
+static void ForEachCurveGroup(std::array<const CURVE*, InstanceChunk::InstancesOfChunk>& curves, const FUNC& func)
+{
+	std::array<int32_t, InstanceChunk::InstancesOfChunk> indexes;
+
+	for (int32_t i = 0; i < InstanceChunk::InstancesOfChunk; i++)
+	{
+		const auto curve = curves[i];
+		if (curve == nullptr)
+		{
+			continue;
+		}
+
+		int32_t count = 0;
+		for (int32_t j = i; j < InstanceChunk::InstancesOfChunk; j++)
+		{
+			if (curves[j] == curve)
+			{
+				indexes[count] = j;
+				curves[j] = nullptr;
+				count++;
+			}
+		}
+
+		func(curve, indexes.data(), count);
+	}
+}
+
+void InstanceChunk::EvaluateFCurves()
+{
+	std::array<const FCurveVector3D*, InstancesOfChunk> vectorCurves[static_cast<int32_t>(PVAType::Max)];
+	std::array<const FCurveScalar*, InstancesOfChunk> singleScalingCurves;
+	std::array<const FCurveVectorColor*, InstancesOfChunk> colorCurves;
+	std::array<float, InstancesOfChunk> livedTimes;
+	bool hasCurve = false;
+
+	for (int32_t i = 0; i < InstancesOfChunk; i++)
+	{
+		for (auto& curves : vectorCurves)
+		{
+			curves[i] = nullptr;
+		}
+		singleScalingCurves[i] = nullptr;
+		colorCurves[i] = nullptr;
+		livedTimes[i] = 0.0f;
+
+		if (evaluatedTimes_[i] < 0.0f)
+		{
+			continue;
+		}
+
+		Instance* instance = reinterpret_cast<Instance*>(instances_[i]);
+		const auto node = instance->m_pEffectNode;
+		livedTimes[i] = instance->m_LivedTime;
+
+		if (node->TranslationType == ParameterTranslationType_FCurve)
+		{
+			vectorCurves[static_cast<int32_t>(PVAType::Translation)][i] = node->TranslationFCurve;
+		}
+
+		if (node->RotationType == ParameterRotationType_FCurve)
+		{
+			vectorCurves[static_cast<int32_t>(PVAType::Rotation)][i] = node->RotationFCurve;
+		}
+
+		if (node->ScalingType == ParameterScalingType_FCurve)
+		{
+			vectorCurves[static_cast<int32_t>(PVAType::Scaling)][i] = node->ScalingFCurve;
 		}
+		else if (node->ScalingType == ParameterScalingType_SingleFCurve)
+		{
+			singleScalingCurves[i] = node->ScalingSingleFCurve;
+		}
+
+		colorCurves[i] = node->GetAllColorFCurve();
+
+		hasCurve |= node->TranslationType == ParameterTranslationType_FCurve || node->RotationType == ParameterRotationType_FCurve ||
+					node->ScalingType == ParameterScalingType_FCurve || node->ScalingType == ParameterScalingType_SingleFCurve ||
+					colorCurves[i] != nullptr;
 	}
-	return nullptr;
+
+	if (!hasCurve)
+	{
+		return;
+	}
+
+	alignas(32) std::array<float, InstancesOfChunk> livings;
+	alignas(32) std::array<float, InstancesOfChunk> lifes;
+	alignas(32) std::array<float, InstancesOfChunk> values[4];
+
+	const auto gather = [&](const int32_t* indexes, int32_t count) {
+		for (int32_t i = 0; i < count; i++)
+		{
+			livings[i] = evaluatedTimes_[indexes[i]];
+			lifes[i] = livedTimes[indexes[i]];
+		}
+	};
+
+	for (int32_t type = 0; type < static_cast<int32_t>(PVAType::Max); type++)
+	{
+		auto& evaluated = evaluatedFCurves_[type];
+
+		ForEachCurveGroup(vectorCurves[type], [&](const FCurveVector3D* curve, const int32_t* indexes, int32_t count) {
+			gather(indexes, count);
+			curve->GetValues(livings.data(), lifes.data(), count, values[0].data(), values[1].data(), values[2].data());
+
+			for (int32_t i = 0; i < count; i++)
+			{
+				evaluated.X[indexes[i]] = values[0][i];
+				evaluated.Y[indexes[i]] = values[1][i];
+				evaluated.Z[indexes[i]] = values[2][i];
+			}
+		});
+	}
+
+	auto& evaluatedScaling = evaluatedFCurves_[static_cast<int32_t>(PVAType::Scaling)];
+
+	ForEachCurveGroup(singleScalingCurves, [&](const FCurveScalar* curve, const int32_t* indexes, int32_t count) {
+		gather(indexes, count);
+		curve->GetValues(livings.data(), lifes.data(), count, values[0].data());
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			evaluatedScaling.X[indexes[i]] = values[0][i];
+		}
+	});
+
+	ForEachCurveGroup(colorCurves, [&](const FCurveVectorColor* curve, const int32_t* indexes, int32_t count) {
+		gather(indexes, count);
+		curve->GetValues(livings.data(), lifes.data(), count, values[0].data(), values[1].data(), values[2].data(), values[3].data());
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			for (size_t c = 0; c < evaluatedColorFCurves_.size(); c++)
+			{
+				evaluatedColorFCurves_[c][indexes[i]] = values[c][i];
+			}
+		}
+	});
+}
+
+void InstanceChunk::EvaluateEasings()
+{
+	std::array<const ParameterEasingSIMDVec3*, InstancesOfChunk> easings[static_cast<int32_t>(PVAType::Max)];
+	std::array<const InstanceEasing<SIMD::Vec3f>*, InstancesOfChunk> instanceEasings[static_cast<int32_t>(PVAType::Max)];
+	bool hasEasing = false;
+
+	for (int32_t i = 0; i < InstancesOfChunk; i++)
+	{
+		for (auto& e : easings)
+		{
+			e[i] = nullptr;
+		}
+
+		if (evaluatedTimes_[i] < 0.0f)
+		{
+			continue;
+		}
+
+		Instance* instance = reinterpret_cast<Instance*>(instances_[i]);
+		const auto node = instance->m_pEffectNode;
+
+		if (node->TranslationType == ParameterTranslationType_Easing)
+		{
+			easings[static_cast<int32_t>(PVAType::Translation)][i] = &node->TranslationEasing;
+			instanceEasings[static_cast<int32_t>(PVAType::Translation)][i] = &instance->translation_values.easing;
+			hasEasing = true;
+		}
+
+		if (node->RotationType == ParameterRotationType_Easing)
+		{
+			easings[static_cast<int32_t>(PVAType::Rotation)][i] = &node->RotationEasing;
+			instanceEasings[static_cast<int32_t>(PVAType::Rotation)][i] = &instance->rotation_values.easing;
+			hasEasing = true;
+		}
+
+		if (node->ScalingType == ParameterScalingType_Easing)
+		{
+			easings[static_cast<int32_t>(PVAType::Scaling)][i] = &node->ScalingEasing;
+			instanceEasings[static_cast<int32_t>(PVAType::Scaling)][i] = &instance->scaling_values.easing;
+			hasEasing = true;
+		}
+	}
+
+	if (!hasEasing)
+	{
+		return;
+	}
+
+	std::array<const InstanceEasing<SIMD::Vec3f>*, InstancesOfChunk> gatheredInstances;
+	std::array<float, InstancesOfChunk> times;
+	std::array<SIMD::Vec3f, InstancesOfChunk> values;
+
+	for (int32_t type = 0; type < static_cast<int32_t>(PVAType::Max); type++)
+	{
+		auto& evaluated = evaluatedEasings_[type];
+
+		ForEachCurveGroup(easings[type], [&](const ParameterEasingSIMDVec3* easing, const int32_t* indexes, int32_t count) {
+			for (int32_t i = 0; i < count; i++)
+			{
+				// the same time as Instance::CalculateMatrix
+				const auto index = indexes[i];
+				gatheredInstances[i] = instanceEasings[type][index];
+				times[i] = evaluatedTimes_[index] / reinterpret_cast<Instance*>(instances_[index])->m_LivedTime;
+			}
+
+			easing->GetValues(gatheredInstances.data(), times.data(), count, values.data());
+
+			for (int32_t i = 0; i < count; i++)
+			{
+				evaluated.Set(indexes[i], values[i]);
+			}
+		});
+	}
+}
+
+bool InstanceChunk::GetLocalRotationScaling(Instance* instance, int32_t index, float livingTime, SIMD::Vec3f& angle, SIMD::Vec3f& scaling) const
+{
+	// the same values as Instance::CalculateMatrix
+	const auto node = instance->m_pEffectNode;
+	const float normalizedTime = livingTime / instance->m_LivedTime;
+
+	if (node->RotationType == ParameterRotationType_None)
+	{
+		angle = {0, 0, 0};
+	}
+	else if (node->RotationType == ParameterRotationType_Fixed && node->RotationFixed.RefEq < 0)
+	{
+		angle = instance->rotation_values.fixed.rotation;
+	}
+	else if (node->RotationType == ParameterRotationType_PVA)
+	{
+		angle = evaluatedPVAs_[static_cast<int32_t>(PVAType::Rotation)].Get(index);
+	}
+	else if (node->RotationType == ParameterRotationType_Easing)
+	{
+		angle = evaluatedEasings_[static_cast<int32_t>(PVAType::Rotation)].Get(index);
+	}
+	else if (node->RotationType == ParameterRotationType_FCurve)
+	{
+		angle = evaluatedFCurves_[static_cast<int32_t>(PVAType::Rotation)].Get(index) + instance->rotation_values.fcruve.offset;
+	}
+	else
+	{
+		return false;
+	}
+
+	if (node->ScalingType == ParameterScalingType_None)
+	{
+		scaling = {1.0f, 1.0f, 1.0f};
+	}
+	else if (node->ScalingType == ParameterScalingType_Fixed && node->ScalingFixed.RefEq < 0)
+	{
+		scaling = instance->scaling_values.fixed.scale;
+	}
+	else if (node->ScalingType == ParameterScalingType_PVA)
+	{
+		scaling = evaluatedPVAs_[static_cast<int32_t>(PVAType::Scaling)].Get(index);
+	}
+	else if (node->ScalingType == ParameterScalingType_Easing)
+	{
+		scaling = evaluatedEasings_[static_cast<int32_t>(PVAType::Scaling)].Get(index);
+	}
+	else if (node->ScalingType == ParameterScalingType_SinglePVA)
+	{
+		const auto& values = instance->scaling_values.single_random;
+		float s = values.scale + values.velocity * livingTime + values.acceleration * livingTime * livingTime * 0.5f;
+		scaling = {s, s, s};
+	}
+	else if (node->ScalingType == ParameterScalingType_SingleEasing)
+	{
+		const auto& values = instance->scaling_values.single_easing;
+		float s = node->ScalingSingleEasing.getValue(values.start, values.end, normalizedTime);
+		scaling = {s, s, s};
+	}
+	else if (node->ScalingType == ParameterScalingType_FCurve)
+	{
+		scaling = evaluatedFCurves_[static_cast<int32_t>(PVAType::Scaling)].Get(index) + instance->scaling_values.fcruve.offset;
+	}
+	else if (node->ScalingType == ParameterScalingType_SingleFCurve)
+	{
+		float s = evaluatedFCurves_[static_cast<int32_t>(PVAType::Scaling)].X[index] + instance->scaling_values.single_fcruve.offset;
+		scaling = {s, s, s};
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
 }
 
 } // namespace Effekseer
@@ -4,6 +4,7 @@
 
 #include "Effekseer.Base.h"
 #include "Effekseer.Instance.h"
+#include "Effekseer.InstanceChunkKernel.h"
 #include <array>
 
 namespace Effekseer
@@ -17,7 +18,7 @@ namespace Effekseer
 class alignas(32) InstanceChunk
 {
 public:
-	static const int32_t InstancesOfChunk = 16;
+	static const int32_t InstancesOfChunk = InstanceChunkKernel::Lanes;
 
 	InstanceChunk();
 
@@ -25,14 +26,32 @@ public:
 
 	void UpdateInstances();
 
-	void GenerateChildrenInRequired();
+	void CollectChildrenInRequired(CustomVector<ChildGenerationRequest>& requests);
 
 	void UpdateInstancesByInstanceGlobal(const InstanceGlobal* global);
 
-	void GenerateChildrenInRequiredByInstanceGlobal(const InstanceGlobal* global);
+	void CollectChildrenInRequiredByInstanceGlobal(const InstanceGlobal* global, CustomVector<ChildGenerationRequest>& requests);
 
 	Instance* CreateInstance(ManagerImplemented* pManager, EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGroup* pGroup);
 
+	/**
+		@brief	mark a slot of an instance as used
+		@return	an index of the slot (-1 if the chunk is full)
+	*/
+	int32_t ReserveInstance();
+
+	/**
+		@brief	construct an instance in a slot which is reserved with ReserveInstance
+		@note
+		Instances in different slots can be constructed on different threads.
+	*/
+	Instance* ConstructInstance(int32_t index,
+								ManagerImplemented* pManager,
+								EffectNodeImplemented* pEffectNode,
+								InstanceContainer* pContainer,
+								InstanceGroup* pGroup,
+								InstanceGroup* childrenGroups);
+
 	int32_t GetAliveCount() const
 	{
 		return aliveCount_;
@@ -43,9 +62,92 @@ public:
 		return aliveCount_ < InstancesOfChunk;
 	}
 
+	//! kinds of values which are stored as PVA in a chunk
+	enum class PVAType : int32_t
+	{
+		Translation,
+		Rotation,
+		Scaling,
+		Max,
+	};
+
+	//! set an initial value, velocity and acceleration of PVA
+	void SetPVA(PVAType type, int32_t index, const SIMD::Vec3f& value, const SIMD::Vec3f& velocity, const SIMD::Vec3f& acceleration);
+
+	//! get a value of PVA at the time
+	SIMD::Vec3f GetPVA(PVAType type, int32_t index, float livingTime) const;
+
+	/**
+		@brief	get a matrix which is rotated and scaled without translation
+		@return	false if it is not evaluated at the time
+	*/
+	bool GetEvaluatedRotationScaling(int32_t index, float livingTime, SIMD::Mat43f& matrix) const;
+
+	/**
+		@brief	get a value of FCurve without an offset
+		@return	false if it is not evaluated at the time
+	*/
+	bool GetEvaluatedFCurve(PVAType type, int32_t index, float livingTime, SIMD::Vec3f& value) const;
+
+	/**
+		@brief	get a value of easing
+		@return	false if it is not evaluated at the time
+	*/
+	bool GetEvaluatedEasing(PVAType type, int32_t index, float livingTime, SIMD::Vec3f& value) const;
+
+	/**
+		@brief	get a value of FCurve of all colors without an offset
+		@return	false if it is not evaluated at the time
+	*/
+	bool GetEvaluatedColorFCurve(int32_t index, float livingTime, std::array<float, 4>& value) const;
+
 private:
+	using Vec3Array = InstanceChunkKernel::Vec3Array;
+	using PVAArray = InstanceChunkKernel::PVAArray;
+
+	/**
+		@brief	evaluate values which instances are going to use in Instance::CalculateMatrix
+		@param	global	[in]	only instances with this global are evaluated if it is not null
+		@note
+		PVA of all instances and matrices of fixed, PVA and easing rotation and scaling are evaluated with SIMD.
+		FCurves and easings are evaluated for each parameter with times of all instances which use it.
+	*/
+	void EvaluateLocalMatrices(const InstanceGlobal* global);
+
+	//! evaluate FCurves of translation, rotation, scaling and all colors at once for instances which share the same FCurve
+	void EvaluateFCurves();
+
+	//! evaluate easings of translation, rotation and scaling at once for instances which share the same easing
+	void EvaluateEasings();
+
+	//! get a rotation and a scaling which are evaluated at the time if it is supported
+	bool GetLocalRotationScaling(Instance* instance, int32_t index, float livingTime, SIMD::Vec3f& angle, SIMD::Vec3f& scaling) const;
+
 	std::array<uint8_t[sizeof(Instance)], InstancesOfChunk> instances_;
 
+	std::array<PVAArray, static_cast<int32_t>(PVAType::Max)> pvas_;
+
+	//! values of PVA evaluated in EvaluateLocalMatrices
+	std::array<Vec3Array, static_cast<int32_t>(PVAType::Max)> evaluatedPVAs_;
+
+	//! values of FCurves evaluated in EvaluateLocalMatrices. Only X is used for a single scaling
+	std::array<Vec3Array, static_cast<int32_t>(PVAType::Max)> evaluatedFCurves_;
+
+	//! values of FCurves of all colors evaluated in EvaluateLocalMatrices as structure of arrays
+	alignas(32) std::array<std::array<float, InstancesOfChunk>, 4> evaluatedColorFCurves_;
+
+	//! values of easings evaluated in EvaluateLocalMatrices
+	std::array<Vec3Array, static_cast<int32_t>(PVAType::Max)> evaluatedEasings_;
+
+	//! living times which values are evaluated at (negative if not evaluated)
+	alignas(32) std::array<float, InstancesOfChunk> evaluatedTimes_;
+
+	//! angles and scalings of instances and matrices which are evaluated from them
+	InstanceChunkKernel::RotationScalingArray rotationScalings_;
+
+	//! flags whether are rotations and scalings evaluated
+	std::array<bool, InstancesOfChunk> rotationScalingEvaluated_;
+
 	//! flags whether are instances alive
 	std::array<bool, InstancesOfChunk> instancesAlive_;
 
@@ -0,0 +1,77 @@
+
+// This file is compiled with AVX2 on x86-64 and its functions are called only if a CPU supports AVX2.
+// Don't include headers which define inline functions with 4 lanes because they are shared with other translation units.
+#include "Effekseer.InstanceChunkKernel.h"
+#include "SIMD/Mat43f8.h"
+
+#if defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace InstanceChunkKernel
+{
+
+void EvaluatePVAWithFloat8(const PVAArray& pva, const float* times, Vec3Array& result)
+{
+	for (int32_t i = 0; i < Lanes; i += 8)
+	{
+		const auto t = SIMD::Float8::Load8(&times[i]);
+		const auto halfSquaredT = t * t * 0.5f;
+
+		const auto x = SIMD::Float8::Load8(&pva.Value.X[i]) + SIMD::Float8::Load8(&pva.Velocity.X[i]) * t + SIMD::Float8::Load8(&pva.Acceleration.X[i]) * halfSquaredT;
+		const auto y = SIMD::Float8::Load8(&pva.Value.Y[i]) + SIMD::Float8::Load8(&pva.Velocity.Y[i]) * t + SIMD::Float8::Load8(&pva.Acceleration.Y[i]) * halfSquaredT;
+		const auto z = SIMD::Float8::Load8(&pva.Value.Z[i]) + SIMD::Float8::Load8(&pva.Velocity.Z[i]) * t + SIMD::Float8::Load8(&pva.Acceleration.Z[i]) * halfSquaredT;
+
+		SIMD::Float8::Store8(&result.X[i], x);
+		SIMD::Float8::Store8(&result.Y[i], y);
+		SIMD::Float8::Store8(&result.Z[i], z);
+	}
+}
+
+void EvaluateRotationScalingWithFloat8(RotationScalingArray& values)
+{
+	const auto identity = SIMD::Mat43f8::Identity();
+	const auto zero = SIMD::Vec3f8(SIMD::Float8::SetZero(), SIMD::Float8::SetZero(), SIMD::Float8::SetZero());
+
+	for (int32_t offset = 0; offset < Lanes; offset += 8)
+	{
+		auto rotation = SIMD::Mat43f8::RotationZXY(
+			SIMD::Float8::Load8(&values.Angle.Z[offset]),
+			SIMD::Float8::Load8(&values.Angle.X[offset]),
+			SIMD::Float8::Load8(&values.Angle.Y[offset]));
+
+		// SIMD::Mat43f::Identity is used if a rotation is not specified
+		const auto isIdentity = SIMD::Float8::Load8(&values.IdentityMask[offset]);
+		for (int32_t r = 0; r < 3; r++)
+		{
+			rotation.X[r] = SIMD::Float8::Select(isIdentity, identity.X[r], rotation.X[r]);
+			rotation.Y[r] = SIMD::Float8::Select(isIdentity, identity.Y[r], rotation.Y[r]);
+			rotation.Z[r] = SIMD::Float8::Select(isIdentity, identity.Z[r], rotation.Z[r]);
+		}
+
+		const SIMD::Vec3f8 scaling(
+			SIMD::Float8::Load8(&values.Scaling.X[offset]),
+			SIMD::Float8::Load8(&values.Scaling.Y[offset]),
+			SIMD::Float8::Load8(&values.Scaling.Z[offset]));
+
+		const auto m = SIMD::Mat43f8::SRT(scaling, rotation, zero);
+
+		auto& rows = values.Rows;
+		SIMD::Float8::Store8(&rows[0].X[offset], m.X[0]);
+		SIMD::Float8::Store8(&rows[0].Y[offset], m.X[1]);
+		SIMD::Float8::Store8(&rows[0].Z[offset], m.X[2]);
+		SIMD::Float8::Store8(&rows[1].X[offset], m.Y[0]);
+		SIMD::Float8::Store8(&rows[1].Y[offset], m.Y[1]);
+		SIMD::Float8::Store8(&rows[1].Z[offset], m.Y[2]);
+		SIMD::Float8::Store8(&rows[2].X[offset], m.Z[0]);
+		SIMD::Float8::Store8(&rows[2].Y[offset], m.Z[1]);
+		SIMD::Float8::Store8(&rows[2].Z[offset], m.Z[2]);
+	}
+}
+
+} // namespace InstanceChunkKernel
+
+} // namespace Effekseer
+
+#endif
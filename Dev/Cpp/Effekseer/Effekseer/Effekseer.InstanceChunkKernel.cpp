@@ -0,0 +1,152 @@
+
+#include "Effekseer.InstanceChunkKernel.h"
+#include "SIMD/Utils.h"
+#include <algorithm>
+
+namespace Effekseer
+{
+
+namespace InstanceChunkKernel
+{
+
+void Vec3Array::Fill(float value)
+{
+	std::fill(X, X + Lanes, value);
+	std::fill(Y, Y + Lanes, value);
+	std::fill(Z, Z + Lanes, value);
+}
+
+void Vec3Array::Set(int32_t index, const SIMD::Vec3f& value)
+{
+	X[index] = value.GetX();
+	Y[index] = value.GetY();
+	Z[index] = value.GetZ();
+}
+
+SIMD::Vec3f Vec3Array::Get(int32_t index) const
+{
+	return SIMD::Vec3f(X[index], Y[index], Z[index]);
+}
+
+#if defined(EFK_SIMD_RUNTIME_AVX2)
+static bool IsAVX2Enabled()
+{
+	static const bool enabled = SIMD::IsAVX2Supported();
+	return enabled;
+}
+#endif
+
+void EvaluatePVA(const PVAArray& pva, const float* times, Vec3Array& result)
+{
+#if defined(EFK_SIMD_RUNTIME_AVX2)
+	if (IsAVX2Enabled())
+	{
+		EvaluatePVAWithFloat8(pva, times, result);
+		return;
+	}
+#endif
+
+	EvaluatePVAWithFloat4(pva, times, result);
+}
+
+void EvaluateRotationScaling(RotationScalingArray& values)
+{
+#if defined(EFK_SIMD_RUNTIME_AVX2)
+	if (IsAVX2Enabled())
+	{
+		EvaluateRotationScalingWithFloat8(values);
+		return;
+	}
+#endif
+
+	EvaluateRotationScalingWithFloat4(values);
+}
+
+void EvaluatePVAWithFloat4(const PVAArray& pva, const float* times, Vec3Array& result)
+{
+	// the same operations as InstanceChunk::GetPVA are applied to 4 instances at once
+	for (int32_t i = 0; i < Lanes; i += 4)
+	{
+		const auto t = SIMD::Float4::Load4(&times[i]);
+		const auto halfSquaredT = t * t * 0.5f;
+
+		const auto x = SIMD::Float4::Load4(&pva.Value.X[i]) + SIMD::Float4::Load4(&pva.Velocity.X[i]) * t + SIMD::Float4::Load4(&pva.Acceleration.X[i]) * halfSquaredT;
+		const auto y = SIMD::Float4::Load4(&pva.Value.Y[i]) + SIMD::Float4::Load4(&pva.Velocity.Y[i]) * t + SIMD::Float4::Load4(&pva.Acceleration.Y[i]) * halfSquaredT;
+		const auto z = SIMD::Float4::Load4(&pva.Value.Z[i]) + SIMD::Float4::Load4(&pva.Velocity.Z[i]) * t + SIMD::Float4::Load4(&pva.Acceleration.Z[i]) * halfSquaredT;
+
+		SIMD::Float4::Store4(&result.X[i], x);
+		SIMD::Float4::Store4(&result.Y[i], y);
+		SIMD::Float4::Store4(&result.Z[i], z);
+	}
+}
+
+void EvaluateRotationScalingWithFloat4(RotationScalingArray& values)
+{
+	const auto zero = SIMD::Float4::SetZero();
+	const auto one = SIMD::Float4(1.0f);
+	const auto signMask = SIMD::Float4::SetUInt(0x80000000, 0x80000000, 0x80000000, 0x80000000);
+
+	for (int32_t offset = 0; offset < Lanes; offset += 4)
+	{
+		auto sinCos = [&](const float* angles, SIMD::Float4& s, SIMD::Float4& c) {
+			const auto angle = SIMD::Float4::Load4(&angles[offset]);
+			SIMD::SinCos(angle, s, c);
+
+			// RotationZXY does not calculate sin and cos of 0
+			const auto isZero = SIMD::Float4::Equal(angle, zero);
+			s = SIMD::Float4::Select(isZero, zero, s);
+			c = SIMD::Float4::Select(isZero, one, c);
+		};
+
+		SIMD::Float4 sx, cx, sy, cy, sz, cz;
+		sinCos(values.Angle.X, sx, cx);
+		sinCos(values.Angle.Y, sy, cy);
+		sinCos(values.Angle.Z, sz, cz);
+
+		const auto negSy = sy ^ signMask;
+		const auto negSz = sz ^ signMask;
+
+		auto m00 = cz * cy + sz * sx * sy;
+		auto m01 = sz * cx;
+		auto m02 = cz * negSy + sz * sx * cy;
+
+		auto m10 = negSz * cy + cz * sx * sy;
+		auto m11 = cz * cx;
+		auto m12 = negSz * negSy + cz * sx * cy;
+
+		auto m20 = cx * sy;
+		auto m21 = sx ^ signMask;
+		auto m22 = cx * cy;
+
+		// SIMD::Mat43f::Identity is used if a rotation is not specified
+		const auto isIdentity = SIMD::Float4::Load4(&values.IdentityMask[offset]);
+		m00 = SIMD::Float4::Select(isIdentity, one, m00);
+		m01 = SIMD::Float4::Select(isIdentity, zero, m01);
+		m02 = SIMD::Float4::Select(isIdentity, zero, m02);
+		m10 = SIMD::Float4::Select(isIdentity, zero, m10);
+		m11 = SIMD::Float4::Select(isIdentity, one, m11);
+		m12 = SIMD::Float4::Select(isIdentity, zero, m12);
+		m20 = SIMD::Float4::Select(isIdentity, zero, m20);
+		m21 = SIMD::Float4::Select(isIdentity, zero, m21);
+		m22 = SIMD::Float4::Select(isIdentity, one, m22);
+
+		const auto scaleX = SIMD::Float4::Load4(&values.Scaling.X[offset]);
+		const auto scaleY = SIMD::Float4::Load4(&values.Scaling.Y[offset]);
+		const auto scaleZ = SIMD::Float4::Load4(&values.Scaling.Z[offset]);
+
+		auto& rows = values.Rows;
+		SIMD::Float4::Store4(&rows[0].X[offset], m00 * scaleX);
+		SIMD::Float4::Store4(&rows[0].Y[offset], m10 * scaleY);
+		SIMD::Float4::Store4(&rows[0].Z[offset], m20 * scaleZ);
+		SIMD::Float4::Store4(&rows[1].X[offset], m01 * scaleX);
+		SIMD::Float4::Store4(&rows[1].Y[offset], m11 * scaleY);
+		SIMD::Float4::Store4(&rows[1].Z[offset], m21 * scaleZ);
+		SIMD::Float4::Store4(&rows[2].X[offset], m02 * scaleX);
+		SIMD::Float4::Store4(&rows[2].Y[offset], m12 * scaleY);
+		SIMD::Float4::Store4(&rows[2].Z[offset], m22 * scaleZ);
+	}
+}
+
+} // namespace InstanceChunkKernel
+
+} // namespace Effekseer
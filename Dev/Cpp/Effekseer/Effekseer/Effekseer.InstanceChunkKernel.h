@@ -0,0 +1,81 @@
+
+#ifndef __EFFEKSEER_INSTANCECHUNKKERNEL_H__
+#define __EFFEKSEER_INSTANCECHUNKKERNEL_H__
+
+#include <stdint.h>
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+struct Vec3f;
+}
+
+/**
+	@brief	kernels which evaluate hot states of instances in InstanceChunk
+	@note
+	A kernel with 8 lanes for AVX2 is selected at runtime if a CPU supports it.
+	This header is also included in a translation unit compiled with AVX2,
+	so that it must not include headers which define inline functions with 4 lanes.
+*/
+namespace InstanceChunkKernel
+{
+
+static const int32_t Lanes = 16;
+
+//! values of instances stored as structure of arrays
+struct Vec3Array
+{
+	alignas(32) float X[Lanes];
+	alignas(32) float Y[Lanes];
+	alignas(32) float Z[Lanes];
+
+	void Fill(float value);
+
+	void Set(int32_t index, const SIMD::Vec3f& value);
+
+	SIMD::Vec3f Get(int32_t index) const;
+};
+
+struct PVAArray
+{
+	Vec3Array Value;
+	Vec3Array Velocity;
+	Vec3Array Acceleration;
+};
+
+/**
+	@brief	inputs and outputs of EvaluateRotationScaling
+*/
+struct RotationScalingArray
+{
+	Vec3Array Angle;
+	Vec3Array Scaling;
+
+	//! all bits are set if a rotation is not specified (it is different from an angle 0 in a sign of zero)
+	alignas(32) uint32_t IdentityMask[Lanes];
+
+	//! rows of rotated and scaled matrices
+	Vec3Array Rows[3];
+};
+
+//! evaluate value + velocity * t + acceleration * t * t * 0.5 at times
+void EvaluatePVA(const PVAArray& pva, const float* times, Vec3Array& result);
+
+//! evaluate SIMD::Mat43f::SRT(scaling, SIMD::Mat43f::RotationZXY(z, x, y), 0)
+void EvaluateRotationScaling(RotationScalingArray& values);
+
+void EvaluatePVAWithFloat4(const PVAArray& pva, const float* times, Vec3Array& result);
+
+void EvaluateRotationScalingWithFloat4(RotationScalingArray& values);
+
+void EvaluatePVAWithFloat8(const PVAArray& pva, const float* times, Vec3Array& result);
+
+void EvaluateRotationScalingWithFloat8(RotationScalingArray& values);
+
+} // namespace InstanceChunkKernel
+
+} // namespace Effekseer
+
+#endif // __EFFEKSEER_INSTANCECHUNKKERNEL_H__
@@ -222,6 +222,11 @@ void InstanceContainer::Draw(bool recursive)
 {
 	if (m_pEffectNode->GetType() != EFFECT_NODE_TYPE_ROOT && m_pEffectNode->GetType() != EFFECT_NODE_TYPE_NONE)
 	{
+		// a bounding box of instances is accumulated while counting to cull the whole node
+		const float cullingRadius = m_pManager->IsFrustumValid() ? m_pEffectNode->GetCullingRadius() : -1.0f;
+		SIMD::Vec3f boundsMin(FLT_MAX, FLT_MAX, FLT_MAX);
+		SIMD::Vec3f boundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
 		/* 個数計測 */
 		int32_t count = 0;
 		{
@@ -232,11 +237,26 @@ void InstanceContainer::Draw(bool recursive)
 					if (instance->m_State == INSTANCE_STATE_ACTIVE)
 					{
 						count++;
+
+						if (cullingRadius >= 0.0f)
+						{
+							const auto& matrix = instance->GetGlobalMatrix43();
+							const auto scale = matrix.GetScale();
+							const auto radius = cullingRadius * Max(Max(scale.GetX(), scale.GetY()), scale.GetZ());
+							const auto position = matrix.GetTranslation();
+							boundsMin = SIMD::Vec3f::Min(boundsMin, position - SIMD::Vec3f(radius, radius, radius));
+							boundsMax = SIMD::Vec3f::Max(boundsMax, position + SIMD::Vec3f(radius, radius, radius));
+						}
 					}
 				}
 			}
 		}
 
+		if (count > 0 && cullingRadius >= 0.0f && m_pManager->IsCulledByFrustum(boundsMin, boundsMax))
+		{
+			count = 0;
+		}
+
 		if (count > 0)
 		{
 			/* 描画 */
@@ -60,6 +60,25 @@ Instance* InstanceGroup::CreateInstance()
 	return instance;
 }
 
+bool InstanceGroup::ReserveInstance(InstanceChunk*& chunk, int32_t& chunkIndex, InstanceGroup*& childrenGroups)
+{
+	if (!m_manager->ReserveInstance(m_effectNode, chunk, chunkIndex))
+	{
+		return false;
+	}
+
+	childrenGroups = Instance::CreateChildrenGroups(m_effectNode, m_container);
+	m_global->IncInstanceCount();
+	return true;
+}
+
+Instance* InstanceGroup::ConstructReservedInstance(InstanceChunk* chunk, int32_t chunkIndex, InstanceGroup* childrenGroups)
+{
+	auto instance = chunk->ConstructInstance(chunkIndex, m_manager, m_effectNode, m_container, this, childrenGroups);
+	m_instances.push_back(instance);
+	return instance;
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
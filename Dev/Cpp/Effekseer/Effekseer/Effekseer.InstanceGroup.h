@@ -65,6 +65,19 @@ public:
 	*/
 	Instance* CreateInstance();
 
+	/**
+		@brief	reserve memory and children groups of an instance which is constructed later with ConstructReservedInstance
+		@return	false if memory is lacked
+	*/
+	bool ReserveInstance(InstanceChunk*& chunk, int32_t& chunkIndex, InstanceGroup*& childrenGroups);
+
+	/**
+		@brief	construct an instance which is reserved with ReserveInstance
+		@note
+		It can be called on a worker thread, but instances of a group must be constructed on the same thread in order of reserving.
+	*/
+	Instance* ConstructReservedInstance(InstanceChunk* chunk, int32_t chunkIndex, InstanceGroup* childrenGroups);
+
 	Instance* GetFirst();
 
 	int GetInstanceCount() const;
@@ -1,6 +1,8 @@
 ﻿#include "Effekseer.InternalScript.h"
 #include "Utils/Effekseer.BinaryReader.h"
+#include <algorithm>
 #include <assert.h>
+#include <math.h>
 
 namespace Effekseer
 {
@@ -26,7 +28,7 @@ bool InternalScript::IsValidRegister(int index) const
 	if (index < 0)
 		return false;
 
-	if (static_cast<uint32_t>(index) < registers.size())
+	if (index < registerCount_)
 		return true;
 
 	if (0x1000 + 0 <= index && index <= 0x1000 + 3)
@@ -41,31 +43,76 @@ bool InternalScript::IsValidRegister(int index) const
 	return false;
 }
 
-float InternalScript::GetRegisterValue(int index,
-									   const std::array<float, 4>& externals,
-									   const std::array<float, 1>& globals,
-									   const std::array<float, 5>& locals) const
+int32_t InternalScript::GetInputCount(OperatorType type)
 {
-	auto ind = static_cast<uint32_t>(index);
-	if (ind < registers.size())
+	switch (type)
 	{
-		return registers[ind];
+	case OperatorType::Add:
+	case OperatorType::Sub:
+	case OperatorType::Mul:
+	case OperatorType::Div:
+	case OperatorType::Mod:
+	case OperatorType::Step:
+		return 2;
+	case OperatorType::UnaryAdd:
+	case OperatorType::UnarySub:
+	case OperatorType::Sine:
+	case OperatorType::Cos:
+	case OperatorType::Rand_WithSeed:
+	case OperatorType::Move:
+		return 1;
+	default:
+		return 0;
 	}
-	else if (0x1000 + 0 <= ind && ind <= 0x1000 + 3)
+}
+
+float InternalScript::Calculate(OperatorType type, float input0, float input1)
+{
+	switch (type)
+	{
+	case OperatorType::Add:
+		return input0 + input1;
+	case OperatorType::Sub:
+		return input0 - input1;
+	case OperatorType::Mul:
+		return input0 * input1;
+	case OperatorType::Div:
+		return input0 / input1;
+	case OperatorType::Mod:
+		return fmodf(input0, input1);
+	case OperatorType::Sine:
+		return sinf(input0);
+	case OperatorType::Cos:
+		return cosf(input0);
+	case OperatorType::UnaryAdd:
+	case OperatorType::Move:
+		return input0;
+	case OperatorType::UnarySub:
+		return -input0;
+	case OperatorType::Step:
+		return input1 >= input0 ? 1.0f : 0.0f;
+	default:
+		assert(false);
+		return 0.0f;
+	}
+}
+
+int32_t InternalScript::ConvertRegister(int index) const
+{
+	if (index < registerCount_)
 	{
-		return externals[ind - 0x1000];
+		return RegisterOffset + index;
 	}
-	else if (0x1000 + 0x100 + 0 <= ind && ind <= 0x1000 + 0x100 + 0)
+	else if (index < 0x1000 + 0x100)
 	{
-		return globals[ind - 0x1000 - 0x100];
+		return ExternalOffset + index - 0x1000;
 	}
-	else if (0x1000 + 0x200 + 0 <= ind && ind <= 0x1000 + 0x200 + 4)
+	else if (index < 0x1000 + 0x200)
 	{
-		return locals[ind - 0x1000 - 0x200];
+		return GlobalOffset + index - 0x1000 - 0x100;
 	}
 
-	assert(false);
-	return 0.0f;
+	return LocalOffset + index - 0x1000 - 0x200;
 }
 
 InternalScript::InternalScript()
@@ -82,11 +129,12 @@ bool InternalScript::Load(uint8_t* data, int size)
 	BinaryReader<true> reader(data, static_cast<size_t>(size));
 
 	int32_t registerCount = 0;
+	int32_t operatorCount = 0;
 
 	reader.Read(version_);
 	reader.Read(runningPhase);
 	reader.Read(registerCount);
-	reader.Read(operatorCount_);
+	reader.Read(operatorCount);
 
 	for (size_t i = 0; i < 4; i++)
 		reader.Read(outputRegisters_[i]);
@@ -94,7 +142,7 @@ bool InternalScript::Load(uint8_t* data, int size)
 	if (registerCount < 0)
 		return false;
 
-	registers.resize(registerCount);
+	registerCount_ = registerCount;
 
 	for (size_t i = 0; i < 4; i++)
 	{
@@ -104,21 +152,40 @@ bool InternalScript::Load(uint8_t* data, int size)
 		}
 	}
 
+	std::vector<uint8_t> operators;
 	reader.Read(operators, static_cast<int32_t>(size - reader.GetOffset()));
 
 	if (reader.GetStatus() == BinaryReaderStatus::Failed)
 		return false;
 
-	// check operators
-	auto operatorReader = BinaryReader<true>(operators.data(), operators.size());
+	if (!Compile(operators, operatorCount))
+		return false;
+
+	Optimize();
+
+	isValid_ = true;
+
+	return true;
+}
+
+bool InternalScript::Compile(const std::vector<uint8_t>& operators, int32_t operatorCount)
+{
+	auto operatorReader = BinaryReader<true>(const_cast<uint8_t*>(operators.data()), operators.size());
+
+	std::vector<int32_t> inputs;
+	std::vector<int32_t> outputs;
+	std::vector<int32_t> attributes;
+	int32_t temporaryCount = 0;
 
-	for (int i = 0; i < operatorCount_; i++)
+	instructions_.clear();
+
+	for (int i = 0; i < operatorCount; i++)
 	{
 		// type
 		OperatorType type;
 		operatorReader.Read(type);
 
-		if (reader.GetStatus() == BinaryReaderStatus::Failed)
+		if (operatorReader.GetStatus() == BinaryReaderStatus::Failed)
 			return false;
 
 		if (!IsValidOperator((int)type))
@@ -133,50 +200,208 @@ bool InternalScript::Load(uint8_t* data, int size)
 		int32_t attributeCount = 0;
 		operatorReader.Read(attributeCount);
 
+		if (inputCount < 0 || inputCount > 8 || outputCount < 0 || attributeCount < 0)
+			return false;
+
+		inputs.resize(inputCount);
+		outputs.resize(outputCount);
+		attributes.resize(attributeCount);
+
 		// input
-		for (int j = 0; j < inputCount; j++)
+		for (auto& index : inputs)
 		{
-			int index = 0;
 			operatorReader.Read(index);
 			if (!IsValidRegister(index))
 			{
 				return false;
 			}
+			index = ConvertRegister(index);
 		}
 
 		// output
-		for (int j = 0; j < outputCount; j++)
+		for (auto& index : outputs)
 		{
-			int index = 0;
 			operatorReader.Read(index);
-			if ((index < 0 || index >= static_cast<int32_t>(registers.size())))
+			if ((index < 0 || index >= registerCount_))
 			{
 				return false;
 			}
+			index = ConvertRegister(index);
 		}
 
 		// attribute
-		for (int j = 0; j < attributeCount; j++)
+		for (auto& attribute : attributes)
 		{
-			int index = 0;
-			operatorReader.Read(index);
+			operatorReader.Read(attribute);
+		}
+
+		if (operatorReader.GetStatus() == BinaryReaderStatus::Failed || outputCount == 0)
+			continue;
+
+		// inputs are the same for all outputs except sine, cos and rand with seed which read an input for each output
+		const bool isInputForEachOutput = type == OperatorType::Sine || type == OperatorType::Cos || type == OperatorType::Rand_WithSeed;
+		const int32_t requiredInputCount = isInputForEachOutput ? outputCount : GetInputCount(type);
+		if (inputCount < requiredInputCount || (type == OperatorType::Constant && attributeCount < 1))
+			return false;
+
+		Instruction instruction;
+		instruction.Type = type;
+		instruction.Inputs.fill(0);
+		instruction.Constant = 0.0f;
+
+		if (type == OperatorType::Constant)
+		{
+			memcpy(&instruction.Constant, &attributes[0], sizeof(float));
+		}
+
+		if (isInputForEachOutput || type == OperatorType::Rand || type == OperatorType::Constant)
+		{
+			// outputs are written into temporary registers first if they overwrite inputs which are read later
+			bool isOverwritten = false;
+			for (int32_t j = 0; j < outputCount; j++)
+			{
+				for (int32_t k = j + 1; k < requiredInputCount; k++)
+				{
+					isOverwritten |= outputs[j] == inputs[k];
+				}
+			}
+
+			for (int32_t j = 0; j < outputCount; j++)
+			{
+				instruction.Output = isOverwritten ? RegisterOffset + registerCount_ + j : outputs[j];
+				instruction.Inputs[0] = isInputForEachOutput ? inputs[j] : 0;
+				instructions_.emplace_back(instruction);
+			}
+
+			if (isOverwritten)
+			{
+				temporaryCount = std::max(temporaryCount, outputCount);
+
+				for (int32_t j = 0; j < outputCount; j++)
+				{
+					instructions_.emplace_back(Instruction{OperatorType::Move, outputs[j], {RegisterOffset + registerCount_ + j, 0}, 0.0f});
+				}
+			}
+		}
+		else
+		{
+			// a result is calculated once and copied because it is the same for all outputs
+			for (int32_t j = 0; j < requiredInputCount; j++)
+			{
+				instruction.Inputs[j] = inputs[j];
+			}
+			instruction.Output = outputs[0];
+			instructions_.emplace_back(instruction);
+
+			for (int32_t j = 1; j < outputCount; j++)
+			{
+				instructions_.emplace_back(Instruction{OperatorType::Move, outputs[j], {outputs[0], 0}, 0.0f});
+			}
 		}
 	}
 
 	if (operatorReader.GetStatus() != BinaryReaderStatus::Complete)
 		return false;
 
-	isValid_ = true;
+	for (auto& outputRegister : outputRegisters_)
+	{
+		outputRegister = ConvertRegister(outputRegister);
+	}
+
+	registerCount_ += temporaryCount;
 
 	return true;
 }
 
+void InternalScript::Optimize()
+{
+	const int32_t allRegisterCount = RegisterOffset + registerCount_;
+
+	// fold instructions whose inputs are constants into constants
+	std::vector<bool> isConstant(allRegisterCount, false);
+	std::vector<float> constants(allRegisterCount, 0.0f);
+
+	for (auto& instruction : instructions_)
+	{
+		const auto inputCount = GetInputCount(instruction.Type);
+		bool isFoldable = instruction.Type != OperatorType::Rand && instruction.Type != OperatorType::Rand_WithSeed;
+
+		for (int32_t j = 0; j < inputCount; j++)
+		{
+			isFoldable &= static_cast<bool>(isConstant[instruction.Inputs[j]]);
+		}
+
+		if (isFoldable && instruction.Type != OperatorType::Constant)
+		{
+			instruction.Constant = Calculate(instruction.Type, constants[instruction.Inputs[0]], constants[instruction.Inputs[1]]);
+			instruction.Type = OperatorType::Constant;
+			instruction.Inputs.fill(0);
+		}
+
+		isConstant[instruction.Output] = isFoldable;
+		constants[instruction.Output] = instruction.Constant;
+	}
+
+	// remove instructions whose outputs are not read. rand is kept not to change a sequence of random numbers
+	std::vector<bool> isRead(allRegisterCount, false);
+	for (const auto outputRegister : outputRegisters_)
+	{
+		isRead[outputRegister] = true;
+	}
+
+	std::vector<Instruction> instructions;
+
+	for (auto it = instructions_.rbegin(); it != instructions_.rend(); ++it)
+	{
+		const auto& instruction = *it;
+		if (!isRead[instruction.Output] && instruction.Type != OperatorType::Rand && instruction.Type != OperatorType::Rand_WithSeed)
+		{
+			continue;
+		}
+
+		isRead[instruction.Output] = false;
+
+		for (int32_t j = 0; j < GetInputCount(instruction.Type); j++)
+		{
+			isRead[instruction.Inputs[j]] = true;
+		}
+
+		instructions.emplace_back(instruction);
+	}
+
+	instructions_.assign(instructions.rbegin(), instructions.rend());
+}
+
+void InternalScript::Run(float* registers, RandFuncCallback* randFuncCallback, RandWithSeedFuncCallback* randSeedFuncCallback, void* userData) const
+{
+	for (const auto& instruction : instructions_)
+	{
+		float& output = registers[instruction.Output];
+
+		switch (instruction.Type)
+		{
+		case OperatorType::Constant:
+			output = instruction.Constant;
+			break;
+		case OperatorType::Rand:
+			output = randFuncCallback(userData);
+			break;
+		case OperatorType::Rand_WithSeed:
+			output = randSeedFuncCallback(userData, registers[instruction.Inputs[0]]);
+			break;
+		default:
+			output = Calculate(instruction.Type, registers[instruction.Inputs[0]], registers[instruction.Inputs[1]]);
+			break;
+		}
+	}
+}
+
 std::array<float, 4> InternalScript::Execute(const std::array<float, 4>& externals,
 											 const std::array<float, 1>& globals,
 											 const std::array<float, 5>& locals,
 											 RandFuncCallback* randFuncCallback,
 											 RandWithSeedFuncCallback* randSeedFuncCallback,
-											 void* userData)
+											 void* userData) const
 {
 	std::array<float, 4> ret;
 	ret.fill(0.0f);
@@ -186,104 +411,28 @@ std::array<float, 4> InternalScript::Execute(const std::array<float, 4>& externa
 		return ret;
 	}
 
-	size_t offset = 0;
-	for (int i = 0; i < operatorCount_; i++)
-	{
-		// type
-		OperatorType type;
-		memcpy(&type, operators.data() + offset, sizeof(OperatorType));
-		offset += sizeof(int);
-
-		int32_t inputCount = 0;
-		memcpy(&inputCount, operators.data() + offset, sizeof(int));
-		offset += sizeof(int);
-
-		int32_t outputCount = 0;
-		memcpy(&outputCount, operators.data() + offset, sizeof(int));
-		offset += sizeof(int);
-
-		int32_t attributeCount = 0;
-		memcpy(&attributeCount, operators.data() + offset, sizeof(int));
-		offset += sizeof(int);
-
-		auto inputOffset = offset;
-		auto outputOffset = inputOffset + inputCount * sizeof(int);
-		auto attributeOffset = outputOffset + outputCount * sizeof(int);
-		offset = attributeOffset + attributeCount * sizeof(int);
+	std::array<float, StackRegisterCount> stackRegisters;
+	std::vector<float> heapRegisters;
 
-		std::array<float, 8> tempInputs;
-		if (inputCount > tempInputs.size())
-			return ret;
+	const int32_t allRegisterCount = RegisterOffset + registerCount_;
+	float* registers = stackRegisters.data();
 
-		for (int j = 0; j < inputCount; j++)
-		{
-			int index = 0;
-			memcpy(&index, operators.data() + inputOffset, sizeof(int));
-			inputOffset += sizeof(int);
+	if (allRegisterCount > StackRegisterCount)
+	{
+		heapRegisters.resize(allRegisterCount);
+		registers = heapRegisters.data();
+	}
 
-			tempInputs[j] = GetRegisterValue(index, externals, globals, locals);
-		}
+	memcpy(registers + ExternalOffset, externals.data(), sizeof(float) * externals.size());
+	memcpy(registers + GlobalOffset, globals.data(), sizeof(float) * globals.size());
+	memcpy(registers + LocalOffset, locals.data(), sizeof(float) * locals.size());
+	std::fill(registers + RegisterOffset, registers + allRegisterCount, 0.0f);
 
-		for (int j = 0; j < outputCount; j++)
-		{
-			int index = 0;
-			memcpy(&index, operators.data() + outputOffset, sizeof(int));
-			outputOffset += sizeof(int);
-
-			if (type == OperatorType::Add)
-				registers[index] = tempInputs[0] + tempInputs[1];
-			else if (type == OperatorType::Sub)
-				registers[index] = tempInputs[0] - tempInputs[1];
-			else if (type == OperatorType::Mul)
-				registers[index] = tempInputs[0] * tempInputs[1];
-			else if (type == OperatorType::Div)
-				registers[index] = tempInputs[0] / tempInputs[1];
-			else if (type == OperatorType::Mod)
-			{
-				registers[index] = fmodf(tempInputs[0], tempInputs[1]);
-			}
-			else if (type == OperatorType::Sine)
-			{
-				registers[index] = sinf(tempInputs[j]);
-			}
-			else if (type == OperatorType::Cos)
-			{
-				registers[index] = cosf(tempInputs[j]);
-			}
-			else if (type == OperatorType::UnaryAdd)
-			{
-				registers[index] = tempInputs[0];
-			}
-			else if (type == OperatorType::UnarySub)
-			{
-				registers[index] = -tempInputs[0];
-			}
-			else if (type == OperatorType::Rand)
-			{
-				registers[index] = randFuncCallback(userData);
-			}
-			else if (type == OperatorType::Rand_WithSeed)
-			{
-				registers[index] = randSeedFuncCallback(userData, tempInputs[j]);
-			}
-			else if (type == OperatorType::Step)
-			{
-				auto edge = tempInputs[0];
-				auto x = tempInputs[1];
-				registers[index] = x >= edge ? 1.0f : 0.0f;
-			}
-			else if (type == OperatorType::Constant)
-			{
-				float att = 0;
-				memcpy(&att, operators.data() + attributeOffset, sizeof(int));
-				registers[index] = att;
-			}
-		}
-	}
+	Run(registers, randFuncCallback, randSeedFuncCallback, userData);
 
 	for (size_t i = 0; i < 4; i++)
 	{
-		ret[i] = GetRegisterValue(outputRegisters_[i], externals, globals, locals);
+		ret[i] = registers[outputRegisters_[i]];
 	}
 
 	return ret;
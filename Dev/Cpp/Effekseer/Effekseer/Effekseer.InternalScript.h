@@ -42,38 +42,75 @@ private:
 		Rand_WithSeed = 32,
 
 		Step = 50,
+
+		//! an operator which is not in data but generated when operators are compiled
+		Move = 100,
+	};
+
+	//! an operator which writes one register
+	struct Instruction
+	{
+		OperatorType Type;
+		int32_t Output;
+		std::array<int32_t, 2> Inputs;
+		float Constant;
 	};
 
+	//! externals, globals and locals are placed before registers when operators are executed
+	static const int32_t ExternalOffset = 0;
+	static const int32_t GlobalOffset = 4;
+	static const int32_t LocalOffset = 5;
+	static const int32_t RegisterOffset = 10;
+
+	//! registers are allocated on the stack if the number of them is less than it
+	static const int32_t StackRegisterCount = 64;
+
 private:
 	RunningPhaseType runningPhase = RunningPhaseType::Local;
-	std::vector<float> registers;
-	std::vector<uint8_t> operators;
 	int32_t version_ = 0;
-	int32_t operatorCount_ = 0;
+	int32_t registerCount_ = 0;
+	std::vector<Instruction> instructions_;
 	std::array<int32_t, 4> outputRegisters_;
 	bool isValid_ = false;
 
 	bool IsValidOperator(int value) const;
 	bool IsValidRegister(int index) const;
-	float GetRegisterValue(int index,
-						   const std::array<float, 4>& externals,
-						   const std::array<float, 1>& globals,
-						   const std::array<float, 5>& locals) const;
+
+	static int32_t GetInputCount(OperatorType type);
+	static float Calculate(OperatorType type, float input0, float input1);
+
+	int32_t ConvertRegister(int index) const;
+	bool Compile(const std::vector<uint8_t>& operators, int32_t operatorCount);
+	void Optimize();
+	void Run(float* registers, RandFuncCallback* randFuncCallback, RandWithSeedFuncCallback* randSeedFuncCallback, void* userData) const;
 
 public:
 	InternalScript();
 	virtual ~InternalScript();
 	bool Load(uint8_t* data, int size);
+
+	/**
+		@brief	execute operators
+		@note
+		Operators are compiled into instructions when they are loaded,
+		and no member is modified while executing, so that it can be called from multiple threads.
+	*/
 	std::array<float, 4> Execute(const std::array<float, 4>& externals,
 								 const std::array<float, 1>& globals,
 								 const std::array<float, 5>& locals,
 								 RandFuncCallback* randFuncCallback,
 								 RandWithSeedFuncCallback* randSeedFuncCallback,
-								 void* userData);
+								 void* userData) const;
 	RunningPhaseType GetRunningPhase() const
 	{
 		return runningPhase;
 	}
+
+	//! get the number of instructions after constants are folded and unused results are removed
+	int32_t GetInstructionCount() const
+	{
+		return static_cast<int32_t>(instructions_.size());
+	}
 };
 
 } // namespace Effekseer
@@ -32,6 +32,7 @@
 #include "Effekseer.CurveLoader.h"
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 
 namespace Effekseer
@@ -61,6 +62,7 @@ void Log(LogType logType, const std::string& message)
 Manager::DrawParameter::DrawParameter()
 {
 	CameraCullingMask = 1;
+	ViewIndex = 0;
 }
 
 ManagerRef Manager::Create(int instance_max, bool autoFlip)
@@ -112,30 +114,68 @@ void ManagerImplemented::DrawSet::CopyMatrixFromInstanceToRoot()
 	}
 }
 
-Handle ManagerImplemented::AddDrawSet(const EffectRef& effect, InstanceContainer* pInstanceContainer, InstanceGlobal* pGlobalPointer)
+void ManagerImplemented::DrawSet::SetMatrix(const Matrix43& mat)
+{
+	auto mat_ = GetEnabledGlobalMatrix();
+
+	if (mat_ != nullptr)
+	{
+		(*mat_) = mat;
+		CopyMatrixFromInstanceToRoot();
+		IsParameterChanged = true;
+	}
+}
+
+void ManagerImplemented::DrawSet::SetLocation(const Vector3D& location)
 {
-	Handle Temp = m_NextHandle;
+	auto mat_ = GetEnabledGlobalMatrix();
 
-	// avoid an overflow
-	if (m_NextHandle > std::numeric_limits<int32_t>::max() - 1)
+	if (mat_ != nullptr)
 	{
-		m_NextHandle = 0;
+		mat_->X.SetW(location.X);
+		mat_->Y.SetW(location.Y);
+		mat_->Z.SetW(location.Z);
+
+		CopyMatrixFromInstanceToRoot();
+		IsParameterChanged = true;
 	}
-	m_NextHandle++;
+}
+
+void ManagerImplemented::DrawSet::SetDynamicInput(int32_t index, float value)
+{
+	if (index < 0 || GlobalPointer->dynamicInputParameters.size() <= static_cast<size_t>(index))
+		return;
+
+	GlobalPointer->dynamicInputParameters[index] = value;
+
+	IsParameterChanged = true;
+}
+
+void ManagerImplemented::DrawSet::SetBaseMatrix(const Matrix43& mat)
+{
+	BaseMatrix = mat;
+	DoUseBaseMatrix = true;
+	IsParameterChanged = true;
+}
 
-	DrawSet drawset(effect, pInstanceContainer, pGlobalPointer);
-	drawset.Self = Temp;
+void ManagerImplemented::DrawSet::SetSpeed(float speed)
+{
+	Speed = speed;
+	IsParameterChanged = true;
+}
 
-	m_DrawSets[Temp] = drawset;
+Handle ManagerImplemented::AddDrawSet(const EffectRef& effect, InstanceContainer* pInstanceContainer, InstanceGlobal* pGlobalPointer)
+{
+	Handle handle = m_DrawSets.Add(DrawSet(effect, pInstanceContainer, pGlobalPointer));
+	m_DrawSets.Find(handle)->Self = handle;
 
-	return Temp;
+	return handle;
 }
 
 void ManagerImplemented::StopStoppingEffects()
 {
-	for (auto& draw_set_it : m_DrawSets)
+	for (auto& draw_set : m_DrawSets)
 	{
-		DrawSet& draw_set = draw_set_it.second;
 		if (draw_set.IsRemoving)
 			continue;
 		if (draw_set.GoingToStop)
@@ -188,7 +228,7 @@ void ManagerImplemented::StopStoppingEffects()
 
 		if (isRemoving)
 		{
-			StopEffect(draw_set_it.first);
+			StopEffect(draw_set.Self);
 		}
 	}
 }
@@ -197,19 +237,16 @@ void ManagerImplemented::GCDrawSet(bool isRemovingManager)
 {
 	// dispose instance groups
 	{
-		auto it = m_RemovingDrawSets[1].begin();
-		while (it != m_RemovingDrawSets[1].end())
+		for (auto& drawset : m_RemovingDrawSets[1])
 		{
 			// HACK for UpdateHandle
-			if (it->second.UpdateCountAfterRemoving < 2)
+			if (drawset.UpdateCountAfterRemoving < 2)
 			{
-				UpdateInstancesByInstanceGlobal(it->second);
-				UpdateHandleInternal(it->second);
-				it->second.UpdateCountAfterRemoving++;
+				UpdateInstancesByInstanceGlobal(drawset);
+				UpdateHandleInternal(drawset);
+				drawset.UpdateCountAfterRemoving++;
 			}
 
-			DrawSet& drawset = (*it).second;
-
 			// dispose all instances
 			if (drawset.InstanceContainerPointer != nullptr)
 			{
@@ -225,52 +262,58 @@ void ManagerImplemented::GCDrawSet(bool isRemovingManager)
 				m_cullingWorld->RemoveObject(drawset.CullingObjectPointer);
 				Culling3D::SafeRelease(drawset.CullingObjectPointer);
 			}
-
-			m_RemovingDrawSets[1].erase(it++);
 		}
 		m_RemovingDrawSets[1].clear();
 	}
 
 	// wait next frame to be removed
 	{
-		auto it = m_RemovingDrawSets[0].begin();
-		while (it != m_RemovingDrawSets[0].end())
+		for (auto& drawset : m_RemovingDrawSets[0])
 		{
 			// HACK for UpdateHandle
-			if (it->second.UpdateCountAfterRemoving < 1)
+			if (drawset.UpdateCountAfterRemoving < 1)
 			{
-				UpdateInstancesByInstanceGlobal(it->second);
-				UpdateHandleInternal(it->second);
-				it->second.UpdateCountAfterRemoving++;
+				UpdateInstancesByInstanceGlobal(drawset);
+				UpdateHandleInternal(drawset);
+				drawset.UpdateCountAfterRemoving++;
 			}
-
-			m_RemovingDrawSets[1][(*it).first] = (*it).second;
-			m_RemovingDrawSets[0].erase(it++);
 		}
-		m_RemovingDrawSets[0].clear();
+		std::swap(m_RemovingDrawSets[0], m_RemovingDrawSets[1]);
 	}
 
 	{
-		auto it = m_DrawSets.begin();
-		while (it != m_DrawSets.end())
-		{
-			DrawSet& draw_set = (*it).second;
+		removingHandles_.clear();
 
+		for (auto& draw_set : m_DrawSets)
+		{
 			if (draw_set.IsRemoving)
 			{
-				if ((*it).second.RemovingCallback != nullptr)
-				{
-					(*it).second.RemovingCallback(this, (*it).first, isRemovingManager);
-				}
-
-				m_RemovingDrawSets[0][(*it).first] = (*it).second;
-				m_DrawSets.erase(it++);
+				removingHandles_.emplace_back(draw_set.Self);
 			}
-			else
+		}
+
+		// callbacks may play or stop effects, so draw sets are found again
+		for (auto handle : removingHandles_)
+		{
+			DrawSet* draw_set = m_DrawSets.Find(handle);
+			if (draw_set != nullptr && draw_set->RemovingCallback != nullptr)
 			{
-				++it;
+				draw_set->RemovingCallback(this, handle, isRemovingManager);
 			}
 		}
+
+		// effects stopped in callbacks are removed with their callbacks next time
+		size_t removingIndex = 0;
+		m_DrawSets.RemoveIf([&](DrawSet& draw_set) {
+			if (removingIndex >= removingHandles_.size() || removingHandles_[removingIndex] != draw_set.Self)
+			{
+				return false;
+			}
+
+			removingIndex++;
+			m_RemovingDrawSets[0].emplace_back(std::move(draw_set));
+			return true;
+		});
 	}
 }
 
@@ -348,29 +391,264 @@ int EFK_STDCALL ManagerImplemented::Rand()
 	return rand();
 }
 
+void ManagerImplemented::ExecuteParallel(int32_t taskCount, const std::function<void(int32_t threadID, int32_t taskIndex)>& task)
+{
+	// worker thread 0 runs this function itself
+	if (m_WorkerThreads.size() < 2 || taskCount < 2)
+	{
+		for (int32_t i = 0; i < taskCount; i++)
+		{
+			task(0, i);
+		}
+		return;
+	}
+
+	m_workStealingQueue.Reset(taskCount, static_cast<int32_t>(m_WorkerThreads.size()));
+
+	ExecuteOnAllThreads([this, &task](int32_t threadID) {
+		int32_t taskIndex = 0;
+		while (m_workStealingQueue.Pop(threadID, taskIndex))
+		{
+			task(threadID, taskIndex);
+		}
+	});
+}
+
+void ManagerImplemented::ExecuteOnAllThreads(const std::function<void(int32_t threadID)>& func)
+{
+	const auto threadCount = static_cast<int32_t>(m_WorkerThreads.size());
+
+	// Process on worker thread
+	for (int32_t threadID = 1; threadID < threadCount; threadID++)
+	{
+		m_WorkerThreads[threadID].RunAsync([&func, threadID]() { func(threadID); });
+	}
+
+	// Process on this thread
+	func(0);
+
+	// Wait for all worker threads completion
+	for (int32_t threadID = 1; threadID < threadCount; threadID++)
+	{
+		m_WorkerThreads[threadID].WaitForComplete();
+	}
+}
+
+void ManagerImplemented::UpdateInstanceChunks()
+{
+	if (m_WorkerThreads.size() < 2)
+	{
+		for (auto& chunks : instanceChunks_)
+		{
+			for (size_t i = 0; i < chunks.size(); i++)
+			{
+				UpdateInstanceChunk(0, chunks, static_cast<int32_t>(i));
+			}
+
+			GenerateRequestedChildren(static_cast<int32_t>(chunks.size()));
+			ClearChildGenerationRequests();
+		}
+		return;
+	}
+
+	// Worker threads are woken up once per update instead of once per generation.
+	// Generations without chunks are skipped without synchronization.
+	//
+	// Generations are separated by barriers instead of a graph of tasks for each effect because
+	// - a chunk contains instances of many effects so that chunks are filled and evaluated with SIMD.
+	//   Tasks for each effect would need chunks for each effect, and an effect with a few instances would occupy a chunk for each generation.
+	// - children of all effects are reserved in one ordered pass, which keeps random seeds independent of the number of threads.
+	// So the number of barriers is bounded by generations which have chunks (two or three for each), not by the number of effects.
+	const auto threadCount = static_cast<int32_t>(m_WorkerThreads.size());
+	const auto generationCount = static_cast<int32_t>(instanceChunks_.size());
+
+	m_threadBarrier.Reset(threadCount);
+
+	ExecuteOnAllThreads([this, threadCount, generationCount](int32_t threadID) {
+		int32_t nextGeneration = 0;
+
+		while (true)
+		{
+			// Only thread 0 modifies chunks, so it selects a generation to be updated
+			if (threadID == 0)
+			{
+				while (nextGeneration < generationCount && instanceChunks_[nextGeneration].empty())
+				{
+					nextGeneration++;
+				}
+
+				m_updatingGeneration = nextGeneration;
+
+				if (nextGeneration < generationCount)
+				{
+					m_workStealingQueue.Reset(static_cast<int32_t>(instanceChunks_[nextGeneration].size()), threadCount);
+				}
+			}
+
+			m_threadBarrier.Wait();
+
+			const auto generation = m_updatingGeneration;
+			if (generation >= generationCount)
+			{
+				break;
+			}
+
+			auto& chunks = instanceChunks_[generation];
+
+			// requests of a previous generation are not read by any thread after the barrier
+			m_childGenerationRequests[threadID].clear();
+
+			int32_t taskIndex = 0;
+			while (m_workStealingQueue.Pop(threadID, taskIndex))
+			{
+				UpdateInstanceChunk(threadID, chunks, taskIndex);
+			}
+
+			m_threadBarrier.Wait();
+
+			// all threads get the same number because requests are not changed until the next barrier
+			size_t requestCount = 0;
+			for (const auto& requests : m_childGenerationRequests)
+			{
+				requestCount += requests.size();
+			}
+
+			// children are generated into a next generation
+			if (requestCount < static_cast<size_t>(ParallelChildGenerationMin))
+			{
+				if (threadID == 0)
+				{
+					GenerateRequestedChildren(static_cast<int32_t>(chunks.size()));
+				}
+			}
+			else
+			{
+				if (threadID == 0)
+				{
+					ReserveRequestedChildren(static_cast<int32_t>(chunks.size()));
+					m_childGenerationQueue.Reset(static_cast<int32_t>(m_childGenerationTaskOffsets.size()), threadCount);
+				}
+
+				m_threadBarrier.Wait();
+
+				while (m_childGenerationQueue.Pop(threadID, taskIndex))
+				{
+					GenerateReservedChildren(taskIndex);
+				}
+			}
+
+			nextGeneration = generation + 1;
+		}
+	});
+
+	ClearChildGenerationRequests();
+}
+
+void ManagerImplemented::UpdateInstanceChunk(int32_t threadID, const std::vector<InstanceChunk*>& chunks, int32_t chunkIndex)
+{
+	auto& requests = m_childGenerationRequests[threadID];
+	auto& range = m_childGenerationRequestRanges[chunkIndex];
+
+	chunks[chunkIndex]->UpdateInstances();
+
+	range.ThreadID = threadID;
+	range.Offset = static_cast<int32_t>(requests.size());
+	chunks[chunkIndex]->CollectChildrenInRequired(requests);
+	range.Count = static_cast<int32_t>(requests.size()) - range.Offset;
+}
+
+void ManagerImplemented::GenerateRequestedChildren(int32_t chunkCount)
+{
+	for (int32_t i = 0; i < chunkCount; i++)
+	{
+		const auto& range = m_childGenerationRequestRanges[i];
+		const auto& requests = m_childGenerationRequests[range.ThreadID];
+
+		for (int32_t j = 0; j < range.Count; j++)
+		{
+			Instance::GenerateChild(requests[range.Offset + j]);
+		}
+	}
+}
+
+void ManagerImplemented::ReserveRequestedChildren(int32_t chunkCount)
+{
+	m_reservedChildren.clear();
+	m_childGenerationTaskOffsets.clear();
+
+	const InstanceGroup* lastGroup = nullptr;
+	int32_t taskSize = 0;
+
+	for (int32_t i = 0; i < chunkCount; i++)
+	{
+		const auto& range = m_childGenerationRequestRanges[i];
+		const auto& requests = m_childGenerationRequests[range.ThreadID];
+
+		for (int32_t j = 0; j < range.Count; j++)
+		{
+			auto request = requests[range.Offset + j];
+			if (!Instance::ReserveChild(request))
+			{
+				continue;
+			}
+
+			// a task is split only between groups because instances are added into a group in order
+			if (request.Group != lastGroup && (m_childGenerationTaskOffsets.empty() || taskSize >= ChildGenerationTaskSize))
+			{
+				m_childGenerationTaskOffsets.push_back(static_cast<int32_t>(m_reservedChildren.size()));
+				taskSize = 0;
+			}
+
+			lastGroup = request.Group;
+			m_reservedChildren.push_back(request);
+			taskSize++;
+		}
+	}
+}
+
+void ManagerImplemented::GenerateReservedChildren(int32_t taskIndex)
+{
+	const auto begin = m_childGenerationTaskOffsets[taskIndex];
+	const auto end = taskIndex + 1 < static_cast<int32_t>(m_childGenerationTaskOffsets.size()) ? m_childGenerationTaskOffsets[taskIndex + 1]
+																							  : static_cast<int32_t>(m_reservedChildren.size());
+
+	for (int32_t i = begin; i < end; i++)
+	{
+		Instance::GenerateReservedChild(m_reservedChildren[i]);
+	}
+}
+
+void ManagerImplemented::ClearChildGenerationRequests()
+{
+	for (auto& requests : m_childGenerationRequests)
+	{
+		requests.clear();
+	}
+}
+
 void ManagerImplemented::ExecuteEvents()
 {
 	for (auto& ds : m_DrawSets)
 	{
-		if (ds.second.GoingToStop)
+		if (ds.GoingToStop)
 		{
-			InstanceContainer* pContainer = ds.second.InstanceContainerPointer;
+			InstanceContainer* pContainer = ds.InstanceContainerPointer;
 
 			if (pContainer != nullptr)
 			{
 				pContainer->KillAllInstances(true);
 			}
 
-			ds.second.IsRemoving = true;
+			ds.IsRemoving = true;
 			if (GetSoundPlayer() != nullptr)
 			{
-				GetSoundPlayer()->StopTag(ds.second.GlobalPointer);
+				GetSoundPlayer()->StopTag(ds.GlobalPointer);
 			}
 		}
 
-		if (ds.second.GoingToStopRoot)
+		if (ds.GoingToStopRoot)
 		{
-			InstanceContainer* pContainer = ds.second.InstanceContainerPointer;
+			InstanceContainer* pContainer = ds.InstanceContainerPointer;
 
 			if (pContainer != nullptr)
 			{
@@ -382,7 +660,6 @@ void ManagerImplemented::ExecuteEvents()
 
 ManagerImplemented::ManagerImplemented(int instance_max, bool autoFlip)
 	: m_autoFlip(autoFlip)
-	, m_NextHandle(0)
 	, m_instance_max(instance_max)
 	, m_setting(nullptr)
 	, m_sequenceNumber(0)
@@ -424,6 +701,9 @@ ManagerImplemented::ManagerImplemented(int instance_max, bool autoFlip)
 	}
 	std::fill(creatableChunkOffsets_.begin(), creatableChunkOffsets_.end(), 0);
 
+	m_childGenerationRequests.resize(1);
+	m_childGenerationRequestRanges.resize(chunk_max);
+
 	// Pooling InstanceGroup
 	reservedGroupBuffer_.resize(instance_max * sizeof(InstanceGroup));
 	for (int i = 0; i < instance_max; i++)
@@ -465,6 +745,19 @@ ManagerImplemented::~ManagerImplemented()
 }
 
 Instance* ManagerImplemented::CreateInstance(EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGroup* pGroup)
+{
+	InstanceChunk* chunk = nullptr;
+	int32_t chunkIndex = 0;
+
+	if (!ReserveInstance(pEffectNode, chunk, chunkIndex))
+	{
+		return nullptr;
+	}
+
+	return chunk->ConstructInstance(chunkIndex, this, pEffectNode, pContainer, pGroup, Instance::CreateChildrenGroups(pEffectNode, pContainer));
+}
+
+bool ManagerImplemented::ReserveInstance(EffectNodeImplemented* pEffectNode, InstanceChunk*& chunk, int32_t& chunkIndex)
 {
 	int32_t generationNumber = pEffectNode->GetGeneration();
 	assert(generationNumber < GenerationsMax);
@@ -479,19 +772,21 @@ Instance* ManagerImplemented::CreateInstance(EffectNodeImplemented* pEffectNode,
 
 	if (it != chunks.end())
 	{
-		auto chunk = *it;
-		return chunk->CreateInstance(this, pEffectNode, pContainer, pGroup);
+		chunk = *it;
+		chunkIndex = chunk->ReserveInstance();
+		return true;
 	}
 
 	if (!pooledChunks_.empty())
 	{
-		auto chunk = pooledChunks_.front();
+		chunk = pooledChunks_.front();
 		pooledChunks_.pop();
 		chunks.push_back(chunk);
-		return chunk->CreateInstance(this, pEffectNode, pContainer, pGroup);
+		chunkIndex = chunk->ReserveInstance();
+		return true;
 	}
 
-	return nullptr;
+	return false;
 }
 
 InstanceGroup* ManagerImplemented::CreateInstanceGroup(EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGlobal* pGlobal)
@@ -514,6 +809,13 @@ void ManagerImplemented::ReleaseGroup(InstanceGroup* group)
 void ManagerImplemented::LaunchWorkerThreads(uint32_t threadCount)
 {
 	m_WorkerThreads.resize(threadCount);
+	m_childGenerationRequests.resize(std::max(threadCount, 1u));
+
+	m_renderingCommandBuffers.clear();
+	for (uint32_t i = 0; i < threadCount; i++)
+	{
+		m_renderingCommandBuffers.emplace_back(new RenderingCommandBuffer());
+	}
 
 	for (auto& worker : m_WorkerThreads)
 	{
@@ -530,6 +832,16 @@ ThreadNativeHandleType ManagerImplemented::GetWorkerThreadHandle(uint32_t thread
 	return 0;
 }
 
+void ManagerImplemented::SetParallelDrawingEnabled(bool enabled)
+{
+	m_isParallelDrawingEnabled = enabled;
+}
+
+bool ManagerImplemented::GetParallelDrawingEnabled() const
+{
+	return m_isParallelDrawingEnabled;
+}
+
 uint32_t ManagerImplemented::GetSequenceNumber() const
 {
 	return m_sequenceNumber;
@@ -587,6 +899,13 @@ void ManagerImplemented::SetCoordinateSystem(CoordinateSystem coordinateSystem)
 
 SpriteRendererRef ManagerImplemented::GetSpriteRenderer()
 {
+	// calls are recorded while draw sets are drawn in parallel
+	auto recordingBuffer = RenderingCommandBuffer::GetRecordingBuffer();
+	if (recordingBuffer != nullptr && m_spriteRenderer != nullptr)
+	{
+		return recordingBuffer->GetSpriteRenderer();
+	}
+
 	return m_spriteRenderer;
 }
 
@@ -597,6 +916,12 @@ void ManagerImplemented::SetSpriteRenderer(SpriteRendererRef renderer)
 
 RibbonRendererRef ManagerImplemented::GetRibbonRenderer()
 {
+	auto recordingBuffer = RenderingCommandBuffer::GetRecordingBuffer();
+	if (recordingBuffer != nullptr && m_ribbonRenderer != nullptr)
+	{
+		return recordingBuffer->GetRibbonRenderer();
+	}
+
 	return m_ribbonRenderer;
 }
 
@@ -607,6 +932,12 @@ void ManagerImplemented::SetRibbonRenderer(RibbonRendererRef renderer)
 
 RingRendererRef ManagerImplemented::GetRingRenderer()
 {
+	auto recordingBuffer = RenderingCommandBuffer::GetRecordingBuffer();
+	if (recordingBuffer != nullptr && m_ringRenderer != nullptr)
+	{
+		return recordingBuffer->GetRingRenderer();
+	}
+
 	return m_ringRenderer;
 }
 
@@ -617,6 +948,12 @@ void ManagerImplemented::SetRingRenderer(RingRendererRef renderer)
 
 ModelRendererRef ManagerImplemented::GetModelRenderer()
 {
+	auto recordingBuffer = RenderingCommandBuffer::GetRecordingBuffer();
+	if (recordingBuffer != nullptr && m_modelRenderer != nullptr)
+	{
+		return recordingBuffer->GetModelRenderer();
+	}
+
 	return m_modelRenderer;
 }
 
@@ -627,6 +964,12 @@ void ManagerImplemented::SetModelRenderer(ModelRendererRef renderer)
 
 TrackRendererRef ManagerImplemented::GetTrackRenderer()
 {
+	auto recordingBuffer = RenderingCommandBuffer::GetRecordingBuffer();
+	if (recordingBuffer != nullptr && m_trackRenderer != nullptr)
+	{
+		return recordingBuffer->GetTrackRenderer();
+	}
+
 	return m_trackRenderer;
 }
 
@@ -717,51 +1060,53 @@ void ManagerImplemented::SetCurveLoader(CurveLoaderRef loader)
 
 void ManagerImplemented::StopEffect(Handle handle)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		DrawSet& drawSet = m_DrawSets[handle];
-		drawSet.GoingToStop = true;
-		drawSet.IsRemoving = true;
+		drawSet->GoingToStop = true;
+		drawSet->IsRemoving = true;
 	}
 }
 
 void ManagerImplemented::StopAllEffects()
 {
-	for (auto& it : m_DrawSets)
+	for (auto& drawSet : m_DrawSets)
 	{
-		it.second.GoingToStop = true;
-		it.second.IsRemoving = true;
+		drawSet.GoingToStop = true;
+		drawSet.IsRemoving = true;
 	}
 }
 
 void ManagerImplemented::StopRoot(Handle handle)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		m_DrawSets[handle].GoingToStopRoot = true;
+		drawSet->GoingToStopRoot = true;
 	}
 }
 
 void ManagerImplemented::StopRoot(const EffectRef& effect)
 {
-	for (auto& it : m_DrawSets)
+	for (auto& drawSet : m_DrawSets)
 	{
-		if (it.second.ParameterPointer == effect)
+		if (drawSet.ParameterPointer == effect)
 		{
-			it.second.GoingToStopRoot = true;
+			drawSet.GoingToStopRoot = true;
 		}
 	}
 }
 
 bool ManagerImplemented::Exists(Handle handle)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
 		// always exists before update
-		if (!m_DrawSets[handle].IsPreupdated)
+		if (!drawSet->IsPreupdated)
 			return true;
 
-		if (m_DrawSets[handle].IsRemoving)
+		if (drawSet->IsRemoving)
 			return false;
 		return true;
 	}
@@ -770,9 +1115,10 @@ bool ManagerImplemented::Exists(Handle handle)
 
 int32_t ManagerImplemented::GetInstanceCount(Handle handle)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		return m_DrawSets[handle].GlobalPointer->GetInstanceCount();
+		return drawSet->GlobalPointer->GetInstanceCount();
 	}
 	return 0;
 }
@@ -780,9 +1126,8 @@ int32_t ManagerImplemented::GetInstanceCount(Handle handle)
 int32_t ManagerImplemented::GetTotalInstanceCount() const
 {
 	int32_t instanceCount = 0;
-	for (auto pair : m_DrawSets)
+	for (const auto& drawSet : m_DrawSets)
 	{
-		const DrawSet& drawSet = pair.second;
 		instanceCount += drawSet.GlobalPointer->GetInstanceCount();
 	}
 	return instanceCount;
@@ -790,11 +1135,10 @@ int32_t ManagerImplemented::GetTotalInstanceCount() const
 
 Matrix43 ManagerImplemented::GetMatrix(Handle handle)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		DrawSet& drawSet = m_DrawSets[handle];
-
-		auto mat = drawSet.GetEnabledGlobalMatrix();
+		auto mat = drawSet->GetEnabledGlobalMatrix();
 
 		if (mat != nullptr)
 		{
@@ -807,16 +1151,24 @@ Matrix43 ManagerImplemented::GetMatrix(Handle handle)
 
 void ManagerImplemented::SetMatrix(Handle handle, const Matrix43& mat)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		DrawSet& drawSet = m_DrawSets[handle];
-		auto mat_ = drawSet.GetEnabledGlobalMatrix();
+		drawSet->SetMatrix(mat);
+	}
+}
 
-		if (mat_ != nullptr)
+void ManagerImplemented::SetMatrices(const Handle* handles, const Matrix43* matrices, int32_t count)
+{
+	if (handles == nullptr || matrices == nullptr || count <= 0)
+		return;
+
+	for (int32_t i = 0; i < count; i++)
+	{
+		DrawSet* drawSet = m_DrawSets.Find(handles[i]);
+		if (drawSet != nullptr)
 		{
-			(*mat_) = mat;
-			drawSet.CopyMatrixFromInstanceToRoot();
-			drawSet.IsParameterChanged = true;
+			drawSet->SetMatrix(matrices[i]);
 		}
 	}
 }
@@ -825,10 +1177,10 @@ Vector3D ManagerImplemented::GetLocation(Handle handle)
 {
 	Vector3D location;
 
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		DrawSet& drawSet = m_DrawSets[handle];
-		auto mat_ = drawSet.GetEnabledGlobalMatrix();
+		auto mat_ = drawSet->GetEnabledGlobalMatrix();
 
 		if (mat_ != nullptr)
 		{
@@ -843,53 +1195,57 @@ Vector3D ManagerImplemented::GetLocation(Handle handle)
 
 void ManagerImplemented::SetLocation(Handle handle, float x, float y, float z)
 {
-	if (m_DrawSets.count(handle) > 0)
-	{
-		DrawSet& drawSet = m_DrawSets[handle];
-		auto mat_ = drawSet.GetEnabledGlobalMatrix();
-
-		if (mat_ != nullptr)
-		{
-			mat_->X.SetW(x);
-			mat_->Y.SetW(y);
-			mat_->Z.SetW(z);
+	SetLocation(handle, Vector3D(x, y, z));
+}
 
-			drawSet.CopyMatrixFromInstanceToRoot();
-			drawSet.IsParameterChanged = true;
-		}
+void ManagerImplemented::SetLocation(Handle handle, const Vector3D& location)
+{
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
+	{
+		drawSet->SetLocation(location);
 	}
 }
 
-void ManagerImplemented::SetLocation(Handle handle, const Vector3D& location)
+void ManagerImplemented::SetLocations(const Handle* handles, const Vector3D* locations, int32_t count)
 {
-	SetLocation(handle, location.X, location.Y, location.Z);
+	if (handles == nullptr || locations == nullptr || count <= 0)
+		return;
+
+	for (int32_t i = 0; i < count; i++)
+	{
+		DrawSet* drawSet = m_DrawSets.Find(handles[i]);
+		if (drawSet != nullptr)
+		{
+			drawSet->SetLocation(locations[i]);
+		}
+	}
 }
 
 void ManagerImplemented::AddLocation(Handle handle, const Vector3D& location)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		DrawSet& drawSet = m_DrawSets[handle];
-		auto mat_ = drawSet.GetEnabledGlobalMatrix();
+		auto mat_ = drawSet->GetEnabledGlobalMatrix();
 
 		if (mat_ != nullptr)
 		{
 			mat_->X.SetW(mat_->X.GetW() + location.X);
 			mat_->Y.SetW(mat_->Y.GetW() + location.Y);
 			mat_->Z.SetW(mat_->Z.GetW() + location.Z);
-			drawSet.CopyMatrixFromInstanceToRoot();
-			drawSet.IsParameterChanged = true;
+			drawSet->CopyMatrixFromInstanceToRoot();
+			drawSet->IsParameterChanged = true;
 		}
 	}
 }
 
 void ManagerImplemented::SetRotation(Handle handle, float x, float y, float z)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		DrawSet& drawSet = m_DrawSets[handle];
-
-		auto mat_ = drawSet.GetEnabledGlobalMatrix();
+		auto mat_ = drawSet->GetEnabledGlobalMatrix();
 
 		if (mat_ != nullptr)
 		{
@@ -902,19 +1258,18 @@ void ManagerImplemented::SetRotation(Handle handle, float x, float y, float z)
 
 			*mat_ = SIMD::Mat43f::SRT(s, r, t);
 
-			drawSet.CopyMatrixFromInstanceToRoot();
-			drawSet.IsParameterChanged = true;
+			drawSet->CopyMatrixFromInstanceToRoot();
+			drawSet->IsParameterChanged = true;
 		}
 	}
 }
 
 void ManagerImplemented::SetRotation(Handle handle, const Vector3D& axis, float angle)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		DrawSet& drawSet = m_DrawSets[handle];
-
-		auto mat_ = drawSet.GetEnabledGlobalMatrix();
+		auto mat_ = drawSet->GetEnabledGlobalMatrix();
 
 		if (mat_ != nullptr)
 		{
@@ -927,19 +1282,18 @@ void ManagerImplemented::SetRotation(Handle handle, const Vector3D& axis, float
 
 			*mat_ = SIMD::Mat43f::SRT(s, r, t);
 
-			drawSet.CopyMatrixFromInstanceToRoot();
-			drawSet.IsParameterChanged = true;
+			drawSet->CopyMatrixFromInstanceToRoot();
+			drawSet->IsParameterChanged = true;
 		}
 	}
 }
 
 void ManagerImplemented::SetScale(Handle handle, float x, float y, float z)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		DrawSet& drawSet = m_DrawSets[handle];
-
-		auto mat_ = drawSet.GetEnabledGlobalMatrix();
+		auto mat_ = drawSet->GetEnabledGlobalMatrix();
 
 		if (mat_ != nullptr)
 		{
@@ -952,20 +1306,19 @@ void ManagerImplemented::SetScale(Handle handle, float x, float y, float z)
 
 			*mat_ = SIMD::Mat43f::SRT(s, r, t);
 
-			drawSet.CopyMatrixFromInstanceToRoot();
-			drawSet.IsParameterChanged = true;
+			drawSet->CopyMatrixFromInstanceToRoot();
+			drawSet->IsParameterChanged = true;
 		}
 	}
 }
 
 void ManagerImplemented::SetAllColor(Handle handle, Color color)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		auto& drawSet = m_DrawSets[handle];
-
-		drawSet.GlobalPointer->IsGlobalColorSet = true;
-		drawSet.GlobalPointer->GlobalColor = color;
+		drawSet->GlobalPointer->IsGlobalColorSet = true;
+		drawSet->GlobalPointer->GlobalColor = color;
 	}
 }
 
@@ -976,24 +1329,23 @@ void ManagerImplemented::SetTargetLocation(Handle handle, float x, float y, floa
 
 void ManagerImplemented::SetTargetLocation(Handle handle, const Vector3D& location)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		DrawSet& drawSet = m_DrawSets[handle];
-
-		InstanceGlobal* instanceGlobal = drawSet.GlobalPointer;
+		InstanceGlobal* instanceGlobal = drawSet->GlobalPointer;
 		instanceGlobal->SetTargetLocation(location);
 
-		drawSet.IsParameterChanged = true;
+		drawSet->IsParameterChanged = true;
 	}
 }
 
 float ManagerImplemented::GetDynamicInput(Handle handle, int32_t index)
 {
-	auto it = m_DrawSets.find(handle);
-	if (it != m_DrawSets.end())
+	const DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		auto globalPtr = it->second.GlobalPointer;
-		if (index < 0 || globalPtr->dynamicInputParameters.size() <= index)
+		auto globalPtr = drawSet->GlobalPointer;
+		if (index < 0 || globalPtr->dynamicInputParameters.size() <= static_cast<size_t>(index))
 			return 0.0f;
 
 		return globalPtr->dynamicInputParameters[index];
@@ -1004,26 +1356,34 @@ float ManagerImplemented::GetDynamicInput(Handle handle, int32_t index)
 
 void ManagerImplemented::SetDynamicInput(Handle handle, int32_t index, float value)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		DrawSet& drawSet = m_DrawSets[handle];
-
-		InstanceGlobal* instanceGlobal = drawSet.GlobalPointer;
-
-		if (index < 0 || instanceGlobal->dynamicInputParameters.size() <= index)
-			return;
+		drawSet->SetDynamicInput(index, value);
+	}
+}
 
-		instanceGlobal->dynamicInputParameters[index] = value;
+void ManagerImplemented::SetDynamicInputs(const Handle* handles, int32_t index, const float* values, int32_t count)
+{
+	if (handles == nullptr || values == nullptr || count <= 0 || index < 0)
+		return;
 
-		drawSet.IsParameterChanged = true;
+	for (int32_t i = 0; i < count; i++)
+	{
+		DrawSet* drawSet = m_DrawSets.Find(handles[i]);
+		if (drawSet != nullptr)
+		{
+			drawSet->SetDynamicInput(index, values[i]);
+		}
 	}
 }
 
 Matrix43 ManagerImplemented::GetBaseMatrix(Handle handle)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		return ToStruct(m_DrawSets[handle].BaseMatrix);
+		return ToStruct(drawSet->BaseMatrix);
 	}
 
 	return Matrix43();
@@ -1031,27 +1391,43 @@ Matrix43 ManagerImplemented::GetBaseMatrix(Handle handle)
 
 void ManagerImplemented::SetBaseMatrix(Handle handle, const Matrix43& mat)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
+	{
+		drawSet->SetBaseMatrix(mat);
+	}
+}
+
+void ManagerImplemented::SetBaseMatrices(const Handle* handles, const Matrix43* matrices, int32_t count)
+{
+	if (handles == nullptr || matrices == nullptr || count <= 0)
+		return;
+
+	for (int32_t i = 0; i < count; i++)
 	{
-		m_DrawSets[handle].BaseMatrix = mat;
-		m_DrawSets[handle].DoUseBaseMatrix = true;
-		m_DrawSets[handle].IsParameterChanged = true;
+		DrawSet* drawSet = m_DrawSets.Find(handles[i]);
+		if (drawSet != nullptr)
+		{
+			drawSet->SetBaseMatrix(matrices[i]);
+		}
 	}
 }
 
 void ManagerImplemented::SetRemovingCallback(Handle handle, EffectInstanceRemovingCallback callback)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		m_DrawSets[handle].RemovingCallback = callback;
+		drawSet->RemovingCallback = callback;
 	}
 }
 
 bool ManagerImplemented::GetShown(Handle handle)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		return m_DrawSets[handle].IsShown;
+		return drawSet->IsShown;
 	}
 
 	return false;
@@ -1059,64 +1435,82 @@ bool ManagerImplemented::GetShown(Handle handle)
 
 void ManagerImplemented::SetShown(Handle handle, bool shown)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		m_DrawSets[handle].IsShown = shown;
+		drawSet->IsShown = shown;
 	}
 }
 
-bool ManagerImplemented::GetPaused(Handle handle)
+void ManagerImplemented::SetShownFlags(const Handle* handles, const bool* shown, int32_t count)
 {
-	if (m_DrawSets.count(handle) > 0)
+	if (handles == nullptr || shown == nullptr || count <= 0)
+		return;
+
+	for (int32_t i = 0; i < count; i++)
 	{
-		return m_DrawSets[handle].IsPaused;
+		DrawSet* drawSet = m_DrawSets.Find(handles[i]);
+		if (drawSet != nullptr)
+		{
+			drawSet->IsShown = shown[i];
+		}
 	}
-
-	return false;
 }
 
-void ManagerImplemented::SetPaused(Handle handle, bool paused)
+bool ManagerImplemented::GetPaused(Handle handle)
+{
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
+	{
+		return drawSet->IsPaused;
+	}
+
+	return false;
+}
+
+void ManagerImplemented::SetPaused(Handle handle, bool paused)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		m_DrawSets[handle].IsPaused = paused;
+		drawSet->IsPaused = paused;
 	}
 }
 
 void ManagerImplemented::SetPausedToAllEffects(bool paused)
 {
-	std::map<Handle, DrawSet>::iterator it = m_DrawSets.begin();
-	while (it != m_DrawSets.end())
+	for (auto& drawSet : m_DrawSets)
 	{
-		(*it).second.IsPaused = paused;
-		++it;
+		drawSet.IsPaused = paused;
 	}
 }
 
 int ManagerImplemented::GetLayer(Handle handle)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		return m_DrawSets[handle].Layer;
+		return drawSet->Layer;
 	}
 	return 0;
 }
 
 void ManagerImplemented::SetLayer(Handle handle, int32_t layer)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		m_DrawSets[handle].Layer = layer;
+		drawSet->Layer = layer;
 	}
 }
 
 int64_t ManagerImplemented::GetGroupMask(Handle handle) const
 {
-	auto it = m_DrawSets.find(handle);
+	const DrawSet* drawSet = m_DrawSets.Find(handle);
 
-	if (it != m_DrawSets.end())
+	if (drawSet != nullptr)
 	{
-		return it->second.GroupMask;
+		return drawSet->GroupMask;
 	}
 
 	return 0;
@@ -1124,57 +1518,73 @@ int64_t ManagerImplemented::GetGroupMask(Handle handle) const
 
 void ManagerImplemented::SetGroupMask(Handle handle, int64_t groupmask)
 {
-	auto it = m_DrawSets.find(handle);
+	DrawSet* drawSet = m_DrawSets.Find(handle);
 
-	if (it != m_DrawSets.end())
+	if (drawSet != nullptr)
 	{
-		it->second.GroupMask = groupmask;
+		drawSet->GroupMask = groupmask;
 	}
 }
 
 float ManagerImplemented::GetSpeed(Handle handle) const
 {
-	auto it = m_DrawSets.find(handle);
-	if (it == m_DrawSets.end())
+	const DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet == nullptr)
 		return 0.0f;
-	return it->second.Speed;
+	return drawSet->Speed;
 }
 
 void ManagerImplemented::SetSpeed(Handle handle, float speed)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		m_DrawSets[handle].Speed = speed;
-		m_DrawSets[handle].IsParameterChanged = true;
+		drawSet->SetSpeed(speed);
+	}
+}
+
+void ManagerImplemented::SetSpeeds(const Handle* handles, const float* speeds, int32_t count)
+{
+	if (handles == nullptr || speeds == nullptr || count <= 0)
+		return;
+
+	for (int32_t i = 0; i < count; i++)
+	{
+		DrawSet* drawSet = m_DrawSets.Find(handles[i]);
+		if (drawSet != nullptr)
+		{
+			drawSet->SetSpeed(speeds[i]);
+		}
 	}
 }
 
 void ManagerImplemented::SetTimeScaleByGroup(int64_t groupmask, float timeScale)
 {
-	for (auto& it : m_DrawSets)
+	for (auto& drawSet : m_DrawSets)
 	{
-		if ((it.second.GroupMask & groupmask) != 0)
+		if ((drawSet.GroupMask & groupmask) != 0)
 		{
-			it.second.TimeScale = timeScale;
+			drawSet.TimeScale = timeScale;
 		}
 	}
 }
 
 void ManagerImplemented::SetTimeScaleByHandle(Handle handle, float timeScale)
 {
-	auto it = m_DrawSets.find(handle);
+	DrawSet* drawSet = m_DrawSets.Find(handle);
 
-	if (it != m_DrawSets.end())
+	if (drawSet != nullptr)
 	{
-		it->second.TimeScale = timeScale;
+		drawSet->TimeScale = timeScale;
 	}
 }
 
 void ManagerImplemented::SetAutoDrawing(Handle handle, bool autoDraw)
 {
-	if (m_DrawSets.count(handle) > 0)
+	DrawSet* drawSet = m_DrawSets.Find(handle);
+	if (drawSet != nullptr)
 	{
-		m_DrawSets[handle].IsAutoDrawing = autoDraw;
+		drawSet->IsAutoDrawing = autoDraw;
 	}
 }
 
@@ -1188,7 +1598,7 @@ void ManagerImplemented::Flip()
 	// execute preupdate
 	for (auto& drawSet : m_DrawSets)
 	{
-		Preupdate(drawSet.second);
+		Preupdate(drawSet);
 	}
 
 	StopStoppingEffects();
@@ -1197,8 +1607,13 @@ void ManagerImplemented::Flip()
 
 	GCDrawSet(false);
 
+	for (const auto& ds : m_renderingDrawSets)
+	{
+		m_renderingDrawSetIndexes[SlotMap<DrawSet>::GetSlotIndex(ds.Self)] = -1;
+	}
 	m_renderingDrawSets.clear();
-	m_renderingDrawSetMaps.clear();
+	m_renderingDrawSets.reserve(m_DrawSets.GetCount());
+	m_renderingDrawSetIndexes.resize(m_DrawSets.GetSlotCount(), -1);
 
 	// Generate culling
 	if (cullingNext.SizeX != cullingCurrent.SizeX || cullingNext.SizeY != cullingCurrent.SizeY ||
@@ -1206,9 +1621,8 @@ void ManagerImplemented::Flip()
 	{
 		Culling3D::SafeRelease(m_cullingWorld);
 
-		for (auto& it : m_DrawSets)
+		for (auto& ds : m_DrawSets)
 		{
-			DrawSet& ds = it.second;
 			Culling3D::SafeRelease(ds.CullingObjectPointer);
 		}
 
@@ -1218,9 +1632,8 @@ void ManagerImplemented::Flip()
 	}
 
 	{
-		for (auto& it : m_DrawSets)
+		for (auto& ds : m_DrawSets)
 		{
-			DrawSet& ds = it.second;
 			EffectImplemented* effect = (EffectImplemented*)ds.ParameterPointer.Get();
 
 			if (ds.InstanceContainerPointer == nullptr)
@@ -1296,22 +1709,31 @@ void ManagerImplemented::Flip()
 				ds.IsParameterChanged = false;
 			}
 
-			m_renderingDrawSets.push_back(ds);
-			m_renderingDrawSetMaps[it.first] = it.second;
-		}
-
-		if (m_cullingWorld != nullptr)
-		{
-			for (size_t i = 0; i < m_renderingDrawSets.size(); i++)
+			RenderingDrawSet rds;
+			rds.Self = ds.Self;
+			rds.ParameterPointer = ds.ParameterPointer.Get();
+			rds.InstanceContainerPointer = ds.InstanceContainerPointer;
+			rds.GlobalPointer = ds.GlobalPointer;
+			rds.GlobalPosition = ds.GlobalMatrix.GetTranslation();
+			rds.Layer = ds.Layer;
+			rds.IsShown = ds.IsShown;
+			rds.IsAutoDrawing = ds.IsAutoDrawing;
+			rds.CulledViewMask = 0;
+
+			m_renderingDrawSetIndexes[SlotMap<DrawSet>::GetSlotIndex(ds.Self)] = static_cast<int32_t>(m_renderingDrawSets.size());
+			m_renderingDrawSets.emplace_back(rds);
+
+			// pointers are not invalidated because the capacity is reserved
+			if (m_cullingWorld != nullptr)
 			{
-				m_renderingDrawSets[i].CullingObjectPointer->SetUserData(&(m_renderingDrawSets[i]));
+				ds.CullingObjectPointer->SetUserData(&m_renderingDrawSets.back());
 			}
 		}
 	}
 
 	m_culledObjects.clear();
-	m_culledObjectSets.clear();
 	m_culled = false;
+	m_cullingViews.clear();
 
 	if (!m_autoFlip)
 	{
@@ -1356,7 +1778,7 @@ void ManagerImplemented::DoUpdate(const UpdateParameter& parameter)
 	{
 		for (auto& ds : m_RemovingDrawSets[i])
 		{
-			ds.second.UpdateCountAfterRemoving++;
+			ds.UpdateCountAfterRemoving++;
 		}
 	}
 
@@ -1365,10 +1787,10 @@ void ManagerImplemented::DoUpdate(const UpdateParameter& parameter)
 
 	for (auto& drawSet : m_DrawSets)
 	{
-		float df = drawSet.second.IsPaused ? 0 : parameter.DeltaFrame * drawSet.second.Speed * drawSet.second.TimeScale;
-		drawSet.second.NextUpdateFrame += df;
+		float df = drawSet.IsPaused ? 0 : parameter.DeltaFrame * drawSet.Speed * drawSet.TimeScale;
+		drawSet.NextUpdateFrame += df;
 
-		maximumDeltaFrame = std::max(maximumDeltaFrame, drawSet.second.NextUpdateFrame);
+		maximumDeltaFrame = std::max(maximumDeltaFrame, drawSet.NextUpdateFrame);
 	}
 
 	int times = 0;
@@ -1391,7 +1813,7 @@ void ManagerImplemented::DoUpdate(const UpdateParameter& parameter)
 		// specify delta frames
 		for (auto& drawSet : m_DrawSets)
 		{
-			if (drawSet.second.NextUpdateFrame >= parameter.UpdateInterval)
+			if (drawSet.NextUpdateFrame >= parameter.UpdateInterval)
 			{
 				float idf = 0;
 
@@ -1401,65 +1823,23 @@ void ManagerImplemented::DoUpdate(const UpdateParameter& parameter)
 				}
 				else
 				{
-					idf = drawSet.second.NextUpdateFrame;
+					idf = drawSet.NextUpdateFrame;
 				}
 
-				drawSet.second.NextUpdateFrame -= idf;
-				drawSet.second.GlobalPointer->BeginDeltaFrame(idf);
+				drawSet.NextUpdateFrame -= idf;
+				drawSet.GlobalPointer->BeginDeltaFrame(idf);
 			}
 			else
 			{
-				drawSet.second.GlobalPointer->BeginDeltaFrame(0);
+				drawSet.GlobalPointer->BeginDeltaFrame(0);
 			}
 		}
 
-		for (auto& chunks : instanceChunks_)
-		{
-			if (m_WorkerThreads.size() >= 2)
-			{
-				const uint32_t chunkStep = (uint32_t)m_WorkerThreads.size();
-
-				for (uint32_t threadID = 1; threadID < (uint32_t)m_WorkerThreads.size(); threadID++)
-				{
-					const uint32_t chunkOffset = threadID;
-					// Process on worker thread
-					m_WorkerThreads[threadID].RunAsync([this, &chunks, chunkOffset, chunkStep]() {
-						for (size_t i = chunkOffset; i < chunks.size(); i += chunkStep)
-						{
-							chunks[i]->UpdateInstances();
-						}
-					});
-				}
-
-				// Process on this thread
-				for (size_t i = 0; i < chunks.size(); i += chunkStep)
-				{
-					chunks[i]->UpdateInstances();
-				}
-
-				// Wait for all worker threads completion
-				for (uint32_t threadID = 1; threadID < (uint32_t)m_WorkerThreads.size(); threadID++)
-				{
-					m_WorkerThreads[threadID].WaitForComplete();
-				}
-			}
-			else
-			{
-				for (auto chunk : chunks)
-				{
-					chunk->UpdateInstances();
-				}
-			}
-
-			for (auto chunk : chunks)
-			{
-				chunk->GenerateChildrenInRequired();
-			}
-		}
+		UpdateInstanceChunks();
 
 		for (auto& drawSet : m_DrawSets)
 		{
-			UpdateHandleInternal(drawSet.second);
+			UpdateHandleInternal(drawSet);
 		}
 	}
 
@@ -1511,35 +1891,33 @@ void ManagerImplemented::EndUpdate()
 void ManagerImplemented::UpdateHandle(Handle handle, float deltaFrame)
 {
 	{
-		auto it = m_DrawSets.find(handle);
-		if (it != m_DrawSets.end())
+		DrawSet* drawSet = m_DrawSets.Find(handle);
+		if (drawSet != nullptr)
 		{
-			DrawSet& drawSet = it->second;
-
 			{
-				float df = drawSet.IsPaused ? 0 : deltaFrame * drawSet.Speed * drawSet.TimeScale;
-				drawSet.NextUpdateFrame += df;
+				float df = drawSet->IsPaused ? 0 : deltaFrame * drawSet->Speed * drawSet->TimeScale;
+				drawSet->NextUpdateFrame += df;
 
-				drawSet.GlobalPointer->BeginDeltaFrame(drawSet.NextUpdateFrame);
-				drawSet.NextUpdateFrame = 0.0f;
+				drawSet->GlobalPointer->BeginDeltaFrame(drawSet->NextUpdateFrame);
+				drawSet->NextUpdateFrame = 0.0f;
 			}
 
-			UpdateInstancesByInstanceGlobal(drawSet);
+			UpdateInstancesByInstanceGlobal(*drawSet);
 
-			UpdateHandleInternal(drawSet);
+			UpdateHandleInternal(*drawSet);
 		}
 	}
 }
 
 void ManagerImplemented::UpdateHandleToMoveToFrame(Handle handle, float frame)
 {
-	auto it = m_DrawSets.find(handle);
-	if (it == m_DrawSets.end())
+	DrawSet* drawSetPtr = m_DrawSets.Find(handle);
+	if (drawSetPtr == nullptr)
 	{
 		return;
 	}
 
-	DrawSet& drawSet = it->second;
+	DrawSet& drawSet = *drawSetPtr;
 
 	if (frame < drawSet.GlobalPointer->GetUpdatedFrame())
 	{
@@ -1565,10 +1943,19 @@ void ManagerImplemented::UpdateInstancesByInstanceGlobal(const DrawSet& drawSet)
 			chunk->UpdateInstancesByInstanceGlobal(drawSet.GlobalPointer);
 		}
 
+		auto& requests = m_childGenerationRequests[0];
+
 		for (auto chunk : chunks)
 		{
-			chunk->GenerateChildrenInRequiredByInstanceGlobal(drawSet.GlobalPointer);
+			chunk->CollectChildrenInRequiredByInstanceGlobal(drawSet.GlobalPointer, requests);
 		}
+
+		for (const auto& request : requests)
+		{
+			Instance::GenerateChild(request);
+		}
+
+		requests.clear();
 	}
 }
 
@@ -1640,15 +2027,14 @@ void ManagerImplemented::Preupdate(DrawSet& drawSet)
 	}
 }
 
-bool ManagerImplemented::IsClippedWithDepth(DrawSet& drawSet, InstanceContainer* container, const Manager::DrawParameter& drawParameter)
+bool ManagerImplemented::IsClippedWithDepth(const RenderingDrawSet& drawSet, InstanceContainer* container, const Manager::DrawParameter& drawParameter)
 {
 
 	// don't use this parameter
 	if (container->m_pEffectNode->DepthValues.DepthParameter.DepthClipping > FLT_MAX / 10)
 		return false;
 
-	SIMD::Vec3f pos = drawSet.GlobalMatrix.GetTranslation();
-	auto distance = SIMD::Vec3f::Dot(SIMD::Vec3f(drawParameter.CameraPosition) - pos, SIMD::Vec3f(drawParameter.CameraDirection));
+	auto distance = SIMD::Vec3f::Dot(SIMD::Vec3f(drawParameter.CameraPosition) - drawSet.GlobalPosition, SIMD::Vec3f(drawParameter.CameraDirection));
 	if (container->m_pEffectNode->DepthValues.DepthParameter.DepthClipping < distance)
 	{
 		return true;
@@ -1659,6 +2045,28 @@ bool ManagerImplemented::IsClippedWithDepth(DrawSet& drawSet, InstanceContainer*
 	}
 }
 
+ManagerImplemented::RenderingDrawSet* ManagerImplemented::FindRenderingDrawSet(Handle handle)
+{
+	if (handle < 0)
+	{
+		return nullptr;
+	}
+
+	const auto slotIndex = SlotMap<DrawSet>::GetSlotIndex(handle);
+	if (slotIndex >= static_cast<int32_t>(m_renderingDrawSetIndexes.size()))
+	{
+		return nullptr;
+	}
+
+	const auto index = m_renderingDrawSetIndexes[slotIndex];
+	if (index < 0 || m_renderingDrawSets[index].Self != handle)
+	{
+		return nullptr;
+	}
+
+	return &m_renderingDrawSets[index];
+}
+
 void ManagerImplemented::StopWithoutRemoveDrawSet(DrawSet& drawSet)
 {
 	drawSet.InstanceContainerPointer->KillAllInstances(true);
@@ -1720,211 +2128,232 @@ void ManagerImplemented::ResetAndPlayWithDataSet(DrawSet& drawSet, float frame)
 	drawSet.GlobalPointer->EndDeltaFrame();
 }
 
-void ManagerImplemented::Draw(const Manager::DrawParameter& drawParameter)
+void ManagerImplemented::DrawDrawSets(const Manager::DrawParameter& drawParameter, const std::function<void(RenderingDrawSet& drawSet)>& drawDrawSet)
 {
-	if (m_WorkerThreads.size() > 0)
-	{
-		m_WorkerThreads[0].WaitForComplete();
-	}
+	m_drawingViewIndex = drawParameter.ViewIndex;
 
-	std::lock_guard<std::mutex> lock(m_renderingMutex);
+	auto isDrawn = [&drawParameter](const RenderingDrawSet& drawSet) {
+		if (drawSet.InstanceContainerPointer == nullptr)
+		{
+			return false;
+		}
 
-	// start to record a time
-	int64_t beginTime = ::Effekseer::GetTime();
+		return drawSet.IsShown && drawSet.IsAutoDrawing && ((drawParameter.CameraCullingMask & (1 << drawSet.Layer)) != 0);
+	};
 
-	if (m_culled)
+	if (m_isParallelDrawingEnabled && m_WorkerThreads.size() >= 2)
 	{
-		for (size_t i = 0; i < m_culledObjects.size(); i++)
-		{
-			DrawSet& drawSet = *m_culledObjects[i];
-			if (drawSet.InstanceContainerPointer == nullptr)
-			{
-				continue;
-			}
+		m_parallelDrawingEntries.clear();
 
-			if (drawSet.IsShown && drawSet.IsAutoDrawing && ((drawParameter.CameraCullingMask & (1 << drawSet.Layer)) != 0))
+		auto addEntry = [this](RenderingDrawSet& drawSet) {
+			ParallelDrawingEntry entry;
+			entry.DrawSetPointer = &drawSet;
+			entry.Next = -1;
+			entry.ThreadID = 0;
+			entry.CommandBegin = 0;
+			entry.CommandEnd = 0;
+			m_parallelDrawingEntries.emplace_back(entry);
+		};
+
+		if (m_culled)
+		{
+			for (size_t i = 0; i < m_culledObjects.size(); i++)
 			{
-				if (drawSet.GlobalPointer->RenderedInstanceContainers.size() > 0)
+				if (isDrawn(*m_culledObjects[i]) && IsInDrawingView(*m_culledObjects[i]))
 				{
-					for (auto& c : drawSet.GlobalPointer->RenderedInstanceContainers)
-					{
-						if (IsClippedWithDepth(drawSet, c, drawParameter))
-							continue;
-
-						c->Draw(false);
-					}
+					addEntry(*m_culledObjects[i]);
 				}
-				else
+			}
+		}
+		else
+		{
+			for (size_t i = 0; i < m_renderingDrawSets.size(); i++)
+			{
+				if (isDrawn(m_renderingDrawSets[i]))
 				{
-					drawSet.InstanceContainerPointer->Draw(true);
+					addEntry(m_renderingDrawSets[i]);
 				}
 			}
 		}
+
+		DrawDrawSetsInParallel(drawDrawSet);
+		return;
 	}
-	else
+
+	if (m_culled)
 	{
-		for (size_t i = 0; i < m_renderingDrawSets.size(); i++)
+		for (size_t i = 0; i < m_culledObjects.size(); i++)
 		{
-			DrawSet& drawSet = m_renderingDrawSets[i];
+			RenderingDrawSet& drawSet = *m_culledObjects[i];
 
-			if (drawSet.InstanceContainerPointer == nullptr)
+			if (isDrawn(drawSet) && IsInDrawingView(drawSet))
 			{
-				continue;
+				drawDrawSet(drawSet);
 			}
+		}
+	}
+	else
+	{
+		for (size_t i = 0; i < m_renderingDrawSets.size(); i++)
+		{
+			RenderingDrawSet& drawSet = m_renderingDrawSets[i];
 
-			if (drawSet.IsShown && drawSet.IsAutoDrawing && ((drawParameter.CameraCullingMask & (1 << drawSet.Layer)) != 0))
+			if (isDrawn(drawSet))
 			{
-				if (drawSet.GlobalPointer->RenderedInstanceContainers.size() > 0)
-				{
-					for (auto& c : drawSet.GlobalPointer->RenderedInstanceContainers)
-					{
-						if (IsClippedWithDepth(drawSet, c, drawParameter))
-							continue;
-
-						c->Draw(false);
-					}
-				}
-				else
-				{
-					drawSet.InstanceContainerPointer->Draw(true);
-				}
+				drawDrawSet(drawSet);
 			}
 		}
 	}
-
-	// calculate a time
-	m_drawTime = (int)(Effekseer::GetTime() - beginTime);
 }
 
-void ManagerImplemented::DrawBack(const Manager::DrawParameter& drawParameter)
+void ManagerImplemented::DrawDrawSetsInParallel(const std::function<void(RenderingDrawSet& drawSet)>& drawDrawSet)
 {
-	std::lock_guard<std::mutex> lock(m_renderingMutex);
+	// link entries of the same effect in order of entries
+	m_parallelDrawingTasks.clear();
+	m_parallelDrawingTaskIndexes.clear();
 
-	// start to record a time
-	int64_t beginTime = ::Effekseer::GetTime();
-
-	if (m_culled)
+	for (int32_t i = static_cast<int32_t>(m_parallelDrawingEntries.size()) - 1; i >= 0; i--)
 	{
-		for (size_t i = 0; i < m_culledObjects.size(); i++)
+		auto& entry = m_parallelDrawingEntries[i];
+		auto effect = entry.DrawSetPointer->ParameterPointer;
+
+		auto it = m_parallelDrawingTaskIndexes.find(effect);
+		if (it == m_parallelDrawingTaskIndexes.end())
 		{
-			DrawSet& drawSet = *m_culledObjects[i];
+			it = m_parallelDrawingTaskIndexes.emplace(effect, static_cast<int32_t>(m_parallelDrawingTasks.size())).first;
+			m_parallelDrawingTasks.emplace_back(-1);
+		}
 
-			if (drawSet.InstanceContainerPointer == nullptr)
-			{
-				continue;
-			}
+		entry.Next = m_parallelDrawingTasks[it->second];
+		m_parallelDrawingTasks[it->second] = i;
+	}
 
-			if (drawSet.IsShown && drawSet.IsAutoDrawing && ((drawParameter.CameraCullingMask & (1 << drawSet.Layer)) != 0))
-			{
-				auto e = (EffectImplemented*)drawSet.ParameterPointer.Get();
-				for (int32_t j = 0; j < e->renderingNodesThreshold; j++)
-				{
-					if (IsClippedWithDepth(drawSet, drawSet.GlobalPointer->RenderedInstanceContainers[j], drawParameter))
-						continue;
+	for (auto& buffer : m_renderingCommandBuffers)
+	{
+		buffer->SetTargetRenderers(
+			m_spriteRenderer.Get(), m_ribbonRenderer.Get(), m_ringRenderer.Get(), m_modelRenderer.Get(), m_trackRenderer.Get());
+	}
 
-					drawSet.GlobalPointer->RenderedInstanceContainers[j]->Draw(false);
-				}
-			}
+	// renderers returned by this manager are replaced with recorders on each thread
+	ExecuteParallel(static_cast<int32_t>(m_parallelDrawingTasks.size()), [this, &drawDrawSet](int32_t threadID, int32_t taskIndex) {
+		auto buffer = m_renderingCommandBuffers[threadID].get();
+		RenderingCommandBuffer::SetRecordingBuffer(buffer);
+
+		for (int32_t i = m_parallelDrawingTasks[taskIndex]; i >= 0; i = m_parallelDrawingEntries[i].Next)
+		{
+			auto& entry = m_parallelDrawingEntries[i];
+			entry.ThreadID = threadID;
+			entry.CommandBegin = buffer->GetCommandCount();
+			drawDrawSet(*entry.DrawSetPointer);
+			entry.CommandEnd = buffer->GetCommandCount();
 		}
+
+		RenderingCommandBuffer::SetRecordingBuffer(nullptr);
+	});
+
+	// submit in the same order as drawing on this thread
+	for (const auto& entry : m_parallelDrawingEntries)
+	{
+		m_renderingCommandBuffers[entry.ThreadID]->Submit(entry.CommandBegin, entry.CommandEnd);
 	}
-	else
+
+	for (auto& buffer : m_renderingCommandBuffers)
 	{
-		for (size_t i = 0; i < m_renderingDrawSets.size(); i++)
-		{
-			DrawSet& drawSet = m_renderingDrawSets[i];
+		buffer->Clear();
+	}
+}
 
-			if (drawSet.InstanceContainerPointer == nullptr)
-			{
-				continue;
-			}
+void ManagerImplemented::Draw(const Manager::DrawParameter& drawParameter)
+{
+	if (m_WorkerThreads.size() > 0)
+	{
+		m_WorkerThreads[0].WaitForComplete();
+	}
+
+	std::lock_guard<std::mutex> lock(m_renderingMutex);
+
+	// start to record a time
+	int64_t beginTime = ::Effekseer::GetTime();
 
-			if (drawSet.IsShown && drawSet.IsAutoDrawing && ((drawParameter.CameraCullingMask & (1 << drawSet.Layer)) != 0))
+	DrawDrawSets(drawParameter, [this, &drawParameter](RenderingDrawSet& drawSet) {
+		if (drawSet.GlobalPointer->RenderedInstanceContainers.size() > 0)
+		{
+			for (auto& c : drawSet.GlobalPointer->RenderedInstanceContainers)
 			{
-				auto e = (EffectImplemented*)drawSet.ParameterPointer.Get();
-				for (int32_t j = 0; j < e->renderingNodesThreshold; j++)
-				{
-					if (IsClippedWithDepth(drawSet, drawSet.GlobalPointer->RenderedInstanceContainers[j], drawParameter))
-						continue;
+				if (IsClippedWithDepth(drawSet, c, drawParameter))
+					continue;
 
-					drawSet.GlobalPointer->RenderedInstanceContainers[j]->Draw(false);
-				}
+				c->Draw(false);
 			}
 		}
-	}
+		else
+		{
+			drawSet.InstanceContainerPointer->Draw(true);
+		}
+	});
 
 	// calculate a time
 	m_drawTime = (int)(Effekseer::GetTime() - beginTime);
 }
 
-void ManagerImplemented::DrawFront(const Manager::DrawParameter& drawParameter)
+void ManagerImplemented::DrawBack(const Manager::DrawParameter& drawParameter)
 {
+	// worker threads must not be updating to draw in parallel
+	if (m_isParallelDrawingEnabled && m_WorkerThreads.size() > 0)
+	{
+		m_WorkerThreads[0].WaitForComplete();
+	}
+
 	std::lock_guard<std::mutex> lock(m_renderingMutex);
 
 	// start to record a time
 	int64_t beginTime = ::Effekseer::GetTime();
 
-	if (m_culled)
-	{
-		for (size_t i = 0; i < m_culledObjects.size(); i++)
+	DrawDrawSets(drawParameter, [this, &drawParameter](RenderingDrawSet& drawSet) {
+		auto e = (EffectImplemented*)drawSet.ParameterPointer;
+		for (int32_t j = 0; j < e->renderingNodesThreshold; j++)
 		{
-			DrawSet& drawSet = *m_culledObjects[i];
-
-			if (drawSet.InstanceContainerPointer == nullptr)
-			{
+			if (IsClippedWithDepth(drawSet, drawSet.GlobalPointer->RenderedInstanceContainers[j], drawParameter))
 				continue;
-			}
-
-			if (drawSet.IsShown && drawSet.IsAutoDrawing && ((drawParameter.CameraCullingMask & (1 << drawSet.Layer)) != 0))
-			{
-				if (drawSet.GlobalPointer->RenderedInstanceContainers.size() > 0)
-				{
-					auto e = (EffectImplemented*)drawSet.ParameterPointer.Get();
-					for (size_t j = e->renderingNodesThreshold; j < drawSet.GlobalPointer->RenderedInstanceContainers.size(); j++)
-					{
-						if (IsClippedWithDepth(drawSet, drawSet.GlobalPointer->RenderedInstanceContainers[j], drawParameter))
-							continue;
 
-						drawSet.GlobalPointer->RenderedInstanceContainers[j]->Draw(false);
-					}
-				}
-				else
-				{
-					drawSet.InstanceContainerPointer->Draw(true);
-				}
-			}
+			drawSet.GlobalPointer->RenderedInstanceContainers[j]->Draw(false);
 		}
-	}
-	else
+	});
+
+	// calculate a time
+	m_drawTime = (int)(Effekseer::GetTime() - beginTime);
+}
+
+void ManagerImplemented::DrawFront(const Manager::DrawParameter& drawParameter)
+{
+	// worker threads must not be updating to draw in parallel
+	if (m_isParallelDrawingEnabled && m_WorkerThreads.size() > 0)
 	{
-		for (size_t i = 0; i < m_renderingDrawSets.size(); i++)
-		{
-			DrawSet& drawSet = m_renderingDrawSets[i];
+		m_WorkerThreads[0].WaitForComplete();
+	}
 
-			if (drawSet.InstanceContainerPointer == nullptr)
-			{
-				continue;
-			}
+	std::lock_guard<std::mutex> lock(m_renderingMutex);
+
+	// start to record a time
+	int64_t beginTime = ::Effekseer::GetTime();
 
-			if (drawSet.IsShown && drawSet.IsAutoDrawing && ((drawParameter.CameraCullingMask & (1 << drawSet.Layer)) != 0))
+	DrawDrawSets(drawParameter, [this, &drawParameter](RenderingDrawSet& drawSet) {
+		if (drawSet.GlobalPointer->RenderedInstanceContainers.size() > 0)
+		{
+			auto e = (EffectImplemented*)drawSet.ParameterPointer;
+			for (size_t j = e->renderingNodesThreshold; j < drawSet.GlobalPointer->RenderedInstanceContainers.size(); j++)
 			{
-				if (drawSet.GlobalPointer->RenderedInstanceContainers.size() > 0)
-				{
-					auto e = (EffectImplemented*)drawSet.ParameterPointer.Get();
-					for (size_t j = e->renderingNodesThreshold; j < drawSet.GlobalPointer->RenderedInstanceContainers.size(); j++)
-					{
-						if (IsClippedWithDepth(drawSet, drawSet.GlobalPointer->RenderedInstanceContainers[j], drawParameter))
-							continue;
+				if (IsClippedWithDepth(drawSet, drawSet.GlobalPointer->RenderedInstanceContainers[j], drawParameter))
+					continue;
 
-						drawSet.GlobalPointer->RenderedInstanceContainers[j]->Draw(false);
-					}
-				}
-				else
-				{
-					drawSet.InstanceContainerPointer->Draw(true);
-				}
+				drawSet.GlobalPointer->RenderedInstanceContainers[j]->Draw(false);
 			}
 		}
-	}
+		else
+		{
+			drawSet.InstanceContainerPointer->Draw(true);
+		}
+	});
 
 	// calculate a time
 	m_drawTime = (int)(Effekseer::GetTime() - beginTime);
@@ -1969,7 +2398,7 @@ Handle ManagerImplemented::Play(const EffectRef& effect, const Vector3D& positio
 	// an instance is created in Preupdate because effects need to show instances without update(0 frame)
 	Handle handle = AddDrawSet(effect, nullptr, pGlobal);
 
-	auto& drawSet = m_DrawSets[handle];
+	auto& drawSet = *m_DrawSets.Find(handle);
 
 	drawSet.GlobalMatrix = SIMD::Mat43f::Translation(position);
 
@@ -1986,7 +2415,7 @@ int ManagerImplemented::GetCameraCullingMaskToShowAllEffects()
 
 	for (auto& ds : m_DrawSets)
 	{
-		auto layer = 1 << ds.second.Layer;
+		auto layer = 1 << ds.Layer;
 		mask |= layer;
 	}
 
@@ -2002,10 +2431,12 @@ void ManagerImplemented::DrawHandle(Handle handle, const Manager::DrawParameter&
 
 	std::lock_guard<std::mutex> lock(m_renderingMutex);
 
-	auto it = m_renderingDrawSetMaps.find(handle);
-	if (it != m_renderingDrawSetMaps.end())
+	m_drawingViewIndex = drawParameter.ViewIndex;
+
+	RenderingDrawSet* drawSetPtr = FindRenderingDrawSet(handle);
+	if (drawSetPtr != nullptr)
 	{
-		DrawSet& drawSet = it->second;
+		RenderingDrawSet& drawSet = *drawSetPtr;
 
 		if (drawSet.InstanceContainerPointer == nullptr)
 		{
@@ -2014,7 +2445,7 @@ void ManagerImplemented::DrawHandle(Handle handle, const Manager::DrawParameter&
 
 		if (m_culled)
 		{
-			if (m_culledObjectSets.find(drawSet.Self) != m_culledObjectSets.end())
+			if (IsInDrawingView(drawSet))
 			{
 				if (drawSet.IsShown)
 				{
@@ -2067,15 +2498,17 @@ void ManagerImplemented::DrawHandleBack(Handle handle, const Manager::DrawParame
 
 	std::lock_guard<std::mutex> lock(m_renderingMutex);
 
-	std::map<Handle, DrawSet>::iterator it = m_renderingDrawSetMaps.find(handle);
-	if (it != m_renderingDrawSetMaps.end())
+	m_drawingViewIndex = drawParameter.ViewIndex;
+
+	RenderingDrawSet* drawSetPtr = FindRenderingDrawSet(handle);
+	if (drawSetPtr != nullptr)
 	{
-		DrawSet& drawSet = it->second;
-		auto e = (EffectImplemented*)drawSet.ParameterPointer.Get();
+		RenderingDrawSet& drawSet = *drawSetPtr;
+		auto e = (EffectImplemented*)drawSet.ParameterPointer;
 
 		if (m_culled)
 		{
-			if (m_culledObjectSets.find(drawSet.Self) != m_culledObjectSets.end())
+			if (IsInDrawingView(drawSet))
 			{
 				if (drawSet.IsShown)
 				{
@@ -2114,11 +2547,13 @@ void ManagerImplemented::DrawHandleFront(Handle handle, const Manager::DrawParam
 
 	std::lock_guard<std::mutex> lock(m_renderingMutex);
 
-	std::map<Handle, DrawSet>::iterator it = m_renderingDrawSetMaps.find(handle);
-	if (it != m_renderingDrawSetMaps.end())
+	m_drawingViewIndex = drawParameter.ViewIndex;
+
+	RenderingDrawSet* drawSetPtr = FindRenderingDrawSet(handle);
+	if (drawSetPtr != nullptr)
 	{
-		DrawSet& drawSet = it->second;
-		auto e = (EffectImplemented*)drawSet.ParameterPointer.Get();
+		RenderingDrawSet& drawSet = *drawSetPtr;
+		auto e = (EffectImplemented*)drawSet.ParameterPointer;
 
 		if (drawSet.InstanceContainerPointer == nullptr)
 		{
@@ -2127,7 +2562,7 @@ void ManagerImplemented::DrawHandleFront(Handle handle, const Manager::DrawParam
 
 		if (m_culled)
 		{
-			if (m_culledObjectSets.find(drawSet.Self) != m_culledObjectSets.end())
+			if (IsInDrawingView(drawSet))
 			{
 				if (drawSet.IsShown)
 				{
@@ -2194,31 +2629,29 @@ void ManagerImplemented::BeginReloadEffect(const EffectRef& effect, bool doLockT
 		m_isLockedWithRenderingMutex = true;
 	}
 
-	for (auto& it : m_DrawSets)
+	for (auto& ds : m_DrawSets)
 	{
-		if (it.second.ParameterPointer != effect)
+		if (ds.ParameterPointer != effect)
 			continue;
 
-		if (it.second.InstanceContainerPointer == nullptr)
+		if (ds.InstanceContainerPointer == nullptr)
 		{
 			continue;
 		}
 
 		// dispose instances
-		StopWithoutRemoveDrawSet(it.second);
+		StopWithoutRemoveDrawSet(ds);
 	}
 }
 
 void ManagerImplemented::EndReloadEffect(const EffectRef& effect, bool doLockThread)
 {
-	for (auto& it : m_DrawSets)
+	for (auto& ds : m_DrawSets)
 	{
-		auto& ds = it.second;
-
 		if (ds.ParameterPointer != effect)
 			continue;
 
-		if (it.second.InstanceContainerPointer != nullptr)
+		if (ds.InstanceContainerPointer != nullptr)
 		{
 			continue;
 		}
@@ -2248,40 +2681,147 @@ void ManagerImplemented::CreateCullingWorld(float xsize, float ysize, float zsiz
 
 void ManagerImplemented::CalcCulling(const Matrix44& cameraProjMat, bool isOpenGL)
 {
-	if (m_cullingWorld == nullptr)
+	CalcCulling(&cameraProjMat, 1, isOpenGL);
+}
+
+void ManagerImplemented::CalcCulling(const Matrix44* cameraProjMats, int32_t viewCount, bool isOpenGL)
+{
+	assert(cameraProjMats != nullptr && viewCount > 0);
+
+	// no view is rejected because nothing would be drawn
+	if (m_cullingWorld == nullptr || cameraProjMats == nullptr || viewCount <= 0)
 		return;
 
+	viewCount = std::min(viewCount, static_cast<int32_t>(Culling3D::World::MaxViewCount));
+
 	m_culledObjects.clear();
-	m_culledObjectSets.clear();
 
-	Matrix44 mat = cameraProjMat;
-	mat.Transpose();
+	for (auto& drawSet : m_renderingDrawSets)
+	{
+		drawSet.CulledViewMask = 0;
+	}
 
-	Culling3D::Matrix44 cullingMat;
+	std::array<Culling3D::Matrix44, Culling3D::World::MaxViewCount> cullingMats;
 
-	for (int32_t c = 0; c < 4; c++)
+	for (int32_t v = 0; v < viewCount; v++)
 	{
-		for (int32_t r = 0; r < 4; r++)
+		Matrix44 mat = cameraProjMats[v];
+		mat.Transpose();
+
+		for (int32_t c = 0; c < 4; c++)
 		{
-			cullingMat.Values[c][r] = mat.Values[c][r];
+			for (int32_t r = 0; r < 4; r++)
+			{
+				cullingMats[v].Values[c][r] = mat.Values[c][r];
+			}
 		}
 	}
 
-	m_cullingWorld->Culling(cullingMat, isOpenGL);
+	// all views are culled with one scan of the world
+	m_cullingWorld->Culling(cullingMats.data(), viewCount, isOpenGL);
 
 	for (int32_t i = 0; i < m_cullingWorld->GetObjectCount(); i++)
 	{
 		Culling3D::Object* o = m_cullingWorld->GetObject(i);
-		DrawSet* ds = (DrawSet*)o->GetUserData();
+		RenderingDrawSet* ds = (RenderingDrawSet*)o->GetUserData();
 
+		ds->CulledViewMask = m_cullingWorld->GetObjectViewMask(i);
 		m_culledObjects.push_back(ds);
-		m_culledObjectSets.insert(ds->Self);
 	}
 
-	// sort with handle
-	std::sort(m_culledObjects.begin(), m_culledObjects.end(), [](DrawSet* const& lhs, DrawSet* const& rhs) { return lhs->Self > rhs->Self; });
+	// sort in reverse order of playing (objects on rendering are in order of playing)
+	std::sort(m_culledObjects.begin(), m_culledObjects.end(), [](RenderingDrawSet* const& lhs, RenderingDrawSet* const& rhs) { return lhs > rhs; });
 
 	m_culled = true;
+
+	m_cullingViews.resize(viewCount);
+
+	for (int32_t v = 0; v < viewCount; v++)
+	{
+		const auto& cameraProjMat = cameraProjMats[v];
+		auto& view = m_cullingViews[v];
+
+		// planes are extracted from columns because points are multiplied as row vectors
+		auto getColumn = [&cameraProjMat](int32_t c) -> std::array<float, 4> {
+			return {cameraProjMat.Values[0][c], cameraProjMat.Values[1][c], cameraProjMat.Values[2][c], cameraProjMat.Values[3][c]};
+		};
+
+		auto combine = [](const std::array<float, 4>& lhs, const std::array<float, 4>& rhs, float sign) -> std::array<float, 4> {
+			return {lhs[0] + rhs[0] * sign, lhs[1] + rhs[1] * sign, lhs[2] + rhs[2] * sign, lhs[3] + rhs[3] * sign};
+		};
+
+		const auto colX = getColumn(0);
+		const auto colY = getColumn(1);
+		const auto colZ = getColumn(2);
+		const auto colW = getColumn(3);
+
+		const std::array<std::array<float, 4>, 6> planes = {
+			combine(colW, colX, 1.0f),
+			combine(colW, colX, -1.0f),
+			combine(colW, colY, 1.0f),
+			combine(colW, colY, -1.0f),
+			isOpenGL ? combine(colW, colZ, 1.0f) : colZ,
+			combine(colW, colZ, -1.0f),
+		};
+
+		// an infinite far plane is not supported as well as Culling3D
+		view.IsFrustumValid = true;
+		for (size_t i = 0; i < planes.size(); i++)
+		{
+			for (const auto& value : planes[i])
+			{
+				if (!std::isfinite(value))
+				{
+					view.IsFrustumValid = false;
+				}
+			}
+
+			view.PlaneXs[i] = planes[i][0];
+			view.PlaneYs[i] = planes[i][1];
+			view.PlaneZs[i] = planes[i][2];
+			view.PlaneWs[i] = planes[i][3];
+		}
+
+		for (size_t i = planes.size(); i < view.PlaneXs.size(); i++)
+		{
+			view.PlaneXs[i] = 0.0f;
+			view.PlaneYs[i] = 0.0f;
+			view.PlaneZs[i] = 0.0f;
+			view.PlaneWs[i] = 1.0f;
+		}
+	}
+}
+
+bool ManagerImplemented::IsCulledByFrustum(const SIMD::Vec3f& min, const SIMD::Vec3f& max) const
+{
+	if (!IsFrustumValid())
+	{
+		return false;
+	}
+
+	const auto& view = m_cullingViews[m_drawingViewIndex];
+	const auto zero = SIMD::Float4::SetZero();
+
+	for (size_t i = 0; i < view.PlaneXs.size(); i += 4)
+	{
+		const auto planeX = SIMD::Float4::Load4(&view.PlaneXs[i]);
+		const auto planeY = SIMD::Float4::Load4(&view.PlaneYs[i]);
+		const auto planeZ = SIMD::Float4::Load4(&view.PlaneZs[i]);
+
+		// test corners which are the farthest along the normals of planes
+		const auto x = SIMD::Float4::Select(SIMD::Float4::GreaterEqual(planeX, zero), SIMD::Float4(max.GetX()), SIMD::Float4(min.GetX()));
+		const auto y = SIMD::Float4::Select(SIMD::Float4::GreaterEqual(planeY, zero), SIMD::Float4(max.GetY()), SIMD::Float4(min.GetY()));
+		const auto z = SIMD::Float4::Select(SIMD::Float4::GreaterEqual(planeZ, zero), SIMD::Float4(max.GetZ()), SIMD::Float4(min.GetZ()));
+
+		const auto distance = planeX * x + planeY * y + planeZ * z + SIMD::Float4::Load4(&view.PlaneWs[i]);
+
+		if (SIMD::Float4::MoveMask(SIMD::Float4::LessThan(distance, zero)) != 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
 }
 
 void ManagerImplemented::RessignCulling()
@@ -2290,7 +2830,11 @@ void ManagerImplemented::RessignCulling()
 		return;
 
 	m_culledObjects.clear();
-	m_culledObjectSets.clear();
+
+	for (auto& drawSet : m_renderingDrawSets)
+	{
+		drawSet.CulledViewMask = 0;
+	}
 
 	m_cullingWorld->Reassign();
 }
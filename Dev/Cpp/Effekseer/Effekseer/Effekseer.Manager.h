@@ -79,6 +79,16 @@ public:
 		*/
 		int32_t CameraCullingMask;
 
+		/**
+			@brief
+			\~English An index of a view specified with CalcCulling
+			\~Japanese CalcCullingで指定された視点の番号
+			@note
+			\~English Only effects in the view are drawn after CalcCulling. It is ignored when CalcCulling is not called.
+			\~Japanese CalcCullingの後、視点に含まれるエフェクトのみ描画される。CalcCullingが呼ばれていない場合は無視される。
+		*/
+		int32_t ViewIndex;
+
 		DrawParameter();
 	};
 
@@ -113,6 +123,29 @@ public:
 	*/
 	virtual ThreadNativeHandleType GetWorkerThreadHandle(uint32_t threadID) = 0;
 
+	/**
+		@brief
+		\~English Specify whether rendering parameters of effects are generated on worker threads when effects are drawn
+		\~Japanese エフェクトの描画時に描画用のパラメーターをワーカースレッドで生成するかどうかを指定する。
+		@note
+		\~English
+		Parameters are recorded on each worker thread and they are passed to renderers on the calling thread in the same order as usual.
+		It is valid only if two or more worker threads are launched. Only SpriteRenderer::WriteVertices is called from worker threads,
+		and vertices written by it are drawn with SpriteRenderer::RenderingVertices on the calling thread.
+		\~Japanese
+		パラメーターは各ワーカースレッドで記録され、呼び出したスレッドで通常と同じ順番でレンダラーに渡される。
+		2つ以上のワーカースレッドが起動している場合のみ有効である。ワーカースレッドからは SpriteRenderer::WriteVertices のみが呼ばれ、
+		書き込まれた頂点は呼び出したスレッドで SpriteRenderer::RenderingVertices により描画される。
+	*/
+	virtual void SetParallelDrawingEnabled(bool enabled) = 0;
+
+	/**
+		@brief
+		\~English Get whether rendering parameters of effects are generated on worker threads when effects are drawn
+		\~Japanese エフェクトの描画時に描画用のパラメーターをワーカースレッドで生成するかどうかを取得する。
+	*/
+	virtual bool GetParallelDrawingEnabled() const = 0;
+
 	/**
 		@brief
 		\~English get an allocator
@@ -398,6 +431,19 @@ public:
 	*/
 	virtual void SetMatrix(Handle handle, const Matrix43& mat) = 0;
 
+	/**
+		@brief
+		\~English Set transform matrices of many effects at once
+		\~Japanese 複数のエフェクトのインスタンスに変換行列を一度に設定する。
+		@param	handles		[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	matrices	[in]	\~English matrices for each handle \~Japanese ハンドルごとの変換行列
+		@param	count		[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetMatrices(const Handle* handles, const Matrix43* matrices, int32_t count) = 0;
+
 	/**
 		@brief	エフェクトのインスタンスの位置を取得する。
 		@param	handle	[in]	インスタンスのハンドル
@@ -419,6 +465,19 @@ public:
 	*/
 	virtual void SetLocation(Handle handle, const Vector3D& location) = 0;
 
+	/**
+		@brief
+		\~English Set locations of many effects at once
+		\~Japanese 複数のエフェクトのインスタンスに位置を一度に設定する。
+		@param	handles		[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	locations	[in]	\~English locations for each handle \~Japanese ハンドルごとの位置
+		@param	count		[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetLocations(const Handle* handles, const Vector3D* locations, int32_t count) = 0;
+
 	/**
 		@brief	エフェクトのインスタンスの位置に加算する。
 		@param	location	[in]	加算する値
@@ -482,6 +541,20 @@ public:
 	*/
 	virtual void SetDynamicInput(Handle handle, int32_t index, float value) = 0;
 
+	/**
+		@brief
+		\~English Specify a dynamic parameter of many effects at once
+		\~Japanese 複数のエフェクトの動的パラメーターを一度に設定する。
+		@param	handles	[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	index	[in]	\~English an index of the dynamic parameter \~Japanese 動的パラメーターのインデックス
+		@param	values	[in]	\~English values for each handle \~Japanese ハンドルごとの値
+		@param	count	[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetDynamicInputs(const Handle* handles, int32_t index, const float* values, int32_t count) = 0;
+
 	/**
 		@brief	エフェクトのベース行列を取得する。
 		@param	handle	[in]	インスタンスのハンドル
@@ -498,6 +571,19 @@ public:
 	*/
 	virtual void SetBaseMatrix(Handle handle, const Matrix43& mat) = 0;
 
+	/**
+		@brief
+		\~English Set base matrices of many effects at once
+		\~Japanese 複数のエフェクトのベース行列を一度に設定する。
+		@param	handles		[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	matrices	[in]	\~English matrices for each handle \~Japanese ハンドルごとのベース行列
+		@param	count		[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetBaseMatrices(const Handle* handles, const Matrix43* matrices, int32_t count) = 0;
+
 	/**
 		@brief	エフェクトのインスタンスに廃棄時のコールバックを設定する。
 		@param	handle	[in]	インスタンスのハンドル
@@ -521,6 +607,19 @@ public:
 	*/
 	virtual void SetShown(Handle handle, bool shown) = 0;
 
+	/**
+		@brief
+		\~English Specify whether many effects are drawn at once
+		\~Japanese 複数のエフェクトのインスタンスをDraw時に描画するか一度に設定する。
+		@param	handles	[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	shown	[in]	\~English whether each handle is drawn \~Japanese ハンドルごとの描画するか?
+		@param	count	[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetShownFlags(const Handle* handles, const bool* shown, int32_t count) = 0;
+
 	/**
 	@brief	\~English	Get status that a particle of effect specified is paused.
 	\~Japanese	指定したエフェクトのパーティクルが一時停止されているか取得する。
@@ -598,6 +697,19 @@ public:
 	*/
 	virtual void SetSpeed(Handle handle, float speed) = 0;
 
+	/**
+		@brief
+		\~English Set playing speeds of many effects at once
+		\~Japanese 複数のエフェクトのインスタンスの再生スピードを一度に設定する。
+		@param	handles	[in]	\~English handles of effects \~Japanese インスタンスのハンドル
+		@param	speeds	[in]	\~English speeds for each handle \~Japanese ハンドルごとのスピード
+		@param	count	[in]	\~English the number of handles \~Japanese ハンドルの数
+		@note
+		\~English Values are written immediately in order of handles like calling a setter for each handle. Handles which are not playing are ignored.
+		\~Japanese ハンドルごとにSetterを呼ぶ場合と同じく、ハンドルの順に即座に書き込まれる。再生されていないハンドルは無視される。
+	*/
+	virtual void SetSpeeds(const Handle* handles, const float* speeds, int32_t count) = 0;
+
 	/**
 		@brief
 		\~English	Specify a rate of scale in relation to manager's time  by a group.
@@ -805,6 +917,21 @@ public:
 	*/
 	virtual void CalcCulling(const Matrix44& cameraProjMat, bool isOpenGL) = 0;
 
+	/**
+		@brief
+		\~English	Cull effects for multiple views at once, and draw only culled effects in a view specified with DrawParameter::ViewIndex.
+		\~Japanese	複数の視点に対して一度にカリングを行い、DrawParameter::ViewIndexで指定された視点でカリングされたオブジェクトのみを描画するようにする。
+		@param	cameraProjMats	[in]	\~English camera projection matrices of views \~Japanese 視点ごとのカメラプロジェクション行列
+		@param	viewCount		[in]	\~English the number of views (1 to 32). It is ignored if it is less than 1. \~Japanese 視点の数(1以上32以下)。1未満の場合は無視される。
+		@param	isOpenGL		[in]	\~English whether is it drawn with OpenGL \~Japanese OpenGLによる描画か?
+		@note
+		\~English	It is faster than culling each view because the culling space is scanned once. It is useful for split screens and VR.
+		Only culling is shared. Vertices are still generated in each Draw call for each view.
+		\~Japanese	カリングの空間を一度だけ走査するため、視点ごとにカリングするより高速である。画面分割やVRに有用である。
+		共有されるのはカリングのみで、頂点は視点ごとのDrawで生成される。
+	*/
+	virtual void CalcCulling(const Matrix44* cameraProjMats, int32_t viewCount, bool isOpenGL) = 0;
+
 	/**
 		@brief	現在存在するエフェクトのハンドルからカリングの空間を配置しなおす。
 	*/
@@ -9,6 +9,9 @@
 #include "Effekseer.Manager.h"
 #include "Effekseer.Matrix43.h"
 #include "Effekseer.Matrix44.h"
+#include "Effekseer.RenderingCommandBuffer.h"
+#include "Effekseer.SlotMap.h"
+#include "Effekseer.WorkStealingQueue.h"
 #include "Effekseer.WorkerThread.h"
 #include "Utils/Effekseer.CustomAllocator.h"
 
@@ -104,6 +107,53 @@ private:
 		SIMD::Mat43f* GetEnabledGlobalMatrix();
 
 		void CopyMatrixFromInstanceToRoot();
+
+		void SetMatrix(const Matrix43& mat);
+
+		void SetLocation(const Vector3D& location);
+
+		void SetDynamicInput(int32_t index, float value);
+
+		void SetBaseMatrix(const Matrix43& mat);
+
+		void SetSpeed(float speed);
+	};
+
+	/**
+		@brief	parameters of a DrawSet which are needed to draw
+		@note
+		They are copied from a DrawSet in Flip so that drawing is not affected by updating.
+		The effect and instances are kept alive until the next Flip
+		because removed DrawSets are disposed after they wait two Flips.
+	*/
+	struct RenderingDrawSet
+	{
+		Handle Self;
+		Effect* ParameterPointer;
+		InstanceContainer* InstanceContainerPointer;
+		InstanceGlobal* GlobalPointer;
+		SIMD::Vec3f GlobalPosition;
+		int32_t Layer;
+		bool IsShown;
+		bool IsAutoDrawing;
+
+		//! a bit mask of views which contain it after CalcCulling
+		uint32_t CulledViewMask;
+	};
+
+	struct CullingView
+	{
+		/**
+			@brief	components of planes of a frustum which are tested four at once
+			@note
+			A point is inside a frustum if dot((x,y,z,1), plane) >= 0 for all planes.
+			Two planes which contain all points are appended to six planes.
+		*/
+		std::array<float, 8> PlaneXs;
+		std::array<float, 8> PlaneYs;
+		std::array<float, 8> PlaneZs;
+		std::array<float, 8> PlaneWs;
+		bool IsFrustumValid;
 	};
 
 	struct CullingParameter
@@ -126,12 +176,72 @@ private:
 private:
 	CustomVector<WorkerThread> m_WorkerThreads;
 
+	//! distributes tasks among worker threads
+	WorkStealingQueue m_workStealingQueue;
+
+	//! synchronizes worker threads while updating generations
+	ThreadBarrier m_threadBarrier;
+
+	//! a generation which is updated next by all threads
+	int32_t m_updatingGeneration = 0;
+
+	struct ChildGenerationRequestRange
+	{
+		int32_t ThreadID;
+		int32_t Offset;
+		int32_t Count;
+	};
+
+	//! requests to generate children which are collected by each thread
+	CustomVector<CustomVector<ChildGenerationRequest>> m_childGenerationRequests;
+
+	//! ranges in m_childGenerationRequests which are collected from each chunk of a generation
+	CustomVector<ChildGenerationRequestRange> m_childGenerationRequestRanges;
+
+	//! children are generated on worker threads if the number of requests is not less than it
+	static const int32_t ParallelChildGenerationMin = 64;
+
+	//! the number of children which a task to generate children contains at least
+	static const int32_t ChildGenerationTaskSize = 16;
+
+	//! children which are reserved in order of requests and are generated on worker threads
+	CustomVector<ChildGenerationRequest> m_reservedChildren;
+
+	//! offsets in m_reservedChildren where tasks begin. Children of the same group are contained in the same task
+	CustomVector<int32_t> m_childGenerationTaskOffsets;
+
+	//! distributes tasks to generate children among worker threads
+	WorkStealingQueue m_childGenerationQueue;
+
+	//! whether are rendering parameters generated on worker threads
+	bool m_isParallelDrawingEnabled = false;
+
+	struct ParallelDrawingEntry
+	{
+		RenderingDrawSet* DrawSetPointer;
+
+		//! a next entry of the same effect (-1 if it does not exist)
+		int32_t Next;
+
+		int32_t ThreadID;
+		int32_t CommandBegin;
+		int32_t CommandEnd;
+	};
+
+	//! calls to renderers which are recorded by each thread
+	CustomVector<std::unique_ptr<RenderingCommandBuffer>> m_renderingCommandBuffers;
+
+	//! draw sets which are drawn in parallel in order of drawing
+	CustomVector<ParallelDrawingEntry> m_parallelDrawingEntries;
+
+	//! first entries of each effect. Draw sets of the same effect are drawn on the same thread because nodes have states while rendering
+	CustomVector<int32_t> m_parallelDrawingTasks;
+
+	CustomUnorderedMap<Effect*, int32_t> m_parallelDrawingTaskIndexes;
+
 	//! whether does rendering and update handle flipped automatically
 	bool m_autoFlip = true;
 
-	//! next handle
-	Handle m_NextHandle = 0;
-
 	// 確保済みインスタンス数
 	int m_instance_max;
 
@@ -154,16 +264,19 @@ private:
 	std::array<int32_t, GenerationsMax> creatableChunkOffsets_;
 
 	// playing objects
-	CustomAlignedMap<Handle, DrawSet> m_DrawSets;
+	SlotMap<DrawSet> m_DrawSets;
 
 	//! objects which are waiting to be disposed
-	std::array<CustomAlignedMap<Handle, DrawSet>, 2> m_RemovingDrawSets;
+	std::array<CustomAlignedVector<DrawSet>, 2> m_RemovingDrawSets;
 
-	//! objects on rendering
-	CustomAlignedVector<DrawSet> m_renderingDrawSets;
+	//! handles of objects which are removed in GCDrawSet
+	CustomVector<Handle> removingHandles_;
 
 	//! objects on rendering
-	CustomAlignedMap<Handle, DrawSet> m_renderingDrawSetMaps;
+	CustomAlignedVector<RenderingDrawSet> m_renderingDrawSets;
+
+	//! indexes of m_renderingDrawSets by slots of handles (-1 if an object is not rendered)
+	CustomVector<int32_t> m_renderingDrawSetIndexes;
 
 	// mutex for rendering
 	std::mutex m_renderingMutex;
@@ -178,10 +291,21 @@ private:
 
 	Culling3D::World* m_cullingWorld;
 
-	std::vector<DrawSet*> m_culledObjects;
-	std::set<Handle> m_culledObjectSets;
+	std::vector<RenderingDrawSet*> m_culledObjects;
 	bool m_culled;
 
+	//! views specified with CalcCulling
+	CustomVector<CullingView> m_cullingViews;
+
+	//! an index of a view which is drawn now
+	int32_t m_drawingViewIndex = 0;
+
+	//! whether is a draw set contained in a view which is drawn now after CalcCulling
+	bool IsInDrawingView(const RenderingDrawSet& drawSet) const
+	{
+		return m_drawingViewIndex >= 0 && m_drawingViewIndex < Culling3D::World::MaxViewCount && (drawSet.CulledViewMask & (1u << m_drawingViewIndex)) != 0;
+	}
+
 	SpriteRendererRef m_spriteRenderer;
 
 	RibbonRendererRef m_ribbonRenderer;
@@ -217,6 +341,47 @@ private:
 
 	void ExecuteEvents();
 
+	/**
+		@brief	execute tasks on this thread and worker threads and wait for completion
+		@note
+		Tasks are balanced with work stealing. threadID is 0 on this thread.
+	*/
+	void ExecuteParallel(int32_t taskCount, const std::function<void(int32_t threadID, int32_t taskIndex)>& task);
+
+	//! execute a function on this thread and all worker threads and wait for completion
+	void ExecuteOnAllThreads(const std::function<void(int32_t threadID)>& func);
+
+	//! update chunks and generate children from the first generation to the last generation
+	void UpdateInstanceChunks();
+
+	//! update a chunk and collect requests to generate children into a buffer of the thread
+	void UpdateInstanceChunk(int32_t threadID, const std::vector<InstanceChunk*>& chunks, int32_t chunkIndex);
+
+	//! generate children requested from chunks in order of chunks
+	void GenerateRequestedChildren(int32_t chunkCount);
+
+	/**
+		@brief	reserve children requested from chunks in order of chunks and divide them into tasks
+		@note
+		Memory, groups and random seeds are reserved in the same order as GenerateRequestedChildren,
+		so that results do not depend on the number of threads.
+	*/
+	void ReserveRequestedChildren(int32_t chunkCount);
+
+	//! construct and initialize children in a task which is divided in ReserveRequestedChildren
+	void GenerateReservedChildren(int32_t taskIndex);
+
+	//! clear requests to generate children which are collected by all threads
+	void ClearChildGenerationRequests();
+
+	//! call a function to draw each draw set which is shown with drawParameter
+	void DrawDrawSets(const Manager::DrawParameter& drawParameter, const std::function<void(RenderingDrawSet& drawSet)>& drawDrawSet);
+
+	/**
+		@brief	draw draw sets on this thread and worker threads and submit recorded calls to renderers in order of entries
+	*/
+	void DrawDrawSetsInParallel(const std::function<void(RenderingDrawSet& drawSet)>& drawDrawSet);
+
 public:
 	ManagerImplemented(int instance_max, bool autoFlip);
 
@@ -224,6 +389,12 @@ public:
 
 	Instance* CreateInstance(EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGroup* pGroup);
 
+	/**
+		@brief	reserve a slot of an instance in chunks of a generation of a node
+		@return	false if memory is lacked
+	*/
+	bool ReserveInstance(EffectNodeImplemented* pEffectNode, InstanceChunk*& chunk, int32_t& chunkIndex);
+
 	InstanceGroup* CreateInstanceGroup(EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGlobal* pGlobal);
 	void ReleaseGroup(InstanceGroup* group);
 
@@ -235,6 +406,10 @@ public:
 
 	ThreadNativeHandleType GetWorkerThreadHandle(uint32_t threadID) override;
 
+	void SetParallelDrawingEnabled(bool enabled) override;
+
+	bool GetParallelDrawingEnabled() const override;
+
 	uint32_t GetSequenceNumber() const;
 
 	MallocFunc GetMallocFunc() const override;
@@ -327,9 +502,12 @@ public:
 
 	void SetMatrix(Handle handle, const Matrix43& mat) override;
 
+	void SetMatrices(const Handle* handles, const Matrix43* matrices, int32_t count) override;
+
 	Vector3D GetLocation(Handle handle) override;
 	void SetLocation(Handle handle, float x, float y, float z) override;
 	void SetLocation(Handle handle, const Vector3D& location) override;
+	void SetLocations(const Handle* handles, const Vector3D* locations, int32_t count) override;
 	void AddLocation(Handle handle, const Vector3D& location) override;
 
 	void SetRotation(Handle handle, float x, float y, float z) override;
@@ -347,16 +525,22 @@ public:
 
 	void SetDynamicInput(Handle handle, int32_t index, float value) override;
 
+	void SetDynamicInputs(const Handle* handles, int32_t index, const float* values, int32_t count) override;
+
 	Matrix43 GetBaseMatrix(Handle handle) override;
 
 	void SetBaseMatrix(Handle handle, const Matrix43& mat) override;
 
+	void SetBaseMatrices(const Handle* handles, const Matrix43* matrices, int32_t count) override;
+
 	void SetRemovingCallback(Handle handle, EffectInstanceRemovingCallback callback) override;
 
 	bool GetShown(Handle handle) override;
 
 	void SetShown(Handle handle, bool shown) override;
 
+	void SetShownFlags(const Handle* handles, const bool* shown, int32_t count) override;
+
 	bool GetPaused(Handle handle) override;
 
 	void SetPaused(Handle handle, bool paused) override;
@@ -375,6 +559,8 @@ public:
 
 	void SetSpeed(Handle handle, float speed) override;
 
+	void SetSpeeds(const Handle* handles, const float* speeds, int32_t count) override;
+
 	void SetTimeScaleByGroup(int64_t groupmask, float timeScale) override;
 
 	void SetTimeScaleByHandle(Handle handle, float timeScale) override;
@@ -406,7 +592,9 @@ private:
 	void Preupdate(DrawSet& drawSet);
 
 	//! whether container is disabled while rendering because of a distance between the effect and a camera
-	bool IsClippedWithDepth(DrawSet& drawSet, InstanceContainer* container, const Manager::DrawParameter& drawParameter);
+	bool IsClippedWithDepth(const RenderingDrawSet& drawSet, InstanceContainer* container, const Manager::DrawParameter& drawParameter);
+
+	RenderingDrawSet* FindRenderingDrawSet(Handle handle);
 
 	void StopWithoutRemoveDrawSet(DrawSet& drawSet);
 
@@ -445,8 +633,23 @@ public:
 
 	void CalcCulling(const Matrix44& cameraProjMat, bool isOpenGL) override;
 
+	void CalcCulling(const Matrix44* cameraProjMats, int32_t viewCount, bool isOpenGL) override;
+
 	void RessignCulling() override;
 
+	/**
+		@brief	whether is an axis aligned bounding box outside a frustum of a view which is drawn now
+		@note
+		It returns false if CalcCulling is not called after Flip.
+	*/
+	bool IsCulledByFrustum(const SIMD::Vec3f& min, const SIMD::Vec3f& max) const;
+
+	bool IsFrustumValid() const
+	{
+		return m_drawingViewIndex >= 0 && m_drawingViewIndex < static_cast<int32_t>(m_cullingViews.size()) &&
+			   m_cullingViews[m_drawingViewIndex].IsFrustumValid;
+	}
+
 	virtual int GetRef() override
 	{
 		return ReferenceObject::GetRef();
@@ -0,0 +1,383 @@
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+#include "Effekseer.RenderingCommandBuffer.h"
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+namespace Effekseer
+{
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+template <typename RENDERER>
+void RenderingCommandBuffer::WriteVertices(Parameters<RENDERER>&)
+{
+	// instances of other renderers are submitted with Rendering
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+template <>
+void RenderingCommandBuffer::WriteVertices<SpriteRenderer>(Parameters<SpriteRenderer>& parameters)
+{
+	if (targetSpriteRenderer_ == nullptr)
+	{
+		return;
+	}
+
+	// find Rendering of instances since the last BeginRendering
+	int32_t begin = static_cast<int32_t>(commands_.size()) - 1;
+	for (; begin >= 0; begin--)
+	{
+		const auto& command = commands_[begin];
+		if (command.Renderer != RendererType::Sprite || command.Type != CommandType::Rendering)
+		{
+			break;
+		}
+	}
+
+	const int32_t count = static_cast<int32_t>(commands_.size()) - begin - 1;
+	if (begin < 0 || commands_[begin].Renderer != RendererType::Sprite || commands_[begin].Type != CommandType::BeginRendering || count == 0)
+	{
+		return;
+	}
+
+	const auto& first = commands_[begin + 1];
+	const auto& nodeParameter = parameters.NodeParameters[commands_[begin].NodeParameterIndex];
+	const auto offset = static_cast<int32_t>(vertices_.size());
+	const auto stride = targetSpriteRenderer_->WriteVertices(nodeParameter, &parameters.InstanceParameters[first.InstanceParameterIndex], count, vertices_);
+
+	if (stride == 0)
+	{
+		vertices_.resize(offset);
+		return;
+	}
+
+	Command command;
+	command.Renderer = RendererType::Sprite;
+	command.Type = CommandType::RenderingVertices;
+	command.Count = count;
+	command.NodeParameterIndex = commands_[begin].NodeParameterIndex;
+	command.InstanceParameterIndex = first.InstanceParameterIndex;
+	command.VertexOffset = offset;
+	command.VertexSize = static_cast<int32_t>(vertices_.size()) - offset;
+	command.VertexStride = stride;
+	command.UserData = first.UserData;
+
+	commands_.resize(begin + 1);
+	commands_.emplace_back(command);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+template <typename RENDERER>
+void RenderingCommandBuffer::SubmitVertices(RENDERER*, const Parameters<RENDERER>&, const Command&) const
+{
+	// only WriteVertices<SpriteRenderer> records vertices
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+template <>
+void RenderingCommandBuffer::SubmitVertices<SpriteRenderer>(SpriteRenderer* renderer,
+															 const Parameters<SpriteRenderer>& parameters,
+															 const Command& command) const
+{
+	const auto& nodeParameter = parameters.NodeParameters[command.NodeParameterIndex];
+
+	if (renderer->RenderingVertices(nodeParameter, vertices_.data() + command.VertexOffset, command.VertexSize, command.VertexStride, command.UserData))
+	{
+		return;
+	}
+
+	// a state of the renderer is changed since vertices are written
+	for (int32_t i = 0; i < command.Count; i++)
+	{
+		renderer->Rendering(nodeParameter, parameters.InstanceParameters[command.InstanceParameterIndex + i], command.UserData);
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+template <typename RENDERER>
+class RenderingCommandRecorder : public RENDERER
+{
+private:
+	RenderingCommandBuffer* buffer_;
+	RenderingCommandBuffer::Parameters<RENDERER>& parameters_;
+	RenderingCommandBuffer::RendererType rendererType_;
+
+protected:
+	void Record(RenderingCommandBuffer::CommandType commandType,
+				const typename RENDERER::NodeParameter& nodeParameter,
+				const typename RENDERER::InstanceParameter* instanceParameter,
+				int32_t count,
+				void* userData)
+	{
+		buffer_->Record(parameters_, rendererType_, commandType, nodeParameter, instanceParameter, count, userData);
+	}
+
+public:
+	RenderingCommandRecorder(RenderingCommandBuffer* buffer,
+							 RenderingCommandBuffer::Parameters<RENDERER>& parameters,
+							 RenderingCommandBuffer::RendererType rendererType)
+		: buffer_(buffer)
+		, parameters_(parameters)
+		, rendererType_(rendererType)
+	{
+	}
+
+	void BeginRendering(const typename RENDERER::NodeParameter& parameter, int32_t count, void* userData) override
+	{
+		Record(RenderingCommandBuffer::CommandType::BeginRendering, parameter, nullptr, count, userData);
+	}
+
+	void Rendering(const typename RENDERER::NodeParameter& parameter,
+				   const typename RENDERER::InstanceParameter& instanceParameter,
+				   void* userData) override
+	{
+		Record(RenderingCommandBuffer::CommandType::Rendering, parameter, &instanceParameter, 0, userData);
+	}
+
+	void EndRendering(const typename RENDERER::NodeParameter& parameter, void* userData) override
+	{
+		buffer_->WriteVertices(parameters_);
+		Record(RenderingCommandBuffer::CommandType::EndRendering, parameter, nullptr, 0, userData);
+	}
+};
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+template <typename RENDERER>
+class RenderingCommandGroupRecorder : public RenderingCommandRecorder<RENDERER>
+{
+public:
+	RenderingCommandGroupRecorder(RenderingCommandBuffer* buffer,
+								  RenderingCommandBuffer::Parameters<RENDERER>& parameters,
+								  RenderingCommandBuffer::RendererType rendererType)
+		: RenderingCommandRecorder<RENDERER>(buffer, parameters, rendererType)
+	{
+	}
+
+	void BeginRenderingGroup(const typename RENDERER::NodeParameter& parameter, int32_t count, void* userData) override
+	{
+		this->Record(RenderingCommandBuffer::CommandType::BeginRenderingGroup, parameter, nullptr, count, userData);
+	}
+
+	void EndRenderingGroup(const typename RENDERER::NodeParameter& parameter, int32_t count, void* userData) override
+	{
+		this->Record(RenderingCommandBuffer::CommandType::EndRenderingGroup, parameter, nullptr, count, userData);
+	}
+};
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+static thread_local RenderingCommandBuffer* g_recordingBuffer = nullptr;
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+RenderingCommandBuffer::RenderingCommandBuffer()
+{
+	spriteRenderer_ = MakeRefPtr<RenderingCommandRecorder<SpriteRenderer>>(this, spriteParameters_, RendererType::Sprite);
+	ribbonRenderer_ = MakeRefPtr<RenderingCommandGroupRecorder<RibbonRenderer>>(this, ribbonParameters_, RendererType::Ribbon);
+	ringRenderer_ = MakeRefPtr<RenderingCommandRecorder<RingRenderer>>(this, ringParameters_, RendererType::Ring);
+	modelRenderer_ = MakeRefPtr<RenderingCommandRecorder<ModelRenderer>>(this, modelParameters_, RendererType::Model);
+	trackRenderer_ = MakeRefPtr<RenderingCommandGroupRecorder<TrackRenderer>>(this, trackParameters_, RendererType::Track);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+template <typename RENDERER>
+void RenderingCommandBuffer::Record(Parameters<RENDERER>& parameters,
+									RendererType rendererType,
+									CommandType commandType,
+									const typename RENDERER::NodeParameter& nodeParameter,
+									const typename RENDERER::InstanceParameter* instanceParameter,
+									int32_t count,
+									void* userData)
+{
+	Command command;
+	command.Renderer = rendererType;
+	command.Type = commandType;
+	command.Count = count;
+	command.NodeParameterIndex = static_cast<int32_t>(parameters.NodeParameters.size());
+	command.InstanceParameterIndex = -1;
+	command.VertexOffset = 0;
+	command.VertexSize = 0;
+	command.VertexStride = 0;
+	command.UserData = userData;
+
+	parameters.NodeParameters.emplace_back(nodeParameter);
+
+	if (instanceParameter != nullptr)
+	{
+		command.InstanceParameterIndex = static_cast<int32_t>(parameters.InstanceParameters.size());
+		parameters.InstanceParameters.emplace_back(*instanceParameter);
+	}
+
+	commands_.emplace_back(command);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RenderingCommandBuffer::SetTargetRenderers(SpriteRenderer* spriteRenderer,
+												  RibbonRenderer* ribbonRenderer,
+												  RingRenderer* ringRenderer,
+												  ModelRenderer* modelRenderer,
+												  TrackRenderer* trackRenderer)
+{
+	targetSpriteRenderer_ = spriteRenderer;
+	targetRibbonRenderer_ = ribbonRenderer;
+	targetRingRenderer_ = ringRenderer;
+	targetModelRenderer_ = modelRenderer;
+	targetTrackRenderer_ = trackRenderer;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RenderingCommandBuffer::Clear()
+{
+	commands_.clear();
+	vertices_.clear();
+
+	// user data of node parameters are released here
+	spriteParameters_.NodeParameters.clear();
+	spriteParameters_.InstanceParameters.clear();
+	ribbonParameters_.NodeParameters.clear();
+	ribbonParameters_.InstanceParameters.clear();
+	ringParameters_.NodeParameters.clear();
+	ringParameters_.InstanceParameters.clear();
+	modelParameters_.NodeParameters.clear();
+	modelParameters_.InstanceParameters.clear();
+	trackParameters_.NodeParameters.clear();
+	trackParameters_.InstanceParameters.clear();
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+template <typename RENDERER>
+void RenderingCommandBuffer::Submit(RENDERER* renderer, const Parameters<RENDERER>& parameters, const Command& command) const
+{
+	if (renderer == nullptr)
+	{
+		return;
+	}
+
+	const auto& nodeParameter = parameters.NodeParameters[command.NodeParameterIndex];
+
+	switch (command.Type)
+	{
+	case CommandType::BeginRendering:
+		renderer->BeginRendering(nodeParameter, command.Count, command.UserData);
+		break;
+	case CommandType::Rendering:
+		renderer->Rendering(nodeParameter, parameters.InstanceParameters[command.InstanceParameterIndex], command.UserData);
+		break;
+	case CommandType::RenderingVertices:
+		SubmitVertices(renderer, parameters, command);
+		break;
+	case CommandType::EndRendering:
+		renderer->EndRendering(nodeParameter, command.UserData);
+		break;
+	default:
+		assert(0);
+		break;
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+template <typename RENDERER>
+void RenderingCommandBuffer::SubmitGroup(RENDERER* renderer, const Parameters<RENDERER>& parameters, const Command& command) const
+{
+	if (renderer == nullptr)
+	{
+		return;
+	}
+
+	const auto& nodeParameter = parameters.NodeParameters[command.NodeParameterIndex];
+
+	switch (command.Type)
+	{
+	case CommandType::BeginRenderingGroup:
+		renderer->BeginRenderingGroup(nodeParameter, command.Count, command.UserData);
+		break;
+	case CommandType::EndRenderingGroup:
+		renderer->EndRenderingGroup(nodeParameter, command.Count, command.UserData);
+		break;
+	default:
+		Submit(renderer, parameters, command);
+		break;
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RenderingCommandBuffer::Submit(int32_t begin, int32_t end) const
+{
+	assert(0 <= begin && begin <= end && end <= GetCommandCount());
+
+	for (int32_t i = begin; i < end; i++)
+	{
+		const auto& command = commands_[i];
+
+		switch (command.Renderer)
+		{
+		case RendererType::Sprite:
+			Submit(targetSpriteRenderer_, spriteParameters_, command);
+			break;
+		case RendererType::Ribbon:
+			SubmitGroup(targetRibbonRenderer_, ribbonParameters_, command);
+			break;
+		case RendererType::Ring:
+			Submit(targetRingRenderer_, ringParameters_, command);
+			break;
+		case RendererType::Model:
+			Submit(targetModelRenderer_, modelParameters_, command);
+			break;
+		case RendererType::Track:
+			SubmitGroup(targetTrackRenderer_, trackParameters_, command);
+			break;
+		}
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+RenderingCommandBuffer* RenderingCommandBuffer::GetRecordingBuffer()
+{
+	return g_recordingBuffer;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RenderingCommandBuffer::SetRecordingBuffer(RenderingCommandBuffer* buffer)
+{
+	g_recordingBuffer = buffer;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace Effekseer
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
@@ -0,0 +1,197 @@
+#ifndef __EFFEKSEER_RENDERING_COMMAND_BUFFER_H__
+#define __EFFEKSEER_RENDERING_COMMAND_BUFFER_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "Effekseer.Base.h"
+#include "Effekseer.RectF.h"
+#include "Renderer/Effekseer.ModelRenderer.h"
+#include "Renderer/Effekseer.RibbonRenderer.h"
+#include "Renderer/Effekseer.RingRenderer.h"
+#include "Renderer/Effekseer.SpriteRenderer.h"
+#include "Renderer/Effekseer.TrackRenderer.h"
+#include "Utils/Effekseer.CustomAllocator.h"
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+namespace Effekseer
+{
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+
+/**
+	@brief	a buffer which records calls to renderers to submit them later
+	@note
+	Renderers returned by this class only copy parameters into this buffer.
+	Instances are drawn into a buffer on each worker thread,
+	and recorded calls are submitted to actual renderers on the thread which owns them in the original order.
+	If an actual renderer can write vertices on worker threads, vertices of instances are written into this buffer when they are recorded,
+	and only copied into a vertex buffer when they are submitted.
+*/
+class RenderingCommandBuffer
+{
+public:
+	enum class RendererType : uint8_t
+	{
+		Sprite,
+		Ribbon,
+		Ring,
+		Model,
+		Track,
+	};
+
+	enum class CommandType : uint8_t
+	{
+		BeginRendering,
+		BeginRenderingGroup,
+		Rendering,
+		RenderingVertices,
+		EndRenderingGroup,
+		EndRendering,
+	};
+
+	struct Command
+	{
+		RendererType Renderer;
+		CommandType Type;
+
+		//! count of BeginRendering, BeginRenderingGroup and EndRenderingGroup
+		int32_t Count;
+
+		int32_t NodeParameterIndex;
+
+		//! an index of an instance parameter of Rendering, or the first instance parameter of RenderingVertices
+		int32_t InstanceParameterIndex;
+
+		//! a region of vertices of RenderingVertices
+		int32_t VertexOffset;
+		int32_t VertexSize;
+		int32_t VertexStride;
+
+		void* UserData;
+	};
+
+private:
+	template <typename RENDERER>
+	struct Parameters
+	{
+		CustomVector<typename RENDERER::NodeParameter> NodeParameters;
+		CustomAlignedVector<typename RENDERER::InstanceParameter> InstanceParameters;
+	};
+
+	CustomVector<Command> commands_;
+	CustomAlignedVector<uint8_t> vertices_;
+	Parameters<SpriteRenderer> spriteParameters_;
+	Parameters<RibbonRenderer> ribbonParameters_;
+	Parameters<RingRenderer> ringParameters_;
+	Parameters<ModelRenderer> modelParameters_;
+	Parameters<TrackRenderer> trackParameters_;
+
+	SpriteRendererRef spriteRenderer_;
+	RibbonRendererRef ribbonRenderer_;
+	RingRendererRef ringRenderer_;
+	ModelRendererRef modelRenderer_;
+	TrackRendererRef trackRenderer_;
+
+	//! renderers which recorded calls are submitted to
+	SpriteRenderer* targetSpriteRenderer_ = nullptr;
+	RibbonRenderer* targetRibbonRenderer_ = nullptr;
+	RingRenderer* targetRingRenderer_ = nullptr;
+	ModelRenderer* targetModelRenderer_ = nullptr;
+	TrackRenderer* targetTrackRenderer_ = nullptr;
+
+	template <typename RENDERER>
+	void Record(Parameters<RENDERER>& parameters,
+				RendererType rendererType,
+				CommandType commandType,
+				const typename RENDERER::NodeParameter& nodeParameter,
+				const typename RENDERER::InstanceParameter* instanceParameter,
+				int32_t count,
+				void* userData);
+
+	//! replace recorded Rendering of instances since the last BeginRendering with vertices if a renderer can write them
+	template <typename RENDERER>
+	void WriteVertices(Parameters<RENDERER>& parameters);
+
+	template <typename RENDERER>
+	void SubmitVertices(RENDERER* renderer, const Parameters<RENDERER>& parameters, const Command& command) const;
+
+	template <typename RENDERER>
+	void Submit(RENDERER* renderer, const Parameters<RENDERER>& parameters, const Command& command) const;
+
+	template <typename RENDERER>
+	void SubmitGroup(RENDERER* renderer, const Parameters<RENDERER>& parameters, const Command& command) const;
+
+	template <typename RENDERER>
+	friend class RenderingCommandRecorder;
+
+	template <typename RENDERER>
+	friend class RenderingCommandGroupRecorder;
+
+public:
+	RenderingCommandBuffer();
+
+	RenderingCommandBuffer(const RenderingCommandBuffer&) = delete;
+
+	RenderingCommandBuffer& operator=(const RenderingCommandBuffer&) = delete;
+
+	//! set renderers which recorded calls are submitted to. Sprite renderer may write vertices on worker threads
+	void SetTargetRenderers(SpriteRenderer* spriteRenderer,
+							RibbonRenderer* ribbonRenderer,
+							RingRenderer* ringRenderer,
+							ModelRenderer* modelRenderer,
+							TrackRenderer* trackRenderer);
+
+	//! remove all recorded calls but keep the memory
+	void Clear();
+
+	int32_t GetCommandCount() const
+	{
+		return static_cast<int32_t>(commands_.size());
+	}
+
+	//! submit recorded calls in [begin, end) to target renderers
+	void Submit(int32_t begin, int32_t end) const;
+
+	const SpriteRendererRef& GetSpriteRenderer() const
+	{
+		return spriteRenderer_;
+	}
+
+	const RibbonRendererRef& GetRibbonRenderer() const
+	{
+		return ribbonRenderer_;
+	}
+
+	const RingRendererRef& GetRingRenderer() const
+	{
+		return ringRenderer_;
+	}
+
+	const ModelRendererRef& GetModelRenderer() const
+	{
+		return modelRenderer_;
+	}
+
+	const TrackRendererRef& GetTrackRenderer() const
+	{
+		return trackRenderer_;
+	}
+
+	//! a buffer which renderers of a manager are replaced with on this thread
+	static RenderingCommandBuffer* GetRecordingBuffer();
+
+	static void SetRecordingBuffer(RenderingCommandBuffer* buffer);
+};
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace Effekseer
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+#endif // __EFFEKSEER_RENDERING_COMMAND_BUFFER_H__
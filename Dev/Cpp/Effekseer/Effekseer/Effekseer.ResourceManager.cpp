@@ -8,8 +8,10 @@
 #include "Effekseer.MaterialLoader.h"
 #include "Effekseer.SoundLoader.h"
 #include "Effekseer.TextureLoader.h"
+#include "Model/Model.h"
 #include "Model/ModelLoader.h"
 #include "Model/ProcedualModelGenerator.h"
+#include <memory>
 
 //----------------------------------------------------------------------------------
 //
@@ -17,12 +19,114 @@
 namespace Effekseer
 {
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void ResourceManager::PrepareTexture(const char16_t* path, TextureType textureType)
+{
+	auto loader = cachedTextures_.loader;
+	if (loader == nullptr)
+	{
+		return;
+	}
+
+	const CustomString pathString(path);
+
+	{
+		std::lock_guard<std::mutex> lock(preparedTextureMutex_);
+
+		// it is decoded by another thread
+		if (++preparedTextures_[pathString].PrepareCount > 1)
+		{
+			return;
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(cachedTextures_.mutex);
+		if (cachedTextures_.cached.find(path) != cachedTextures_.cached.end())
+		{
+			return;
+		}
+	}
+
+	Backend::TextureParameter param;
+	if (!loader->Decode(path, textureType, param))
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(preparedTextureMutex_);
+
+	// it may be loaded or discarded while decoding
+	auto it = preparedTextures_.find(pathString);
+	if (it != preparedTextures_.end())
+	{
+		it->second.Param = std::move(param);
+		it->second.IsDecoded = true;
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void ResourceManager::DiscardPreparedTexture(const char16_t* path)
+{
+	std::lock_guard<std::mutex> lock(preparedTextureMutex_);
+
+	auto it = preparedTextures_.find(path);
+	if (it != preparedTextures_.end() && --it->second.PrepareCount <= 0)
+	{
+		preparedTextures_.erase(it);
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+bool ResourceManager::TakePreparedTexture(const char16_t* path, Backend::TextureParameter& param)
+{
+	std::lock_guard<std::mutex> lock(preparedTextureMutex_);
+
+	auto it = preparedTextures_.find(path);
+	if (it == preparedTextures_.end())
+	{
+		return false;
+	}
+
+	// the first one creates a texture and others get it from the cache
+	const bool isDecoded = it->second.IsDecoded;
+	if (isDecoded)
+	{
+		param = std::move(it->second.Param);
+		it->second.IsDecoded = false;
+	}
+
+	if (--it->second.PrepareCount <= 0)
+	{
+		preparedTextures_.erase(it);
+	}
+
+	return isDecoded;
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
 TextureRef ResourceManager::LoadTexture(const char16_t* path, TextureType textureType)
 {
-	return cachedTextures_.Load(path, textureType);
+	Backend::TextureParameter param;
+	const bool isDecoded = TakePreparedTexture(path, param);
+
+	return cachedTextures_.LoadWith(path, [&]() {
+		// a prepared texture only needs to be created with a graphics device
+		if (isDecoded)
+		{
+			return cachedTextures_.loader->Create(param);
+		}
+
+		return cachedTextures_.loader->Load(path, textureType);
+	});
 }
 
 //----------------------------------------------------------------------------------
@@ -97,20 +201,133 @@ void ResourceManager::UnloadCurve(CurveRef resource)
 	cachedCurves_.Unload(resource);
 }
 
+void ResourceManager::SetProcedualModelCacheDirectory(const char16_t* directory, FileInterface* fileInterface)
+{
+	std::lock_guard<std::mutex> lock(procedualModelMutex_);
+
+	procedualModelCacheDirectory_ = directory != nullptr ? directory : u"";
+	if (!procedualModelCacheDirectory_.empty() && procedualModelCacheDirectory_.back() != u'/' && procedualModelCacheDirectory_.back() != u'\\')
+	{
+		procedualModelCacheDirectory_ += u'/';
+	}
+
+	procedualModelCacheFileInterface_ = fileInterface != nullptr ? fileInterface : &defaultFileInterface_;
+}
+
+CustomString ResourceManager::GetProcedualModelCachePath(uint64_t hash) const
+{
+	CustomString path = procedualModelCacheDirectory_;
+	for (int32_t i = 15; i >= 0; i--)
+	{
+		path += u"0123456789abcdef"[(hash >> (i * 4)) & 0xF];
+	}
+	path += u".efkmodel";
+	return path;
+}
+
+ModelRef ResourceManager::LoadProcedualModelCache(const CustomString& path, uint64_t hash)
+{
+	std::unique_ptr<FileReader> reader(procedualModelCacheFileInterface_->OpenRead(path.c_str()));
+	if (reader == nullptr)
+	{
+		return nullptr;
+	}
+
+	CustomVector<uint8_t> data(reader->GetLength());
+	if (data.empty() || reader->Read(data.data(), data.size()) != data.size())
+	{
+		return nullptr;
+	}
+
+	// a broken file or a file of another generator version is generated again
+	if (!Model::IsValidSavedData(data.data(), static_cast<int32_t>(data.size()), hash))
+	{
+		return nullptr;
+	}
+
+	return MakeRefPtr<Model>(data.data(), static_cast<int32_t>(data.size()));
+}
+
+void ResourceManager::SaveProcedualModelCache(const CustomString& path, const ModelRef& model, uint64_t hash)
+{
+	std::unique_ptr<FileWriter> writer(procedualModelCacheFileInterface_->OpenWrite(path.c_str()));
+	if (writer == nullptr)
+	{
+		return;
+	}
+
+	CustomVector<uint8_t> data;
+	model->Save(data, hash);
+	writer->Write(data.data(), data.size());
+}
+
 ModelRef ResourceManager::GenerateProcedualModel(const ProcedualModelParameter* param)
 {
-	if (procedualMeshGenerator_ != nullptr)
+	if (procedualMeshGenerator_ == nullptr || param == nullptr)
+	{
+		return nullptr;
+	}
+
+	std::unique_lock<std::mutex> lock(procedualModelMutex_);
+	procedualModelGeneratedCV_.wait(lock, [&]() { return generatingProcedualModels_.count(*param) == 0; });
+
+	auto it = cachedProcedualModels_.find(*param);
+	if (it != cachedProcedualModels_.end())
+	{
+		it->second.loadCount++;
+		return it->second.resource;
+	}
+
+	// other parameters can be generated while generating
+	generatingProcedualModels_.insert(*param);
+	const auto hash = param->GetHash();
+	const auto cachePath = procedualModelCacheDirectory_.empty() ? CustomString() : GetProcedualModelCachePath(hash);
+	lock.unlock();
+
+	ModelRef model = !cachePath.empty() ? LoadProcedualModelCache(cachePath, hash) : nullptr;
+	if (model == nullptr)
+	{
+		model = procedualMeshGenerator_->Generate(param);
+
+		if (model != nullptr && !cachePath.empty())
+		{
+			SaveProcedualModelCache(cachePath, model, hash);
+		}
+	}
+
+	lock.lock();
+	generatingProcedualModels_.erase(*param);
+
+	if (model != nullptr)
 	{
-		return procedualMeshGenerator_->Generate(param);
+		cachedProcedualModels_.emplace(*param, LoadCounted<ModelRef>{model, 1});
 	}
-	return nullptr;
+
+	lock.unlock();
+	procedualModelGeneratedCV_.notify_all();
+	return model;
 }
 
 void ResourceManager::UngenerateProcedualModel(ModelRef resource)
 {
-	if (procedualMeshGenerator_ != nullptr)
+	if (procedualMeshGenerator_ == nullptr || resource == nullptr)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(procedualModelMutex_);
+
+	for (auto it = cachedProcedualModels_.begin(); it != cachedProcedualModels_.end(); ++it)
 	{
-		procedualMeshGenerator_->Ungenerate(resource);
+		if (it->second.resource == resource)
+		{
+			if (--it->second.loadCount <= 0)
+			{
+				cachedProcedualModels_.erase(it);
+				procedualMeshGenerator_->Ungenerate(resource);
+			}
+			return;
+		}
 	}
 }
 
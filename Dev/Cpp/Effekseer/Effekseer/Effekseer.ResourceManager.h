@@ -5,9 +5,14 @@
 //----------------------------------------------------------------------------------
 // Include
 //----------------------------------------------------------------------------------
+#include "Backend/GraphicsDevice.h"
 #include "Effekseer.Base.Pre.h"
+#include "Effekseer.DefaultFile.h"
 #include "Effekseer.Resource.h"
 #include "Model/ProcedualModelGenerator.h"
+#include "Model/ProcedualModelParameter.h"
+#include <condition_variable>
+#include <mutex>
 
 //----------------------------------------------------------------------------------
 //
@@ -18,6 +23,13 @@ namespace Effekseer
 //
 //----------------------------------------------------------------------------------
 
+/**
+	@brief	a class which caches resources loaded with loaders
+	@note
+	Resources can be loaded and unloaded from multiple threads.
+	If a resource is requested while it is being loaded, the request waits for it instead of loading it twice.
+	Loaders must be thread-safe when resources are loaded from multiple threads.
+*/
 class ResourceManager : public ReferenceObject
 {
 public:
@@ -85,6 +97,23 @@ public:
 		procedualMeshGenerator_ = generator;
 	}
 
+	const char16_t* GetProcedualModelCacheDirectory() const
+	{
+		return procedualModelCacheDirectory_.c_str();
+	}
+
+	void SetProcedualModelCacheDirectory(const char16_t* directory, FileInterface* fileInterface);
+
+	/**
+		@brief	decode a texture on a worker thread so that LoadTexture only creates it
+		@note
+		A decoded texture is kept until LoadTexture or DiscardPreparedTexture is called with the same path as many times as it is prepared.
+	*/
+	void PrepareTexture(const char16_t* path, TextureType textureType);
+
+	//! discard a texture which is prepared but will not be loaded
+	void DiscardPreparedTexture(const char16_t* path);
+
 	TextureRef LoadTexture(const char16_t* path, TextureType textureType);
 
 	void UnloadTexture(TextureRef resource);
@@ -119,17 +148,67 @@ private:
 		int32_t loadCount;
 	};
 
+	//! models which are shared by effects with the same parameter
+	CustomMap<ProcedualModelParameter, LoadCounted<ModelRef>> cachedProcedualModels_;
+
+	//! parameters whose models are being generated without locking mutex
+	CustomSet<ProcedualModelParameter> generatingProcedualModels_;
+	std::mutex procedualModelMutex_;
+	std::condition_variable procedualModelGeneratedCV_;
+
+	struct PreparedTexture
+	{
+		Backend::TextureParameter Param;
+		bool IsDecoded = false;
+		int32_t PrepareCount = 0;
+	};
+
+	//! textures which are decoded with PrepareTexture and are not loaded yet
+	CustomMap<CustomString, PreparedTexture> preparedTextures_;
+	std::mutex preparedTextureMutex_;
+
+	//! take a decoded texture out if it is prepared
+	bool TakePreparedTexture(const char16_t* path, Backend::TextureParameter& param);
+
+	//! a directory where generated models are saved. Models are not saved if it is empty
+	CustomString procedualModelCacheDirectory_;
+	DefaultFileInterface defaultFileInterface_;
+	FileInterface* procedualModelCacheFileInterface_ = nullptr;
+
+	CustomString GetProcedualModelCachePath(uint64_t hash) const;
+
+	ModelRef LoadProcedualModelCache(const CustomString& path, uint64_t hash);
+
+	void SaveProcedualModelCache(const CustomString& path, const ModelRef& model, uint64_t hash);
+
 	template <typename LOADER, typename RESOURCE>
 	struct CachedResources
 	{
 		LOADER loader;
 		CustomUnorderedMap<StringView, LoadCounted<RESOURCE>, StringView::Hash> cached;
 
+		//! paths which are being loaded without locking mutex
+		CustomSet<CustomString> loading;
+		std::mutex mutex;
+		std::condition_variable loadedCV;
+
 		template <typename... Arg>
 		RESOURCE Load(const char16_t* path, Arg&&... args)
+		{
+			return LoadWith(path, [&]() { return loader->Load(path, args...); });
+		}
+
+		//! load a resource with a function if it is not cached
+		template <typename FUNC>
+		RESOURCE LoadWith(const char16_t* path, const FUNC& load)
 		{
 			if (loader != nullptr)
 			{
+				const CustomString pathString(path);
+
+				std::unique_lock<std::mutex> lock(mutex);
+				loadedCV.wait(lock, [&]() { return loading.count(pathString) == 0; });
+
 				auto it = cached.find(path);
 				if (it != cached.end())
 				{
@@ -137,14 +216,25 @@ private:
 					return it->second.resource;
 				}
 
-				auto resource = loader->Load(path, args...);
+				// other paths can be loaded while loading
+				loading.insert(pathString);
+				lock.unlock();
+
+				auto resource = load();
+
+				lock.lock();
+				loading.erase(pathString);
+
 				if (resource != nullptr)
 				{
 					resource->SetPath(path);
 					const StringView view = resource->GetPath();
 					cached.emplace(view, LoadCounted<RESOURCE>{resource, 1});
-					return resource;
 				}
+
+				lock.unlock();
+				loadedCV.notify_all();
+				return resource;
 			}
 			return nullptr;
 		}
@@ -153,6 +243,8 @@ private:
 		{
 			if (loader != nullptr && resource != nullptr)
 			{
+				std::lock_guard<std::mutex> lock(mutex);
+
 				auto it = cached.find(resource->GetPath());
 				if (it != cached.end())
 				{
@@ -22,6 +22,7 @@
 #include "Effekseer.Effect.h"
 #include "IO/Effekseer.EfkEfcFactory.h"
 #include "Effekseer.ResourceManager.h"
+#include "Effekseer.WorkerThread.h"
 
 //----------------------------------------------------------------------------------
 //
@@ -51,6 +52,9 @@ Setting::Setting()
 //----------------------------------------------------------------------------------
 Setting::~Setting()
 {
+	// loading tasks hold a setting, so no task is queued here
+	loadingThreadPool_.reset();
+
 	ClearEffectFactory();
 }
 
@@ -190,6 +194,14 @@ void Setting::SetProcedualMeshGenerator(ProcedualModelGeneratorRef generator)
 	resourceManager_->SetProcedualMeshGenerator(generator);
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void Setting::SetProcedualModelCacheDirectory(const char16_t* directory, FileInterface* fileInterface)
+{
+	resourceManager_->SetProcedualModelCacheDirectory(directory, fileInterface);
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -236,4 +248,21 @@ const RefPtr<ResourceManager>& Setting::GetResourceManager() const
 	return resourceManager_;
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+ThreadPool* Setting::GetLoadingThreadPool()
+{
+	std::lock_guard<std::mutex> lock(loadingThreadPoolMutex_);
+
+	if (loadingThreadPool_ == nullptr)
+	{
+		const int32_t maxThreadCount = 2;
+		const auto threadCount = Clamp(static_cast<int32_t>(std::thread::hardware_concurrency()) - 1, maxThreadCount, 1);
+		loadingThreadPool_ = std::unique_ptr<ThreadPool>(new ThreadPool(threadCount));
+	}
+
+	return loadingThreadPool_.get();
+}
+
 } // namespace Effekseer
@@ -6,6 +6,8 @@
 // Include
 //----------------------------------------------------------------------------------
 #include "Effekseer.Base.h"
+#include <memory>
+#include <mutex>
 
 //----------------------------------------------------------------------------------
 //
@@ -18,6 +20,7 @@ namespace Effekseer
 
 class EffectFactory;
 class ResourceManager;
+class ThreadPool;
 
 /**
 	@brief	設定クラス
@@ -35,6 +38,10 @@ private:
 	std::vector<RefPtr<EffectFactory>> effectFactories_;
 	RefPtr<ResourceManager> resourceManager_;
 
+	//! threads which load effects with Effect::CreateAsync
+	std::unique_ptr<ThreadPool> loadingThreadPool_;
+	std::mutex loadingThreadPoolMutex_;
+
 protected:
 	Setting();
 
@@ -193,6 +200,22 @@ public:
 	*/
 	void SetProcedualMeshGenerator(ProcedualModelGeneratorRef generator);
 
+	/**
+		@brief
+		\~English	specify a directory where generated procedual models are saved and loaded
+		\~Japanese	生成されたプロシージャルモデルを保存、読み込みするディレクトリを設定する。
+		@param	directory
+		\~English	a directory. Models are not saved if it is null or empty
+		\~Japanese	ディレクトリ。nullか空の場合はモデルは保存されない。
+		@param	fileInterface
+		\~English	an interface to open files. A default one is used if it is null
+		\~Japanese	ファイルを開くインターフェース。nullの場合は標準のものが使用される。
+		@note
+		\~English	Files are named with hashes of parameters, so that models are not generated again when the same parameters are loaded in next time.
+		\~Japanese	ファイルはパラメーターのハッシュで命名されるため、次回以降に同じパラメーターが読み込まれた時にモデルは再生成されない。
+	*/
+	void SetProcedualModelCacheDirectory(const char16_t* directory, FileInterface* fileInterface = nullptr);
+
 	/**
 		@brief
 		\~English	Add effect factory
@@ -227,6 +250,16 @@ public:
 		\~Japanese Resource Managerを取得する。
 	*/
 	const RefPtr<ResourceManager>& GetResourceManager() const;
+
+	/**
+		@brief
+		\~English	Get threads which load effects with Effect::CreateAsync
+		\~Japanese Effect::CreateAsyncでエフェクトを読み込むスレッドを取得する。
+		@note
+		\~English	Threads are launched when an effect is loaded asynchronously first. The number of threads is up to 2 so that loading doesn't occupy all cores.
+		\~Japanese スレッドは最初にエフェクトが非同期に読み込まれる時に起動される。読み込みが全てのコアを占有しないように、スレッド数は最大2である。
+	*/
+	ThreadPool* GetLoadingThreadPool();
 };
 
 //----------------------------------------------------------------------------------
@@ -0,0 +1,210 @@
+#ifndef __EFFEKSEER_SLOT_MAP_H__
+#define __EFFEKSEER_SLOT_MAP_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "Effekseer.Base.h"
+#include "Utils/Effekseer.CustomAllocator.h"
+#include <assert.h>
+#include <queue>
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+namespace Effekseer
+{
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+/**
+	@brief	a container which finds values by handles in O(1)
+	@note
+	A handle consists of an index of a slot and a generation of the slot.
+	Values are packed densely in the order of addition, so that iterating them doesn't chase pointers.
+	A generation of a slot is incremented when a value is removed, so that old handles are not found.
+	Removed slots are reused in FIFO order to reuse the same handle as late as possible.
+*/
+template <typename T>
+class SlotMap final
+{
+public:
+	static const int32_t IndexBits = 18;
+	static const int32_t GenerationBits = 13;
+	static const int32_t IndexMax = (1 << IndexBits) - 1;
+	static const int32_t GenerationMask = (1 << GenerationBits) - 1;
+
+private:
+	struct Slot
+	{
+		//! an index of a value. -1 if the slot is not used
+		int32_t DenseIndex = -1;
+		int32_t Generation = 0;
+	};
+
+	CustomAlignedVector<T> values_;
+	CustomVector<Handle> handles_;
+	CustomVector<Slot> slots_;
+	std::queue<int32_t> freeSlots_;
+
+	static int32_t GetGeneration(Handle handle)
+	{
+		return (handle >> IndexBits) & GenerationMask;
+	}
+
+	int32_t FindDenseIndex(Handle handle) const
+	{
+		if (handle < 0)
+		{
+			return -1;
+		}
+
+		const auto slotIndex = GetSlotIndex(handle);
+		if (slotIndex >= static_cast<int32_t>(slots_.size()))
+		{
+			return -1;
+		}
+
+		const auto& slot = slots_[slotIndex];
+		if (slot.Generation != GetGeneration(handle))
+		{
+			return -1;
+		}
+
+		return slot.DenseIndex;
+	}
+
+public:
+	//! get an index of a slot which is less than GetSlotCount()
+	static int32_t GetSlotIndex(Handle handle)
+	{
+		return handle & IndexMax;
+	}
+
+	typedef typename CustomAlignedVector<T>::iterator iterator;
+	typedef typename CustomAlignedVector<T>::const_iterator const_iterator;
+
+	/**
+		@brief	add a value at the end
+		@return	a handle of the value
+	*/
+	Handle Add(const T& value)
+	{
+		int32_t slotIndex = 0;
+
+		if (!freeSlots_.empty())
+		{
+			slotIndex = freeSlots_.front();
+			freeSlots_.pop();
+		}
+		else
+		{
+			assert(slots_.size() <= static_cast<size_t>(IndexMax));
+			slotIndex = static_cast<int32_t>(slots_.size());
+			slots_.emplace_back();
+		}
+
+		auto& slot = slots_[slotIndex];
+		slot.DenseIndex = static_cast<int32_t>(values_.size());
+
+		const Handle handle = (slot.Generation << IndexBits) | slotIndex;
+		values_.emplace_back(value);
+		handles_.emplace_back(handle);
+		return handle;
+	}
+
+	/**
+		@brief	find a value
+		@return	a pointer to the value or nullptr if the handle was removed
+		@note
+		The pointer is invalidated when a value is added or removed.
+	*/
+	T* Find(Handle handle)
+	{
+		const auto denseIndex = FindDenseIndex(handle);
+		return denseIndex >= 0 ? &values_[denseIndex] : nullptr;
+	}
+
+	const T* Find(Handle handle) const
+	{
+		const auto denseIndex = FindDenseIndex(handle);
+		return denseIndex >= 0 ? &values_[denseIndex] : nullptr;
+	}
+
+	/**
+		@brief	remove values which satisfy a predicate
+		@note
+		A predicate is called once for each value in order and may move the value away when it returns true.
+		Remaining values keep their order.
+	*/
+	template <typename PREDICATE>
+	void RemoveIf(PREDICATE predicate)
+	{
+		const auto count = static_cast<int32_t>(values_.size());
+		int32_t dst = 0;
+
+		for (int32_t src = 0; src < count; src++)
+		{
+			const auto slotIndex = GetSlotIndex(handles_[src]);
+
+			if (predicate(values_[src]))
+			{
+				auto& slot = slots_[slotIndex];
+				slot.DenseIndex = -1;
+				slot.Generation = (slot.Generation + 1) & GenerationMask;
+				freeSlots_.push(slotIndex);
+				continue;
+			}
+
+			if (dst != src)
+			{
+				values_[dst] = std::move(values_[src]);
+				handles_[dst] = handles_[src];
+				slots_[slotIndex].DenseIndex = dst;
+			}
+			dst++;
+		}
+
+		values_.erase(values_.begin() + dst, values_.end());
+		handles_.erase(handles_.begin() + dst, handles_.end());
+	}
+
+	int32_t GetCount() const
+	{
+		return static_cast<int32_t>(values_.size());
+	}
+
+	int32_t GetSlotCount() const
+	{
+		return static_cast<int32_t>(slots_.size());
+	}
+
+	iterator begin()
+	{
+		return values_.begin();
+	}
+
+	iterator end()
+	{
+		return values_.end();
+	}
+
+	const_iterator begin() const
+	{
+		return values_.begin();
+	}
+
+	const_iterator end() const
+	{
+		return values_.end();
+	}
+};
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace Effekseer
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+#endif // __EFFEKSEER_SLOT_MAP_H__
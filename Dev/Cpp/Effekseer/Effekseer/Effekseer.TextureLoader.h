@@ -75,6 +75,47 @@ public:
 		return nullptr;
 	}
 
+	/**
+		@brief
+		\~English	decode a texture into parameters to create it without a graphics device
+		\~Japanese	グラフィックスデバイスを使わずに、テクスチャを生成するためのパラメーターにデコードする。
+		@param	path
+		\~English	a path of a texture
+		\~Japanese	読み込み元パス
+		@param	textureType
+		\~English	a kind of texture
+		\~Japanese	テクスチャの種類
+		@param	param
+		\~English	decoded parameters
+		\~Japanese	デコードされたパラメーター
+		@return
+		\~English	whether it is decoded. If it is false, Load is used instead of Create.
+		\~Japanese	デコードされたかどうか。falseの場合、Createの代わりにLoadが使用される。
+		@note
+		\~English	It is called on worker threads when an effect is loaded with Effect::CreateAsync, so it must be thread-safe.
+		\~Japanese	Effect::CreateAsyncでエフェクトが読み込まれる時にワーカースレッドで呼ばれるため、スレッドセーフである必要がある。
+	*/
+	virtual bool Decode(const char16_t* path, TextureType textureType, Backend::TextureParameter& param)
+	{
+		return false;
+	}
+
+	/**
+		@brief
+		\~English	create a texture from parameters which are decoded with Decode
+		\~Japanese	Decodeでデコードされたパラメーターからテクスチャを生成する。
+		@param	param
+		\~English	decoded parameters
+		\~Japanese	デコードされたパラメーター
+		@return
+		\~English	a pointer of created texture
+		\~Japanese	生成されたテクスチャのポインタ
+	*/
+	virtual TextureRef Create(const Backend::TextureParameter& param)
+	{
+		return nullptr;
+	}
+
 	/**
 		@brief	テクスチャを破棄する。
 		@param	data	[in]	テクスチャ
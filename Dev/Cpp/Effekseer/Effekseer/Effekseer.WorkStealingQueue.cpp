@@ -0,0 +1,98 @@
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+#include "Effekseer.WorkStealingQueue.h"
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+namespace Effekseer
+{
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void WorkStealingQueue::Reset(int32_t taskCount, int32_t threadCount)
+{
+	assert(taskCount >= 0);
+	assert(threadCount > 0);
+
+	if (rangeCapacity_ < threadCount)
+	{
+		ranges_.reset(new Range[threadCount]);
+		rangeCapacity_ = threadCount;
+	}
+
+	threadCount_ = threadCount;
+
+	// contiguous ranges keep neighboring tasks on the same thread
+	for (int32_t i = 0; i < threadCount_; i++)
+	{
+		const auto begin = static_cast<uint32_t>(static_cast<int64_t>(taskCount) * i / threadCount_);
+		const auto end = static_cast<uint32_t>(static_cast<int64_t>(taskCount) * (i + 1) / threadCount_);
+		ranges_[i].Value.store(Pack(begin, end), std::memory_order_relaxed);
+	}
+
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+bool WorkStealingQueue::Pop(int32_t threadID, int32_t& taskIndex)
+{
+	assert(0 <= threadID && threadID < threadCount_);
+
+	auto& range = ranges_[threadID].Value;
+	auto value = range.load(std::memory_order_acquire);
+
+	while (GetBegin(value) < GetEnd(value))
+	{
+		const auto begin = GetBegin(value);
+		if (range.compare_exchange_weak(value, Pack(begin + 1, GetEnd(value)), std::memory_order_acq_rel))
+		{
+			taskIndex = static_cast<int32_t>(begin);
+			return true;
+		}
+	}
+
+	return Steal(threadID, taskIndex);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+bool WorkStealingQueue::Steal(int32_t threadID, int32_t& taskIndex)
+{
+	// Only the owner makes an empty range non-empty again, so other threads never touch the own range while stealing.
+	for (int32_t offset = 1; offset < threadCount_; offset++)
+	{
+		auto& victim = ranges_[(threadID + offset) % threadCount_].Value;
+		auto value = victim.load(std::memory_order_acquire);
+
+		while (GetBegin(value) < GetEnd(value))
+		{
+			const auto begin = GetBegin(value);
+			const auto end = GetEnd(value);
+			const auto middle = begin + (end - begin) / 2;
+
+			if (victim.compare_exchange_weak(value, Pack(begin, middle), std::memory_order_acq_rel))
+			{
+				// the first stolen task is executed immediately and the rest becomes the own range
+				ranges_[threadID].Value.store(Pack(middle + 1, end), std::memory_order_release);
+				taskIndex = static_cast<int32_t>(middle);
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace Effekseer
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
@@ -0,0 +1,91 @@
+#ifndef __EFFEKSEER_WORK_STEALING_QUEUE_H__
+#define __EFFEKSEER_WORK_STEALING_QUEUE_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "Effekseer.Base.h"
+#include <atomic>
+#include <memory>
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+namespace Effekseer
+{
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+
+/**
+	@brief	a queue which distributes indexes of tasks among threads
+	@note
+	Each thread owns a contiguous range of indexes and pops them from the front.
+	A thread which runs out of its own range steals the latter half of the range of another thread,
+	so that a thread which lands on heavy tasks does not keep the other threads waiting.
+*/
+class WorkStealingQueue
+{
+private:
+	struct Range
+	{
+		//! begin (upper 32bit) and end (lower 32bit) are packed to be updated atomically
+		std::atomic<uint64_t> Value;
+
+		//! avoid false sharing between threads
+		uint8_t Padding[64 - sizeof(std::atomic<uint64_t>)];
+	};
+
+	std::unique_ptr<Range[]> ranges_;
+	int32_t rangeCapacity_ = 0;
+	int32_t threadCount_ = 0;
+
+	static uint64_t Pack(uint32_t begin, uint32_t end)
+	{
+		return (static_cast<uint64_t>(begin) << 32) | static_cast<uint64_t>(end);
+	}
+
+	static uint32_t GetBegin(uint64_t value)
+	{
+		return static_cast<uint32_t>(value >> 32);
+	}
+
+	static uint32_t GetEnd(uint64_t value)
+	{
+		return static_cast<uint32_t>(value & 0xFFFFFFFF);
+	}
+
+	bool Steal(int32_t threadID, int32_t& taskIndex);
+
+public:
+	WorkStealingQueue() = default;
+
+	WorkStealingQueue(const WorkStealingQueue&) = delete;
+
+	WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+	/**
+		@brief	distribute tasks among threads
+		@note
+		It must not be called while other threads pop tasks.
+	*/
+	void Reset(int32_t taskCount, int32_t threadCount);
+
+	/**
+		@brief	get an index of a next task
+		@param	threadID	[in]	an index of a thread which is smaller than threadCount specified in Reset
+		@param	taskIndex	[out]	an index of a task
+		@return	false if no task is left
+	*/
+	bool Pop(int32_t threadID, int32_t& taskIndex);
+};
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace Effekseer
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+
+#endif // __EFFEKSEER_WORK_STEALING_QUEUE_H__
@@ -84,6 +84,108 @@ void WorkerThread::WaitForComplete()
 	m_Task = nullptr;
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+ThreadBarrier::ThreadBarrier()
+{
+	m_WaitingCount.store(0);
+	m_Phase.store(0);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void ThreadBarrier::Reset(int32_t threadCount)
+{
+	m_ThreadCount = threadCount;
+	m_WaitingCount.store(0);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void ThreadBarrier::Wait()
+{
+	const uint32_t phase = m_Phase.load(std::memory_order_acquire);
+
+	if (m_WaitingCount.fetch_add(1, std::memory_order_acq_rel) == m_ThreadCount - 1)
+	{
+		// the last thread releases others
+		m_WaitingCount.store(0, std::memory_order_relaxed);
+		m_Phase.fetch_add(1, std::memory_order_acq_rel);
+		return;
+	}
+
+	const int32_t spinCount = 1024;
+	for (int32_t i = 0; m_Phase.load(std::memory_order_acquire) == phase; i++)
+	{
+		if (i >= spinCount)
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+ThreadPool::ThreadPool(int32_t threadCount)
+{
+	for (int32_t i = 0; i < threadCount; i++)
+	{
+		m_Threads.emplace_back([this]() {
+			while (1)
+			{
+				std::function<void()> task;
+
+				{
+					std::unique_lock<std::mutex> lock(m_Mutex);
+					m_TaskRequestCV.wait(lock, [this]() { return m_Tasks.size() > 0 || m_QuitRequested; });
+					if (m_Tasks.size() == 0)
+					{
+						break;
+					}
+
+					task = std::move(m_Tasks.front());
+					m_Tasks.pop_front();
+				}
+
+				task();
+			}
+		});
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_QuitRequested = true;
+	}
+	m_TaskRequestCV.notify_all();
+
+	for (auto& thread : m_Threads)
+	{
+		thread.join();
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void ThreadPool::Enqueue(std::function<void()> task)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Tasks.emplace_back(std::move(task));
+	}
+	m_TaskRequestCV.notify_one();
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
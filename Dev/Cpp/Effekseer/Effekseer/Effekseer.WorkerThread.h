@@ -6,6 +6,7 @@
 // Include
 //----------------------------------------------------------------------------------
 #include "Effekseer.Base.h"
+#include "Utils/Effekseer.CustomAllocator.h"
 #include <atomic>
 #include <condition_variable>
 #include <functional>
@@ -61,6 +62,54 @@ public:
 	void WaitForComplete();
 };
 
+/**
+	@brief	a barrier which blocks threads until all threads reach it
+	@note
+	It spins for a while before yielding because threads usually reach it at almost the same time.
+	It is much cheaper than RunAsync and WaitForComplete to synchronize threads many times in a frame.
+*/
+class ThreadBarrier
+{
+private:
+	std::atomic<int32_t> m_WaitingCount;
+	std::atomic<uint32_t> m_Phase;
+	int32_t m_ThreadCount = 0;
+
+public:
+	ThreadBarrier();
+
+	/**
+		@brief	specify the number of threads which wait
+		@note
+		It must not be called while threads wait.
+	*/
+	void Reset(int32_t threadCount);
+
+	void Wait();
+};
+
+/**
+	@brief	threads which run queued tasks
+	@note
+	Tasks are run in the order in which they are queued. Queued tasks are run before threads are shut down.
+*/
+class ThreadPool
+{
+private:
+	CustomVector<std::thread> m_Threads;
+	CustomList<std::function<void()>> m_Tasks;
+	std::mutex m_Mutex;
+	std::condition_variable m_TaskRequestCV;
+	bool m_QuitRequested = false;
+
+public:
+	ThreadPool(int32_t threadCount);
+
+	~ThreadPool();
+
+	void Enqueue(std::function<void()> task);
+};
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
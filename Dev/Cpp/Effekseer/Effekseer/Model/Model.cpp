@@ -1,14 +1,73 @@
 ﻿#include "Model.h"
 #include "../Backend/GraphicsDevice.h"
+#include <algorithm>
+#include <math.h>
 
 namespace Effekseer
 {
 
+static_assert(sizeof(Model::PackedVertex) == 32, "PackedVertex must be packed");
+
+//! indexes are stored in 16bit integers if all vertices can be indexed with them
+static const int32_t PackedIndexMaxVertexCount = 65536;
+
+static uint32_t PackSnorm10(const Vector3D& v)
+{
+	const auto quantize = [](float value) -> uint32_t {
+		value = std::min(std::max(value, -1.0f), 1.0f);
+		const auto quantized = static_cast<int32_t>(value >= 0.0f ? value * 511.0f + 0.5f : value * 511.0f - 0.5f);
+		return static_cast<uint32_t>(quantized) & 0x3FF;
+	};
+
+	return quantize(v.X) | (quantize(v.Y) << 10) | (quantize(v.Z) << 20);
+}
+
+static uint16_t PackHalf(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(uint32_t));
+
+	const uint32_t sign = (bits >> 16) & 0x8000;
+	const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFF) - 127 + 15;
+	uint32_t mantissa = bits & 0x7FFFFF;
+
+	if (((bits >> 23) & 0xFF) == 0xFF)
+	{
+		// infinity or NaN
+		return static_cast<uint16_t>(sign | 0x7C00 | (mantissa != 0 ? 0x200 : 0));
+	}
+
+	if (exponent >= 31)
+	{
+		return static_cast<uint16_t>(sign | 0x7C00);
+	}
+
+	if (exponent <= 0)
+	{
+		if (exponent < -10)
+		{
+			return static_cast<uint16_t>(sign);
+		}
+
+		// subnormal
+		mantissa |= 0x800000;
+		const uint32_t shift = 14 - exponent;
+		const uint32_t rounded = (mantissa + (1 << (shift - 1))) >> shift;
+		return static_cast<uint16_t>(sign | rounded);
+	}
+
+	// a carry of rounding moves into the exponent correctly
+	const uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+	return static_cast<uint16_t>(sign | (half + ((mantissa >> 12) & 1)));
+}
+
 Model::Model(const CustomVector<Vertex>& vertecies, const CustomVector<Face>& faces)
 {
 	models_.resize(1);
 	models_[0].vertexes = vertecies;
 	models_[0].faces = faces;
+
+	CalculateBoundingRadius();
 }
 
 Model::Model(const void* data, int32_t size)
@@ -71,6 +130,139 @@ Model::Model(const void* data, int32_t size)
 		memcpy(models_[f].faces.data(), p, sizeof(Face) * faceCount);
 		p += sizeof(Face) * faceCount;
 	}
+
+	CalculateBoundingRadius();
+}
+
+void Model::CalculateBoundingRadius()
+{
+	float radiusSquared = 0.0f;
+
+	for (const auto& model : models_)
+	{
+		for (const auto& vertex : model.vertexes)
+		{
+			const auto& pos = vertex.Position;
+			radiusSquared = std::max(radiusSquared, pos.X * pos.X + pos.Y * pos.Y + pos.Z * pos.Z);
+		}
+	}
+
+	boundingRadius_ = sqrtf(radiusSquared);
+}
+
+void Model::Save(CustomVector<uint8_t>& data, uint64_t key) const
+{
+	const auto write = [&data](const void* src, size_t size) {
+		const auto offset = data.size();
+		data.resize(offset + size);
+		if (size > 0)
+		{
+			memcpy(data.data() + offset, src, size);
+		}
+	};
+
+	const int32_t version = SavedVersion;
+	const int32_t scale = 1;
+	const int32_t modelCount = 1;
+	const int32_t frameCount = GetFrameCount();
+
+	data.clear();
+	write(&version, sizeof(int32_t));
+	write(&scale, sizeof(int32_t));
+	write(&modelCount, sizeof(int32_t));
+	write(&frameCount, sizeof(int32_t));
+
+	for (const auto& model : models_)
+	{
+		const int32_t vertexCount = static_cast<int32_t>(model.vertexes.size());
+		write(&vertexCount, sizeof(int32_t));
+		write(model.vertexes.data(), sizeof(Vertex) * vertexCount);
+
+		const int32_t faceCount = static_cast<int32_t>(model.faces.size());
+		write(&faceCount, sizeof(int32_t));
+		write(model.faces.data(), sizeof(Face) * faceCount);
+	}
+
+	write(&key, sizeof(uint64_t));
+}
+
+bool Model::IsValidSavedData(const void* data, int32_t size, uint64_t key)
+{
+	const uint8_t* p = (const uint8_t*)data;
+	int64_t rest = size;
+
+	const auto read = [&p, &rest](int32_t& value) {
+		if (rest < static_cast<int64_t>(sizeof(int32_t)))
+		{
+			return false;
+		}
+		memcpy(&value, p, sizeof(int32_t));
+		p += sizeof(int32_t);
+		rest -= sizeof(int32_t);
+		return true;
+	};
+
+	const auto skip = [&p, &rest](int32_t count, size_t elementSize) {
+		if (count < 0 || rest < static_cast<int64_t>(count) * static_cast<int64_t>(elementSize))
+		{
+			return false;
+		}
+		p += count * elementSize;
+		rest -= count * elementSize;
+		return true;
+	};
+
+	int32_t version = 0;
+	int32_t scale = 0;
+	int32_t modelCount = 0;
+	int32_t frameCount = 0;
+
+	if (!read(version) || version != SavedVersion || !read(scale) || !read(modelCount) || !read(frameCount) || frameCount <= 0)
+	{
+		return false;
+	}
+
+	for (int32_t f = 0; f < frameCount; f++)
+	{
+		int32_t vertexCount = 0;
+		int32_t faceCount = 0;
+
+		if (!read(vertexCount) || !skip(vertexCount, sizeof(Vertex)) || !read(faceCount))
+		{
+			return false;
+		}
+
+		const uint8_t* faces = p;
+		if (!skip(faceCount, sizeof(Face)))
+		{
+			return false;
+		}
+
+		for (int32_t i = 0; i < faceCount; i++)
+		{
+			Face face;
+			memcpy(&face, faces + sizeof(Face) * i, sizeof(Face));
+
+			for (const auto index : face.Indexes)
+			{
+				if (index < 0 || index >= vertexCount)
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	// data saved with another key is rejected
+	if (rest != static_cast<int64_t>(sizeof(uint64_t)))
+	{
+		return false;
+	}
+
+	uint64_t savedKey = 0;
+	memcpy(&savedKey, p, sizeof(uint64_t));
+
+	return savedKey == key;
 }
 
 Model ::~Model()
@@ -117,6 +309,11 @@ int32_t Model::GetFrameCount() const
 	return static_cast<int32_t>(models_.size());
 }
 
+float Model::GetBoundingRadius() const
+{
+	return boundingRadius_;
+}
+
 Model::Emitter Model::GetEmitter(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification)
 {
 	time = time % GetFrameCount();
@@ -299,7 +496,7 @@ Model::Emitter Model::GetEmitterFromFace(int32_t index, int32_t time, Coordinate
 	return emitter;
 }
 
-bool Model::StoreBufferToGPU(Backend::GraphicsDevice* graphicsDevice)
+bool Model::StoreBufferToGPU(Backend::GraphicsDevice* graphicsDevice, bool isPacked)
 {
 	if (isBufferStoredOnGPU_)
 	{
@@ -313,23 +510,62 @@ bool Model::StoreBufferToGPU(Backend::GraphicsDevice* graphicsDevice)
 
 	for (int32_t f = 0; f < GetFrameCount(); f++)
 	{
+		if (isPacked)
 		{
-			models_[f].vertexBuffer = graphicsDevice->CreateVertexBuffer(sizeof(Effekseer::Model::Vertex) * GetVertexCount(f), models_[f].vertexes.data(), false);
-			if (models_[f].vertexBuffer == nullptr)
+			CustomVector<PackedVertex> packedVertexes;
+			packedVertexes.resize(models_[f].vertexes.size());
+
+			for (size_t i = 0; i < packedVertexes.size(); i++)
 			{
-				return false;
+				const auto& vertex = models_[f].vertexes[i];
+				auto& packed = packedVertexes[i];
+				packed.Position = vertex.Position;
+				packed.Normal = PackSnorm10(vertex.Normal);
+				packed.Binormal = PackSnorm10(vertex.Binormal);
+				packed.Tangent = PackSnorm10(vertex.Tangent);
+				packed.UV = {PackHalf(vertex.UV.X), PackHalf(vertex.UV.Y)};
+				packed.VColor = vertex.VColor;
 			}
+
+			models_[f].vertexBuffer = graphicsDevice->CreateVertexBuffer(sizeof(PackedVertex) * GetVertexCount(f), packedVertexes.data(), false);
+		}
+		else
+		{
+			models_[f].vertexBuffer = graphicsDevice->CreateVertexBuffer(sizeof(Effekseer::Model::Vertex) * GetVertexCount(f), models_[f].vertexes.data(), false);
 		}
 
+		if (models_[f].vertexBuffer == nullptr)
 		{
-			models_[f].indexBuffer = graphicsDevice->CreateIndexBuffer(3 * GetFaceCount(f), models_[f].faces.data(), Effekseer::Backend::IndexBufferStrideType::Stride4);
-			if (models_[f].indexBuffer == nullptr)
+			return false;
+		}
+
+		if (isPacked && GetVertexCount(f) <= PackedIndexMaxVertexCount)
+		{
+			CustomVector<uint16_t> indexes;
+			indexes.reserve(models_[f].faces.size() * 3);
+
+			for (const auto& face : models_[f].faces)
 			{
-				return false;
+				for (const auto index : face.Indexes)
+				{
+					indexes.emplace_back(static_cast<uint16_t>(index));
+				}
 			}
+
+			models_[f].indexBuffer = graphicsDevice->CreateIndexBuffer(3 * GetFaceCount(f), indexes.data(), Effekseer::Backend::IndexBufferStrideType::Stride2);
+		}
+		else
+		{
+			models_[f].indexBuffer = graphicsDevice->CreateIndexBuffer(3 * GetFaceCount(f), models_[f].faces.data(), Effekseer::Backend::IndexBufferStrideType::Stride4);
+		}
+
+		if (models_[f].indexBuffer == nullptr)
+		{
+			return false;
 		}
 	}
 
+	isBufferPacked_ = isPacked;
 	isBufferStoredOnGPU_ = true;
 	return true;
 }
@@ -339,6 +575,11 @@ bool Model::GetIsBufferStoredOnGPU() const
 	return isBufferStoredOnGPU_;
 }
 
+int32_t Model::GetVertexBufferStride() const
+{
+	return isBufferPacked_ ? sizeof(PackedVertex) : sizeof(Vertex);
+}
+
 bool Model::GenerateWireIndexBuffer(Backend::GraphicsDevice* graphicsDevice)
 {
 	if (isWireIndexBufferGenerated_)
@@ -30,6 +30,9 @@ class Model : public Resource
 public:
 	static const int32_t Version = 1;
 
+	//! a version of efkmodel which is written by Save
+	static const int32_t SavedVersion = 5;
+
 	struct Vertex
 	{
 		Vector3D Position;
@@ -40,6 +43,22 @@ public:
 		Color VColor;
 	};
 
+	/**
+		@brief	a vertex which is stored on GPU by StoreBufferToGPU with isPacked
+		@note
+		A normal, a binormal and a tangent are signed normalized 10:10:10:2 integers whose x is in the lowest bits.
+		An uv is stored in half floats. They are decoded when vertices are fetched.
+	*/
+	struct PackedVertex
+	{
+		Vector3D Position;
+		uint32_t Normal;
+		uint32_t Binormal;
+		uint32_t Tangent;
+		std::array<uint16_t, 2> UV;
+		Color VColor;
+	};
+
 	struct Face
 	{
 		std::array<int32_t, 3> Indexes;
@@ -66,7 +85,11 @@ protected:
 	int32_t version_ = 0;
 	CustomVector<InternalModel> models_;
 	bool isBufferStoredOnGPU_ = false;
+	bool isBufferPacked_ = false;
 	bool isWireIndexBufferGenerated_ = false;
+	float boundingRadius_ = 0.0f;
+
+	void CalculateBoundingRadius();
 
 public:
 	Model(const CustomVector<Vertex>& vertecies, const CustomVector<Face>& faces);
@@ -91,6 +114,29 @@ public:
 
 	int32_t GetFrameCount() const;
 
+	/**
+		@brief
+		\~English	get a radius of a sphere around the origin which contains vertices of all frames
+		\~Japanese	全てのフレームの頂点を含む原点中心の球の半径を取得する。
+	*/
+	float GetBoundingRadius() const;
+
+	/**
+		@brief
+		\~English	write vertices and faces of all frames in the format which is read by the constructor, and a key after them
+		\~Japanese	全てのフレームの頂点と面をコンストラクタで読み込める形式で書き込み、その後にキーを書き込む。
+		@param	key	\~English	a value which identifies how the model was made. The constructor ignores it.
+					\~Japanese	モデルの作り方を識別する値。コンストラクタでは無視される。
+	*/
+	void Save(CustomVector<uint8_t>& data, uint64_t key) const;
+
+	/**
+		@brief
+		\~English	check whether data written by Save with the key can be read by the constructor without reading out of the data
+		\~Japanese	指定したキーでSaveで書き込まれたデータがデータ外を読まずにコンストラクタで読み込めるか確認する。
+	*/
+	static bool IsValidSavedData(const void* data, int32_t size, uint64_t key);
+
 	Emitter GetEmitter(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
 
 	Emitter GetEmitterFromVertex(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
@@ -101,10 +147,25 @@ public:
 
 	Emitter GetEmitterFromFace(int32_t index, int32_t time, CoordinateSystem coordinate, float magnification);
 
-	bool StoreBufferToGPU(Backend::GraphicsDevice* graphicsDevice);
+	/**
+		@brief
+		\~English	store vertices and faces of all frames on GPU
+		\~Japanese	全てのフレームの頂点と面をGPUに格納する。
+		@param	graphicsDevice	[in]	\~English	a graphics device	\~Japanese	グラフィックスデバイス
+		@param	isPacked	[in]	\~English	whether vertices are stored as PackedVertex and indexes are stored in 16bit integers if possible. It is lossy.
+		\~Japanese	頂点をPackedVertexとして格納し、可能ならインデックスを16bit整数で格納するか。非可逆である。
+	*/
+	bool StoreBufferToGPU(Backend::GraphicsDevice* graphicsDevice, bool isPacked = false);
 
 	bool GetIsBufferStoredOnGPU() const;
 
+	/**
+		@brief
+		\~English	get a size of a vertex in a vertex buffer on GPU
+		\~Japanese	GPU上の頂点バッファの頂点のサイズを取得する。
+	*/
+	int32_t GetVertexBufferStride() const;
+
 	bool GenerateWireIndexBuffer(Backend::GraphicsDevice* graphicsDevice);
 
 	bool GetIsWireIndexBufferGenerated() const;
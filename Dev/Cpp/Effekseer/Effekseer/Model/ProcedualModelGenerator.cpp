@@ -4,12 +4,15 @@
 #include "../Noise/CurlNoise.h"
 #include "../Noise/PerlinNoise.h"
 #include "../SIMD/Utils.h"
+#include "../Effekseer.WorkerThread.h"
 #include "ProcedualModelParameter.h"
 #include "SplineGenerator.h"
 
 #define _USE_MATH_DEFINES
 #include <cmath>
 #include <iterator>
+#include <mutex>
+#include <thread>
 
 namespace Effekseer
 {
@@ -58,6 +61,92 @@ static float CalcSineWave(float x, float frequency, float offset, float power)
 	return sinf(x * frequency + offset) * power;
 }
 
+/**
+	@brief	threads which are reused by ParallelFor while a generator generates models
+	@note
+	Threads of a manager are not used because models are generated when effects are loaded, independent of managers,
+	and threads of a manager may update effects asynchronously at that time.
+	Threads are launched when a model is large enough to be split first, and are reused by later models.
+*/
+class ProcedualModelWorkers
+{
+	std::mutex mutex_;
+	CustomVector<WorkerThread> threads_;
+	int32_t threadCount_ = 1;
+
+public:
+	//! the mutex which is locked while a model is generated with threads
+	std::mutex& GetMutex()
+	{
+		return mutex_;
+	}
+
+	int32_t GetThreadCount() const
+	{
+		return threadCount_;
+	}
+
+	void SetThreadCount(int32_t threadCount)
+	{
+		threadCount_ = Max(threadCount, 1);
+	}
+
+	//! get threads except the calling thread, which are relaunched if the number of threads is changed
+	CustomVector<WorkerThread>& GetThreads()
+	{
+		if (static_cast<int32_t>(threads_.size()) != threadCount_ - 1)
+		{
+			threads_.clear();
+			threads_.resize(threadCount_ - 1);
+
+			for (auto& thread : threads_)
+			{
+				thread.Launch();
+			}
+		}
+
+		return threads_;
+	}
+};
+
+/**
+	@brief	call a function with ranges which split [0, count) on threads
+	@note
+	The calling thread runs the first range. If workers is null, all ranges are run on the calling thread.
+	Ranges are not split smaller than minCount because passing ranges to threads has overheads.
+*/
+template <typename FUNC>
+static void ParallelFor(ProcedualModelWorkers* workers, int32_t count, int32_t minCount, const FUNC& func)
+{
+	const int32_t threadCount = workers != nullptr ? workers->GetThreadCount() : 1;
+	const int32_t rangeCount = Clamp(count / Max(minCount, 1), threadCount, 1);
+
+	if (rangeCount <= 1)
+	{
+		func(0, count);
+		return;
+	}
+
+	auto& threads = workers->GetThreads();
+
+	for (int32_t i = 1; i < rangeCount; i++)
+	{
+		const int32_t begin = count * i / rangeCount;
+		const int32_t end = count * (i + 1) / rangeCount;
+		threads[i - 1].RunAsync([&func, begin, end]() { func(begin, end); });
+	}
+
+	func(0, count / rangeCount);
+
+	for (int32_t i = 1; i < rangeCount; i++)
+	{
+		threads[i - 1].WaitForComplete();
+	}
+}
+
+//! the minimum number of vertices or faces which are processed on a thread
+static const int32_t MinParallelElementCount = 2048;
+
 static void CalcTangentSpace(const ProcedualMeshVertex& v1, const ProcedualMeshVertex& v2, const ProcedualMeshVertex& v3, SIMD::Vec3f& binormal, SIMD::Vec3f& tangent)
 {
 	binormal = SIMD::Vec3f();
@@ -105,46 +194,44 @@ static void CalcTangentSpace(const ProcedualMeshVertex& v1, const ProcedualMeshV
 	binormal.Normalize();
 }
 
-static void CalculateNormal(ProcedualMesh& mesh)
+static void CalculateNormal(ProcedualMesh& mesh, ProcedualModelWorkers* workers)
 {
+	const auto faceCount = static_cast<int32_t>(mesh.Faces.size());
+	const auto vertexCount = static_cast<int32_t>(mesh.Vertexes.size());
+
 	CustomAlignedVector<SIMD::Vec3f> faceNormals;
 	CustomAlignedVector<SIMD::Vec3f> faceTangents;
 
-	faceNormals.resize(mesh.Faces.size());
-	faceTangents.resize(mesh.Faces.size());
-
-	for (size_t i = 0; i < faceNormals.size(); i++)
-	{
-		faceNormals[i] = SIMD::Vec3f(0.0f, 0.0f, 0.0f);
-		faceTangents[i] = SIMD::Vec3f(0.0f, 0.0f, 0.0f);
-	}
-
-	for (size_t i = 0; i < mesh.Faces.size(); i++)
-	{
-		const auto& v1 = mesh.Vertexes[mesh.Faces[i].Indexes[0]];
-		const auto& v2 = mesh.Vertexes[mesh.Faces[i].Indexes[1]];
-		const auto& v3 = mesh.Vertexes[mesh.Faces[i].Indexes[2]];
+	faceNormals.resize(faceCount);
+	faceTangents.resize(faceCount);
 
-		const auto eps = 0.0001f;
-		if ((v1.Position - v2.Position).GetLength() < eps || (v2.Position - v3.Position).GetLength() < eps || (v1.Position - v3.Position).GetLength() < eps)
+	ParallelFor(workers, faceCount, MinParallelElementCount, [&](int32_t begin, int32_t end) {
+		for (int32_t i = begin; i < end; i++)
 		{
-			continue;
-		}
+			faceNormals[i] = SIMD::Vec3f(0.0f, 0.0f, 0.0f);
+			faceTangents[i] = SIMD::Vec3f(0.0f, 0.0f, 0.0f);
 
-		const auto normal = SIMD::Vec3f::Cross(v3.Position - v1.Position, v2.Position - v1.Position).Normalize();
+			const auto& v1 = mesh.Vertexes[mesh.Faces[i].Indexes[0]];
+			const auto& v2 = mesh.Vertexes[mesh.Faces[i].Indexes[1]];
+			const auto& v3 = mesh.Vertexes[mesh.Faces[i].Indexes[2]];
 
-		faceNormals[i] = normal;
-		SIMD::Vec3f binotmal;
-		SIMD::Vec3f tangent;
+			const auto eps = 0.0001f;
+			if ((v1.Position - v2.Position).GetLength() < eps || (v2.Position - v3.Position).GetLength() < eps || (v1.Position - v3.Position).GetLength() < eps)
+			{
+				continue;
+			}
 
-		CalcTangentSpace(v1, v2, v3, binotmal, tangent);
+			const auto normal = SIMD::Vec3f::Cross(v3.Position - v1.Position, v2.Position - v1.Position).Normalize();
 
-		faceTangents[i] = tangent;
-	}
+			faceNormals[i] = normal;
+			SIMD::Vec3f binotmal;
+			SIMD::Vec3f tangent;
+
+			CalcTangentSpace(v1, v2, v3, binotmal, tangent);
 
-	CustomAlignedUnorderedMap<SIMD::Vec3f, SIMD::Vec3f> normals;
-	CustomAlignedUnorderedMap<SIMD::Vec3f, SIMD::Vec3f> tangents;
-	CustomAlignedUnorderedMap<SIMD::Vec3f, int32_t> vertexCounts;
+			faceTangents[i] = tangent;
+		}
+	});
 
 	auto generateKey = [](SIMD::Vec3f s) -> SIMD::Vec3f {
 		s.SetX(roundf(s.GetX() * 1024.0f));
@@ -153,36 +240,54 @@ static void CalculateNormal(ProcedualMesh& mesh)
 		return s;
 	};
 
-	for (size_t i = 0; i < mesh.Faces.size(); i++)
+	// vertices at the same position are welded to share a normal
+	CustomVector<int32_t> weldedIndexes;
+	weldedIndexes.resize(vertexCount);
+
 	{
-		for (size_t j = 0; j < 3; j++)
+		CustomAlignedUnorderedMap<SIMD::Vec3f, int32_t> keyToIndex;
+		keyToIndex.reserve(vertexCount);
+
+		for (int32_t i = 0; i < vertexCount; i++)
 		{
-			const auto& key = generateKey(mesh.Vertexes[mesh.Faces[i].Indexes[j]].Position);
+			const auto key = generateKey(mesh.Vertexes[i].Position);
+			weldedIndexes[i] = keyToIndex.emplace(key, static_cast<int32_t>(keyToIndex.size())).first->second;
+		}
+	}
 
-			if (normals.count(key) == 0)
-			{
-				normals[key] = SIMD::Vec3f(0.0f, 0.0f, 0.0f);
-				tangents[key] = SIMD::Vec3f(0.0f, 0.0f, 0.0f);
-				vertexCounts[key] = 0;
-			}
+	CustomAlignedVector<SIMD::Vec3f> normals;
+	CustomAlignedVector<SIMD::Vec3f> tangents;
+	CustomVector<int32_t> vertexCounts;
 
-			if (faceNormals[i] == SIMD::Vec3f(0.0f, 0.0f, 0.0f))
-			{
-				continue;
-			}
+	normals.resize(vertexCount, SIMD::Vec3f(0.0f, 0.0f, 0.0f));
+	tangents.resize(vertexCount, SIMD::Vec3f(0.0f, 0.0f, 0.0f));
+	vertexCounts.resize(vertexCount, 0);
 
-			normals[key] += faceNormals[i];
-			tangents[key] += faceTangents[i];
-			vertexCounts[key]++;
+	// faces are accumulated in order to keep results of floating points
+	for (int32_t i = 0; i < faceCount; i++)
+	{
+		if (faceNormals[i] == SIMD::Vec3f(0.0f, 0.0f, 0.0f))
+		{
+			continue;
 		}
-	}
 
-	for (size_t i = 0; i < mesh.Vertexes.size(); i++)
-	{
-		const auto& key = generateKey(mesh.Vertexes[i].Position);
-		mesh.Vertexes[i].Normal = normals[key] / static_cast<float>(vertexCounts[key]);
-		mesh.Vertexes[i].Tangent = tangents[key] / static_cast<float>(vertexCounts[key]);
+		for (size_t j = 0; j < 3; j++)
+		{
+			const auto index = weldedIndexes[mesh.Faces[i].Indexes[j]];
+			normals[index] += faceNormals[i];
+			tangents[index] += faceTangents[i];
+			vertexCounts[index]++;
+		}
 	}
+
+	ParallelFor(workers, vertexCount, MinParallelElementCount, [&](int32_t begin, int32_t end) {
+		for (int32_t i = begin; i < end; i++)
+		{
+			const auto index = weldedIndexes[i];
+			mesh.Vertexes[i].Normal = normals[index] / static_cast<float>(vertexCounts[index]);
+			mesh.Vertexes[i].Tangent = tangents[index] / static_cast<float>(vertexCounts[index]);
+		}
+	});
 }
 
 static void CalculateVertexColor(ProcedualMesh& mesh,
@@ -192,7 +297,8 @@ static void CalculateVertexColor(ProcedualMesh& mesh,
 								 const Color& ColorLeftMiddle,
 								 const Color& ColorCenterMiddle,
 								 const Color& ColorRightMiddle,
-								 const std::array<float, 2>& colorCenterArea)
+								 const std::array<float, 2>& colorCenterArea,
+								 ProcedualModelWorkers* workers)
 {
 	auto calcColor = [&](float u, float v) -> Color {
 		::Effekseer::Color leftColor;
@@ -278,10 +384,13 @@ static void CalculateVertexColor(ProcedualMesh& mesh,
 		}
 	};
 
-	for (auto& v : mesh.Vertexes)
-	{
-		v.VColor = calcColor(v.UV.GetX(), v.UV.GetY());
-	}
+	ParallelFor(workers, static_cast<int32_t>(mesh.Vertexes.size()), MinParallelElementCount, [&](int32_t begin, int32_t end) {
+		for (int32_t i = begin; i < end; i++)
+		{
+			auto& v = mesh.Vertexes[i];
+			v.VColor = calcColor(v.UV.GetX(), v.UV.GetY());
+		}
+	});
 }
 
 static void ChangeAxis(ProcedualMesh& mesh, ProcedualModelAxisType axisType)
@@ -323,7 +432,7 @@ static void ChangeAxis(ProcedualMesh& mesh, ProcedualModelAxisType axisType)
 	}
 }
 
-static ModelRef ConvertMeshToModel(const ProcedualMesh& mesh)
+static ModelRef ConvertMeshToModel(const ProcedualMesh& mesh, ProcedualModelWorkers* workers)
 {
 	CustomVector<Model::Vertex> vs;
 	CustomVector<Model::Face> faces;
@@ -331,16 +440,18 @@ static ModelRef ConvertMeshToModel(const ProcedualMesh& mesh)
 	vs.resize(mesh.Vertexes.size());
 	faces.resize(mesh.Faces.size());
 
-	for (size_t i = 0; i < vs.size(); i++)
-	{
-		vs[i].Position = ToStruct(mesh.Vertexes[i].Position);
-		vs[i].Normal = ToStruct(mesh.Vertexes[i].Normal);
-		vs[i].Tangent = ToStruct(mesh.Vertexes[i].Tangent);
-		vs[i].UV = ToStruct(mesh.Vertexes[i].UV);
-		Vector3D::Cross(vs[i].Binormal, vs[i].Normal, vs[i].Tangent);
-		Vector3D::Normal(vs[i].Binormal, vs[i].Binormal);
-		vs[i].VColor = mesh.Vertexes[i].VColor;
-	}
+	ParallelFor(workers, static_cast<int32_t>(vs.size()), MinParallelElementCount, [&](int32_t begin, int32_t end) {
+		for (int32_t i = begin; i < end; i++)
+		{
+			vs[i].Position = ToStruct(mesh.Vertexes[i].Position);
+			vs[i].Normal = ToStruct(mesh.Vertexes[i].Normal);
+			vs[i].Tangent = ToStruct(mesh.Vertexes[i].Tangent);
+			vs[i].UV = ToStruct(mesh.Vertexes[i].UV);
+			Vector3D::Cross(vs[i].Binormal, vs[i].Normal, vs[i].Tangent);
+			Vector3D::Normal(vs[i].Binormal, vs[i].Binormal);
+			vs[i].VColor = mesh.Vertexes[i].VColor;
+		}
+	});
 
 	for (size_t i = 0; i < faces.size(); i++)
 	{
@@ -476,33 +587,61 @@ static SIMD::Vec3f WaveNoise(SIMD::Vec3f v, std::array<float, 3> waveOffsets, st
 				   CalcSineWave(v.GetY(), waveFrequency[2], waveOffsets[2], noiseScales[2]));
 }
 
-struct RotatorMeshGenerator
+//! deformation which is applied to each vertex
+struct ProcedualMeshNoise
 {
-	float AngleMin;
-	float AngleMax;
-	bool IsConnected = false;
+	const ProcedualModelParameter* Parameter = nullptr;
+	CurlNoise Curl;
 
-	std::function<SIMD::Vec2f(float)> Rotator;
-	std::function<SIMD::Vec3f(SIMD::Vec3f)> Noise;
+	//! curl noise is the most expensive, so that it is skipped if it has no effect
+	bool IsCurlNoiseEnabled = false;
 
-	SIMD::Vec3f GetPosition(float angleValue, float depthValue) const
+	ProcedualMeshNoise(const ProcedualModelParameter* parameter)
+		: Parameter(parameter)
+		, Curl(0, 1.0f, 2)
+		, IsCurlNoiseEnabled(parameter->CurlNoisePower[0] != 0.0f || parameter->CurlNoisePower[1] != 0.0f || parameter->CurlNoisePower[2] != 0.0f)
 	{
-		depthValue = Clamp(depthValue, 1.0f, 0.0f);
-		auto angle = (AngleMax - AngleMin) * angleValue + AngleMin;
+	}
 
-		SIMD::Vec2f pos2d = Rotator(depthValue);
+	SIMD::Vec3f Apply(SIMD::Vec3f v) const
+	{
+		// tilt noise
+		{
+			float angleX = CalcSineWave(v.GetY(), Parameter->TiltNoiseFrequency[0], Parameter->TiltNoiseOffset[0], Parameter->TiltNoisePower[0]);
+			float angleY = CalcSineWave(v.GetY(), Parameter->TiltNoiseFrequency[1], Parameter->TiltNoiseOffset[1], Parameter->TiltNoisePower[1]);
 
-		float s;
-		float c;
-		SinCos(angle, s, c);
-		auto x = pos2d.GetX();
-		//x += sin(depthValue) * 0.4f;
-		auto rx = x * s;
-		auto rz = x * c;
-		auto y = pos2d.GetY();
+			SIMD::Vec3f dirX(cos(angleX), sin(angleX), 0.0f);
+			SIMD::Vec3f dirZ(0.0f, sin(angleY), cos(angleY));
+			SIMD::Vec3f dirY = SIMD::Vec3f::Cross(dirZ, dirX).Normalize();
+			dirZ = SIMD::Vec3f::Cross(dirX, dirY).Normalize();
 
-		return SIMD::Vec3f(rx, y, rz);
+			v = SIMD::Vec3f(0.0f, v.GetY(), 0.0f) + dirX * v.GetX() + dirZ * v.GetZ();
+		}
+
+		v = WaveNoise(v,
+					  Parameter->WaveNoiseOffset,
+					  Parameter->WaveNoiseFrequency,
+					  Parameter->WaveNoisePower);
+
+		if (!IsCurlNoiseEnabled)
+		{
+			return v;
+		}
+
+		return v + Curl.Get(v * Parameter->CurlNoiseFrequency + Parameter->CurlNoiseOffset) * Parameter->CurlNoisePower;
 	}
+};
+
+template <typename ROTATOR>
+struct RotatorMeshGenerator
+{
+	float AngleMin;
+	float AngleMax;
+	bool IsConnected = false;
+	ProcedualModelWorkers* Workers = nullptr;
+
+	const ROTATOR* Rotator = nullptr;
+	const ProcedualMeshNoise* Noise = nullptr;
 
 	ProcedualMesh Generate(int32_t angleDivision, int32_t depthDivision) const
 	{
@@ -514,22 +653,48 @@ struct RotatorMeshGenerator
 		ret.Vertexes.resize(depthDivision * angleDivision);
 		ret.Faces.resize((depthDivision - 1) * (angleDivision - 1) * 2);
 
-		for (int32_t v = 0; v < depthDivision; v++)
+		// angles are shared by all rows
+		CustomVector<float> sines;
+		CustomVector<float> cosines;
+		sines.resize(angleDivision);
+		cosines.resize(angleDivision);
+
+		for (int32_t u = 0; u < angleDivision; u++)
 		{
-			for (int32_t u = 0; u < angleDivision; u++)
-			{
-				ret.Vertexes[u + v * angleDivision].Position = GetPosition(u / float(angleDivision - 1), v / float(depthDivision - 1));
-				ret.Vertexes[u + v * angleDivision].UV = SIMD::Vec2f(u / float(angleDivision - 1), 1.0f - v / float(depthDivision - 1));
-			}
+			const auto angle = (AngleMax - AngleMin) * (u / float(angleDivision - 1)) + AngleMin;
+			SinCos(angle, sines[u], cosines[u]);
 		}
 
-		if (IsConnected)
-		{
-			for (int32_t v = 0; v < depthDivision; v++)
+		const auto minRowCount = Max(MinParallelElementCount / angleDivision, 1);
+
+		ParallelFor(Workers, depthDivision, minRowCount, [&](int32_t begin, int32_t end) {
+			for (int32_t v = begin; v < end; v++)
 			{
-				ret.Vertexes[(angleDivision - 1) + v * angleDivision].Position = ret.Vertexes[0 + v * angleDivision].Position;
+				auto* row = &ret.Vertexes[v * angleDivision];
+
+				// a cross section depends only on a depth
+				const auto depthValue = v / float(depthDivision - 1);
+				const SIMD::Vec2f pos2d = Rotator->GetPosition(Clamp(depthValue, 1.0f, 0.0f));
+				const auto x = pos2d.GetX();
+				const auto y = pos2d.GetY();
+
+				for (int32_t u = 0; u < angleDivision; u++)
+				{
+					row[u].Position = SIMD::Vec3f(x * sines[u], y, x * cosines[u]);
+					row[u].UV = SIMD::Vec2f(u / float(angleDivision - 1), 1.0f - depthValue);
+				}
+
+				if (IsConnected)
+				{
+					row[angleDivision - 1].Position = row[0].Position;
+				}
+
+				for (int32_t u = 0; u < angleDivision; u++)
+				{
+					row[u].Position = Noise->Apply(row[u].Position);
+				}
 			}
-		}
+		});
 
 		for (int32_t v = 0; v < depthDivision - 1; v++)
 		{
@@ -556,27 +721,24 @@ struct RotatorMeshGenerator
 			}
 		}
 
-		for (size_t i = 0; i < ret.Vertexes.size(); i++)
-		{
-			ret.Vertexes[i].Position = Noise(ret.Vertexes[i].Position);
-		}
-
 		return ret;
 	}
 };
 
+template <typename ROTATOR>
 struct RotatedWireMeshGenerator
 {
 	float Rotate;
 	int Vertices;
 	int Count;
+	ProcedualModelWorkers* Workers = nullptr;
 
 	std::array<float, 2> RibbonNoises;
 	std::array<float, 2> RibbonAngles;
 	std::array<float, 2> RibbonSizes;
 
-	std::function<SIMD::Vec2f(float)> Rotator;
-	std::function<SIMD::Vec3f(SIMD::Vec3f)> Noise;
+	const ROTATOR* Rotator = nullptr;
+	const ProcedualMeshNoise* Noise = nullptr;
 
 	ProcedualModelCrossSectionType CrossSectionType;
 
@@ -585,7 +747,7 @@ struct RotatedWireMeshGenerator
 		auto value = depthValue;
 		auto angle = angleValue;
 
-		SIMD::Vec2f pos2d = Rotator(value);
+		SIMD::Vec2f pos2d = Rotator->GetPosition(value);
 
 		float s;
 		float c;
@@ -663,7 +825,9 @@ struct RotatedWireMeshGenerator
 		float depthSpeed = 1.0f / static_cast<float>(Vertices);
 		float rotateSpeed = Rotate * EFK_PI * 2.0f / static_cast<float>(Vertices);
 
-		ProcedualMesh ret;
+		// ribbons are built in order because they consume random numbers
+		CustomVector<ProcedualMesh> ribbons;
+		ribbons.resize(Count);
 
 		for (int32_t l = 0; l < Count; l++)
 		{
@@ -691,7 +855,7 @@ struct RotatedWireMeshGenerator
 				currentAngle += rotateSpeed;
 			}
 
-			ProcedualMesh ribbon;
+			auto& ribbon = ribbons[l];
 
 			ribbon.Vertexes.resize(vs.size() * vertexPoses.size());
 
@@ -744,14 +908,30 @@ struct RotatedWireMeshGenerator
 					ribbon.Faces[v * edgeIDs.size() + i * 2 + 1] = face1;
 				}
 			}
+		}
 
-			for (size_t i = 0; i < ribbon.Vertexes.size(); i++)
+		// ribbons are deformed independently
+		const auto vertexCountPerRibbon = Max(Vertices, 1) * static_cast<int32_t>(vertexPoses.size());
+		const auto minRibbonCount = Max(MinParallelElementCount / Max(vertexCountPerRibbon, 1), 1);
+
+		ParallelFor(Workers, Count, minRibbonCount, [&](int32_t begin, int32_t end) {
+			for (int32_t l = begin; l < end; l++)
 			{
-				ribbon.Vertexes[i].Position = Noise(ribbon.Vertexes[i].Position);
+				auto& ribbon = ribbons[l];
+
+				for (size_t i = 0; i < ribbon.Vertexes.size(); i++)
+				{
+					ribbon.Vertexes[i].Position = Noise->Apply(ribbon.Vertexes[i].Position);
+				}
+
+				CalculateNormal(ribbon, nullptr);
 			}
+		});
 
-			CalculateNormal(ribbon);
+		ProcedualMesh ret;
 
+		for (auto& ribbon : ribbons)
+		{
 			ret = ProcedualMesh::Combine(std::move(ret), std::move(ribbon));
 		}
 
@@ -759,6 +939,44 @@ struct RotatedWireMeshGenerator
 	}
 };
 
+template <typename ROTATOR>
+static ProcedualMesh GenerateMesh(const ProcedualModelParameter* parameter, const ROTATOR& rotator, const ProcedualMeshNoise& noise, ProcedualModelWorkers* workers)
+{
+	if (parameter->Type == ProcedualModelType::Mesh)
+	{
+		const auto AngleBegin = parameter->Mesh.AngleBegin / 180.0f * EFK_PI;
+		const auto AngleEnd = parameter->Mesh.AngleEnd / 180.0f * EFK_PI;
+		const auto eps = 0.000001f;
+		const auto isConnected = std::fmod(std::abs(parameter->Mesh.AngleBegin - parameter->Mesh.AngleEnd), 360.0f) < eps;
+
+		auto generator = RotatorMeshGenerator<ROTATOR>();
+		generator.Rotator = &rotator;
+		generator.Noise = &noise;
+		generator.AngleMin = AngleBegin;
+		generator.AngleMax = AngleEnd;
+		generator.IsConnected = isConnected;
+		generator.Workers = workers;
+		return generator.Generate(parameter->Mesh.Divisions[0], parameter->Mesh.Divisions[1]);
+	}
+	else
+	{
+		RandObject randObj;
+
+		auto generator = RotatedWireMeshGenerator<ROTATOR>();
+		generator.Rotator = &rotator;
+		generator.Noise = &noise;
+		generator.CrossSectionType = parameter->Ribbon.CrossSection;
+		generator.Vertices = parameter->Ribbon.Vertices;
+		generator.Rotate = parameter->Ribbon.Rotate;
+		generator.Count = parameter->Ribbon.Count;
+		generator.RibbonSizes = parameter->Ribbon.RibbonSizes;
+		generator.RibbonAngles = parameter->Ribbon.RibbonAngles;
+		generator.RibbonNoises = parameter->Ribbon.RibbonNoises;
+		generator.Workers = workers;
+		return generator.Generate(randObj);
+	}
+}
+
 ModelRef ProcedualModelGenerator::Generate(const ProcedualModelParameter* parameter)
 {
 	if (parameter == nullptr)
@@ -766,10 +984,24 @@ ModelRef ProcedualModelGenerator::Generate(const ProcedualModelParameter* parame
 		return nullptr;
 	}
 
-	RandObject randObj;
-	CurlNoise curlNoise(0, 1.0f, 2);
+	if (parameter->Type != ProcedualModelType::Mesh && parameter->Type != ProcedualModelType::Ribbon)
+	{
+		return nullptr;
+	}
+
+	// a model which is generated while another model is generated, for example by loading effects asynchronously, is generated on the calling thread
+	std::unique_lock<std::mutex> lock(workers_->GetMutex(), std::try_to_lock);
+	ProcedualModelWorkers* workers = nullptr;
+
+	if (lock.owns_lock())
+	{
+		workers = workers_.get();
+		workers->SetThreadCount(GetThreadCount());
+	}
+
+	const ProcedualMeshNoise noise(parameter);
 
-	std::function<SIMD::Vec2f(float)> primitiveGenerator;
+	ProcedualMesh generated;
 
 	if (parameter->PrimitiveType == ProcedualModelPrimitiveType::Sphere)
 	{
@@ -777,20 +1009,14 @@ ModelRef ProcedualModelGenerator::Generate(const ProcedualModelParameter* parame
 		rotator.DepthMin = parameter->Sphere.DepthMin;
 		rotator.DepthMax = parameter->Sphere.DepthMax;
 		rotator.Radius = parameter->Sphere.Radius;
-
-		primitiveGenerator = [rotator](float value) -> SIMD::Vec2f {
-			return rotator.GetPosition(value);
-		};
+		generated = GenerateMesh(parameter, rotator, noise, workers);
 	}
 	else if (parameter->PrimitiveType == ProcedualModelPrimitiveType::Cone)
 	{
 		RotatorCone rotator;
 		rotator.Radius = parameter->Cone.Radius;
 		rotator.Depth = parameter->Cone.Depth;
-
-		primitiveGenerator = [rotator](float value) -> SIMD::Vec2f {
-			return rotator.GetPosition(value);
-		};
+		generated = GenerateMesh(parameter, rotator, noise, workers);
 	}
 	else if (parameter->PrimitiveType == ProcedualModelPrimitiveType::Cylinder)
 	{
@@ -798,10 +1024,7 @@ ModelRef ProcedualModelGenerator::Generate(const ProcedualModelParameter* parame
 		rotator.Radius1 = parameter->Cylinder.Radius1;
 		rotator.Radius2 = parameter->Cylinder.Radius2;
 		rotator.Depth = parameter->Cylinder.Depth;
-
-		primitiveGenerator = [rotator](float value) -> SIMD::Vec2f {
-			return rotator.GetPosition(value);
-		};
+		generated = GenerateMesh(parameter, rotator, noise, workers);
 	}
 	else if (parameter->PrimitiveType == ProcedualModelPrimitiveType::Spline4)
 	{
@@ -811,83 +1034,29 @@ ModelRef ProcedualModelGenerator::Generate(const ProcedualModelParameter* parame
 		rotator.Point3 = parameter->Spline4.Point3;
 		rotator.Point4 = parameter->Spline4.Point4;
 		rotator.Calculate();
-
-		primitiveGenerator = [rotator](float value) -> SIMD::Vec2f {
-			return rotator.GetPosition(value);
-		};
+		generated = GenerateMesh(parameter, rotator, noise, workers);
 	}
 	else
 	{
 		assert(0);
+		return nullptr;
 	}
 
-	std::function<SIMD::Vec3f(SIMD::Vec3f)> noiseFunc = [parameter, &curlNoise](SIMD::Vec3f v) -> SIMD::Vec3f {
-		// tilt noise
-		{
-			float angleX = CalcSineWave(v.GetY(), parameter->TiltNoiseFrequency[0], parameter->TiltNoiseOffset[0], parameter->TiltNoisePower[0]);
-			float angleY = CalcSineWave(v.GetY(), parameter->TiltNoiseFrequency[1], parameter->TiltNoiseOffset[1], parameter->TiltNoisePower[1]);
-
-			SIMD::Vec3f dirX(cos(angleX), sin(angleX), 0.0f);
-			SIMD::Vec3f dirZ(0.0f, sin(angleY), cos(angleY));
-			SIMD::Vec3f dirY = SIMD::Vec3f::Cross(dirZ, dirX).Normalize();
-			dirZ = SIMD::Vec3f::Cross(dirX, dirY).Normalize();
-
-			v = SIMD::Vec3f(0.0f, v.GetY(), 0.0f) + dirX * v.GetX() + dirZ * v.GetZ();
-		}
-
-		v = WaveNoise(v,
-					  parameter->WaveNoiseOffset,
-					  parameter->WaveNoiseFrequency,
-					  parameter->WaveNoisePower);
-
-		return v + curlNoise.Get(v * parameter->CurlNoiseFrequency + parameter->CurlNoiseOffset) * parameter->CurlNoisePower;
-	};
-
-	if (parameter->Type == ProcedualModelType::Mesh)
-	{
-		const auto AngleBegin = parameter->Mesh.AngleBegin / 180.0f * EFK_PI;
-		const auto AngleEnd = parameter->Mesh.AngleEnd / 180.0f * EFK_PI;
-		const auto eps = 0.000001f;
-		const auto isConnected = std::fmod(std::abs(parameter->Mesh.AngleBegin - parameter->Mesh.AngleEnd), 360.0f) < eps;
-
-		auto generator = RotatorMeshGenerator();
-		generator.Rotator = primitiveGenerator;
-		generator.Noise = noiseFunc;
-		generator.AngleMin = AngleBegin;
-		generator.AngleMax = AngleEnd;
-		generator.IsConnected = isConnected;
-		auto generated = generator.Generate(parameter->Mesh.Divisions[0], parameter->Mesh.Divisions[1]);
-		CalculateNormal(generated);
-		CalculateVertexColor(generated, parameter->ColorLeft, parameter->ColorCenter, parameter->ColorRight, parameter->ColorLeftMiddle, parameter->ColorCenterMiddle, parameter->ColorRightMiddle, parameter->ColorCenterArea);
-		ChangeAxis(generated, parameter->AxisType);
-
-		return ConvertMeshToModel(generated);
-	}
-	else if (parameter->Type == ProcedualModelType::Ribbon)
-	{
-		auto generator = RotatedWireMeshGenerator();
-		generator.Rotator = primitiveGenerator;
-		generator.Noise = noiseFunc;
-		generator.CrossSectionType = parameter->Ribbon.CrossSection;
-		generator.Vertices = parameter->Ribbon.Vertices;
-		generator.Rotate = parameter->Ribbon.Rotate;
-		generator.Count = parameter->Ribbon.Count;
-		generator.RibbonSizes = parameter->Ribbon.RibbonSizes;
-		generator.RibbonAngles = parameter->Ribbon.RibbonAngles;
-		generator.RibbonNoises = parameter->Ribbon.RibbonNoises;
-
-		auto generated = generator.Generate(randObj);
+	CalculateNormal(generated, workers);
+	CalculateVertexColor(generated, parameter->ColorLeft, parameter->ColorCenter, parameter->ColorRight, parameter->ColorLeftMiddle, parameter->ColorCenterMiddle, parameter->ColorRightMiddle, parameter->ColorCenterArea, workers);
+	ChangeAxis(generated, parameter->AxisType);
 
-		CalculateNormal(generated);
-		CalculateVertexColor(generated, parameter->ColorLeft, parameter->ColorCenter, parameter->ColorRight, parameter->ColorLeftMiddle, parameter->ColorCenterMiddle, parameter->ColorRightMiddle, parameter->ColorCenterArea);
-		ChangeAxis(generated, parameter->AxisType);
-
-		return ConvertMeshToModel(generated);
-	}
+	return ConvertMeshToModel(generated, workers);
+}
 
-	return nullptr;
+ProcedualModelGenerator::ProcedualModelGenerator()
+	: workers_(new ProcedualModelWorkers())
+	, threadCount_(Clamp(static_cast<int32_t>(std::thread::hardware_concurrency()), MaxDefaultThreadCount, 1))
+{
 }
 
+ProcedualModelGenerator::~ProcedualModelGenerator() = default;
+
 void ProcedualModelGenerator::Ungenerate(ModelRef model)
 {
 }
@@ -5,19 +5,53 @@
 #include "../SIMD/Vec2f.h"
 #include "../SIMD/Vec3f.h"
 #include "../Utils/Effekseer.CustomAllocator.h"
+#include <atomic>
+#include <memory>
 
 namespace Effekseer
 {
 
+class ProcedualModelWorkers;
+
 class ProcedualModelGenerator : public ReferenceObject
 {
+	//! the maximum number of threads by default
+	static const int32_t MaxDefaultThreadCount = 4;
+
+	std::unique_ptr<ProcedualModelWorkers> workers_;
+	std::atomic<int32_t> threadCount_;
+
 public:
-	ProcedualModelGenerator() = default;
-	virtual ~ProcedualModelGenerator() = default;
+	ProcedualModelGenerator();
+	virtual ~ProcedualModelGenerator();
 
 	virtual ModelRef Generate(const ProcedualModelParameter* parameter);
 
 	virtual void Ungenerate(ModelRef model);
+
+	int32_t GetThreadCount() const
+	{
+		return threadCount_;
+	}
+
+	/**
+		@brief
+		\~English	specify the number of threads which generate a model
+		\~Japanese	モデルを生成するスレッド数を設定する。
+		@note
+		\~English
+		Vertices of a large model are generated in parallel. A generated model doesn't depend on the number of threads.
+		The default is the number of hardware threads, up to 4. Threads are launched when a large model is generated first and are reused.
+		A model which is generated while another model is generated is generated on the calling thread.
+		\~Japanese
+		大きなモデルの頂点は並列に生成される。生成されるモデルはスレッド数に依存しない。
+		既定値はハードウェアスレッド数(最大4)である。スレッドは大きなモデルが最初に生成される時に起動され、再利用される。
+		他のモデルの生成中に生成されるモデルは呼び出し元のスレッドで生成される。
+	*/
+	void SetThreadCount(int32_t threadCount)
+	{
+		threadCount_ = Max(threadCount, 1);
+	}
 };
 
 } // namespace Effekseer
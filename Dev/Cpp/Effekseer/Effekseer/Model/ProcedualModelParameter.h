@@ -91,6 +91,9 @@ enum class ProcedualModelAxisType : int32_t
 
 struct ProcedualModelParameter
 {
+	//! a version of generated models. Increase it when ProcedualModelGenerator generates different models from the same parameters.
+	static const int32_t GeneratorVersion = 1;
+
 	ProcedualModelType Type;
 	ProcedualModelPrimitiveType PrimitiveType;
 	ProcedualModelAxisType AxisType = ProcedualModelAxisType::Y;
@@ -228,6 +231,9 @@ struct ProcedualModelParameter
 				return Sphere.Radius < rhs.Sphere.Radius;
 
 			if (Sphere.DepthMin != rhs.Sphere.DepthMin)
+				return Sphere.DepthMin < rhs.Sphere.DepthMin;
+
+			if (Sphere.DepthMax != rhs.Sphere.DepthMax)
 				return Sphere.DepthMax < rhs.Sphere.DepthMax;
 		}
 		else if (PrimitiveType == ProcedualModelPrimitiveType::Cone)
@@ -324,6 +330,99 @@ struct ProcedualModelParameter
 		return false;
 	}
 
+	/**
+		@brief	get a hash of values which are used to generate a model
+		@note
+		Parameters which are equal with operator< have the same hash except signs of zeros.
+		The hash is not changed between runs, so that it can be used as a name of a cached file.
+		It is changed when GeneratorVersion is changed.
+	*/
+	uint64_t GetHash() const
+	{
+		// FNV-1a
+		uint64_t hash = 14695981039346656037ULL;
+
+		auto add = [&hash](const void* data, size_t size) {
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			for (size_t i = 0; i < size; i++)
+			{
+				hash = (hash ^ bytes[i]) * 1099511628211ULL;
+			}
+		};
+
+		const int32_t generatorVersion = GeneratorVersion;
+		add(&generatorVersion, sizeof(generatorVersion));
+		add(&Type, sizeof(Type));
+
+		if (Type == ProcedualModelType::Mesh)
+		{
+			add(&Mesh.AngleBegin, sizeof(Mesh.AngleBegin));
+			add(&Mesh.AngleEnd, sizeof(Mesh.AngleEnd));
+			add(Mesh.Divisions.data(), sizeof(Mesh.Divisions));
+		}
+		else if (Type == ProcedualModelType::Ribbon)
+		{
+			add(&Ribbon.CrossSection, sizeof(Ribbon.CrossSection));
+			add(&Ribbon.Rotate, sizeof(Ribbon.Rotate));
+			add(&Ribbon.Vertices, sizeof(Ribbon.Vertices));
+			add(Ribbon.RibbonSizes.data(), sizeof(Ribbon.RibbonSizes));
+			add(Ribbon.RibbonAngles.data(), sizeof(Ribbon.RibbonAngles));
+			add(Ribbon.RibbonNoises.data(), sizeof(Ribbon.RibbonNoises));
+			add(&Ribbon.Count, sizeof(Ribbon.Count));
+		}
+
+		add(&PrimitiveType, sizeof(PrimitiveType));
+
+		if (PrimitiveType == ProcedualModelPrimitiveType::Sphere)
+		{
+			add(&Sphere.Radius, sizeof(Sphere.Radius));
+			add(&Sphere.DepthMin, sizeof(Sphere.DepthMin));
+			add(&Sphere.DepthMax, sizeof(Sphere.DepthMax));
+		}
+		else if (PrimitiveType == ProcedualModelPrimitiveType::Cone)
+		{
+			add(&Cone.Radius, sizeof(Cone.Radius));
+			add(&Cone.Depth, sizeof(Cone.Depth));
+		}
+		else if (PrimitiveType == ProcedualModelPrimitiveType::Cylinder)
+		{
+			add(&Cylinder.Radius1, sizeof(Cylinder.Radius1));
+			add(&Cylinder.Radius2, sizeof(Cylinder.Radius2));
+			add(&Cylinder.Depth, sizeof(Cylinder.Depth));
+		}
+		else if (PrimitiveType == ProcedualModelPrimitiveType::Spline4)
+		{
+			add(Spline4.Point1.data(), sizeof(Spline4.Point1));
+			add(Spline4.Point2.data(), sizeof(Spline4.Point2));
+			add(Spline4.Point3.data(), sizeof(Spline4.Point3));
+			add(Spline4.Point4.data(), sizeof(Spline4.Point4));
+		}
+
+		add(&AxisType, sizeof(AxisType));
+
+		add(TiltNoiseFrequency.data(), sizeof(TiltNoiseFrequency));
+		add(TiltNoiseOffset.data(), sizeof(TiltNoiseOffset));
+		add(TiltNoisePower.data(), sizeof(TiltNoisePower));
+
+		add(WaveNoiseFrequency.data(), sizeof(WaveNoiseFrequency));
+		add(WaveNoiseOffset.data(), sizeof(WaveNoiseOffset));
+		add(WaveNoisePower.data(), sizeof(WaveNoisePower));
+
+		add(CurlNoiseFrequency.data(), sizeof(CurlNoiseFrequency));
+		add(CurlNoiseOffset.data(), sizeof(CurlNoiseOffset));
+		add(CurlNoisePower.data(), sizeof(CurlNoisePower));
+
+		for (const auto& color : {ColorLeft, ColorCenter, ColorRight, ColorLeftMiddle, ColorCenterMiddle, ColorRightMiddle})
+		{
+			const uint8_t rgba[4] = {color.R, color.G, color.B, color.A};
+			add(rgba, sizeof(rgba));
+		}
+
+		add(ColorCenterArea.data(), sizeof(ColorCenterArea));
+
+		return hash;
+	}
+
 	template <bool T>
 	bool Load(BinaryReader<T>& reader)
 	{
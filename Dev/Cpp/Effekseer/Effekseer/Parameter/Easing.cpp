@@ -3,21 +3,29 @@
 namespace Effekseer
 {
 
-float ParameterEasingFloat::GetValue(const InstanceEasingType& instance, float time)
+template <bool IsMiddleEnabled>
+float ParameterEasingFloat::Evaluate(const ParameterEasingFloat& param, const InstanceEasingType& instance, float time)
 {
-	auto t = getEaseValue(type_, time);
+	auto t = param.easingFunctions_[0](param.params, time);
 
-	if (isIndividualEnabled)
+	if (IsMiddleEnabled)
 	{
-		t = getEaseValue(types[0], time);
+		return param.get3Point(instance, t);
 	}
 
-	if (isMiddleEnabled)
-	{
-		return get3Point(instance, t);
-	}
+	return param.get2Point(instance, t);
+}
+
+void ParameterEasingFloat::Load(uint8_t* pos, int32_t size, int32_t version)
+{
+	ParameterEasing<float>::Load(pos, size, version);
+
+	evaluator_ = isMiddleEnabled ? Evaluate<true> : Evaluate<false>;
+}
 
-	return get2Point(instance, t);
+float ParameterEasingFloat::GetValue(const InstanceEasingType& instance, float time)
+{
+	return evaluator_(*this, instance, time);
 }
 
 void ParameterEasingFloat::Init(InstanceEasingType& instance, Effect* e, InstanceGlobal* instg, Instance* parent, IRandObject* rand)
@@ -63,39 +71,65 @@ void ParameterEasingFloat::Init(InstanceEasingType& instance, Effect* e, Instanc
 	}
 }
 
-SIMD::Vec3f ParameterEasingSIMDVec3::GetValue(const InstanceEasingType& instance, float time)
+template <bool IsIndividualEnabled, bool IsMiddleEnabled>
+void ParameterEasingSIMDVec3::Evaluate(const ParameterEasingSIMDVec3& param,
+									   const InstanceEasingType* const* instances,
+									   const float* times,
+									   int32_t count,
+									   SIMD::Vec3f* values)
 {
-	if (isIndividualEnabled)
+	const auto getPoint = [&param](const InstanceEasingType& instance, float t) {
+		return IsMiddleEnabled ? param.get3Point(instance, t) : param.get2Point(instance, t);
+	};
+
+	for (int32_t i = 0; i < count; i++)
 	{
-		std::array<SIMD::Vec3f, 3> values;
+		const auto& instance = *instances[i];
+		const auto time = times[i];
 
-		for (size_t i = 0; i < 3; i++)
+		if (IsIndividualEnabled)
 		{
-			auto t = getEaseValue(types[i], time);
+			std::array<SIMD::Vec3f, 3> channelValues;
 
-			if (isMiddleEnabled)
-			{
-				values[i] = get3Point(instance, t);
-			}
-			else
+			for (size_t j = 0; j < 3; j++)
 			{
-				values[i] = get2Point(instance, t);
+				channelValues[j] = getPoint(instance, param.easingFunctions_[j](param.params, time));
 			}
+
+			values[i] = SIMD::Vec3f(channelValues[0].GetX(), channelValues[1].GetY(), channelValues[2].GetZ());
 		}
+		else
+		{
+			values[i] = getPoint(instance, param.easingFunctions_[0](param.params, time));
+		}
+	}
+}
 
-		return SIMD::Vec3f(values[0].GetX(), values[1].GetY(), values[2].GetZ());
+void ParameterEasingSIMDVec3::Load(uint8_t* pos, int32_t size, int32_t version)
+{
+	ParameterEasing<SIMD::Vec3f>::Load(pos, size, version);
+
+	if (isIndividualEnabled)
+	{
+		evaluator_ = isMiddleEnabled ? Evaluate<true, true> : Evaluate<true, false>;
 	}
 	else
 	{
-		auto t = getEaseValue(type_, time);
+		evaluator_ = isMiddleEnabled ? Evaluate<false, true> : Evaluate<false, false>;
+	}
+}
 
-		if (isMiddleEnabled)
-		{
-			return get3Point(instance, t);
-		}
+SIMD::Vec3f ParameterEasingSIMDVec3::GetValue(const InstanceEasingType& instance, float time)
+{
+	const InstanceEasingType* instances[] = {&instance};
+	SIMD::Vec3f value;
+	evaluator_(*this, instances, &time, 1, &value);
+	return value;
+}
 
-		return get2Point(instance, t);
-	}
+void ParameterEasingSIMDVec3::GetValues(const InstanceEasingType* const* instances, const float* times, int32_t count, SIMD::Vec3f* values) const
+{
+	evaluator_(*this, instances, times, count, values);
 }
 
 void ParameterEasingSIMDVec3::Init(InstanceEasingType& instance, Effect* e, InstanceGlobal* instg, Instance* parent, IRandObject* rand, const std::array<float, 3>& scale, const std::array<float, 3>& scaleInv)
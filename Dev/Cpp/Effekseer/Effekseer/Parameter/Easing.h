@@ -78,28 +78,28 @@ protected:
 	static constexpr uint8_t ElemNum = easing_type_information<T>::elemNum;
 
 protected:
-	float getEasingStartEndValue(float t) const
+	static float getEasingStartEndValue(const std::array<float, 4>& params, float t)
 	{
 		return params[0] * t * t * t + params[1] * t * t + params[2] * t;
 	}
 
-	float getEasingLinearValue(float t) const
+	static float getEasingLinearValue(const std::array<float, 4>& params, float t)
 	{
 		return t;
 	}
 
-	float getEaseInQuadratic(float t)
+	static float getEaseInQuadratic(const std::array<float, 4>& params, float t)
 	{
 		return t * t;
 	}
 
-	float getEaseOutQuadratic(float t)
+	static float getEaseOutQuadratic(const std::array<float, 4>& params, float t)
 	{
 		t = (1.0f - t);
 		return 1.0f - t * t;
 	}
 
-	float getEaseInOutQuadratic(float t)
+	static float getEaseInOutQuadratic(const std::array<float, 4>& params, float t)
 	{
 		if (t <= 0.5f)
 		{
@@ -113,18 +113,18 @@ protected:
 		}
 	}
 
-	float getEaseInCubic(float t)
+	static float getEaseInCubic(const std::array<float, 4>& params, float t)
 	{
 		return t * t * t;
 	}
 
-	float getEaseOutCubic(float t)
+	static float getEaseOutCubic(const std::array<float, 4>& params, float t)
 	{
 		t = (1.0f - t);
 		return 1.0f - t * t * t;
 	}
 
-	float getEaseInOutCubic(float t)
+	static float getEaseInOutCubic(const std::array<float, 4>& params, float t)
 	{
 		if (t <= 0.5f)
 		{
@@ -138,18 +138,18 @@ protected:
 		}
 	}
 
-	float getEaseInQuartic(float t)
+	static float getEaseInQuartic(const std::array<float, 4>& params, float t)
 	{
 		return t * t * t * t;
 	}
 
-	float getEaseOutQuartic(float t)
+	static float getEaseOutQuartic(const std::array<float, 4>& params, float t)
 	{
 		t = (1.0f - t);
 		return 1.0f - t * t * t * t;
 	}
 
-	float getEaseInOutQuartic(float t)
+	static float getEaseInOutQuartic(const std::array<float, 4>& params, float t)
 	{
 		if (t <= 0.5f)
 		{
@@ -163,18 +163,18 @@ protected:
 		}
 	}
 
-	float getEaseInQuintic(float t)
+	static float getEaseInQuintic(const std::array<float, 4>& params, float t)
 	{
 		return t * t * t * t * t;
 	}
 
-	float getEaseOutQuintic(float t)
+	static float getEaseOutQuintic(const std::array<float, 4>& params, float t)
 	{
 		t = (1.0f - t);
 		return 1.0f - t * t * t * t * t;
 	}
 
-	float getEaseInOutQuintic(float t)
+	static float getEaseInOutQuintic(const std::array<float, 4>& params, float t)
 	{
 		if (t <= 0.5f)
 		{
@@ -188,20 +188,20 @@ protected:
 		}
 	}
 
-	float getEaseInBack(float t)
+	static float getEaseInBack(const std::array<float, 4>& params, float t)
 	{
 		float c = 1.8f;
 		return (c + 1.0f) * t * t * t - c * t * t;
 	}
 
-	float getEaseOutBack(float t)
+	static float getEaseOutBack(const std::array<float, 4>& params, float t)
 	{
 		t = (1.0f - t);
 		float c = 1.8f;
 		return 1.0f - ((c + 1.0f) * t * t * t - c * t * t);
 	}
 
-	float getEaseInOutBack(float t)
+	static float getEaseInOutBack(const std::array<float, 4>& params, float t)
 	{
 		float c = 1.8f;
 		if (t <= 0.5f)
@@ -216,7 +216,7 @@ protected:
 		}
 	}
 
-	float getEaseOutBounce(float t)
+	static float getEaseOutBounce(const std::array<float, 4>& params, float t)
 	{
 		if (t < 4.0f / 11.0f)
 		{
@@ -240,122 +240,86 @@ protected:
 		}
 	}
 
-	float getEaseInBounce(float t)
+	static float getEaseInBounce(const std::array<float, 4>& params, float t)
 	{
-		return 1.0f - getEaseOutBounce(1.0f - t);
+		return 1.0f - getEaseOutBounce(params, 1.0f - t);
 	}
 
-	float getEaseInOutBounce(float t)
+	static float getEaseInOutBounce(const std::array<float, 4>& params, float t)
 	{
 		if (t <= 0.5f)
 		{
 			t *= 2.0f;
-			return getEaseInBounce(t) * 0.5f;
+			return getEaseInBounce(params, t) * 0.5f;
 		}
 		else
 		{
 			t = (t - 0.5f) * 2.0f;
-			return getEaseOutBounce(t) * 0.5f + 0.5f;
+			return getEaseOutBounce(params, t) * 0.5f + 0.5f;
 		}
 	}
 
-	float getEaseValue(Easing3Type type, float time)
+	static float getEaseUnknown(const std::array<float, 4>& params, float t)
 	{
-		auto t = 0.0f;
-		if (type == Easing3Type::StartEndSpeed)
-		{
-			t = getEasingStartEndValue(time);
-		}
-		else if (type == Easing3Type::Linear)
-		{
-			t = getEasingLinearValue(time);
-		}
-
-		else if (type == Easing3Type::EaseInQuadratic)
-		{
-			t = getEaseInQuadratic(time);
-		}
-		else if (type == Easing3Type::EaseOutQuadratic)
-		{
-			t = getEaseOutQuadratic(time);
-		}
-		else if (type == Easing3Type::EaseInOutQuadratic)
-		{
-			t = getEaseInOutQuadratic(time);
-		}
-
-		else if (type == Easing3Type::EaseInCubic)
-		{
-			t = getEaseInCubic(time);
-		}
-		else if (type == Easing3Type::EaseOutCubic)
-		{
-			t = getEaseOutCubic(time);
-		}
-		else if (type == Easing3Type::EaseInOutCubic)
-		{
-			t = getEaseInOutCubic(time);
-		}
-
-		else if (type == Easing3Type::EaseInQuartic)
-		{
-			t = getEaseInQuartic(time);
-		}
-		else if (type == Easing3Type::EaseOutQuartic)
-		{
-			t = getEaseOutQuartic(time);
-		}
-		else if (type == Easing3Type::EaseInOutQuartic)
-		{
-			t = getEaseInOutQuartic(time);
-		}
-
-		else if (type == Easing3Type::EaseInQuintic)
-		{
-			t = getEaseInQuintic(time);
-		}
-		else if (type == Easing3Type::EaseOutQuintic)
-		{
-			t = getEaseOutQuintic(time);
-		}
-		else if (type == Easing3Type::EaseInOutQuintic)
-		{
-			t = getEaseInOutQuintic(time);
-		}
+		assert(0);
+		return 0.0f;
+	}
 
-		else if (type == Easing3Type::EaseInBack)
-		{
-			t = getEaseInBack(time);
-		}
-		else if (type == Easing3Type::EaseOutBack)
-		{
-			t = getEaseOutBack(time);
-		}
-		else if (type == Easing3Type::EaseInOutBack)
-		{
-			t = getEaseInOutBack(time);
-		}
+	using EasingFunction = float (*)(const std::array<float, 4>& params, float t);
 
-		else if (type == Easing3Type::EaseInBounce)
-		{
-			t = getEaseInBounce(time);
-		}
-		else if (type == Easing3Type::EaseOutBounce)
-		{
-			t = getEaseOutBounce(time);
-		}
-		else if (type == Easing3Type::EaseInOutBounce)
-		{
-			t = getEaseInOutBounce(time);
-		}
-		else
-		{
-			assert(0);
+	//! select a function of an easing type when it is loaded not to branch by the type whenever it is evaluated
+	static EasingFunction getEasingFunction(Easing3Type type)
+	{
+		switch (type)
+		{
+		case Easing3Type::StartEndSpeed:
+			return getEasingStartEndValue;
+		case Easing3Type::Linear:
+			return getEasingLinearValue;
+		case Easing3Type::EaseInQuadratic:
+			return getEaseInQuadratic;
+		case Easing3Type::EaseOutQuadratic:
+			return getEaseOutQuadratic;
+		case Easing3Type::EaseInOutQuadratic:
+			return getEaseInOutQuadratic;
+		case Easing3Type::EaseInCubic:
+			return getEaseInCubic;
+		case Easing3Type::EaseOutCubic:
+			return getEaseOutCubic;
+		case Easing3Type::EaseInOutCubic:
+			return getEaseInOutCubic;
+		case Easing3Type::EaseInQuartic:
+			return getEaseInQuartic;
+		case Easing3Type::EaseOutQuartic:
+			return getEaseOutQuartic;
+		case Easing3Type::EaseInOutQuartic:
+			return getEaseInOutQuartic;
+		case Easing3Type::EaseInQuintic:
+			return getEaseInQuintic;
+		case Easing3Type::EaseOutQuintic:
+			return getEaseOutQuintic;
+		case Easing3Type::EaseInOutQuintic:
+			return getEaseInOutQuintic;
+		case Easing3Type::EaseInBack:
+			return getEaseInBack;
+		case Easing3Type::EaseOutBack:
+			return getEaseOutBack;
+		case Easing3Type::EaseInOutBack:
+			return getEaseInOutBack;
+		case Easing3Type::EaseInBounce:
+			return getEaseInBounce;
+		case Easing3Type::EaseOutBounce:
+			return getEaseOutBounce;
+		case Easing3Type::EaseInOutBounce:
+			return getEaseInOutBounce;
+		default:
+			return getEaseUnknown;
 		}
-
-		return t;
 	}
 
+	//! easing functions of channels. All of them are the same as type_ unless an individual easing is enabled
+	std::array<EasingFunction, ElemNum> easingFunctions_;
+
 	T get2Point(const InstanceEasingType& v, float t) const
 	{
 		T size = v.end - v.start;
@@ -453,6 +417,11 @@ public:
 	bool isIndividualEnabled = false;
 	std::array<Easing3Type, ElemNum> types;
 
+	ParameterEasing()
+	{
+		easingFunctions_.fill(getEasingStartEndValue);
+	}
+
 	void Load(uint8_t* pos, int32_t size, int32_t version)
 	{
 		BinaryReader<true> reader(pos, size);
@@ -538,6 +507,11 @@ public:
 				}
 			}
 		}
+
+		for (int32_t i = 0; i < ElemNum; i++)
+		{
+			easingFunctions_[i] = getEasingFunction(isIndividualEnabled ? types[i] : type_);
+		}
 	}
 
 	virtual T GetValue(const InstanceEasingType& instance, float time) = 0;
@@ -545,15 +519,44 @@ public:
 
 class ParameterEasingFloat : public ParameterEasing<float>
 {
+	using Evaluator = float (*)(const ParameterEasingFloat& param, const InstanceEasingType& instance, float time);
+
+	template <bool IsMiddleEnabled>
+	static float Evaluate(const ParameterEasingFloat& param, const InstanceEasingType& instance, float time);
+
+	Evaluator evaluator_ = Evaluate<false>;
+
 public:
+	void Load(uint8_t* pos, int32_t size, int32_t version);
 	virtual float GetValue(const InstanceEasingType& instance, float time) override;
 	void Init(InstanceEasingType& instance, Effect* e, InstanceGlobal* instg, Instance* parent, IRandObject* rand);
 };
 
 class ParameterEasingSIMDVec3 : public ParameterEasing<SIMD::Vec3f>
 {
+	using Evaluator = void (*)(const ParameterEasingSIMDVec3& param,
+							   const InstanceEasingType* const* instances,
+							   const float* times,
+							   int32_t count,
+							   SIMD::Vec3f* values);
+
+	template <bool IsIndividualEnabled, bool IsMiddleEnabled>
+	static void Evaluate(const ParameterEasingSIMDVec3& param,
+						 const InstanceEasingType* const* instances,
+						 const float* times,
+						 int32_t count,
+						 SIMD::Vec3f* values);
+
+	//! an evaluator which is specialized for flags is selected when it is loaded
+	Evaluator evaluator_ = Evaluate<false, false>;
+
 public:
+	void Load(uint8_t* pos, int32_t size, int32_t version);
 	virtual SIMD::Vec3f GetValue(const InstanceEasingType& instance, float time) override;
+
+	//! get values of multiple instances at once
+	void GetValues(const InstanceEasingType* const* instances, const float* times, int32_t count, SIMD::Vec3f* values) const;
+
 	void Init(InstanceEasingType& instance, Effect* e, InstanceGlobal* instg, Instance* parent, IRandObject* rand, const std::array<float, 3>& scale, const std::array<float, 3>& scaleInv);
 };
 
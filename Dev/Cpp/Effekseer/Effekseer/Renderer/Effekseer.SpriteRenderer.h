@@ -12,6 +12,7 @@
 #include "../SIMD/Mat43f.h"
 #include "../SIMD/Vec2f.h"
 #include "../SIMD/Vec3f.h"
+#include "../Utils/Effekseer.CustomAllocator.h"
 
 //----------------------------------------------------------------------------------
 //
@@ -42,6 +43,9 @@ public:
 
 		bool EnableViewOffset = false;
 
+		//! whether have all corners of each sprite in an effect the same color and are placed at a parallelogram
+		bool HasUniformCorners = false;
+
 		RefPtr<RenderingUserData> UserData;
 	};
 
@@ -97,6 +101,33 @@ public:
 	virtual void EndRendering(const NodeParameter& parameter, void* userData)
 	{
 	}
+
+	/**
+		@brief	write vertices of instances which are drawn between BeginRendering and EndRendering into a buffer
+		@param	parameter	[in]	a parameter of a node
+		@param	instanceParameters	[in]	parameters of instances in the order of Rendering
+		@param	count	[in]	the number of instances
+		@param	vertices	[in,out]	a buffer which vertices are appended to
+		@return	a stride of written vertices. 0 if vertices are not written
+		@note
+		It is called on worker threads while a manager draws in parallel. It must not change this renderer.
+	*/
+	virtual int32_t WriteVertices(const NodeParameter& parameter,
+								  const InstanceParameter* instanceParameters,
+								  int32_t count,
+								  CustomAlignedVector<uint8_t>& vertices) const
+	{
+		return 0;
+	}
+
+	/**
+		@brief	draw vertices written by WriteVertices instead of calling Rendering for each instance
+		@return	false if vertices cannot be drawn and Rendering must be called for each instance
+	*/
+	virtual bool RenderingVertices(const NodeParameter& parameter, const void* vertices, int32_t size, int32_t stride, void* userData)
+	{
+		return false;
+	}
 };
 
 //----------------------------------------------------------------------------------
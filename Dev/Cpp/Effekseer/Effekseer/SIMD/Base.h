@@ -25,6 +25,10 @@
 #if defined(__AVX2__)
 #define EFK_SIMD_AVX2
 #endif
+// FMA is not a part of AVX2 on GCC and Clang (MSVC enables it with /arch:AVX2)
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(EFK_SIMD_AVX2))
+#define EFK_SIMD_FMA
+#endif
 #if defined(__AVX__) || defined(EFK_SIMD_AVX2)
 #define EFK_SIMD_AVX
 #endif
@@ -62,6 +66,14 @@
 
 #endif
 
+// Types with 8 lanes are declared in a namespace which depends on a backend
+// so that a translation unit compiled with AVX2 can be linked with ones compiled without it.
+#if defined(EFK_SIMD_AVX2)
+#define EFK_SIMD_WIDE_NAMESPACE AVX2
+#else
+#define EFK_SIMD_WIDE_NAMESPACE Gen
+#endif
+
 const float DefaultEpsilon = 1e-6f;
 
 #endif // __EFFEKSEER_SIMD_BASE_H__
\ No newline at end of file
@@ -0,0 +1,14 @@
+
+#ifndef __EFFEKSEER_SIMD_BRIDGE8_H__
+#define __EFFEKSEER_SIMD_BRIDGE8_H__
+
+#include <cstdint>
+#include "Base.h"
+
+#if defined(EFK_SIMD_AVX2)
+#include "Bridge8_AVX.h"
+#else
+#include "Bridge8_Gen.h"
+#endif
+
+#endif // __EFFEKSEER_SIMD_BRIDGE8_H__
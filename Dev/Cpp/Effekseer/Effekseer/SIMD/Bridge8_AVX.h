@@ -0,0 +1,36 @@
+
+#ifndef __EFFEKSEER_SIMD_BRIDGE8_AVX_H__
+#define __EFFEKSEER_SIMD_BRIDGE8_AVX_H__
+
+#include "Float8_AVX.h"
+#include "Int8_AVX.h"
+#include "Base.h"
+
+#if defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+inline Int8 Float8::Convert8i() const { return _mm256_cvtps_epi32(s); }
+
+inline Int8 Float8::Cast8i() const { return _mm256_castps_si256(s); }
+
+inline Float8 Int8::Convert8f() const { return _mm256_cvtepi32_ps(s); }
+
+inline Float8 Int8::Cast8f() const { return _mm256_castsi256_ps(s); }
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_BRIDGE8_AVX_H__
@@ -0,0 +1,68 @@
+
+#ifndef __EFFEKSEER_SIMD_BRIDGE8_GEN_H__
+#define __EFFEKSEER_SIMD_BRIDGE8_GEN_H__
+
+#include "Float8_Gen.h"
+#include "Int8_Gen.h"
+#include "Base.h"
+
+#if !defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+inline Int8 Float8::Convert8i() const
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vi[i] = (int32_t)vf[i];
+	}
+	return ret;
+}
+
+inline Int8 Float8::Cast8i() const
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = vu[i];
+	}
+	return ret;
+}
+
+inline Float8 Int8::Convert8f() const
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = (float)vi[i];
+	}
+	return ret;
+}
+
+inline Float8 Int8::Cast8f() const
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = vu[i];
+	}
+	return ret;
+}
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_BRIDGE8_GEN_H__
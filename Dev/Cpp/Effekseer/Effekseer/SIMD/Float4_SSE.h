@@ -282,7 +282,7 @@ inline Float4 Float4::Ceil(const Float4& in)
 
 inline Float4 Float4::MulAdd(const Float4& a, const Float4& b, const Float4& c)
 {
-#if defined(EFK_SIMD_AVX2)
+#if defined(EFK_SIMD_FMA)
 	return Float4{_mm_fmadd_ps(b.s, c.s, a.s)};
 #else
 	return Float4{_mm_add_ps(a.s, _mm_mul_ps(b.s, c.s))};
@@ -291,7 +291,7 @@ inline Float4 Float4::MulAdd(const Float4& a, const Float4& b, const Float4& c)
 
 inline Float4 Float4::MulSub(const Float4& a, const Float4& b, const Float4& c)
 {
-#if defined(EFK_SIMD_AVX2)
+#if defined(EFK_SIMD_FMA)
 	return Float4{_mm_fnmadd_ps(b.s, c.s, a.s)};
 #else
 	return Float4{_mm_sub_ps(a.s, _mm_mul_ps(b.s, c.s))};
@@ -309,7 +309,7 @@ template<size_t LANE>
 Float4 Float4::MulAddLane(const Float4& a, const Float4& b, const Float4& c)
 {
 	static_assert(LANE < 4, "LANE is must be less than 4.");
-#if defined(EFK_SIMD_AVX2)
+#if defined(EFK_SIMD_FMA)
 	return _mm_fmadd_ps(b.s, Swizzle<LANE,LANE,LANE,LANE>(c).s, a.s);
 #else
 	return _mm_add_ps(a.s, _mm_mul_ps(b.s, Swizzle<LANE,LANE,LANE,LANE>(c).s));
@@ -320,7 +320,7 @@ template<size_t LANE>
 Float4 Float4::MulSubLane(const Float4& a, const Float4& b, const Float4& c)
 {
 	static_assert(LANE < 4, "LANE is must be less than 4.");
-#if defined(EFK_SIMD_AVX2)
+#if defined(EFK_SIMD_FMA)
 	return _mm_fnmadd_ps(b.s, Swizzle<LANE,LANE,LANE,LANE>(c).s, a.s);
 #else
 	return _mm_sub_ps(a.s, _mm_mul_ps(b.s, Swizzle<LANE,LANE,LANE,LANE>(c).s));
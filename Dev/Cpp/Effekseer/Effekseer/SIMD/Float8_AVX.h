@@ -0,0 +1,252 @@
+
+#ifndef __EFFEKSEER_SIMD_FLOAT8_AVX_H__
+#define __EFFEKSEER_SIMD_FLOAT8_AVX_H__
+
+#include "Base.h"
+
+#if defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+struct Int8;
+
+/**
+	@brief	simd class with 8 lanes for avx
+*/
+struct alignas(32) Float8
+{
+	__m256 s;
+
+	Float8() = default;
+	Float8(const Float8& rhs) = default;
+	Float8(__m256 rhs) { s = rhs; }
+	Float8(__m256i rhs) { s = _mm256_castsi256_ps(rhs); }
+	Float8(float x0, float x1, float x2, float x3, float x4, float x5, float x6, float x7) { s = _mm256_setr_ps(x0, x1, x2, x3, x4, x5, x6, x7); }
+	Float8(float i) { s = _mm256_set1_ps(i); }
+
+	Int8 Convert8i() const;
+	Int8 Cast8i() const;
+
+	Float8& operator+=(const Float8& rhs);
+	Float8& operator-=(const Float8& rhs);
+	Float8& operator*=(const Float8& rhs);
+	Float8& operator*=(float rhs);
+	Float8& operator/=(const Float8& rhs);
+	Float8& operator/=(float rhs);
+
+	static Float8 Load8(const void* mem);
+	static void Store8(void* mem, const Float8& i);
+
+	static Float8 SetZero();
+	static Float8 Sqrt(const Float8& in);
+	static Float8 Rsqrt(const Float8& in);
+	static Float8 Abs(const Float8& in);
+	static Float8 Min(const Float8& lhs, const Float8& rhs);
+	static Float8 Max(const Float8& lhs, const Float8& rhs);
+	static Float8 Floor(const Float8& in);
+	static Float8 Ceil(const Float8& in);
+	static Float8 MulAdd(const Float8& a, const Float8& b, const Float8& c);
+	static Float8 MulSub(const Float8& a, const Float8& b, const Float8& c);
+
+	static uint32_t MoveMask(const Float8& in);
+	static Float8 Select(const Float8& mask, const Float8& sel1, const Float8& sel2);
+	static Float8 Equal(const Float8& lhs, const Float8& rhs);
+	static Float8 NotEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 LessThan(const Float8& lhs, const Float8& rhs);
+	static Float8 LessEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterThan(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 NearEqual(const Float8& lhs, const Float8& rhs, float epsilon = DefaultEpsilon);
+};
+
+inline Float8 operator+(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_add_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator-(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_sub_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator*(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_mul_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator*(const Float8& lhs, float rhs)
+{
+	return Float8{_mm256_mul_ps(lhs.s, _mm256_set1_ps(rhs))};
+}
+
+inline Float8 operator/(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_div_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator/(const Float8& lhs, float rhs)
+{
+	return Float8{_mm256_div_ps(lhs.s, _mm256_set1_ps(rhs))};
+}
+
+inline Float8 operator&(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_and_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator|(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_or_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator^(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_xor_ps(lhs.s, rhs.s)};
+}
+
+inline bool operator==(const Float8& lhs, const Float8& rhs)
+{
+	return Float8::MoveMask(Float8::Equal(lhs, rhs)) == 0xff;
+}
+
+inline bool operator!=(const Float8& lhs, const Float8& rhs)
+{
+	return Float8::MoveMask(Float8::Equal(lhs, rhs)) != 0xff;
+}
+
+inline Float8& Float8::operator+=(const Float8& rhs) { return *this = *this + rhs; }
+inline Float8& Float8::operator-=(const Float8& rhs) { return *this = *this - rhs; }
+inline Float8& Float8::operator*=(const Float8& rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator*=(float rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator/=(const Float8& rhs) { return *this = *this / rhs; }
+inline Float8& Float8::operator/=(float rhs) { return *this = *this / rhs; }
+
+inline Float8 Float8::Load8(const void* mem)
+{
+	return _mm256_loadu_ps((const float*)mem);
+}
+
+inline void Float8::Store8(void* mem, const Float8& i)
+{
+	_mm256_storeu_ps((float*)mem, i.s);
+}
+
+inline Float8 Float8::SetZero()
+{
+	return _mm256_setzero_ps();
+}
+
+inline Float8 Float8::Sqrt(const Float8& in)
+{
+	return Float8{_mm256_sqrt_ps(in.s)};
+}
+
+inline Float8 Float8::Rsqrt(const Float8& in)
+{
+	return Float8{_mm256_rsqrt_ps(in.s)};
+}
+
+inline Float8 Float8::Abs(const Float8& in)
+{
+	return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), in.s);
+}
+
+inline Float8 Float8::Min(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_min_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 Float8::Max(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_max_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 Float8::Floor(const Float8& in)
+{
+	return _mm256_floor_ps(in.s);
+}
+
+inline Float8 Float8::Ceil(const Float8& in)
+{
+	return _mm256_ceil_ps(in.s);
+}
+
+inline Float8 Float8::MulAdd(const Float8& a, const Float8& b, const Float8& c)
+{
+#if defined(EFK_SIMD_FMA)
+	return Float8{_mm256_fmadd_ps(b.s, c.s, a.s)};
+#else
+	return Float8{_mm256_add_ps(a.s, _mm256_mul_ps(b.s, c.s))};
+#endif
+}
+
+inline Float8 Float8::MulSub(const Float8& a, const Float8& b, const Float8& c)
+{
+#if defined(EFK_SIMD_FMA)
+	return Float8{_mm256_fnmadd_ps(b.s, c.s, a.s)};
+#else
+	return Float8{_mm256_sub_ps(a.s, _mm256_mul_ps(b.s, c.s))};
+#endif
+}
+
+inline uint32_t Float8::MoveMask(const Float8& in)
+{
+	return (uint32_t)_mm256_movemask_ps(in.s);
+}
+
+inline Float8 Float8::Select(const Float8& mask, const Float8& sel1, const Float8& sel2)
+{
+	return _mm256_or_ps(_mm256_and_ps(mask.s, sel1.s), _mm256_andnot_ps(mask.s, sel2.s));
+}
+
+inline Float8 Float8::Equal(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_EQ_OQ)};
+}
+
+inline Float8 Float8::NotEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_NEQ_UQ)};
+}
+
+inline Float8 Float8::LessThan(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_LT_OQ)};
+}
+
+inline Float8 Float8::LessEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_LE_OQ)};
+}
+
+inline Float8 Float8::GreaterThan(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_GT_OQ)};
+}
+
+inline Float8 Float8::GreaterEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_GE_OQ)};
+}
+
+inline Float8 Float8::NearEqual(const Float8& lhs, const Float8& rhs, float epsilon)
+{
+	return LessEqual(Abs(lhs - rhs), Float8(epsilon));
+}
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_FLOAT8_AVX_H__
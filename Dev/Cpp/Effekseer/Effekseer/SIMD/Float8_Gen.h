@@ -0,0 +1,407 @@
+
+#ifndef __EFFEKSEER_SIMD_FLOAT8_GEN_H__
+#define __EFFEKSEER_SIMD_FLOAT8_GEN_H__
+
+#include "Base.h"
+
+#if !defined(EFK_SIMD_AVX2)
+
+#include <algorithm>
+#include <cstring>
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+struct Int8;
+
+/**
+	@brief	simd class with 8 lanes for generic
+*/
+struct alignas(32) Float8
+{
+	union {
+		float vf[8];
+		int32_t vi[8];
+		uint32_t vu[8];
+	};
+
+	Float8() = default;
+	Float8(const Float8& rhs) = default;
+	Float8(float x0, float x1, float x2, float x3, float x4, float x5, float x6, float x7)
+	{
+		vf[0] = x0;
+		vf[1] = x1;
+		vf[2] = x2;
+		vf[3] = x3;
+		vf[4] = x4;
+		vf[5] = x5;
+		vf[6] = x6;
+		vf[7] = x7;
+	}
+	Float8(float i)
+	{
+		for (size_t i_ = 0; i_ < 8; i_++)
+		{
+			vf[i_] = i;
+		}
+	}
+
+	Int8 Convert8i() const;
+	Int8 Cast8i() const;
+
+	Float8& operator+=(const Float8& rhs);
+	Float8& operator-=(const Float8& rhs);
+	Float8& operator*=(const Float8& rhs);
+	Float8& operator*=(float rhs);
+	Float8& operator/=(const Float8& rhs);
+	Float8& operator/=(float rhs);
+
+	static Float8 Load8(const void* mem);
+	static void Store8(void* mem, const Float8& i);
+
+	static Float8 SetZero();
+	static Float8 Sqrt(const Float8& in);
+	static Float8 Rsqrt(const Float8& in);
+	static Float8 Abs(const Float8& in);
+	static Float8 Min(const Float8& lhs, const Float8& rhs);
+	static Float8 Max(const Float8& lhs, const Float8& rhs);
+	static Float8 Floor(const Float8& in);
+	static Float8 Ceil(const Float8& in);
+	static Float8 MulAdd(const Float8& a, const Float8& b, const Float8& c);
+	static Float8 MulSub(const Float8& a, const Float8& b, const Float8& c);
+
+	static uint32_t MoveMask(const Float8& in);
+	static Float8 Select(const Float8& mask, const Float8& sel1, const Float8& sel2);
+	static Float8 Equal(const Float8& lhs, const Float8& rhs);
+	static Float8 NotEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 LessThan(const Float8& lhs, const Float8& rhs);
+	static Float8 LessEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterThan(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 NearEqual(const Float8& lhs, const Float8& rhs, float epsilon = DefaultEpsilon);
+};
+
+inline Float8 operator+(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] + rhs.vf[i];
+	}
+	return ret;
+}
+
+inline Float8 operator-(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] - rhs.vf[i];
+	}
+	return ret;
+}
+
+inline Float8 operator*(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] * rhs.vf[i];
+	}
+	return ret;
+}
+
+inline Float8 operator*(const Float8& lhs, float rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] * rhs;
+	}
+	return ret;
+}
+
+inline Float8 operator/(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] / rhs.vf[i];
+	}
+	return ret;
+}
+
+inline Float8 operator/(const Float8& lhs, float rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = lhs.vf[i] / rhs;
+	}
+	return ret;
+}
+
+inline Float8 operator&(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] & rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Float8 operator|(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] | rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Float8 operator^(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] ^ rhs.vu[i];
+	}
+	return ret;
+}
+
+inline bool operator==(const Float8& lhs, const Float8& rhs)
+{
+	bool ret = true;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret &= lhs.vf[i] == rhs.vf[i];
+	}
+	return ret;
+}
+
+inline bool operator!=(const Float8& lhs, const Float8& rhs)
+{
+	return !(lhs == rhs);
+}
+
+inline Float8& Float8::operator+=(const Float8& rhs) { return *this = *this + rhs; }
+inline Float8& Float8::operator-=(const Float8& rhs) { return *this = *this - rhs; }
+inline Float8& Float8::operator*=(const Float8& rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator*=(float rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator/=(const Float8& rhs) { return *this = *this / rhs; }
+inline Float8& Float8::operator/=(float rhs) { return *this = *this / rhs; }
+
+inline Float8 Float8::Load8(const void* mem)
+{
+	Float8 ret;
+	memcpy(ret.vf, mem, sizeof(float) * 8);
+	return ret;
+}
+
+inline void Float8::Store8(void* mem, const Float8& i)
+{
+	memcpy(mem, i.vf, sizeof(float) * 8);
+}
+
+inline Float8 Float8::SetZero()
+{
+	return Float8(0.0f);
+}
+
+inline Float8 Float8::Sqrt(const Float8& in)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::sqrt(in.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Rsqrt(const Float8& in)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = 1.0f / std::sqrt(in.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Abs(const Float8& in)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::abs(in.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Min(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::fmin(lhs.vf[i], rhs.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Max(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::fmax(lhs.vf[i], rhs.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Floor(const Float8& in)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::floor(in.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Ceil(const Float8& in)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = std::ceil(in.vf[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::MulAdd(const Float8& a, const Float8& b, const Float8& c)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = a.vf[i] + b.vf[i] * c.vf[i];
+	}
+	return ret;
+}
+
+inline Float8 Float8::MulSub(const Float8& a, const Float8& b, const Float8& c)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vf[i] = a.vf[i] - b.vf[i] * c.vf[i];
+	}
+	return ret;
+}
+
+inline uint32_t Float8::MoveMask(const Float8& in)
+{
+	uint32_t ret = 0;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret |= (in.vu[i] >> 31) << i;
+	}
+	return ret;
+}
+
+inline Float8 Float8::Select(const Float8& mask, const Float8& sel1, const Float8& sel2)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (mask.vu[i] & sel1.vu[i]) | (~mask.vu[i] & sel2.vu[i]);
+	}
+	return ret;
+}
+
+inline Float8 Float8::Equal(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] == rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::NotEqual(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] != rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::LessThan(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] < rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::LessEqual(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] <= rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::GreaterThan(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] > rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::GreaterEqual(const Float8& lhs, const Float8& rhs)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vf[i] >= rhs.vf[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Float8 Float8::NearEqual(const Float8& lhs, const Float8& rhs, float epsilon)
+{
+	Float8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (std::abs(lhs.vf[i] - rhs.vf[i]) <= epsilon) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_FLOAT8_GEN_H__
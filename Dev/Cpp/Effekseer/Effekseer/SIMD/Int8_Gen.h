@@ -0,0 +1,358 @@
+
+#ifndef __EFFEKSEER_SIMD_INT8_GEN_H__
+#define __EFFEKSEER_SIMD_INT8_GEN_H__
+
+#include "Base.h"
+
+#if !defined(EFK_SIMD_AVX2)
+
+#include <cstdlib>
+#include <cstring>
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+struct Float8;
+
+/**
+	@brief	simd class with 8 lanes for generic
+*/
+struct alignas(32) Int8
+{
+	union {
+		float vf[8];
+		int32_t vi[8];
+		uint32_t vu[8];
+	};
+
+	Int8() = default;
+	Int8(const Int8& rhs) = default;
+	Int8(int32_t x0, int32_t x1, int32_t x2, int32_t x3, int32_t x4, int32_t x5, int32_t x6, int32_t x7)
+	{
+		vi[0] = x0;
+		vi[1] = x1;
+		vi[2] = x2;
+		vi[3] = x3;
+		vi[4] = x4;
+		vi[5] = x5;
+		vi[6] = x6;
+		vi[7] = x7;
+	}
+	Int8(int32_t i)
+	{
+		for (size_t i_ = 0; i_ < 8; i_++)
+		{
+			vi[i_] = i;
+		}
+	}
+
+	Float8 Convert8f() const;
+	Float8 Cast8f() const;
+
+	Int8& operator+=(const Int8& rhs);
+	Int8& operator-=(const Int8& rhs);
+	Int8& operator*=(const Int8& rhs);
+	Int8& operator*=(int32_t rhs);
+
+	static Int8 Load8(const void* mem);
+	static void Store8(void* mem, const Int8& i);
+
+	static Int8 SetZero();
+	static Int8 Abs(const Int8& in);
+	static Int8 Min(const Int8& lhs, const Int8& rhs);
+	static Int8 Max(const Int8& lhs, const Int8& rhs);
+	static Int8 MulAdd(const Int8& a, const Int8& b, const Int8& c);
+	static Int8 MulSub(const Int8& a, const Int8& b, const Int8& c);
+
+	template <int COUNT>
+	static Int8 ShiftL(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftR(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftRA(const Int8& in);
+
+	static uint32_t MoveMask(const Int8& in);
+	static Int8 Select(const Int8& mask, const Int8& sel1, const Int8& sel2);
+	static Int8 Equal(const Int8& lhs, const Int8& rhs);
+	static Int8 NotEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 LessThan(const Int8& lhs, const Int8& rhs);
+	static Int8 LessEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterThan(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterEqual(const Int8& lhs, const Int8& rhs);
+};
+
+inline Int8 operator+(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] + rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Int8 operator-(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] - rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Int8 operator*(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] * rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Int8 operator*(const Int8& lhs, int32_t rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] * (uint32_t)rhs;
+	}
+	return ret;
+}
+
+inline Int8 operator&(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] & rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Int8 operator|(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] | rhs.vu[i];
+	}
+	return ret;
+}
+
+inline Int8 operator^(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] ^ rhs.vu[i];
+	}
+	return ret;
+}
+
+inline bool operator==(const Int8& lhs, const Int8& rhs)
+{
+	bool ret = true;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret &= lhs.vi[i] == rhs.vi[i];
+	}
+	return ret;
+}
+
+inline bool operator!=(const Int8& lhs, const Int8& rhs)
+{
+	return !(lhs == rhs);
+}
+
+inline Int8& Int8::operator+=(const Int8& rhs) { return *this = *this + rhs; }
+inline Int8& Int8::operator-=(const Int8& rhs) { return *this = *this - rhs; }
+inline Int8& Int8::operator*=(const Int8& rhs) { return *this = *this * rhs; }
+inline Int8& Int8::operator*=(int32_t rhs) { return *this = *this * rhs; }
+
+inline Int8 Int8::Load8(const void* mem)
+{
+	Int8 ret;
+	memcpy(ret.vi, mem, sizeof(int32_t) * 8);
+	return ret;
+}
+
+inline void Int8::Store8(void* mem, const Int8& i)
+{
+	memcpy(mem, i.vi, sizeof(int32_t) * 8);
+}
+
+inline Int8 Int8::SetZero()
+{
+	return Int8(0);
+}
+
+inline Int8 Int8::Abs(const Int8& in)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vi[i] = std::abs(in.vi[i]);
+	}
+	return ret;
+}
+
+inline Int8 Int8::Min(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vi[i] = (lhs.vi[i] < rhs.vi[i]) ? lhs.vi[i] : rhs.vi[i];
+	}
+	return ret;
+}
+
+inline Int8 Int8::Max(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vi[i] = (lhs.vi[i] > rhs.vi[i]) ? lhs.vi[i] : rhs.vi[i];
+	}
+	return ret;
+}
+
+inline Int8 Int8::MulAdd(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a + b * c;
+}
+
+inline Int8 Int8::MulSub(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a - b * c;
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftL(const Int8& lhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] << COUNT;
+	}
+	return ret;
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftR(const Int8& lhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = lhs.vu[i] >> COUNT;
+	}
+	return ret;
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftRA(const Int8& lhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vi[i] = lhs.vi[i] >> COUNT;
+	}
+	return ret;
+}
+
+inline uint32_t Int8::MoveMask(const Int8& in)
+{
+	uint32_t ret = 0;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret |= (in.vu[i] >> 31) << i;
+	}
+	return ret;
+}
+
+inline Int8 Int8::Select(const Int8& mask, const Int8& sel1, const Int8& sel2)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (mask.vu[i] & sel1.vu[i]) | (~mask.vu[i] & sel2.vu[i]);
+	}
+	return ret;
+}
+
+inline Int8 Int8::Equal(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] == rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Int8 Int8::NotEqual(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] != rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Int8 Int8::LessThan(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] < rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Int8 Int8::LessEqual(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] <= rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Int8 Int8::GreaterThan(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] > rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+inline Int8 Int8::GreaterEqual(const Int8& lhs, const Int8& rhs)
+{
+	Int8 ret;
+	for (size_t i = 0; i < 8; i++)
+	{
+		ret.vu[i] = (lhs.vi[i] >= rhs.vi[i]) ? 0xffffffff : 0;
+	}
+	return ret;
+}
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_INT8_GEN_H__
@@ -0,0 +1,253 @@
+
+#ifndef __EFFEKSEER_SIMD_MAT43F8_H__
+#define __EFFEKSEER_SIMD_MAT43F8_H__
+
+#include "Float8.h"
+#include "Int8.h"
+#include "Bridge8.h"
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+inline namespace EFK_SIMD_WIDE_NAMESPACE
+{
+
+/**
+	@brief	8 lanes version of ::Effekseer::NormalizeAngle
+*/
+inline Float8 NormalizeAngle(const Float8& angle)
+{
+	const Float8 signMask = Float8(-0.0f);
+	const Float8 ofs = (angle & signMask) | Float8(0.5f);
+	const Float8 x = angle * 0.159154943f + ofs;
+
+	// truncate toward zero like a cast to int (adding zero turns -0 into +0 as int does)
+	const Float8 truncated = Float8::Select(Float8::GreaterEqual(x, Float8::SetZero()), Float8::Floor(x), Float8::Ceil(x)) + Float8::SetZero();
+	return angle - truncated * 6.283185307f;
+}
+
+/**
+	@brief	8 lanes version of ::Effekseer::SinCos
+	@note
+	Operations are the same order as the scalar version so that results are the same.
+*/
+inline void SinCos(const Float8& in, Float8& s, Float8& c)
+{
+	const Float8 x = NormalizeAngle(in);
+	const Float8 x2 = x * x;
+	const Float8 x4 = x * x * x * x;
+	const Float8 x6 = x * x * x * x * x * x;
+	const Float8 x8 = x * x * x * x * x * x * x * x;
+	const Float8 x10 = x * x * x * x * x * x * x * x * x * x;
+	s = x * (Float8(1.0f) - x2 / 6.0f + x4 / 120.0f - x6 / 5040.0f + x8 / 362880.0f - x10 / 39916800.0f);
+	c = Float8(1.0f) - x2 / 2.0f + x4 / 24.0f - x6 / 720.0f + x8 / 40320.0f - x10 / 3628800.0f;
+}
+
+struct Mat43f8;
+
+/**
+	@brief	8 vectors stored as structure of arrays
+*/
+struct Vec3f8
+{
+	Float8 X;
+	Float8 Y;
+	Float8 Z;
+
+	Vec3f8() = default;
+	Vec3f8(const Vec3f8& rhs) = default;
+	Vec3f8(const Float8& x, const Float8& y, const Float8& z)
+		: X(x)
+		, Y(y)
+		, Z(z)
+	{
+	}
+
+	static Vec3f8 Transform(const Vec3f8& lhs, const Mat43f8& rhs);
+};
+
+/**
+	@brief	8 matrices stored as structure of arrays
+	@note
+	Lanes of X[i], Y[i] and Z[i] are the same as X, Y and Z of Mat43f so that results are the same as Mat43f.
+*/
+struct Mat43f8
+{
+	Float8 X[4];
+	Float8 Y[4];
+	Float8 Z[4];
+
+	//! load 8 matrices which are laid out like Matrix43
+	static Mat43f8 LoadMatrix43(const void* mem);
+
+	//! store 8 matrices which are laid out like Matrix43
+	static void StoreMatrix43(void* mem, const Mat43f8& m);
+
+	static Mat43f8 Identity();
+
+	static Mat43f8 SRT(const Vec3f8& s, const Mat43f8& r, const Vec3f8& t);
+
+	static Mat43f8 RotationZXY(const Float8& rz, const Float8& rx, const Float8& ry);
+};
+
+inline Mat43f8 operator*(const Mat43f8& lhs, const Mat43f8& rhs)
+{
+	const Float8 zero = Float8::SetZero();
+
+	Mat43f8 res;
+	for (int i = 0; i < 4; i++)
+	{
+		const Float8 x = (i == 3) ? rhs.X[3] : zero;
+		const Float8 y = (i == 3) ? rhs.Y[3] : zero;
+		const Float8 z = (i == 3) ? rhs.Z[3] : zero;
+		res.X[i] = x + lhs.X[i] * rhs.X[0] + lhs.Y[i] * rhs.X[1] + lhs.Z[i] * rhs.X[2];
+		res.Y[i] = y + lhs.X[i] * rhs.Y[0] + lhs.Y[i] * rhs.Y[1] + lhs.Z[i] * rhs.Y[2];
+		res.Z[i] = z + lhs.X[i] * rhs.Z[0] + lhs.Y[i] * rhs.Z[1] + lhs.Z[i] * rhs.Z[2];
+	}
+	return res;
+}
+
+inline Vec3f8 Vec3f8::Transform(const Vec3f8& lhs, const Mat43f8& rhs)
+{
+	Vec3f8 res;
+	res.X = rhs.X[3] + rhs.X[0] * lhs.X + rhs.X[1] * lhs.Y + rhs.X[2] * lhs.Z;
+	res.Y = rhs.Y[3] + rhs.Y[0] * lhs.X + rhs.Y[1] * lhs.Y + rhs.Y[2] * lhs.Z;
+	res.Z = rhs.Z[3] + rhs.Z[0] * lhs.X + rhs.Z[1] * lhs.Y + rhs.Z[2] * lhs.Z;
+	return res;
+}
+
+inline Mat43f8 Mat43f8::LoadMatrix43(const void* mem)
+{
+	const float* src = static_cast<const float*>(mem);
+	alignas(32) float transposed[12][8];
+
+	for (int i = 0; i < 8; i++)
+	{
+		for (int e = 0; e < 12; e++)
+		{
+			transposed[e][i] = src[i * 12 + e];
+		}
+	}
+
+	Mat43f8 ret;
+	for (int r = 0; r < 4; r++)
+	{
+		ret.X[r] = Float8::Load8(transposed[r * 3 + 0]);
+		ret.Y[r] = Float8::Load8(transposed[r * 3 + 1]);
+		ret.Z[r] = Float8::Load8(transposed[r * 3 + 2]);
+	}
+	return ret;
+}
+
+inline void Mat43f8::StoreMatrix43(void* mem, const Mat43f8& m)
+{
+	float* dst = static_cast<float*>(mem);
+	alignas(32) float transposed[12][8];
+
+	for (int r = 0; r < 4; r++)
+	{
+		Float8::Store8(transposed[r * 3 + 0], m.X[r]);
+		Float8::Store8(transposed[r * 3 + 1], m.Y[r]);
+		Float8::Store8(transposed[r * 3 + 2], m.Z[r]);
+	}
+
+	for (int i = 0; i < 8; i++)
+	{
+		for (int e = 0; e < 12; e++)
+		{
+			dst[i * 12 + e] = transposed[e][i];
+		}
+	}
+}
+
+inline Mat43f8 Mat43f8::Identity()
+{
+	const Float8 zero = Float8::SetZero();
+	const Float8 one = Float8(1.0f);
+
+	Mat43f8 ret;
+	ret.X[0] = one;
+	ret.X[1] = zero;
+	ret.X[2] = zero;
+	ret.X[3] = zero;
+	ret.Y[0] = zero;
+	ret.Y[1] = one;
+	ret.Y[2] = zero;
+	ret.Y[3] = zero;
+	ret.Z[0] = zero;
+	ret.Z[1] = zero;
+	ret.Z[2] = one;
+	ret.Z[3] = zero;
+	return ret;
+}
+
+inline Mat43f8 Mat43f8::SRT(const Vec3f8& s, const Mat43f8& r, const Vec3f8& t)
+{
+	Mat43f8 ret;
+	ret.X[0] = r.X[0] * s.X;
+	ret.X[1] = r.X[1] * s.Y;
+	ret.X[2] = r.X[2] * s.Z;
+	ret.X[3] = t.X;
+	ret.Y[0] = r.Y[0] * s.X;
+	ret.Y[1] = r.Y[1] * s.Y;
+	ret.Y[2] = r.Y[2] * s.Z;
+	ret.Y[3] = t.Y;
+	ret.Z[0] = r.Z[0] * s.X;
+	ret.Z[1] = r.Z[1] * s.Y;
+	ret.Z[2] = r.Z[2] * s.Z;
+	ret.Z[3] = t.Z;
+	return ret;
+}
+
+inline Mat43f8 Mat43f8::RotationZXY(const Float8& rz, const Float8& rx, const Float8& ry)
+{
+	const Float8 zero = Float8::SetZero();
+	const Float8 one = Float8(1.0f);
+	const Float8 signMask = Float8(-0.0f);
+
+	// Mat43f::RotationZXY does not calculate sin and cos of 0
+	auto sinCos = [&](const Float8& angle, Float8& s, Float8& c) {
+		SinCos(angle, s, c);
+		const Float8 isZero = Float8::Equal(angle, zero);
+		s = Float8::Select(isZero, zero, s);
+		c = Float8::Select(isZero, one, c);
+	};
+
+	Float8 sx, cx, sy, cy, sz, cz;
+	sinCos(rx, sx, cx);
+	sinCos(ry, sy, cy);
+	sinCos(rz, sz, cz);
+
+	const Float8 negSy = sy ^ signMask;
+	const Float8 negSz = sz ^ signMask;
+
+	// X, Y and Z are {m00, m10, m20}, {m01, m11, m21} and {m02, m12, m22} of Mat43f::RotationZXY
+	Mat43f8 ret;
+	ret.X[0] = cz * cy + sz * sx * sy;
+	ret.Y[0] = sz * cx;
+	ret.Z[0] = cz * negSy + sz * sx * cy;
+
+	ret.X[1] = negSz * cy + cz * sx * sy;
+	ret.Y[1] = cz * cx;
+	ret.Z[1] = negSz * negSy + cz * sx * cy;
+
+	ret.X[2] = cx * sy;
+	ret.Y[2] = sx ^ signMask;
+	ret.Z[2] = cx * cy;
+
+	ret.X[3] = zero;
+	ret.Y[3] = zero;
+	ret.Z[3] = zero;
+	return ret;
+}
+
+} // namespace EFK_SIMD_WIDE_NAMESPACE
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif // __EFFEKSEER_SIMD_MAT43F8_H__
@@ -6,6 +6,14 @@
 #include "Vec3f.h"
 #include "Vec4f.h"
 
+#if defined(EFK_SIMD_SSE2)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 namespace Effekseer
 {
 	
@@ -40,6 +48,66 @@ Vec3f::Vec3f(const std::array<float, 3>& vec)
 {
 }
 
+bool IsAVX2Supported()
+{
+#if defined(EFK_SIMD_SSE2)
+	uint32_t regs1[4] = {};
+	uint32_t regs7[4] = {};
+
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+	{
+		return false;
+	}
+
+	__cpuid(info, 1);
+	for (int i = 0; i < 4; i++)
+	{
+		regs1[i] = static_cast<uint32_t>(info[i]);
+	}
+
+	__cpuidex(info, 7, 0);
+	for (int i = 0; i < 4; i++)
+	{
+		regs7[i] = static_cast<uint32_t>(info[i]);
+	}
+#else
+	if (__get_cpuid_max(0, nullptr) < 7)
+	{
+		return false;
+	}
+
+	__cpuid(1, regs1[0], regs1[1], regs1[2], regs1[3]);
+	__cpuid_count(7, 0, regs7[0], regs7[1], regs7[2], regs7[3]);
+#endif
+
+	const bool osxsave = (regs1[2] & (1u << 27)) != 0;
+	const bool avx = (regs1[2] & (1u << 28)) != 0;
+	const bool avx2 = (regs7[1] & (1u << 5)) != 0;
+
+	if (!osxsave || !avx || !avx2)
+	{
+		return false;
+	}
+
+	// an OS must save YMM registers on context switches
+#if defined(_MSC_VER)
+	const uint64_t xcr0 = _xgetbv(0);
+#else
+	uint32_t xcr0Low = 0;
+	uint32_t xcr0High = 0;
+	__asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+	const uint64_t xcr0 = (static_cast<uint64_t>(xcr0High) << 32) | xcr0Low;
+#endif
+
+	return (xcr0 & 0x6) == 0x6;
+#else
+	return false;
+#endif
+}
+
 } // namespace SIMD
 
 } // namespace Effekseer
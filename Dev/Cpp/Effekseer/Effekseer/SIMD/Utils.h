@@ -91,6 +91,44 @@ inline Matrix44 ToStruct(const Mat44f& o)
 	return ret;
 }
 
+/**
+	@brief	4 lanes version of ::Effekseer::NormalizeAngle
+*/
+inline Float4 NormalizeAngle(const Float4& angle)
+{
+	const Float4 signMask = Float4::SetUInt(0x80000000, 0x80000000, 0x80000000, 0x80000000);
+	const Float4 ofs = (angle & signMask) | Float4(0.5f);
+	const Float4 x = angle * 0.159154943f + ofs;
+
+	// truncate toward zero like a cast to int (adding zero turns -0 into +0 as int does)
+	const Float4 truncated = Float4::Select(Float4::GreaterEqual(x, Float4::SetZero()), Float4::Floor(x), Float4::Ceil(x)) + Float4::SetZero();
+	return angle - truncated * 6.283185307f;
+}
+
+/**
+	@brief	4 lanes version of ::Effekseer::SinCos
+	@note
+	Operations are the same order as the scalar version so that results are the same.
+*/
+inline void SinCos(const Float4& in, Float4& s, Float4& c)
+{
+	const Float4 x = NormalizeAngle(in);
+	const Float4 x2 = x * x;
+	const Float4 x4 = x * x * x * x;
+	const Float4 x6 = x * x * x * x * x * x;
+	const Float4 x8 = x * x * x * x * x * x * x * x;
+	const Float4 x10 = x * x * x * x * x * x * x * x * x * x;
+	s = x * (Float4(1.0f) - x2 / 6.0f + x4 / 120.0f - x6 / 5040.0f + x8 / 362880.0f - x10 / 39916800.0f);
+	c = Float4(1.0f) - x2 / 2.0f + x4 / 24.0f - x6 / 720.0f + x8 / 40320.0f - x10 / 3628800.0f;
+}
+
+/**
+	@brief	whether can types with 8 lanes for AVX2 be used on a running CPU
+	@note
+	It is always false except x86/x86-64.
+*/
+bool IsAVX2Supported();
+
 } // namespace SIMD
 
 } // namespace Effekseer
@@ -201,6 +201,74 @@ struct SimpleVertex
 	}
 };
 
+/**
+	@brief	a sprite which is expanded into a quad by a vertex shader instead of 4 SimpleVertex
+	@note
+	A corner (u, v) of a quad is placed at Position + u * AxisU + v * AxisV,
+	so that a billboard, a scale and corners are applied once per sprite on CPU.
+	It is used when a sprite is a parallelogram with one color. Otherwise, please use SimpleSpriteInstanceWithCorners.
+*/
+struct SimpleSpriteInstance
+{
+	//! a world position of the lower left corner
+	std::array<float, 3> Position;
+
+	//! offsets from the lower left corner to the lower right corner and the upper left corner
+	std::array<float, 3> AxisU;
+	std::array<float, 3> AxisV;
+
+	VertexColor Color;
+
+	//! x, y, width and height
+	float UV[4];
+};
+
+/**
+	@brief	a sprite whose corners have own colors or are not placed at a parallelogram
+	@note
+	A corner (u, v) of a quad is placed at Position + u * AxisU + v * AxisV + u * v * AxisUV.
+*/
+struct SimpleSpriteInstanceWithCorners
+{
+	std::array<float, 3> Position;
+	std::array<float, 3> AxisU;
+	std::array<float, 3> AxisV;
+	std::array<float, 3> AxisUV;
+
+	//! lower left, lower right, upper left and upper right
+	VertexColor Colors[4];
+
+	//! x, y, width and height
+	float UV[4];
+};
+
+/**
+	@brief	a ring which is drawn with a cached ring mesh instead of VertexCount * 8 SimpleVertex
+	@note
+	A vertex of a ring mesh is placed by a vertex shader with a rate of an angle and outer, center or inner.
+	Please read Renderer::Impl::GetRingMesh.
+*/
+struct SimpleRingInstance
+{
+	//! rows of a matrix which transforms a local position into a world position
+	std::array<float, 4> Matrix[3];
+
+	//! radiuses of outer, center and inner and the number of segments
+	float Radiuses[4];
+
+	//! heights of outer, center and inner and unused
+	float Heights[4];
+
+	//! a beginning angle in radian, an angle of a ring, a starting fade and an ending fade in degree
+	float Angles[4];
+
+	//! outer, center, inner and unused
+	VertexColor Colors[4];
+
+	//! x, y, width and height
+	float UV[4];
+};
+
 struct AdvancedLightingVertex
 {
 	VertexFloat3 Pos;
@@ -853,6 +921,15 @@ enum class RendererShaderType
 	AdvancedLit,
 	AdvancedBackDistortion,
 	Material,
+
+	//! Unlit whose sprites are drawn with SimpleSpriteInstance
+	UnlitSpriteInstanced,
+
+	//! Unlit whose sprites are drawn with SimpleSpriteInstanceWithCorners
+	UnlitSpriteCornersInstanced,
+
+	//! Unlit whose rings are drawn with SimpleRingInstance
+	UnlitRingInstanced,
 };
 
 struct ShaderParameterCollector
@@ -10,6 +10,7 @@
 
 #include "EffekseerRenderer.CommonUtils.h"
 #include "EffekseerRenderer.IndexBufferBase.h"
+#include "EffekseerRenderer.RadixSorter.h"
 #include "EffekseerRenderer.RenderStateBase.h"
 #include "EffekseerRenderer.Renderer.h"
 #include "EffekseerRenderer.VertexBufferBase.h"
@@ -226,13 +227,7 @@ enum class ModelRendererVertexType
 class ModelRendererBase : public ::Effekseer::ModelRenderer, public ::Effekseer::SIMD::AlignedAllocationPolicy<16>
 {
 protected:
-	struct KeyValue
-	{
-		float Key;
-		int Value;
-	};
-
-	std::vector<KeyValue> keyValues_;
+	RadixSorter sorter_;
 
 	std::vector<Effekseer::Matrix44> matrixesSorted_;
 	std::vector<Effekseer::RectF> uvSorted_;
@@ -337,99 +332,97 @@ protected:
 	{
 		if (param.DepthParameterPtr->ZSort != Effekseer::ZSortType::None)
 		{
-			keyValues_.resize(m_matrixes.size());
-			for (size_t i = 0; i < keyValues_.size(); i++)
+			auto frontDirection = renderer->GetCameraFrontDirection();
+			if (!param.IsRightHand)
 			{
-				efkVector3D t(m_matrixes[i].Values[3][0], m_matrixes[i].Values[3][1], m_matrixes[i].Values[3][2]);
-
-				auto frontDirection = renderer->GetCameraFrontDirection();
-				if (!param.IsRightHand)
-				{
-					frontDirection.Z = -frontDirection.Z;
-				}
-
-				keyValues_[i].Key = Effekseer::SIMD::Vec3f::Dot(t, frontDirection);
-				keyValues_[i].Value = static_cast<int32_t>(i);
+				frontDirection.Z = -frontDirection.Z;
 			}
 
-			if (param.DepthParameterPtr->ZSort == Effekseer::ZSortType::NormalOrder)
-			{
-				std::sort(keyValues_.begin(), keyValues_.end(), [](const KeyValue& a, const KeyValue& b) -> bool { return a.Key < b.Key; });
-			}
-			else
+			const auto count = static_cast<int32_t>(m_matrixes.size());
+
+			sorter_.Resize(count);
+			for (int32_t i = 0; i < count; i++)
 			{
-				std::sort(keyValues_.begin(), keyValues_.end(), [](const KeyValue& a, const KeyValue& b) -> bool { return a.Key > b.Key; });
+				efkVector3D t(m_matrixes[i].Values[3][0], m_matrixes[i].Values[3][1], m_matrixes[i].Values[3][2]);
+				sorter_.SetKey(i, Effekseer::SIMD::Vec3f::Dot(t, frontDirection));
 			}
 
-			matrixesSorted_.resize(m_matrixes.size());
-			uvSorted_.resize(m_matrixes.size());
-			alphaUVSorted_.resize(m_matrixes.size());
-			uvDistortionUVSorted_.resize(m_matrixes.size());
-			blendUVSorted_.resize(m_matrixes.size());
-			blendAlphaUVSorted_.resize(m_matrixes.size());
-			blendUVDistortionUVSorted_.resize(m_matrixes.size());
-			flipbookIndexAndNextRateSorted_.resize(m_matrixes.size());
-			alphaThresholdSorted_.resize(m_matrixes.size());
-			viewOffsetDistanceSorted_.resize(m_matrixes.size());
-			colorsSorted_.resize(m_matrixes.size());
-			timesSorted_.resize(m_matrixes.size());
+			sorter_.Sort(param.DepthParameterPtr->ZSort != Effekseer::ZSortType::NormalOrder);
+
+			matrixesSorted_.resize(count);
+			uvSorted_.resize(count);
+			alphaUVSorted_.resize(count);
+			uvDistortionUVSorted_.resize(count);
+			blendUVSorted_.resize(count);
+			blendAlphaUVSorted_.resize(count);
+			blendUVDistortionUVSorted_.resize(count);
+			flipbookIndexAndNextRateSorted_.resize(count);
+			alphaThresholdSorted_.resize(count);
+			viewOffsetDistanceSorted_.resize(count);
+			colorsSorted_.resize(count);
+			timesSorted_.resize(count);
 
 			if (customData1Count_ > 0)
 			{
-				customData1Sorted_.resize(m_matrixes.size());
+				customData1Sorted_.resize(count);
 			}
 
 			if (customData2Count_ > 0)
 			{
-				customData2Sorted_.resize(m_matrixes.size());
+				customData2Sorted_.resize(count);
 			}
 
-			for (size_t i = 0; i < keyValues_.size(); i++)
+			// gather all values in sorted order at once
+			for (int32_t i = 0; i < count; i++)
 			{
-				matrixesSorted_[keyValues_[i].Value] = m_matrixes[i];
-				uvSorted_[keyValues_[i].Value] = m_uv[i];
-				alphaUVSorted_[keyValues_[i].Value] = m_alphaUV[i];
-				uvDistortionUVSorted_[keyValues_[i].Value] = m_uvDistortionUV[i];
-				blendUVSorted_[keyValues_[i].Value] = m_blendUV[i];
-				blendAlphaUVSorted_[keyValues_[i].Value] = m_blendAlphaUV[i];
-				blendUVDistortionUVSorted_[keyValues_[i].Value] = m_blendUVDistortionUV[i];
-				flipbookIndexAndNextRateSorted_[keyValues_[i].Value] = m_flipbookIndexAndNextRate[i];
-				alphaThresholdSorted_[keyValues_[i].Value] = m_alphaThreshold[i];
-				viewOffsetDistanceSorted_[keyValues_[i].Value] = m_viewOffsetDistance[i];
-				colorsSorted_[keyValues_[i].Value] = m_colors[i];
-				timesSorted_[keyValues_[i].Value] = m_times[i];
+				const auto src = sorter_.GetIndex(i);
+				matrixesSorted_[i] = m_matrixes[src];
+				uvSorted_[i] = m_uv[src];
+				alphaUVSorted_[i] = m_alphaUV[src];
+				uvDistortionUVSorted_[i] = m_uvDistortionUV[src];
+				blendUVSorted_[i] = m_blendUV[src];
+				blendAlphaUVSorted_[i] = m_blendAlphaUV[src];
+				blendUVDistortionUVSorted_[i] = m_blendUVDistortionUV[src];
+				flipbookIndexAndNextRateSorted_[i] = m_flipbookIndexAndNextRate[src];
+				alphaThresholdSorted_[i] = m_alphaThreshold[src];
+				viewOffsetDistanceSorted_[i] = m_viewOffsetDistance[src];
+				colorsSorted_[i] = m_colors[src];
+				timesSorted_[i] = m_times[src];
+
+				if (customData1Count_ > 0)
+				{
+					customData1Sorted_[i] = customData1_[src];
+				}
+
+				if (customData2Count_ > 0)
+				{
+					customData2Sorted_[i] = customData2_[src];
+				}
 			}
 
+			// sorted values are swapped instead of copied
+			std::swap(m_matrixes, matrixesSorted_);
+			std::swap(m_uv, uvSorted_);
+			std::swap(m_alphaUV, alphaUVSorted_);
+			std::swap(m_uvDistortionUV, uvDistortionUVSorted_);
+			std::swap(m_blendUV, blendUVSorted_);
+			std::swap(m_blendAlphaUV, blendAlphaUVSorted_);
+			std::swap(m_blendUVDistortionUV, blendUVDistortionUVSorted_);
+			std::swap(m_flipbookIndexAndNextRate, flipbookIndexAndNextRateSorted_);
+			std::swap(m_alphaThreshold, alphaThresholdSorted_);
+			std::swap(m_viewOffsetDistance, viewOffsetDistanceSorted_);
+			std::swap(m_colors, colorsSorted_);
+			std::swap(m_times, timesSorted_);
+
 			if (customData1Count_ > 0)
 			{
-				for (size_t i = 0; i < keyValues_.size(); i++)
-				{
-					customData1Sorted_[keyValues_[i].Value] = customData1_[i];
-				}
+				std::swap(customData1_, customData1Sorted_);
 			}
 
 			if (customData2Count_ > 0)
 			{
-				for (size_t i = 0; i < keyValues_.size(); i++)
-				{
-					customData2Sorted_[keyValues_[i].Value] = customData2_[i];
-				}
+				std::swap(customData2_, customData2Sorted_);
 			}
-
-			m_matrixes = matrixesSorted_;
-			m_uv = uvSorted_;
-			m_alphaUV = alphaUVSorted_;
-			m_uvDistortionUV = uvDistortionUVSorted_;
-			m_blendUV = blendUVSorted_;
-			m_blendAlphaUV = blendAlphaUVSorted_;
-			m_blendUVDistortionUV = blendUVDistortionUVSorted_;
-			m_flipbookIndexAndNextRate = flipbookIndexAndNextRateSorted_;
-			m_alphaThreshold = alphaThresholdSorted_;
-			m_viewOffsetDistance = viewOffsetDistanceSorted_;
-			m_colors = colorsSorted_;
-			m_times = timesSorted_;
-			customData1_ = customData1Sorted_;
-			customData2_ = customData2Sorted_;
 		}
 	}
 
@@ -584,8 +577,6 @@ public:
 	template <typename RENDERER>
 	void BeginRendering_(RENDERER* renderer, const efkModelNodeParam& parameter, int32_t count, void* userData)
 	{
-		keyValues_.clear();
-
 		m_matrixes.clear();
 		m_uv.clear();
 		m_alphaUV.clear();
@@ -1054,7 +1045,7 @@ public:
 			//auto& imodel = model->InternalModels[stTime0];
 
 			// Invalid unless layout is set after buffer
-			renderer->SetVertexBuffer(model->GetVertexBuffer(stTime0), sizeof(Effekseer::Model::Vertex));
+			renderer->SetVertexBuffer(model->GetVertexBuffer(stTime0), model->GetVertexBufferStride());
 
 			int32_t indexPerFace = 3;
 			if (renderer->GetRenderMode() == Effekseer::RenderMode::Wireframe)
@@ -1160,7 +1151,7 @@ public:
 				// auto& imodel = model->InternalModels[stTime];
 
 				// Invalid unless layout is set after buffer
-				renderer->SetVertexBuffer(model->GetVertexBuffer(stTime), sizeof(Effekseer::Model::Vertex));
+				renderer->SetVertexBuffer(model->GetVertexBuffer(stTime), model->GetVertexBufferStride());
 
 				int32_t indexPerFace = 3;
 				if (renderer->GetRenderMode() == Effekseer::RenderMode::Wireframe)
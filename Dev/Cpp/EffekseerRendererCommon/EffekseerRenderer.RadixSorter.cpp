@@ -0,0 +1,157 @@
+#include "EffekseerRenderer.RadixSorter.h"
+#include <algorithm>
+
+namespace EffekseerRenderer
+{
+
+//! elements less than it are sorted with an insertion sort because radix sort has overheads of histograms
+static const int32_t InsertionSortThreshold = 64;
+
+void RadixSorter::Resize(int32_t count)
+{
+	if (GetCount() != count)
+	{
+		hasPreviousOrder_ = false;
+	}
+
+	keys_.resize(count);
+	indexes_.resize(count);
+}
+
+void RadixSorter::Sort(bool isDescending)
+{
+	const uint32_t flipMask = isDescending ? 0xFFFFFFFF : 0;
+
+	if (hasPreviousOrder_ && SortFromPreviousOrder(flipMask))
+	{
+		return;
+	}
+
+	if (GetCount() < InsertionSortThreshold)
+	{
+		SortWithInsertion(flipMask);
+	}
+	else
+	{
+		SortWithRadix(flipMask);
+	}
+
+	hasPreviousOrder_ = true;
+}
+
+bool RadixSorter::SortFromPreviousOrder(uint32_t flipMask)
+{
+	const int32_t count = GetCount();
+
+	// give up if the previous order is far from sorted
+	int32_t restMoves = count;
+
+	for (int32_t i = 1; i < count; i++)
+	{
+		const int32_t index = indexes_[i];
+		const uint32_t key = keys_[index] ^ flipMask;
+
+		int32_t j = i;
+		for (; j > 0 && (keys_[indexes_[j - 1]] ^ flipMask) > key; j--)
+		{
+			if (restMoves == 0)
+			{
+				return false;
+			}
+
+			indexes_[j] = indexes_[j - 1];
+			restMoves--;
+		}
+		indexes_[j] = index;
+	}
+
+	return true;
+}
+
+void RadixSorter::SortWithInsertion(uint32_t flipMask)
+{
+	const int32_t count = GetCount();
+
+	for (int32_t i = 0; i < count; i++)
+	{
+		indexes_[i] = i;
+	}
+
+	for (int32_t i = 1; i < count; i++)
+	{
+		const int32_t index = indexes_[i];
+		const uint32_t key = keys_[index] ^ flipMask;
+
+		int32_t j = i;
+		for (; j > 0 && (keys_[indexes_[j - 1]] ^ flipMask) > key; j--)
+		{
+			indexes_[j] = indexes_[j - 1];
+		}
+		indexes_[j] = index;
+	}
+}
+
+void RadixSorter::SortWithRadix(uint32_t flipMask)
+{
+	const int32_t count = GetCount();
+	const int32_t passCount = 4;
+
+	tempKeys_.resize(count);
+	tempIndexes_.resize(count);
+
+	// keys are overwritten because they are specified again before the next sort
+	int32_t histograms[passCount][256] = {};
+	for (int32_t i = 0; i < count; i++)
+	{
+		const uint32_t key = keys_[i] ^ flipMask;
+		keys_[i] = key;
+		indexes_[i] = i;
+
+		for (int32_t pass = 0; pass < passCount; pass++)
+		{
+			histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+		}
+	}
+
+	uint32_t* srcKeys = keys_.data();
+	int32_t* srcIndexes = indexes_.data();
+	uint32_t* dstKeys = tempKeys_.data();
+	int32_t* dstIndexes = tempIndexes_.data();
+
+	for (int32_t pass = 0; pass < passCount; pass++)
+	{
+		const int32_t shift = pass * 8;
+		const auto& histogram = histograms[pass];
+
+		// a pass is skipped if all keys have the same digit
+		if (histogram[(srcKeys[0] >> shift) & 0xFF] == count)
+		{
+			continue;
+		}
+
+		int32_t offsets[256];
+		int32_t offset = 0;
+		for (int32_t digit = 0; digit < 256; digit++)
+		{
+			offsets[digit] = offset;
+			offset += histogram[digit];
+		}
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			const int32_t dst = offsets[(srcKeys[i] >> shift) & 0xFF]++;
+			dstKeys[dst] = srcKeys[i];
+			dstIndexes[dst] = srcIndexes[i];
+		}
+
+		std::swap(srcKeys, dstKeys);
+		std::swap(srcIndexes, dstIndexes);
+	}
+
+	if (srcIndexes != indexes_.data())
+	{
+		std::copy(srcIndexes, srcIndexes + count, indexes_.data());
+	}
+}
+
+} // namespace EffekseerRenderer
@@ -0,0 +1,75 @@
+
+#ifndef __EFFEKSEERRENDERER_RADIX_SORTER_H__
+#define __EFFEKSEERRENDERER_RADIX_SORTER_H__
+
+#include <Effekseer.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace EffekseerRenderer
+{
+
+/**
+	@brief	a sorter which sorts indexes of elements by float keys
+	@note
+	Keys are converted into integers which keep the order of floats and indexes are sorted with a stable radix sort,
+	so that elements are permuted with one gather pass after sorting.
+	If the number of elements is the same as the previous sort, the previous order is tried first
+	because depths of particles change little between frames.
+*/
+class RadixSorter
+{
+private:
+	Effekseer::CustomVector<uint32_t> keys_;
+	Effekseer::CustomVector<uint32_t> tempKeys_;
+	Effekseer::CustomVector<int32_t> indexes_;
+	Effekseer::CustomVector<int32_t> tempIndexes_;
+
+	//! whether does indexes_ keep the order of the previous sort
+	bool hasPreviousOrder_ = false;
+
+	bool SortFromPreviousOrder(uint32_t flipMask);
+
+	void SortWithInsertion(uint32_t flipMask);
+
+	void SortWithRadix(uint32_t flipMask);
+
+public:
+	//! resize the number of elements. Keys must be specified again
+	void Resize(int32_t count);
+
+	int32_t GetCount() const
+	{
+		return static_cast<int32_t>(keys_.size());
+	}
+
+	void SetKey(int32_t index, float key)
+	{
+		// -0 is turned into +0 to be equal to +0
+		key += 0.0f;
+
+		uint32_t bits;
+		memcpy(&bits, &key, sizeof(uint32_t));
+
+		// flip all bits of negative values and the sign bit of positive values
+		keys_[index] = (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+	}
+
+	/**
+		@brief	sort indexes by keys
+		@param	isDescending	[in]	whether are indexes sorted from the largest key
+		@note
+		Elements with the same key keep the order of indexes when they are sorted without the previous order.
+	*/
+	void Sort(bool isDescending);
+
+	//! get an index of an element at a sorted position
+	int32_t GetIndex(int32_t position) const
+	{
+		return indexes_[position];
+	}
+};
+
+} // namespace EffekseerRenderer
+
+#endif // __EFFEKSEERRENDERER_RADIX_SORTER_H__
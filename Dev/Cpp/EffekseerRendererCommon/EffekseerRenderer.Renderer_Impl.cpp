@@ -133,6 +133,52 @@ void Renderer::Impl::DeleteProxyTextures(Renderer* renderer)
 	return nullptr;
 }
 
+const Renderer::Impl::RingMesh& Renderer::Impl::GetRingMesh(Renderer* renderer, int32_t segmentCount)
+{
+	auto it = ringMeshes_.find(segmentCount);
+	if (it != ringMeshes_.end())
+	{
+		return it->second;
+	}
+
+	// a segment is two quads, outer-center and center-inner, which are split like sprites
+	Effekseer::CustomVector<int32_t> indexes;
+	indexes.reserve(segmentCount * 12);
+
+	for (int32_t i = 0; i < segmentCount; i++)
+	{
+		const int32_t outer = i * 3 + 0;
+		const int32_t center = i * 3 + 1;
+		const int32_t inner = i * 3 + 2;
+		const int32_t outerNext = outer + 3;
+		const int32_t centerNext = center + 3;
+		const int32_t innerNext = inner + 3;
+
+		for (auto index : {centerNext, center, outer, centerNext, outer, outerNext})
+		{
+			indexes.emplace_back(index);
+		}
+
+		for (auto index : {innerNext, inner, center, innerNext, center, centerNext})
+		{
+			indexes.emplace_back(index);
+		}
+	}
+
+	RingMesh mesh;
+	mesh.IndexCount = static_cast<int32_t>(indexes.size());
+	mesh.VertexCount = (segmentCount + 1) * 3;
+	mesh.IndexBuffer = renderer->GetGraphicsDevice()->CreateIndexBuffer(
+		mesh.IndexCount, indexes.data(), Effekseer::Backend::IndexBufferStrideType::Stride4);
+
+	return ringMeshes_.emplace(segmentCount, mesh).first->second;
+}
+
+void Renderer::Impl::DeleteRingMeshes()
+{
+	ringMeshes_.clear();
+}
+
 UVStyle Renderer::Impl::GetTextureUVStyle() const
 {
 	return textureUVStyle;
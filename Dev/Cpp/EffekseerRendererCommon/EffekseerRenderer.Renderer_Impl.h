@@ -10,6 +10,20 @@ namespace EffekseerRenderer
 
 class Renderer::Impl final : public ::Effekseer::SIMD::AlignedAllocationPolicy<16>
 {
+public:
+	/**
+		@brief	indexes of a ring which is deformed with SimpleRingInstance
+		@note
+		The vertex i of a ring is the (i % 3)-th of outer, center and inner at the (i / 3)-th segment.
+		So that vertices are not stored and a mesh depends on only the number of segments.
+	*/
+	struct RingMesh
+	{
+		::Effekseer::Backend::IndexBufferRef IndexBuffer;
+		int32_t IndexCount = 0;
+		int32_t VertexCount = 0;
+	};
+
 private:
 	::Effekseer::SIMD::Mat44f projectionMat_;
 	::Effekseer::SIMD::Mat44f cameraMat_;
@@ -35,6 +49,8 @@ private:
 	::Effekseer::Backend::TextureRef depthTexture_;
 	DepthReconstructionParameter reconstructionParam_;
 
+	::Effekseer::CustomUnorderedMap<int32_t, RingMesh> ringMeshes_;
+
 	void SetCameraParameterInternal(const ::Effekseer::SIMD::Vec3f& front, const ::Effekseer::SIMD::Vec3f& position);
 
 public:
@@ -43,6 +59,12 @@ public:
 	bool isRenderModeValid = true;
 	bool isSoftParticleEnabled = false;
 
+	//! whether can sprites be drawn with RendererShaderType::UnlitSpriteInstanced and UnlitSpriteCornersInstanced
+	bool isSpriteInstancingEnabled = false;
+
+	//! whether can rings be drawn with RendererShaderType::UnlitRingInstanced
+	bool isRingInstancingEnabled = false;
+
 	Effekseer::RefPtr<Effekseer::RenderingUserData> CurrentRenderingUserData;
 
 	Impl() = default;
@@ -84,6 +106,13 @@ public:
 
 	::Effekseer::Backend::TextureRef GetProxyTexture(EffekseerRenderer::ProxyTextureType type);
 
+	/**
+		@brief	get a ring mesh which has segments, which is created at first
+	*/
+	const RingMesh& GetRingMesh(Renderer* renderer, int32_t segmentCount);
+
+	void DeleteRingMeshes();
+
 	UVStyle GetTextureUVStyle() const;
 
 	void SetTextureUVStyle(UVStyle style);
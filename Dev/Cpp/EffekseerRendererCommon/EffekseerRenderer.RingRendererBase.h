@@ -12,6 +12,7 @@
 
 #include "EffekseerRenderer.CommonUtils.h"
 #include "EffekseerRenderer.IndexBufferBase.h"
+#include "EffekseerRenderer.RadixSorter.h"
 #include "EffekseerRenderer.RenderStateBase.h"
 #include "EffekseerRenderer.StandardRenderer.h"
 #include "EffekseerRenderer.VertexBufferBase.h"
@@ -32,12 +33,8 @@ template <typename RENDERER, bool FLIP_RGB_FLAG>
 class RingRendererBase : public ::Effekseer::RingRenderer, public ::Effekseer::SIMD::AlignedAllocationPolicy<16>
 {
 protected:
-	struct KeyValue
-	{
-		float Key;
-		efkRingInstanceParam Value;
-	};
-	std::vector<KeyValue> instances_;
+	Effekseer::CustomAlignedVector<efkRingInstanceParam> instances_;
+	RadixSorter sorter_;
 
 	RENDERER* m_renderer;
 	int32_t m_ringBufferOffset;
@@ -54,6 +51,9 @@ protected:
 	int32_t customData2Count_ = 0;
 	bool fasterSngleRingModeEnabled_ = true;
 
+	//! whether are rings written as SimpleRingInstance
+	bool isInstanced_ = false;
+
 public:
 	RingRendererBase(RENDERER* renderer)
 		: m_renderer(renderer)
@@ -98,7 +98,11 @@ protected:
 	{
 		void* userData = nullptr;
 		const ShaderParameterCollector& collector = state.Collector;
-		if (collector.ShaderType == RendererShaderType::Material)
+		if (state.RingInstanceVertexCount > 0)
+		{
+			Rendering_Instanced<FLIP_RGB_FLAG>(parameter, instanceParameter, camera);
+		}
+		else if (collector.ShaderType == RendererShaderType::Material)
 		{
 			Rendering_Internal<DynamicVertex, FLIP_RGB_FLAG>(parameter, instanceParameter, userData, camera);
 		}
@@ -141,11 +145,6 @@ protected:
 			instances_.reserve(count);
 		}
 
-		if (count == 1)
-		{
-			renderer->GetStandardRenderer()->ResetAndRenderingIfRequired();
-		}
-
 		EffekseerRenderer::StandardRendererState state;
 		state.AlphaBlend = param.BasicParameterPtr->AlphaBlend;
 		state.CullingType = ::Effekseer::CullingType::Double;
@@ -191,8 +190,21 @@ protected:
 
 		materialType_ = param.BasicParameterPtr->MaterialType;
 
+		// a ring is deformed from a cached ring mesh by a vertex shader if a backend supports it
+		isInstanced_ = SupportInstancedDrawing<RENDERER>::Value &&
+					   m_renderer->GetImpl()->isRingInstancingEnabled &&
+					   state.Collector.ShaderType == RendererShaderType::Unlit &&
+					   m_renderer->GetRenderMode() == Effekseer::RenderMode::Normal && param.VertexCount > 0;
+		state.RingInstanceVertexCount = isInstanced_ ? param.VertexCount : 0;
+
+		if (count == 1 && !isInstanced_)
+		{
+			renderer->GetStandardRenderer()->ResetAndRenderingIfRequired();
+		}
+
 		renderer->GetStandardRenderer()->UpdateStateAndRenderingIfRequired(state);
-		renderer->GetStandardRenderer()->BeginRenderingAndRenderingIfRequired(count * singleVertexCount, stride_, (void*&)m_ringBufferData);
+		renderer->GetStandardRenderer()->BeginRenderingAndRenderingIfRequired(
+			isInstanced_ ? count : count * singleVertexCount, stride_, (void*&)m_ringBufferData);
 
 		vertexCount_ = count * singleVertexCount;
 	}
@@ -210,22 +222,18 @@ protected:
 		}
 		else
 		{
-			KeyValue kv;
-			kv.Value = instanceParameter;
-			instances_.push_back(kv);
+			instances_.push_back(instanceParameter);
 		}
 	}
 
 	bool CanSingleRendering()
 	{
-		return m_instanceCount <= 1 && materialType_ == ::Effekseer::RendererMaterialType::Default && fasterSngleRingModeEnabled_;
+		return !isInstanced_ && m_instanceCount <= 1 && materialType_ == ::Effekseer::RendererMaterialType::Default && fasterSngleRingModeEnabled_;
 	}
 
-	template <typename VERTEX, bool FLIP_RGB>
-	void Rendering_Internal(const efkRingNodeParam& parameter,
-							const efkRingInstanceParam& instanceParameter,
-							void* userData,
-							const ::Effekseer::SIMD::Mat44f& camera)
+	::Effekseer::SIMD::Mat43f CalcRingMatrix(const efkRingNodeParam& parameter,
+											  const efkRingInstanceParam& instanceParameter,
+											  const ::Effekseer::SIMD::Mat44f& camera)
 	{
 		::Effekseer::SIMD::Mat43f mat43;
 
@@ -257,14 +265,7 @@ protected:
 								 parameter.DepthParameterPtr,
 								 parameter.IsRightHand);
 
-			if (CanSingleRendering())
-			{
-				mat43 = ::Effekseer::SIMD::Mat43f::Scaling(s) * mat43;
-			}
-			else
-			{
-				mat43 = ::Effekseer::SIMD::Mat43f::Scaling(s) * mat43;
-			}
+			mat43 = ::Effekseer::SIMD::Mat43f::Scaling(s) * mat43;
 		}
 		else if (parameter.Billboard == ::Effekseer::BillboardType::Fixed)
 		{
@@ -282,6 +283,71 @@ protected:
 								 parameter.IsRightHand);
 		}
 
+		return mat43;
+	}
+
+	template <bool FLIP_RGB>
+	void Rendering_Instanced(const efkRingNodeParam& parameter,
+							 const efkRingInstanceParam& instanceParameter,
+							 const ::Effekseer::SIMD::Mat44f& camera)
+	{
+		auto& instance = *reinterpret_cast<SimpleRingInstance*>(m_ringBufferData);
+
+		const auto mat43 = CalcRingMatrix(parameter, instanceParameter, camera);
+		Effekseer::SIMD::Float4::Store4(instance.Matrix[0].data(), mat43.X);
+		Effekseer::SIMD::Float4::Store4(instance.Matrix[1].data(), mat43.Y);
+		Effekseer::SIMD::Float4::Store4(instance.Matrix[2].data(), mat43.Z);
+
+		const float outerRadius = instanceParameter.OuterLocation.GetX();
+		const float innerRadius = instanceParameter.InnerLocation.GetX();
+		const float outerHeight = instanceParameter.OuterLocation.GetY();
+		const float innerHeight = instanceParameter.InnerLocation.GetY();
+
+		instance.Radiuses[0] = outerRadius;
+		instance.Radiuses[1] = innerRadius + (outerRadius - innerRadius) * instanceParameter.CenterRatio;
+		instance.Radiuses[2] = innerRadius;
+		instance.Radiuses[3] = static_cast<float>(parameter.VertexCount);
+
+		instance.Heights[0] = outerHeight;
+		instance.Heights[1] = innerHeight + (outerHeight - innerHeight) * instanceParameter.CenterRatio;
+		instance.Heights[2] = innerHeight;
+		instance.Heights[3] = 0.0f;
+
+		instance.Angles[0] = (instanceParameter.ViewingAngleStart + 90) / 180.0f * 3.141592f;
+		instance.Angles[1] = instanceParameter.ViewingAngleEnd - instanceParameter.ViewingAngleStart;
+		instance.Angles[2] = parameter.StartingFade;
+		instance.Angles[3] = parameter.EndingFade;
+
+		instance.Colors[0] = instanceParameter.OuterColor;
+		instance.Colors[1] = instanceParameter.CenterColor;
+		instance.Colors[2] = instanceParameter.InnerColor;
+		instance.Colors[3] = ::Effekseer::Color();
+
+		if (FLIP_RGB)
+		{
+			for (auto& color : instance.Colors)
+			{
+				std::swap(color.R, color.B);
+			}
+		}
+
+		instance.UV[0] = instanceParameter.UV.X;
+		instance.UV[1] = instanceParameter.UV.Y;
+		instance.UV[2] = instanceParameter.UV.Width;
+		instance.UV[3] = instanceParameter.UV.Height;
+
+		m_spriteCount++;
+		m_ringBufferData += stride_;
+	}
+
+	template <typename VERTEX, bool FLIP_RGB>
+	void Rendering_Internal(const efkRingNodeParam& parameter,
+							const efkRingInstanceParam& instanceParameter,
+							void* userData,
+							const ::Effekseer::SIMD::Mat44f& camera)
+	{
+		const auto mat43 = CalcRingMatrix(parameter, instanceParameter, camera);
+
 		int32_t singleVertexCount = parameter.VertexCount * 8;
 		// Vertex* verteies = (Vertex*)m_renderer->GetVertexBuffer()->GetBufferDirect( sizeof(Vertex) * vertexCount );
 
@@ -722,33 +788,26 @@ protected:
 
 		if (param.DepthParameterPtr->ZSort != Effekseer::ZSortType::None && !CanSingleRendering())
 		{
-			for (auto& kv : instances_)
+			Effekseer::SIMD::Vec3f frontDirection = m_renderer->GetCameraFrontDirection();
+			if (!param.IsRightHand)
 			{
-				efkVector3D t = kv.Value.SRTMatrix43.GetTranslation();
-
-				Effekseer::SIMD::Vec3f frontDirection = m_renderer->GetCameraFrontDirection();
-				if (!param.IsRightHand)
-				{
-					frontDirection.SetZ(-frontDirection.GetZ());
-				}
-
-				kv.Key = Effekseer::SIMD::Vec3f::Dot(t, frontDirection);
+				frontDirection.SetZ(-frontDirection.GetZ());
 			}
 
-			if (param.DepthParameterPtr->ZSort == Effekseer::ZSortType::NormalOrder)
+			sorter_.Resize(static_cast<int32_t>(instances_.size()));
+			for (size_t i = 0; i < instances_.size(); i++)
 			{
-				std::sort(instances_.begin(), instances_.end(), [](const KeyValue& a, const KeyValue& b) -> bool { return a.Key < b.Key; });
-			}
-			else
-			{
-				std::sort(instances_.begin(), instances_.end(), [](const KeyValue& a, const KeyValue& b) -> bool { return a.Key > b.Key; });
+				efkVector3D t = instances_[i].SRTMatrix43.GetTranslation();
+				sorter_.SetKey(static_cast<int32_t>(i), Effekseer::SIMD::Vec3f::Dot(t, frontDirection));
 			}
 
+			sorter_.Sort(param.DepthParameterPtr->ZSort != Effekseer::ZSortType::NormalOrder);
+
 			const auto& state = m_renderer->GetStandardRenderer()->GetState();
 
-			for (auto& kv : instances_)
+			for (int32_t i = 0; i < sorter_.GetCount(); i++)
 			{
-				RenderingInstance(kv.Value, param, state, camera);
+				RenderingInstance(instances_[sorter_.GetIndex(i)], param, state, camera);
 			}
 		}
 	}
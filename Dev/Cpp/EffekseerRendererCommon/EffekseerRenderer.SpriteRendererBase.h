@@ -13,6 +13,7 @@
 
 #include "EffekseerRenderer.CommonUtils.h"
 #include "EffekseerRenderer.IndexBufferBase.h"
+#include "EffekseerRenderer.RadixSorter.h"
 #include "EffekseerRenderer.RenderStateBase.h"
 #include "EffekseerRenderer.StandardRenderer.h"
 #include "EffekseerRenderer.VertexBufferBase.h"
@@ -33,21 +34,30 @@ template <typename RENDERER, bool FLIP_RGB_FLAG>
 class SpriteRendererBase : public ::Effekseer::SpriteRenderer, public ::Effekseer::SIMD::AlignedAllocationPolicy<16>
 {
 protected:
+	//! a layout of vertices which are written for a sprite
+	struct VertexLayout
+	{
+		RendererShaderType ShaderType = RendererShaderType::Unlit;
+		SpriteInstanceType Instance = SpriteInstanceType::None;
+		int32_t Stride = 0;
+		int32_t CustomData1Count = 0;
+		int32_t CustomData2Count = 0;
+
+		//! get a size of vertices or an instance which are written for a sprite
+		int32_t GetSpriteSize() const
+		{
+			return Instance != SpriteInstanceType::None ? Stride : Stride * 4;
+		}
+	};
+
 	RENDERER* m_renderer;
 	int32_t m_spriteCount;
 	uint8_t* m_ringBufferData;
 
-	struct KeyValue
-	{
-		float Key;
-		efkSpriteInstanceParam Value;
-	};
-
-	Effekseer::CustomAlignedVector<KeyValue> instances;
+	Effekseer::CustomAlignedVector<efkSpriteInstanceParam> instances;
+	RadixSorter sorter_;
 	int32_t vertexCount_ = 0;
-	int32_t stride_ = 0;
-	int32_t customData1Count_ = 0;
-	int32_t customData2Count_ = 0;
+	VertexLayout layout_;
 
 public:
 	SpriteRendererBase(RENDERER* renderer)
@@ -64,44 +74,65 @@ public:
 	}
 
 protected:
-	void RenderingInstance(const efkSpriteInstanceParam& instanceParameter,
-						   const efkSpriteNodeParam& parameter,
-						   const StandardRendererState& state,
-						   const ::Effekseer::SIMD::Mat44f& camera)
+	//! write vertices or an instance of a sprite into a buffer
+	void WriteSprite(uint8_t* data,
+					 const VertexLayout& layout,
+					 const efkSpriteInstanceParam& instanceParameter,
+					 const efkSpriteNodeParam& parameter,
+					 const ::Effekseer::SIMD::Mat44f& camera) const
 	{
-		void* userData = nullptr;
-		const ShaderParameterCollector& collector = state.Collector;
-		if (collector.ShaderType == RendererShaderType::Material)
+		if (layout.Instance == SpriteInstanceType::Simple)
+		{
+			Rendering_Instanced<SimpleSpriteInstance, FLIP_RGB_FLAG>(data, parameter, instanceParameter, camera);
+		}
+		else if (layout.Instance == SpriteInstanceType::WithCorners)
+		{
+			Rendering_Instanced<SimpleSpriteInstanceWithCorners, FLIP_RGB_FLAG>(data, parameter, instanceParameter, camera);
+		}
+		else if (layout.ShaderType == RendererShaderType::Material)
 		{
-			Rendering_Internal<DynamicVertex, FLIP_RGB_FLAG>(parameter, instanceParameter, userData, camera);
+			Rendering_Internal<DynamicVertex, FLIP_RGB_FLAG>(data, layout, parameter, instanceParameter, camera);
 		}
-		else if (collector.ShaderType == RendererShaderType::AdvancedLit)
+		else if (layout.ShaderType == RendererShaderType::AdvancedLit)
 		{
-			Rendering_Internal<AdvancedLightingVertex, FLIP_RGB_FLAG>(parameter, instanceParameter, userData, camera);
+			Rendering_Internal<AdvancedLightingVertex, FLIP_RGB_FLAG>(data, layout, parameter, instanceParameter, camera);
 		}
-		else if (collector.ShaderType == RendererShaderType::AdvancedBackDistortion)
+		else if (layout.ShaderType == RendererShaderType::AdvancedBackDistortion)
 		{
-			Rendering_Internal<AdvancedLightingVertex, FLIP_RGB_FLAG>(parameter, instanceParameter, userData, camera);
+			Rendering_Internal<AdvancedLightingVertex, FLIP_RGB_FLAG>(data, layout, parameter, instanceParameter, camera);
 		}
-		else if (collector.ShaderType == RendererShaderType::AdvancedUnlit)
+		else if (layout.ShaderType == RendererShaderType::AdvancedUnlit)
 		{
-			Rendering_Internal<AdvancedSimpleVertex, FLIP_RGB_FLAG>(parameter, instanceParameter, userData, camera);
+			Rendering_Internal<AdvancedSimpleVertex, FLIP_RGB_FLAG>(data, layout, parameter, instanceParameter, camera);
 		}
-		else if (collector.ShaderType == RendererShaderType::Lit)
+		else if (layout.ShaderType == RendererShaderType::Lit)
 		{
-			Rendering_Internal<LightingVertex, FLIP_RGB_FLAG>(parameter, instanceParameter, userData, camera);
+			Rendering_Internal<LightingVertex, FLIP_RGB_FLAG>(data, layout, parameter, instanceParameter, camera);
 		}
-		else if (collector.ShaderType == RendererShaderType::BackDistortion)
+		else if (layout.ShaderType == RendererShaderType::BackDistortion)
 		{
-			Rendering_Internal<LightingVertex, FLIP_RGB_FLAG>(parameter, instanceParameter, userData, camera);
+			Rendering_Internal<LightingVertex, FLIP_RGB_FLAG>(data, layout, parameter, instanceParameter, camera);
 		}
 		else
 		{
-			Rendering_Internal<SimpleVertex, FLIP_RGB_FLAG>(parameter, instanceParameter, userData, camera);
+			Rendering_Internal<SimpleVertex, FLIP_RGB_FLAG>(data, layout, parameter, instanceParameter, camera);
 		}
 	}
 
-	void BeginRendering_(RENDERER* renderer, int32_t count, const efkSpriteNodeParam& param)
+	void RenderingInstance(const efkSpriteInstanceParam& instanceParameter,
+						   const efkSpriteNodeParam& parameter,
+						   const ::Effekseer::SIMD::Mat44f& camera)
+	{
+		if (m_ringBufferData == nullptr)
+			return;
+
+		WriteSprite(m_ringBufferData, layout_, instanceParameter, parameter, camera);
+		m_ringBufferData += layout_.GetSpriteSize();
+		m_spriteCount++;
+	}
+
+	//! create a state of a node. It doesn't change this renderer
+	StandardRendererState CreateState(const efkSpriteNodeParam& param) const
 	{
 		EffekseerRenderer::StandardRendererState state;
 		state.AlphaBlend = param.BasicParameterPtr->AlphaBlend;
@@ -144,12 +175,38 @@ protected:
 			param.EffectPointer,
 			param.BasicParameterPtr);
 
-		customData1Count_ = state.CustomData1Count;
-		customData2Count_ = state.CustomData2Count;
+		// a quad is expanded by a vertex shader if a backend supports it
+		if (SupportInstancedDrawing<RENDERER>::Value &&
+			m_renderer->GetImpl()->isSpriteInstancingEnabled &&
+			state.Collector.ShaderType == RendererShaderType::Unlit &&
+			m_renderer->GetRenderMode() == Effekseer::RenderMode::Normal)
+		{
+			state.SpriteInstance = param.HasUniformCorners ? SpriteInstanceType::Simple : SpriteInstanceType::WithCorners;
+		}
+
+		return state;
+	}
+
+	static VertexLayout GetVertexLayout(const StandardRendererState& state)
+	{
+		VertexLayout layout;
+		layout.ShaderType = state.Collector.ShaderType;
+		layout.Instance = state.SpriteInstance;
+		layout.Stride = state.CalculateStride();
+		layout.CustomData1Count = state.CustomData1Count;
+		layout.CustomData2Count = state.CustomData2Count;
+		return layout;
+	}
+
+	void BeginRendering_(RENDERER* renderer, int32_t count, const efkSpriteNodeParam& param)
+	{
+		const auto state = CreateState(param);
+		layout_ = GetVertexLayout(state);
 
 		renderer->GetStandardRenderer()->UpdateStateAndRenderingIfRequired(state);
 
-		renderer->GetStandardRenderer()->BeginRenderingAndRenderingIfRequired(count * 4, stride_, (void*&)m_ringBufferData);
+		renderer->GetStandardRenderer()->BeginRenderingAndRenderingIfRequired(
+			state.SpriteInstance != SpriteInstanceType::None ? count : count * 4, layout_.Stride, (void*&)m_ringBufferData);
 		m_spriteCount = 0;
 
 		vertexCount_ = count * 4;
@@ -164,29 +221,22 @@ protected:
 	{
 		if (parameter.ZSort == Effekseer::ZSortType::None)
 		{
-			auto camera = m_renderer->GetCameraMatrix();
-			const auto& state = m_renderer->GetStandardRenderer()->GetState();
-
-			RenderingInstance(instanceParameter, parameter, state, camera);
+			RenderingInstance(instanceParameter, parameter, camera);
 		}
 		else
 		{
-			KeyValue kv;
-			kv.Value = instanceParameter;
-			instances.push_back(kv);
+			instances.push_back(instanceParameter);
 		}
 	}
 
 	template <typename VERTEX, bool FLIP_RGB>
-	void Rendering_Internal(const efkSpriteNodeParam& parameter,
+	void Rendering_Internal(uint8_t* data,
+							const VertexLayout& layout,
+							const efkSpriteNodeParam& parameter,
 							const efkSpriteInstanceParam& instanceParameter,
-							void* userData,
-							const ::Effekseer::SIMD::Mat44f& camera)
+							const ::Effekseer::SIMD::Mat44f& camera) const
 	{
-		if (m_ringBufferData == nullptr)
-			return;
-
-		StrideView<VERTEX> verteies(m_ringBufferData, stride_, 4);
+		StrideView<VERTEX> verteies(data, layout.Stride, 4);
 
 		for (int i = 0; i < 4; i++)
 		{
@@ -274,7 +324,7 @@ protected:
 
 		if (VertexUV2Required<VERTEX>())
 		{
-			StrideView<VERTEX> vs(verteies.pointerOrigin_, stride_, 4);
+			StrideView<VERTEX> vs(verteies.pointerOrigin_, layout.Stride, 4);
 			vs[0].SetUV2(0.0f, 1.0f);
 			vs[1].SetUV2(1.0f, 1.0f);
 			vs[2].SetUV2(0.0f, 0.0f);
@@ -325,7 +375,7 @@ protected:
 					F = -F;
 				}
 
-				StrideView<VERTEX> vs(verteies.pointerOrigin_, stride_, 4);
+				StrideView<VERTEX> vs(verteies.pointerOrigin_, layout.Stride, 4);
 				for (auto i = 0; i < 4; i++)
 				{
 					vs[i].SetPackedNormal(PackVector3DF(F));
@@ -356,7 +406,7 @@ protected:
 
 				if (VertexNormalRequired<VERTEX>())
 				{
-					StrideView<VERTEX> vs(verteies.pointerOrigin_, stride_, 4);
+					StrideView<VERTEX> vs(verteies.pointerOrigin_, layout.Stride, 4);
 					auto tangentX = efkVector3D(mat.X.GetX(), mat.Y.GetX(), mat.Z.GetX());
 					auto tangentZ = efkVector3D(mat.X.GetZ(), mat.Y.GetZ(), mat.Z.GetZ());
 					tangentX = tangentX.Normalize();
@@ -374,62 +424,192 @@ protected:
 		}
 
 		// custom parameter
-		if (customData1Count_ > 0)
+		if (layout.CustomData1Count > 0)
 		{
-			StrideView<float> custom(m_ringBufferData + sizeof(DynamicVertex), stride_, 4);
+			StrideView<float> custom(data + sizeof(DynamicVertex), layout.Stride, 4);
 			for (int i = 0; i < 4; i++)
 			{
 				auto c = (float*)(&custom[i]);
-				memcpy(c, instanceParameter.CustomData1.data(), sizeof(float) * customData1Count_);
+				memcpy(c, instanceParameter.CustomData1.data(), sizeof(float) * layout.CustomData1Count);
 			}
 		}
 
-		if (customData2Count_ > 0)
+		if (layout.CustomData2Count > 0)
 		{
-			StrideView<float> custom(m_ringBufferData + sizeof(DynamicVertex) + sizeof(float) * customData1Count_, stride_, 4);
+			StrideView<float> custom(data + sizeof(DynamicVertex) + sizeof(float) * layout.CustomData1Count, layout.Stride, 4);
 			for (int i = 0; i < 4; i++)
 			{
 				auto c = (float*)(&custom[i]);
-				memcpy(c, instanceParameter.CustomData2.data(), sizeof(float) * customData2Count_);
+				memcpy(c, instanceParameter.CustomData2.data(), sizeof(float) * layout.CustomData2Count);
 			}
 		}
+	}
 
-		m_ringBufferData += (stride_ * 4);
-		m_spriteCount++;
+	template <bool FLIP_RGB>
+	static void SetInstanceColors(SimpleSpriteInstance& instance, const efkSpriteInstanceParam& instanceParameter)
+	{
+		// corners have the same color
+		instance.Color = instanceParameter.Colors[0];
+
+		if (FLIP_RGB)
+		{
+			std::swap(instance.Color.R, instance.Color.B);
+		}
 	}
 
-	void EndRendering_(RENDERER* renderer, const efkSpriteNodeParam& param)
+	template <bool FLIP_RGB>
+	static void SetInstanceColors(SimpleSpriteInstanceWithCorners& instance, const efkSpriteInstanceParam& instanceParameter)
 	{
-		if (param.ZSort != Effekseer::ZSortType::None)
+		for (int i = 0; i < 4; i++)
 		{
-			for (auto& kv : instances)
+			instance.Colors[i] = instanceParameter.Colors[i];
+
+			if (FLIP_RGB)
 			{
-				efkVector3D t = kv.Value.SRTMatrix43.GetTranslation();
+				std::swap(instance.Colors[i].R, instance.Colors[i].B);
+			}
+		}
+	}
 
-				auto frontDirection = m_renderer->GetCameraFrontDirection();
-				if (!param.IsRightHand)
-				{
-					frontDirection.Z = -frontDirection.Z;
-				}
+	static void SetInstanceAxisUV(SimpleSpriteInstance& instance, const Effekseer::SIMD::Float4& axisUV)
+	{
+		// corners are placed at a parallelogram
+	}
 
-				kv.Key = Effekseer::SIMD::Vec3f::Dot(t, frontDirection);
-			}
+	static void SetInstanceAxisUV(SimpleSpriteInstanceWithCorners& instance, const Effekseer::SIMD::Float4& axisUV)
+	{
+		Effekseer::SIMD::Float4::Store3(instance.AxisUV.data(), axisUV);
+	}
+
+	template <typename INSTANCE, bool FLIP_RGB>
+	void Rendering_Instanced(uint8_t* data,
+							 const efkSpriteNodeParam& parameter,
+							 const efkSpriteInstanceParam& instanceParameter,
+							 const ::Effekseer::SIMD::Mat44f& camera) const
+	{
+		auto& instance = *reinterpret_cast<INSTANCE*>(data);
+
+		SetInstanceColors<FLIP_RGB>(instance, instanceParameter);
+
+		instance.UV[0] = instanceParameter.UV.X;
+		instance.UV[1] = instanceParameter.UV.Y;
+		instance.UV[2] = instanceParameter.UV.Width;
+		instance.UV[3] = instanceParameter.UV.Height;
+
+		Effekseer::SIMD::Mat43f mat;
+		float scaleX = 1.0f;
+		float scaleY = 1.0f;
 
-			if (param.ZSort == Effekseer::ZSortType::NormalOrder)
+		if (parameter.Billboard == ::Effekseer::BillboardType::Billboard ||
+			parameter.Billboard == ::Effekseer::BillboardType::RotatedBillboard ||
+			parameter.Billboard == ::Effekseer::BillboardType::YAxisFixed)
+		{
+			mat = Effekseer::SIMD::Mat43f::Identity;
+			Effekseer::SIMD::Vec3f s;
+			Effekseer::SIMD::Vec3f R;
+			Effekseer::SIMD::Vec3f F;
+
+			if (parameter.EnableViewOffset == true)
 			{
-				std::sort(instances.begin(), instances.end(), [](const KeyValue& a, const KeyValue& b) -> bool { return a.Key < b.Key; });
+				Effekseer::SIMD::Mat43f instMat = instanceParameter.SRTMatrix43;
+
+				ApplyViewOffset(instMat, camera, instanceParameter.ViewOffsetDistance);
+
+				CalcBillboard(parameter.Billboard, mat, s, R, F, instMat, m_renderer->GetCameraFrontDirection());
 			}
 			else
 			{
-				std::sort(instances.begin(), instances.end(), [](const KeyValue& a, const KeyValue& b) -> bool { return a.Key > b.Key; });
+				CalcBillboard(parameter.Billboard, mat, s, R, F, instanceParameter.SRTMatrix43, m_renderer->GetCameraFrontDirection());
 			}
 
-			for (auto& kv : instances)
+			scaleX = s.GetX();
+			scaleY = s.GetY();
+
+			ApplyDepthParameters(mat,
+								 m_renderer->GetCameraFrontDirection(),
+								 m_renderer->GetCameraPosition(),
+								 s,
+								 parameter.DepthParameterPtr,
+								 parameter.IsRightHand);
+		}
+		else
+		{
+			mat = instanceParameter.SRTMatrix43;
+
+			if (parameter.EnableViewOffset == true)
 			{
-				auto camera = m_renderer->GetCameraMatrix();
-				const auto& state = renderer->GetStandardRenderer()->GetState();
+				ApplyViewOffset(mat, camera, instanceParameter.ViewOffsetDistance);
+			}
+
+			ApplyDepthParameters(mat,
+								 m_renderer->GetCameraFrontDirection(),
+								 m_renderer->GetCameraPosition(),
+								 parameter.DepthParameterPtr,
+								 parameter.IsRightHand);
+		}
+
+		// a corner (u, v) is p0 + u * (p1 - p0) + v * (p2 - p0) + u * v * (p3 - p2 - p1 + p0)
+		std::array<float, 4> xs;
+		std::array<float, 4> ys;
+		for (int i = 0; i < 4; i++)
+		{
+			xs[i] = instanceParameter.Positions[i].GetX() * scaleX;
+			ys[i] = instanceParameter.Positions[i].GetY() * scaleY;
+		}
+
+		const Effekseer::SIMD::Mat43f cornerMat(xs[1] - xs[0],
+												ys[1] - ys[0],
+												0.0f,
+												xs[2] - xs[0],
+												ys[2] - ys[0],
+												0.0f,
+												xs[3] - xs[2] - xs[1] + xs[0],
+												ys[3] - ys[2] - ys[1] + ys[0],
+												0.0f,
+												xs[0],
+												ys[0],
+												0.0f);
+
+		// rows of cornerMat * mat are axes of u, v and u * v and a position
+		auto transform = cornerMat * mat;
+		auto position = Effekseer::SIMD::Float4::SetZero();
+		Effekseer::SIMD::Float4::Transpose(transform.X, transform.Y, transform.Z, position);
+		Effekseer::SIMD::Float4::Store3(instance.AxisU.data(), transform.X);
+		Effekseer::SIMD::Float4::Store3(instance.AxisV.data(), transform.Y);
+		Effekseer::SIMD::Float4::Store3(instance.Position.data(), position);
+		SetInstanceAxisUV(instance, transform.Z);
+	}
+
+	//! sort instances by depths if it is required
+	void SortInstances(RadixSorter& sorter, const efkSpriteInstanceParam* instanceParameters, int32_t count, const efkSpriteNodeParam& param) const
+	{
+		auto frontDirection = m_renderer->GetCameraFrontDirection();
+		if (!param.IsRightHand)
+		{
+			frontDirection.Z = -frontDirection.Z;
+		}
+
+		sorter.Resize(count);
+		for (int32_t i = 0; i < count; i++)
+		{
+			efkVector3D t = instanceParameters[i].SRTMatrix43.GetTranslation();
+			sorter.SetKey(i, Effekseer::SIMD::Vec3f::Dot(t, frontDirection));
+		}
 
-				RenderingInstance(kv.Value, param, state, camera);
+		sorter.Sort(param.ZSort != Effekseer::ZSortType::NormalOrder);
+	}
+
+	void EndRendering_(RENDERER* renderer, const efkSpriteNodeParam& param)
+	{
+		if (param.ZSort != Effekseer::ZSortType::None)
+		{
+			SortInstances(sorter_, instances.data(), static_cast<int32_t>(instances.size()), param);
+
+			auto camera = m_renderer->GetCameraMatrix();
+
+			for (int32_t i = 0; i < sorter_.GetCount(); i++)
+			{
+				RenderingInstance(instances[sorter_.GetIndex(i)], param, camera);
 			}
 		}
 	}
@@ -451,6 +631,60 @@ public:
 	{
 		EndRendering_(m_renderer, parameter);
 	}
+
+	int32_t WriteVertices(const efkSpriteNodeParam& parameter,
+						  const efkSpriteInstanceParam* instanceParameters,
+						  int32_t count,
+						  Effekseer::CustomAlignedVector<uint8_t>& vertices) const override
+	{
+		const auto layout = GetVertexLayout(CreateState(parameter));
+		const auto spriteSize = layout.GetSpriteSize();
+		const auto offset = vertices.size();
+		auto camera = m_renderer->GetCameraMatrix();
+
+		if (parameter.ZSort == Effekseer::ZSortType::None)
+		{
+			// the same number of sprites as Rendering
+			count = Effekseer::Min(count, m_renderer->GetSquareMaxCount());
+			vertices.resize(offset + count * spriteSize);
+
+			for (int32_t i = 0; i < count; i++)
+			{
+				WriteSprite(vertices.data() + offset + i * spriteSize, layout, instanceParameters[i], parameter, camera);
+			}
+		}
+		else
+		{
+			RadixSorter sorter;
+			SortInstances(sorter, instanceParameters, count, parameter);
+			vertices.resize(offset + count * spriteSize);
+
+			for (int32_t i = 0; i < count; i++)
+			{
+				WriteSprite(vertices.data() + offset + i * spriteSize, layout, instanceParameters[sorter.GetIndex(i)], parameter, camera);
+			}
+		}
+
+		return layout.Stride;
+	}
+
+	bool RenderingVertices(const efkSpriteNodeParam& parameter, const void* vertices, int32_t size, int32_t stride, void* userData) override
+	{
+		if (stride != layout_.Stride || m_spriteCount != 0 || !instances.empty())
+		{
+			return false;
+		}
+
+		if (m_ringBufferData == nullptr)
+		{
+			return true;
+		}
+
+		memcpy(m_ringBufferData, vertices, size);
+		m_ringBufferData += size;
+		m_spriteCount += size / layout_.GetSpriteSize();
+		return true;
+	}
 };
 //----------------------------------------------------------------------------------
 //
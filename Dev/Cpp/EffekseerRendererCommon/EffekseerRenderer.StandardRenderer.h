@@ -21,6 +21,64 @@ namespace EffekseerRenderer
 //
 //----------------------------------------------------------------------------------
 
+/**
+	@brief	whether can a renderer draw SimpleSpriteInstance, SimpleSpriteInstanceWithCorners and SimpleRingInstance
+	@note
+	A renderer which specializes it as true must have DrawSpritesInstanced and DrawRingsInstanced.
+	Even if it is true, sprites and rings are drawn as instances only when Renderer::Impl enables it at runtime.
+*/
+template <typename RENDERER>
+class SupportInstancedDrawing
+{
+public:
+	static const bool Value = false;
+};
+
+template <typename RENDERER>
+using enable_if_support_instanced_drawing_t = typename std::enable_if<SupportInstancedDrawing<RENDERER>::Value, std::nullptr_t>::type;
+
+template <typename RENDERER>
+using enable_ifnot_support_instanced_drawing_t = typename std::enable_if<!SupportInstancedDrawing<RENDERER>::Value, std::nullptr_t>::type;
+
+template <typename RENDERER, enable_if_support_instanced_drawing_t<RENDERER> = nullptr>
+void DrawSpritesInstanced(RENDERER* renderer, int32_t spriteCount, int32_t instanceOffset)
+{
+	renderer->DrawSpritesInstanced(spriteCount, instanceOffset);
+}
+
+template <typename RENDERER, enable_ifnot_support_instanced_drawing_t<RENDERER> = nullptr>
+void DrawSpritesInstanced(RENDERER* renderer, int32_t spriteCount, int32_t instanceOffset)
+{
+	// SpriteRendererBase doesn't write instances for this renderer
+	assert(false);
+}
+
+template <typename RENDERER, enable_if_support_instanced_drawing_t<RENDERER> = nullptr>
+void DrawRingsInstanced(RENDERER* renderer, int32_t ringVertexCount, int32_t ringCount, int32_t instanceOffset)
+{
+	renderer->DrawRingsInstanced(ringVertexCount, ringCount, instanceOffset);
+}
+
+template <typename RENDERER, enable_ifnot_support_instanced_drawing_t<RENDERER> = nullptr>
+void DrawRingsInstanced(RENDERER* renderer, int32_t ringVertexCount, int32_t ringCount, int32_t instanceOffset)
+{
+	// RingRendererBase doesn't write instances for this renderer
+	assert(false);
+}
+
+//! a type of instances which sprites are written as
+enum class SpriteInstanceType : int32_t
+{
+	//! 4 vertices per sprite
+	None,
+
+	//! SimpleSpriteInstance
+	Simple,
+
+	//! SimpleSpriteInstanceWithCorners
+	WithCorners,
+};
+
 struct StandardRendererState
 {
 	bool DepthTest;
@@ -56,6 +114,12 @@ struct StandardRendererState
 	float SoftParticleDistanceNearOffset = 0.0f;
 	float Maginification = 1.0f;
 
+	//! a type of instances which sprites are written as instead of 4 vertices
+	SpriteInstanceType SpriteInstance = SpriteInstanceType::None;
+
+	//! the number of segments of rings which are written as SimpleRingInstance, 0 means rings are written as vertices
+	int32_t RingInstanceVertexCount = 0;
+
 	::Effekseer::RendererMaterialType MaterialType;
 	int32_t MaterialUniformCount = 0;
 	std::array<std::array<float, 4>, 16> MaterialUniforms;
@@ -105,6 +169,58 @@ struct StandardRendererState
 		UserData.Reset();
 	}
 
+	//! get a size of a vertex or an instance which is written with this state
+	int32_t CalculateStride() const
+	{
+		if (SpriteInstance == SpriteInstanceType::Simple)
+		{
+			return static_cast<int32_t>(sizeof(SimpleSpriteInstance));
+		}
+
+		if (SpriteInstance == SpriteInstanceType::WithCorners)
+		{
+			return static_cast<int32_t>(sizeof(SimpleSpriteInstanceWithCorners));
+		}
+
+		if (RingInstanceVertexCount > 0)
+		{
+			return static_cast<int32_t>(sizeof(SimpleRingInstance));
+		}
+
+		size_t stride = 0;
+		if (Collector.ShaderType == RendererShaderType::Material)
+		{
+			stride = sizeof(DynamicVertex);
+			stride += (CustomData1Count + CustomData2Count) * sizeof(float);
+		}
+		else if (Collector.ShaderType == RendererShaderType::Lit)
+		{
+			stride = sizeof(LightingVertex);
+		}
+		else if (Collector.ShaderType == RendererShaderType::BackDistortion)
+		{
+			stride = sizeof(LightingVertex);
+		}
+		else if (Collector.ShaderType == RendererShaderType::Unlit)
+		{
+			stride = sizeof(SimpleVertex);
+		}
+		else if (Collector.ShaderType == RendererShaderType::AdvancedLit)
+		{
+			stride = sizeof(AdvancedLightingVertex);
+		}
+		else if (Collector.ShaderType == RendererShaderType::AdvancedBackDistortion)
+		{
+			stride = sizeof(AdvancedLightingVertex);
+		}
+		else if (Collector.ShaderType == RendererShaderType::AdvancedUnlit)
+		{
+			stride = sizeof(AdvancedSimpleVertex);
+		}
+
+		return static_cast<int32_t>(stride);
+	}
+
 	bool operator!=(const StandardRendererState state)
 	{
 		if (Collector != state.Collector)
@@ -168,6 +284,12 @@ struct StandardRendererState
 		if (Maginification != state.Maginification)
 			return true;
 
+		if (SpriteInstance != state.SpriteInstance)
+			return true;
+
+		if (RingInstanceVertexCount != state.RingInstanceVertexCount)
+			return true;
+
 		if (MaterialType != state.MaterialType)
 			return true;
 		if (MaterialUniformCount != state.MaterialUniformCount)
@@ -264,9 +386,16 @@ private:
 
 	StandardRendererState m_state;
 
+	//! vertices are cached here if a vertex buffer can't be written directly
 	std::vector<uint8_t> vertexCaches;
 	int32_t squareMaxSize_ = 0;
-	RendererShaderType renderingMode_ = RendererShaderType::Unlit;
+
+	//! a region of a vertex buffer which vertices are written into directly
+	bool isVertexBufferLocked_ = false;
+	uint8_t* lockedVertexData_ = nullptr;
+	int32_t lockedVertexOffset_ = 0;
+	int32_t lockedVertexSize_ = 0;
+	int32_t writtenVertexSize_ = 0;
 
 	void ColorToFloat4(::Effekseer::Color color, float fc[4])
 	{
@@ -296,38 +425,13 @@ public:
 
 	int32_t CalculateCurrentStride() const
 	{
-		size_t stride = 0;
-		if (renderingMode_ == RendererShaderType::Material)
-		{
-			stride = sizeof(DynamicVertex);
-			stride += (m_state.CustomData1Count + m_state.CustomData2Count) * sizeof(float);
-		}
-		else if (renderingMode_ == RendererShaderType::Lit)
-		{
-			stride = sizeof(LightingVertex);
-		}
-		else if (renderingMode_ == RendererShaderType::BackDistortion)
-		{
-			stride = sizeof(LightingVertex);
-		}
-		else if (renderingMode_ == RendererShaderType::Unlit)
-		{
-			stride = sizeof(SimpleVertex);
-		}
-		else if (renderingMode_ == RendererShaderType::AdvancedLit)
-		{
-			stride = sizeof(AdvancedLightingVertex);
-		}
-		else if (renderingMode_ == RendererShaderType::AdvancedBackDistortion)
-		{
-			stride = sizeof(AdvancedLightingVertex);
-		}
-		else if (renderingMode_ == RendererShaderType::AdvancedUnlit)
-		{
-			stride = sizeof(AdvancedSimpleVertex);
-		}
+		return m_state.CalculateStride();
+	}
 
-		return static_cast<int32_t>(stride);
+	//! get the number of elements which are written for a sprite
+	int32_t GetElementCountPerSprite() const
+	{
+		return (m_state.SpriteInstance != SpriteInstanceType::None || m_state.RingInstanceVertexCount > 0) ? 1 : 4;
 	}
 
 	void UpdateStateAndRenderingIfRequired(StandardRendererState state)
@@ -338,26 +442,55 @@ public:
 		}
 
 		m_state = state;
-
-		renderingMode_ = m_state.Collector.ShaderType;
 	}
 
+	/**
+		@brief	allocate elements to be written
+		@param	count	[in]	the number of vertices, or the number of sprites or rings if they are instanced
+	*/
 	void BeginRenderingAndRenderingIfRequired(int32_t count, int& stride, void*& data)
 	{
 		stride = CalculateCurrentStride();
 
-		{
-			int32_t renderVertexMaxSize = squareMaxSize_ * stride * 4;
+		const int32_t elementCountPerSprite = GetElementCountPerSprite();
+		const int32_t size = count * stride;
+		const int32_t renderVertexMaxSize = squareMaxSize_ * stride * elementCountPerSprite;
 
-			if (count * stride + (int32_t)vertexCaches.size() > renderVertexMaxSize)
+		if (isVertexBufferLocked_)
+		{
+			if (writtenVertexSize_ + size > Effekseer::Min(lockedVertexSize_, renderVertexMaxSize))
 			{
 				Rendering();
 			}
+		}
+		else if (size + (int32_t)vertexCaches.size() > renderVertexMaxSize)
+		{
+			Rendering();
+		}
+
+		// vertices are written into a vertex buffer directly if a backend supports it
+		if (!isVertexBufferLocked_ && vertexCaches.size() == 0 && size <= renderVertexMaxSize)
+		{
+			void* vbData = nullptr;
+			if (m_renderer->GetVertexBuffer()->RingBufferLockRest(size, lockedVertexOffset_, vbData, lockedVertexSize_, stride * elementCountPerSprite))
+			{
+				assert(vbData != nullptr);
+				isVertexBufferLocked_ = true;
+				lockedVertexData_ = static_cast<uint8_t*>(vbData);
+				writtenVertexSize_ = 0;
+			}
+		}
 
-			auto old = vertexCaches.size();
-			vertexCaches.resize(count * stride + vertexCaches.size());
-			data = (vertexCaches.data() + old);
+		if (isVertexBufferLocked_)
+		{
+			data = lockedVertexData_ + writtenVertexSize_;
+			writtenVertexSize_ += size;
+			return;
 		}
+
+		auto old = vertexCaches.size();
+		vertexCaches.resize(size + vertexCaches.size());
+		data = (vertexCaches.data() + old);
 	}
 
 	void ResetAndRenderingIfRequired()
@@ -375,10 +508,11 @@ public:
 
 	void Rendering(const Effekseer::SIMD::Mat44f& mCamera, const Effekseer::SIMD::Mat44f& mProj)
 	{
-		if (vertexCaches.size() == 0)
+		if (!isVertexBufferLocked_ && vertexCaches.size() == 0)
 			return;
 
 		int32_t stride = CalculateCurrentStride();
+		int32_t elementCountPerSprite = GetElementCountPerSprite();
 
 		int32_t passNum = 1;
 
@@ -391,6 +525,27 @@ public:
 			}
 		}
 
+		if (isVertexBufferLocked_)
+		{
+			const int32_t writtenSize = writtenVertexSize_;
+
+			m_renderer->GetVertexBuffer()->UnlockRest(writtenSize);
+			isVertexBufferLocked_ = false;
+			lockedVertexData_ = nullptr;
+			writtenVertexSize_ = 0;
+
+			if (writtenSize == 0)
+				return;
+
+			// all passes are drawn with the same region because written vertices don't exceed the maximum size
+			for (int32_t passInd = 0; passInd < passNum; passInd++)
+			{
+				Rendering_(mCamera, mProj, lockedVertexOffset_, writtenSize, stride, passInd);
+			}
+
+			return;
+		}
+
 		for (int32_t passInd = 0; passInd < passNum; passInd++)
 		{
 			int32_t offset = 0;
@@ -400,15 +555,19 @@ public:
 				// only sprite
 				int32_t renderBufferSize = (int32_t)vertexCaches.size() - offset;
 
-				int32_t renderVertexMaxSize = squareMaxSize_ * stride * 4;
+				int32_t renderVertexMaxSize = squareMaxSize_ * stride * elementCountPerSprite;
 
 				if (renderBufferSize > renderVertexMaxSize)
 				{
 					renderBufferSize =
-						(Effekseer::Min(renderVertexMaxSize, (int32_t)vertexCaches.size() - offset) / (stride * 4)) * (stride * 4);
+						(Effekseer::Min(renderVertexMaxSize, (int32_t)vertexCaches.size() - offset) / (stride * elementCountPerSprite)) * (stride * elementCountPerSprite);
 				}
 
-				Rendering_(mCamera, mProj, offset, renderBufferSize, stride, passInd);
+				int32_t vbOffset = 0;
+				if (UploadVertexCaches(offset, renderBufferSize, stride * elementCountPerSprite, vbOffset))
+				{
+					Rendering_(mCamera, mProj, vbOffset, renderBufferSize, stride, passInd);
+				}
 
 				offset += renderBufferSize;
 
@@ -420,10 +579,27 @@ public:
 		vertexCaches.clear();
 	}
 
+	bool UploadVertexCaches(int32_t bufferOffset, int32_t bufferSize, int32_t alignment, int32_t& vbOffset)
+	{
+		VertexBufferBase* vb = m_renderer->GetVertexBuffer();
+
+		void* vbData = nullptr;
+
+		if (vb->RingBufferLock(bufferSize, vbOffset, vbData, alignment))
+		{
+			assert(vbData != nullptr);
+			memcpy(vbData, vertexCaches.data() + bufferOffset, bufferSize);
+			vb->Unlock();
+			return true;
+		}
+
+		return false;
+	}
+
 	void Rendering_(const Effekseer::SIMD::Mat44f& mCamera,
 					const Effekseer::SIMD::Mat44f& mProj,
-					int32_t bufferOffset,
-					int32_t bufferSize,
+					int32_t vbOffset,
+					int32_t vertexSize,
 					int32_t stride,
 					int32_t renderPass)
 	{
@@ -469,25 +645,6 @@ public:
 			textures[m_state.Collector.DepthIndex] = depthTexture;
 		}
 
-		int32_t vertexSize = bufferSize;
-		int32_t vbOffset = 0;
-		{
-			VertexBufferBase* vb = m_renderer->GetVertexBuffer();
-
-			void* vbData = nullptr;
-
-			if (vb->RingBufferLock(vertexSize, vbOffset, vbData, stride * 4))
-			{
-				assert(vbData != nullptr);
-				memcpy(vbData, vertexCaches.data() + bufferOffset, vertexSize);
-				vb->Unlock();
-			}
-			else
-			{
-				return;
-			}
-		}
-
 		SHADER* shader_ = nullptr;
 
 		bool distortion = m_state.Distortion;
@@ -521,6 +678,18 @@ public:
 			if (shader_ == nullptr)
 				return;
 		}
+		else if (m_state.SpriteInstance == SpriteInstanceType::Simple)
+		{
+			shader_ = m_renderer->GetShader(RendererShaderType::UnlitSpriteInstanced);
+		}
+		else if (m_state.SpriteInstance == SpriteInstanceType::WithCorners)
+		{
+			shader_ = m_renderer->GetShader(RendererShaderType::UnlitSpriteCornersInstanced);
+		}
+		else if (m_state.RingInstanceVertexCount > 0)
+		{
+			shader_ = m_renderer->GetShader(RendererShaderType::UnlitRingInstanced);
+		}
 		else
 		{
 			shader_ = m_renderer->GetShader(m_state.Collector.ShaderType);
@@ -834,7 +1003,18 @@ public:
 		m_renderer->SetIndexBuffer(m_renderer->GetIndexBuffer());
 		m_renderer->SetLayout(shader_);
 		m_renderer->GetImpl()->CurrentRenderingUserData = m_state.UserData;
-		m_renderer->DrawSprites(vertexSize / stride / 4, vbOffset / stride);
+		if (m_state.SpriteInstance != SpriteInstanceType::None)
+		{
+			DrawSpritesInstanced(m_renderer, vertexSize / stride, vbOffset / stride);
+		}
+		else if (m_state.RingInstanceVertexCount > 0)
+		{
+			DrawRingsInstanced(m_renderer, m_state.RingInstanceVertexCount, vertexSize / stride, vbOffset / stride);
+		}
+		else
+		{
+			m_renderer->DrawSprites(vertexSize / stride / 4, vbOffset / stride);
+		}
 
 		m_renderer->EndShader(shader_);
 
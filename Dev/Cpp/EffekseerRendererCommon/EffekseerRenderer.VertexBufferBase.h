@@ -39,6 +39,28 @@ public:
 	virtual bool TryRingBufferLock(int32_t size, int32_t& offset, void*& data, int32_t alignment) = 0;
 
 	virtual void Unlock() = 0;
+
+	/**
+		@brief	lock the rest of a ring buffer to write vertices into it directly without a cache
+		@param	minSize	[in]	a size which must be locked at least. The ring buffer is rewound if the rest is smaller than it.
+		@param	offset	[out]	an offset of a locked region
+		@param	data	[out]	a locked region. It is valid until UnlockRest is called.
+		@param	size	[out]	a size of a locked region
+		@return	false if a backend doesn't support it. Vertices must be copied with RingBufferLock in this case.
+	*/
+	virtual bool RingBufferLockRest(int32_t /*minSize*/, int32_t& /*offset*/, void*& /*data*/, int32_t& /*size*/, int32_t /*alignment*/)
+	{
+		return false;
+	}
+
+	/**
+		@brief	unlock a buffer locked with RingBufferLockRest
+		@param	writtenSize	[in]	a size actually written from the beginning of a locked region. The rest is returned to the ring buffer.
+	*/
+	virtual void UnlockRest(int32_t /*writtenSize*/)
+	{
+	}
+
 	virtual void Push(const void* buffer, int size);
 	virtual int GetMaxSize() const;
 	virtual int GetSize() const;
@@ -25,6 +25,28 @@ TextureLoader::~TextureLoader()
 }
 
 Effekseer::TextureRef TextureLoader::Load(const char16_t* path, ::Effekseer::TextureType textureType)
+{
+	::Effekseer::Backend::TextureParameter param;
+	if (!Decode(path, textureType, param))
+	{
+		return nullptr;
+	}
+
+	return Create(param);
+}
+
+Effekseer::TextureRef TextureLoader::Load(const void* data, int32_t size, Effekseer::TextureType textureType, bool isMipMapEnabled)
+{
+	::Effekseer::Backend::TextureParameter param;
+	if (!Decode(data, size, textureType, isMipMapEnabled, param))
+	{
+		return nullptr;
+	}
+
+	return Create(param);
+}
+
+bool TextureLoader::Decode(const char16_t* path, ::Effekseer::TextureType textureType, ::Effekseer::Backend::TextureParameter& param)
 {
 	std::unique_ptr<::Effekseer::FileReader> reader(m_fileInterface->OpenRead(path));
 
@@ -37,108 +59,79 @@ Effekseer::TextureRef TextureLoader::Load(const char16_t* path, ::Effekseer::Tex
 		std::vector<uint8_t> fileData(fileSize);
 		reader->Read(fileData.data(), fileSize);
 
-		auto texture = Load(fileData.data(), static_cast<int32_t>(fileSize), textureType, isMipEnabled);
-		return texture;
+		return Decode(fileData.data(), static_cast<int32_t>(fileSize), textureType, isMipEnabled, param);
 	}
 
-	return nullptr;
+	return false;
 }
 
-Effekseer::TextureRef TextureLoader::Load(const void* data, int32_t size, Effekseer::TextureType textureType, bool isMipMapEnabled)
+bool TextureLoader::Decode(const void* data, int32_t size, ::Effekseer::TextureType textureType, bool isMipMapEnabled, ::Effekseer::Backend::TextureParameter& param)
 {
 	auto size_texture = size;
 	auto data_texture = (uint8_t*)data;
 
+	// decoders are not shared because textures are decoded on multiple threads
+	::Effekseer::Backend::TextureFormatType format;
+	if (colorSpaceType_ == ::Effekseer::ColorSpaceType::Linear && textureType == Effekseer::TextureType::Color)
+	{
+		format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM_SRGB;
+	}
+	else
+	{
+		format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM;
+	}
+
 	if (size_texture < 4)
 	{
 	}
 	else if (data_texture[1] == 'P' && data_texture[2] == 'N' && data_texture[3] == 'G')
 	{
-		if (pngTextureLoader_.Load(data_texture, size_texture, false))
+		::EffekseerRenderer::PngTextureLoader pngTextureLoader;
+		if (pngTextureLoader.Load(data_texture, size_texture, false))
 		{
-			// Newbackend
-			{
-				::Effekseer::Backend::TextureFormatType format;
-				if (colorSpaceType_ == ::Effekseer::ColorSpaceType::Linear && textureType == Effekseer::TextureType::Color)
-				{
-					format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM_SRGB;
-				}
-				else
-				{
-					format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM;
-				}
-
-				::Effekseer::Backend::TextureParameter param;
-				param.Size[0] = pngTextureLoader_.GetWidth();
-				param.Size[1] = pngTextureLoader_.GetHeight();
-				param.Format = format;
-				param.GenerateMipmap = isMipMapEnabled;
-				param.InitialData.assign(pngTextureLoader_.GetData().begin(), pngTextureLoader_.GetData().end());
-
-				auto texture = ::Effekseer::MakeRefPtr<::Effekseer::Texture>();
-				texture->SetBackend(graphicsDevice_->CreateTexture(param));
-				return texture;
-			}
+			param.Size[0] = pngTextureLoader.GetWidth();
+			param.Size[1] = pngTextureLoader.GetHeight();
+			param.Format = format;
+			param.GenerateMipmap = isMipMapEnabled;
+			param.InitialData.assign(pngTextureLoader.GetData().begin(), pngTextureLoader.GetData().end());
+			return true;
 		}
 	}
 	else if (data_texture[0] == 'D' && data_texture[1] == 'D' && data_texture[2] == 'S' && data_texture[3] == ' ')
 	{
-		// Newbackend
-		if (ddsTextureLoader_.Load(data_texture, size_texture))
+		::EffekseerRenderer::DDSTextureLoader ddsTextureLoader;
+		if (ddsTextureLoader.Load(data_texture, size_texture))
 		{
-			::Effekseer::Backend::TextureFormatType format;
-			if (colorSpaceType_ == ::Effekseer::ColorSpaceType::Linear && textureType == Effekseer::TextureType::Color)
-			{
-				format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM_SRGB;
-			}
-			else
-			{
-				format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM;
-			}
-
-			::Effekseer::Backend::TextureParameter param;
-			param.Size[0] = ddsTextureLoader_.GetTextures().at(0).Width;
-			param.Size[1] = ddsTextureLoader_.GetTextures().at(0).Height;
-			param.Format = ddsTextureLoader_.GetBackendTextureFormat();
-			param.InitialData.assign(ddsTextureLoader_.GetTextures().at(0).Data.begin(), ddsTextureLoader_.GetTextures().at(0).Data.end());
+			param.Size[0] = ddsTextureLoader.GetTextures().at(0).Width;
+			param.Size[1] = ddsTextureLoader.GetTextures().at(0).Height;
+			param.Format = ddsTextureLoader.GetBackendTextureFormat();
+			param.InitialData.assign(ddsTextureLoader.GetTextures().at(0).Data.begin(), ddsTextureLoader.GetTextures().at(0).Data.end());
 			param.GenerateMipmap = false; // TODO : Support nomipmap
-
-			auto texture = ::Effekseer::MakeRefPtr<::Effekseer::Texture>();
-			texture->SetBackend(graphicsDevice_->CreateTexture(param));
-			return texture;
+			return true;
 		}
 	}
 	else
 	{
-		if (tgaTextureLoader_.Load(data_texture, size_texture) == true)
+		::EffekseerRenderer::TGATextureLoader tgaTextureLoader;
+		if (tgaTextureLoader.Load(data_texture, size_texture) == true)
 		{
-			// Newbackend
-			{
-				::Effekseer::Backend::TextureFormatType format;
-				if (colorSpaceType_ == ::Effekseer::ColorSpaceType::Linear && textureType == Effekseer::TextureType::Color)
-				{
-					format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM_SRGB;
-				}
-				else
-				{
-					format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM;
-				}
-
-				::Effekseer::Backend::TextureParameter param;
-				param.Size[0] = tgaTextureLoader_.GetWidth();
-				param.Size[1] = tgaTextureLoader_.GetHeight();
-				param.Format = format;
-				param.GenerateMipmap = isMipMapEnabled;
-				param.InitialData.assign(tgaTextureLoader_.GetData().begin(), tgaTextureLoader_.GetData().end());
-
-				auto texture = ::Effekseer::MakeRefPtr<::Effekseer::Texture>();
-				texture->SetBackend(graphicsDevice_->CreateTexture(param));
-				return texture;
-			}
+			param.Size[0] = tgaTextureLoader.GetWidth();
+			param.Size[1] = tgaTextureLoader.GetHeight();
+			param.Format = format;
+			param.GenerateMipmap = isMipMapEnabled;
+			param.InitialData.assign(tgaTextureLoader.GetData().begin(), tgaTextureLoader.GetData().end());
+			return true;
 		}
 	}
 
-	return nullptr;
+	return false;
+}
+
+Effekseer::TextureRef TextureLoader::Create(const ::Effekseer::Backend::TextureParameter& param)
+{
+	auto texture = ::Effekseer::MakeRefPtr<::Effekseer::Texture>();
+	texture->SetBackend(graphicsDevice_->CreateTexture(param));
+	return texture;
 }
 
 void TextureLoader::Unload(Effekseer::TextureRef data)
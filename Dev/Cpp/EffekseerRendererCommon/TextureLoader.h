@@ -19,11 +19,8 @@ private:
 	::Effekseer::DefaultFileInterface m_defaultFileInterface;
 	::Effekseer::ColorSpaceType colorSpaceType_;
 	::Effekseer::Backend::GraphicsDevice* graphicsDevice_ = nullptr;
-#ifdef __EFFEKSEER_RENDERER_INTERNAL_LOADER__
-	::EffekseerRenderer::PngTextureLoader pngTextureLoader_;
-	::EffekseerRenderer::DDSTextureLoader ddsTextureLoader_;
-	::EffekseerRenderer::TGATextureLoader tgaTextureLoader_;
-#endif
+
+	bool Decode(const void* data, int32_t size, ::Effekseer::TextureType textureType, bool isMipMapEnabled, ::Effekseer::Backend::TextureParameter& param);
 
 public:
 	TextureLoader(::Effekseer::Backend::GraphicsDevice* graphicsDevice,
@@ -36,6 +33,10 @@ public:
 
 	Effekseer::TextureRef Load(const void* data, int32_t size, Effekseer::TextureType textureType, bool isMipMapEnabled) override;
 
+	bool Decode(const char16_t* path, ::Effekseer::TextureType textureType, ::Effekseer::Backend::TextureParameter& param) override;
+
+	Effekseer::TextureRef Create(const ::Effekseer::Backend::TextureParameter& param) override;
+
 	void Unload(Effekseer::TextureRef data) override;
 };
 
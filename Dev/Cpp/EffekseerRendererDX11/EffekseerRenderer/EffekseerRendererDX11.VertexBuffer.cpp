@@ -179,6 +179,58 @@ void VertexBuffer::Unlock()
 	m_ringBufferLock = false;
 }
 
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+bool VertexBuffer::RingBufferLockRest(int32_t minSize, int32_t& offset, void*& data, int32_t& size, int32_t alignment)
+{
+	assert(!m_isLock);
+	assert(!m_ringBufferLock);
+	assert(this->m_isDynamic);
+
+	if (minSize > m_size)
+		return false;
+
+	m_vertexRingOffset = (m_vertexRingOffset + alignment - 1) / alignment * alignment;
+
+	if ((int32_t)m_vertexRingOffset + minSize > m_size)
+	{
+		m_vertexRingOffset = 0;
+	}
+
+	offset = m_vertexRingOffset;
+	size = m_size - offset;
+	m_ringLockedOffset = offset;
+	m_ringLockedSize = size;
+
+	data = (uint8_t*)m_lockedResource;
+	m_resource = (uint8_t*)m_lockedResource;
+	m_ringBufferLock = true;
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+void VertexBuffer::UnlockRest(int32_t writtenSize)
+{
+	assert(m_ringBufferLock);
+	assert(writtenSize <= m_ringLockedSize);
+
+	m_vertexRingOffset += writtenSize;
+	m_ringLockedSize = writtenSize;
+
+	if (writtenSize == 0)
+	{
+		m_resource = nullptr;
+		m_ringBufferLock = false;
+		return;
+	}
+
+	Unlock();
+}
+
 //-----------------------------------------------------------------------------------
 //
 //-----------------------------------------------------------------------------------
@@ -182,6 +182,51 @@ void VertexBuffer::Unlock()
 	m_ringBufferLock = false;
 }
 
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+bool VertexBuffer::RingBufferLockRest(int32_t minSize, int32_t& offset, void*& data, int32_t& size, int32_t alignment)
+{
+	assert(!m_isLock);
+	assert(!m_ringBufferLock);
+	assert(this->m_isDynamic);
+
+	if (minSize > m_size)
+		return false;
+
+	m_vertexRingOffset = (m_vertexRingOffset + alignment - 1) / alignment * alignment;
+
+	if ((int32_t)m_vertexRingOffset + minSize > m_size)
+	{
+		offset = 0;
+		size = m_size;
+		m_buffer->Lock(0, 0, reinterpret_cast<void**>(&data), D3DLOCK_DISCARD);
+	}
+	else
+	{
+		offset = m_vertexRingOffset;
+		size = m_size - offset;
+		m_buffer->Lock(offset, size, reinterpret_cast<void**>(&data), D3DLOCK_NOOVERWRITE);
+	}
+
+	m_vertexRingOffset = offset;
+	m_ringBufferLock = true;
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+void VertexBuffer::UnlockRest(int32_t writtenSize)
+{
+	assert(m_ringBufferLock);
+
+	m_vertexRingOffset += writtenSize;
+
+	Unlock();
+}
+
 //-----------------------------------------------------------------------------------
 //
 //-----------------------------------------------------------------------------------
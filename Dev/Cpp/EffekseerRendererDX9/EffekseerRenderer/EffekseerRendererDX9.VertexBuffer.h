@@ -46,6 +46,9 @@ public:
 	bool RingBufferLock(int32_t size, int32_t& offset, void*& data, int32_t alignment);
 	bool TryRingBufferLock(int32_t size, int32_t& offset, void*& data, int32_t alignment);
 	void Unlock();
+
+	bool RingBufferLockRest(int32_t minSize, int32_t& offset, void*& data, int32_t& size, int32_t alignment);
+	void UnlockRest(int32_t writtenSize);
 };
 
 //-----------------------------------------------------------------------------------
@@ -88,6 +88,8 @@ typedef void(EFK_STDCALL* FP_glDrawElementsInstanced)(GLenum mode,
 													  const void* indices,
 													  GLsizei primcount);
 
+typedef void(EFK_STDCALL* FP_glVertexAttribDivisor)(GLuint index, GLuint divisor);
+
 typedef void(EFK_STDCALL* FP_glCompressedTexImage2D)(
 	GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data);
 
@@ -149,6 +151,7 @@ static FP_glMapBufferRange g_glMapBufferRange = nullptr;
 static FP_glUnmapBuffer g_glUnmapBuffer = nullptr;
 
 static FP_glDrawElementsInstanced g_glDrawElementsInstanced = nullptr;
+static FP_glVertexAttribDivisor g_glVertexAttribDivisor = nullptr;
 
 static FP_glCompressedTexImage2D g_glCompressedTexImage2D = nullptr;
 
@@ -199,6 +202,7 @@ static bool g_isInitialized = false;
 static bool g_isSupportedVertexArray = false;
 static bool g_isSurrpotedBufferRange = false;
 static bool g_isSurrpotedMapBuffer = false;
+static bool g_isSupportedInstancedArrays = false;
 static OpenGLDeviceType g_deviceType = OpenGLDeviceType::OpenGL2;
 
 #if _WIN32
@@ -279,6 +283,9 @@ bool Initialize(OpenGLDeviceType deviceType)
 
 	GET_PROC(glDrawElementsInstanced);
 
+	// glVertexAttribDivisor is OpenGL 3.3, so its absence must not break older contexts
+	g_glVertexAttribDivisor = (FP_glVertexAttribDivisor)wglGetProcAddress("glVertexAttribDivisor");
+
 	GET_PROC(glCompressedTexImage2D);
 
 	GET_PROC(glGenFramebuffers);
@@ -294,6 +301,7 @@ bool Initialize(OpenGLDeviceType deviceType)
 	g_isSupportedVertexArray = (g_glGenVertexArrays && g_glDeleteVertexArrays && g_glBindVertexArray);
 	g_isSurrpotedBufferRange = (g_glMapBufferRange && g_glUnmapBuffer);
 	g_isSurrpotedMapBuffer = (g_glMapBuffer && g_glUnmapBuffer);
+	g_isSupportedInstancedArrays = (g_glDrawElementsInstanced && g_glVertexAttribDivisor);
 
 #endif
 
@@ -347,6 +355,7 @@ bool Initialize(OpenGLDeviceType deviceType)
 	{
 		g_isSupportedVertexArray = true;
 		g_isSurrpotedBufferRange = true;
+		g_isSupportedInstancedArrays = true;
 	}
 	if (deviceType == OpenGLDeviceType::OpenGL3)
 	{
@@ -374,6 +383,11 @@ bool IsSupportedMapBuffer()
 	return g_isSurrpotedMapBuffer;
 }
 
+bool IsSupportedInstancedArrays()
+{
+	return g_isSupportedInstancedArrays;
+}
+
 void MakeMapBufferInvalid()
 {
 	g_isSurrpotedMapBuffer = false;
@@ -797,6 +811,17 @@ void glDrawElementsInstanced(GLenum mode,
 #endif
 }
 
+void glVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+#if _WIN32
+	g_glVertexAttribDivisor(index, divisor);
+#elif defined(__EFFEKSEER_RENDERER_GLES2__)
+	return;
+#else
+	::glVertexAttribDivisor(index, divisor);
+#endif
+}
+
 void glCompressedTexImage2D(
 	GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data)
 {
@@ -119,6 +119,7 @@ namespace GLExt
 #define GL_RG16F 0x822f
 
 #define GL_HALF_FLOAT 0x140b
+#define GL_INT_2_10_10_10_REV 0x8D9F
 
 #define GL_RGBA16F 0x881a
 #define GL_RGBA32F 0x8814
@@ -171,6 +172,9 @@ bool IsSupportedVertexArray();
 bool IsSupportedBufferRange();
 bool IsSupportedMapBuffer();
 
+//! whether can per instance attributes be specified with glVertexAttribDivisor
+bool IsSupportedInstancedArrays();
+
 //! for some devices to avoid a bug
 void MakeMapBufferInvalid();
 
@@ -225,6 +229,8 @@ void glDrawElementsInstanced(GLenum mode,
 							 const void* indices,
 							 GLsizei primcount);
 
+void glVertexAttribDivisor(GLuint index, GLuint divisor);
+
 void glCompressedTexImage2D(
 	GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data);
 
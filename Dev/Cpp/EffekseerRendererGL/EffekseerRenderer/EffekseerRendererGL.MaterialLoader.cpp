@@ -227,7 +227,17 @@ static const int GL_InstanceCount = 10;
 			{"a_Color", GL_UNSIGNED_BYTE, 4, 56, true},
 		};
 
-		shader->GetAttribIdList(NumAttribs, g_model_attribs);
+		// ModelRenderer stores models as Effekseer::Model::PackedVertex on the same devices as instancing
+		static ShaderAttribInfo g_model_attribs_packed[NumAttribs] = {
+			{"a_Position", GL_FLOAT, 3, 0, false},
+			{"a_Normal", GL_INT_2_10_10_10_REV, 4, 12, true},
+			{"a_Binormal", GL_INT_2_10_10_10_REV, 4, 16, true},
+			{"a_Tangent", GL_INT_2_10_10_10_REV, 4, 20, true},
+			{"a_TexCoord", GL_HALF_FLOAT, 2, 24, false},
+			{"a_Color", GL_UNSIGNED_BYTE, 4, 28, true},
+		};
+
+		shader->GetAttribIdList(NumAttribs, instancing ? g_model_attribs_packed : g_model_attribs);
 
 		shader->AddVertexConstantLayout(
 			CONSTANT_TYPE_MATRIX44, shader->GetUniformId("ProjectionMatrix"), parameterGenerator.VertexProjectionMatrixOffset);
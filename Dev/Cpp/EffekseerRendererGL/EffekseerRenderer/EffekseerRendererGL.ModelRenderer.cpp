@@ -56,6 +56,16 @@ static ShaderAttribInfo g_model_attribs[NumAttribs_Model] = {
 	{"Input_Color", GL_UNSIGNED_BYTE, 4, 56, true},
 };
 
+//! a layout of Effekseer::Model::PackedVertex. Directions and uvs are decoded when they are fetched.
+static ShaderAttribInfo g_model_attribs_packed[NumAttribs_Model] = {
+	{"Input_Pos", GL_FLOAT, 3, 0, false},
+	{"Input_Normal", GL_INT_2_10_10_10_REV, 4, 12, true},
+	{"Input_Binormal", GL_INT_2_10_10_10_REV, 4, 16, true},
+	{"Input_Tangent", GL_INT_2_10_10_10_REV, 4, 20, true},
+	{"Input_UV", GL_HALF_FLOAT, 2, 24, false},
+	{"Input_Color", GL_UNSIGNED_BYTE, 4, 28, true},
+};
+
 template <int N>
 void ModelRenderer::InitRenderer()
 {
@@ -72,6 +82,8 @@ void ModelRenderer::InitRenderer()
 		m_va[i] = nullptr;
 	}
 
+	auto modelAttribs = isVertexPacked_ ? g_model_attribs_packed : g_model_attribs;
+
 	shader_ad_lit_->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererAdvancedVertexConstantBuffer<N>));
 	shader_ad_unlit_->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererAdvancedVertexConstantBuffer<N>));
 	shader_ad_distortion_->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererAdvancedVertexConstantBuffer<N>));
@@ -88,7 +100,7 @@ void ModelRenderer::InitRenderer()
 
 	for (auto& shader : {shader_ad_lit_, shader_lit_})
 	{
-		shader->GetAttribIdList(NumAttribs_Model, g_model_attribs);
+		shader->GetAttribIdList(NumAttribs_Model, modelAttribs);
 		shader->SetTextureSlot(0, shader->GetUniformId("Sampler_sampler_colorTex"));
 		shader->SetTextureSlot(1, shader->GetUniformId("Sampler_sampler_normalTex"));
 	}
@@ -98,7 +110,7 @@ void ModelRenderer::InitRenderer()
 
 	for (auto& shader : {shader_ad_unlit_, shader_unlit_})
 	{
-		shader->GetAttribIdList(NumAttribs_Model, g_model_attribs);
+		shader->GetAttribIdList(NumAttribs_Model, modelAttribs);
 		shader->SetTextureSlot(0, shader->GetUniformId("Sampler_sampler_colorTex"));
 	}
 	applyPSAdvancedRendererParameterTexture(shader_ad_unlit_, 1);
@@ -107,7 +119,7 @@ void ModelRenderer::InitRenderer()
 
 	for (auto& shader : {shader_ad_distortion_, shader_distortion_})
 	{
-		shader->GetAttribIdList(NumAttribs_Model, g_model_attribs);
+		shader->GetAttribIdList(NumAttribs_Model, modelAttribs);
 		shader->SetTextureSlot(0, shader->GetUniformId("Sampler_sampler_colorTex"));
 		shader->SetTextureSlot(1, shader->GetUniformId("Sampler_sampler_backTex"));
 	}
@@ -309,6 +321,7 @@ ModelRenderer::ModelRenderer(RendererImplemented* renderer,
 	if (renderer->GetDeviceType() == OpenGLDeviceType::OpenGL3 || renderer->GetDeviceType() == OpenGLDeviceType::OpenGLES3)
 	{
 		VertexType = EffekseerRenderer::ModelRendererVertexType::Instancing;
+		isVertexPacked_ = true;
 		InitRenderer<InstanceCount>();
 	}
 	else
@@ -493,7 +506,7 @@ void ModelRenderer::EndRendering(const efkModelNodeParam& parameter, void* userD
 		return;
 	}
 
-	model->StoreBufferToGPU(graphicsDevice_.Get());
+	model->StoreBufferToGPU(graphicsDevice_.Get(), isVertexPacked_);
 	if (!model->GetIsBufferStoredOnGPU())
 	{
 		return;
@@ -48,6 +48,9 @@ private:
 
 	Backend::GraphicsDeviceRef graphicsDevice_ = nullptr;
 
+	//! whether models are stored as Effekseer::Model::PackedVertex
+	bool isVertexPacked_ = false;
+
 	template <int N>
 	void InitRenderer();
 
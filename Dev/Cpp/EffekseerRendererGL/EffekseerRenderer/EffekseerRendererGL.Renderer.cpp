@@ -41,6 +41,10 @@
 #include "ShaderHeader/model_unlit_ps.h"
 #include "ShaderHeader/sprite_unlit_vs.h"
 
+#include "ShaderHeader/ring_unlit_instanced_vs.h"
+#include "ShaderHeader/sprite_unlit_corners_instanced_vs.h"
+#include "ShaderHeader/sprite_unlit_instanced_vs.h"
+
 #include "GraphicsDevice.h"
 
 namespace EffekseerRendererGL
@@ -149,6 +153,7 @@ RendererImplemented::RendererImplemented(int32_t squareMaxCount, Backend::Graphi
 RendererImplemented::~RendererImplemented()
 {
 	GetImpl()->DeleteProxyTextures(this);
+	GetImpl()->DeleteRingMeshes();
 
 	ES_SAFE_DELETE(m_distortingCallback);
 
@@ -161,6 +166,10 @@ RendererImplemented::~RendererImplemented()
 	ES_SAFE_DELETE(shader_ad_lit_);
 	ES_SAFE_DELETE(shader_ad_distortion_);
 
+	ES_SAFE_DELETE(shader_unlit_instanced_);
+	ES_SAFE_DELETE(shader_unlit_corners_instanced_);
+	ES_SAFE_DELETE(shader_ring_unlit_instanced_);
+
 	auto isVaoEnabled = vao_unlit_ != nullptr;
 
 	ES_SAFE_DELETE(vao_unlit_);
@@ -171,6 +180,10 @@ RendererImplemented::~RendererImplemented()
 	ES_SAFE_DELETE(vao_ad_lit_);
 	ES_SAFE_DELETE(vao_ad_distortion_);
 
+	ES_SAFE_DELETE(vao_unlit_instanced_);
+	ES_SAFE_DELETE(vao_unlit_corners_instanced_);
+	ES_SAFE_DELETE(vao_ring_unlit_instanced_);
+
 	ES_SAFE_DELETE(m_vao_wire_frame);
 
 	ES_SAFE_DELETE(m_renderState);
@@ -317,6 +330,23 @@ bool RendererImplemented::Initialize()
 
 	shader_lit_ = Shader::Create(GetIntetnalGraphicsDevice(), &lit_vs, 1, &lit_ps, 1, "Standard Lighting Tex", false, false);
 
+	// sprites and rings are expanded by a vertex shader only with OpenGL 3.x because gl_VertexID and instanced arrays are required
+	if ((GetDeviceType() == OpenGLDeviceType::OpenGL3 || GetDeviceType() == OpenGLDeviceType::OpenGLES3) &&
+		GLExt::IsSupportedVertexArray() && GLExt::IsSupportedInstancedArrays())
+	{
+		ShaderCodeView unlit_instanced_vs(get_sprite_unlit_instanced_vs(GetDeviceType()));
+		shader_unlit_instanced_ =
+			Shader::Create(GetIntetnalGraphicsDevice(), &unlit_instanced_vs, 1, &unlit_ps, 1, "Standard Tex Instanced", false, false);
+
+		ShaderCodeView unlit_corners_instanced_vs(get_sprite_unlit_corners_instanced_vs(GetDeviceType()));
+		shader_unlit_corners_instanced_ =
+			Shader::Create(GetIntetnalGraphicsDevice(), &unlit_corners_instanced_vs, 1, &unlit_ps, 1, "Standard Tex Corners Instanced", false, false);
+
+		ShaderCodeView ring_unlit_instanced_vs(get_ring_unlit_instanced_vs(GetDeviceType()));
+		shader_ring_unlit_instanced_ =
+			Shader::Create(GetIntetnalGraphicsDevice(), &ring_unlit_instanced_vs, 1, &unlit_ps, 1, "Standard Tex Ring Instanced", false, false);
+	}
+
 	auto applyPSAdvancedRendererParameterTexture = [](Shader* shader, int32_t offset) -> void {
 		shader->SetTextureSlot(0 + offset, shader->GetUniformId("Sampler_sampler_alphaTex"));
 		shader->SetTextureSlot(1 + offset, shader->GetUniformId("Sampler_sampler_uvDistortionTex"));
@@ -348,7 +378,63 @@ bool RendererImplemented::Initialize()
 	};
 	shader_unlit_->GetAttribIdList(3, sprite_attribs);
 
-	for (auto& shader : {shader_ad_unlit_, shader_unlit_})
+	// EffekseerRenderer::SimpleSpriteInstance
+	static ShaderAttribInfo sprite_attribs_instanced[5] = {
+		{"Input_Position", GL_FLOAT, 3, 0, false},
+		{"Input_AxisU", GL_FLOAT, 3, 12, false},
+		{"Input_AxisV", GL_FLOAT, 3, 24, false},
+		{"Input_Color", GL_UNSIGNED_BYTE, 4, 36, true},
+		{"Input_UV", GL_FLOAT, 4, 40, false},
+	};
+
+	// EffekseerRenderer::SimpleSpriteInstanceWithCorners
+	static ShaderAttribInfo sprite_attribs_corners_instanced[9] = {
+		{"Input_Position", GL_FLOAT, 3, 0, false},
+		{"Input_AxisU", GL_FLOAT, 3, 12, false},
+		{"Input_AxisV", GL_FLOAT, 3, 24, false},
+		{"Input_AxisUV", GL_FLOAT, 3, 36, false},
+		{"Input_Color0", GL_UNSIGNED_BYTE, 4, 48, true},
+		{"Input_Color1", GL_UNSIGNED_BYTE, 4, 52, true},
+		{"Input_Color2", GL_UNSIGNED_BYTE, 4, 56, true},
+		{"Input_Color3", GL_UNSIGNED_BYTE, 4, 60, true},
+		{"Input_UV", GL_FLOAT, 4, 64, false},
+	};
+
+	// EffekseerRenderer::SimpleRingInstance
+	static ShaderAttribInfo ring_attribs_instanced[10] = {
+		{"Input_Matrix0", GL_FLOAT, 4, 0, false},
+		{"Input_Matrix1", GL_FLOAT, 4, 16, false},
+		{"Input_Matrix2", GL_FLOAT, 4, 32, false},
+		{"Input_Radiuses", GL_FLOAT, 4, 48, false},
+		{"Input_Heights", GL_FLOAT, 4, 64, false},
+		{"Input_Angles", GL_FLOAT, 4, 80, false},
+		{"Input_Color0", GL_UNSIGNED_BYTE, 4, 96, true},
+		{"Input_Color1", GL_UNSIGNED_BYTE, 4, 100, true},
+		{"Input_Color2", GL_UNSIGNED_BYTE, 4, 104, true},
+		{"Input_UV", GL_FLOAT, 4, 112, false},
+	};
+
+	std::vector<Shader*> unlitShaders = {shader_ad_unlit_, shader_unlit_};
+
+	if (shader_unlit_instanced_ != nullptr)
+	{
+		shader_unlit_instanced_->GetAttribIdList(5, sprite_attribs_instanced);
+		unlitShaders.emplace_back(shader_unlit_instanced_);
+	}
+
+	if (shader_unlit_corners_instanced_ != nullptr)
+	{
+		shader_unlit_corners_instanced_->GetAttribIdList(9, sprite_attribs_corners_instanced);
+		unlitShaders.emplace_back(shader_unlit_corners_instanced_);
+	}
+
+	if (shader_ring_unlit_instanced_ != nullptr)
+	{
+		shader_ring_unlit_instanced_->GetAttribIdList(10, ring_attribs_instanced);
+		unlitShaders.emplace_back(shader_ring_unlit_instanced_);
+	}
+
+	for (auto& shader : unlitShaders)
 	{
 		shader->SetVertexConstantBufferSize(sizeof(EffekseerRenderer::StandardRendererVertexBuffer));
 		shader->SetPixelConstantBufferSize(sizeof(EffekseerRenderer::PixelConstantBuffer));
@@ -374,6 +460,26 @@ bool RendererImplemented::Initialize()
 	vao_unlit_ = VertexArray::Create(graphicsDevice_, shader_unlit_, GetVertexBuffer(), GetIndexBuffer());
 	vao_ad_unlit_ = VertexArray::Create(graphicsDevice_, shader_ad_unlit_, GetVertexBuffer(), GetIndexBuffer());
 
+	if (shader_unlit_instanced_ != nullptr)
+	{
+		shader_unlit_instanced_->SetTextureSlot(1, shader_unlit_instanced_->GetUniformId("Sampler_sampler_depthTex"));
+
+		// buffers and attributes are specified for each draw call because an offset of instances changes
+		vao_unlit_instanced_ = VertexArray::Create(graphicsDevice_, shader_unlit_instanced_, nullptr, nullptr);
+	}
+
+	if (shader_unlit_corners_instanced_ != nullptr)
+	{
+		shader_unlit_corners_instanced_->SetTextureSlot(1, shader_unlit_corners_instanced_->GetUniformId("Sampler_sampler_depthTex"));
+		vao_unlit_corners_instanced_ = VertexArray::Create(graphicsDevice_, shader_unlit_corners_instanced_, nullptr, nullptr);
+	}
+
+	if (shader_ring_unlit_instanced_ != nullptr)
+	{
+		shader_ring_unlit_instanced_->SetTextureSlot(1, shader_ring_unlit_instanced_->GetUniformId("Sampler_sampler_depthTex"));
+		vao_ring_unlit_instanced_ = VertexArray::Create(graphicsDevice_, shader_ring_unlit_instanced_, nullptr, nullptr);
+	}
+
 	// Distortion
 	EffekseerRendererGL::ShaderAttribInfo sprite_attribs_normal_ad[11] = {
 		{"Input_Pos", GL_FLOAT, 3, 0, false},
@@ -474,6 +580,8 @@ bool RendererImplemented::Initialize()
 	GLExt::glBindBuffer(GL_ARRAY_BUFFER, arrayBufferBinding);
 	GLExt::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementArrayBufferBinding);
 	GetImpl()->isSoftParticleEnabled = GetDeviceType() == OpenGLDeviceType::OpenGL3 || GetDeviceType() == OpenGLDeviceType::OpenGLES3;
+	GetImpl()->isSpriteInstancingEnabled = vao_unlit_instanced_ != nullptr && vao_unlit_corners_instanced_ != nullptr;
+	GetImpl()->isRingInstancingEnabled = vao_ring_unlit_instanced_ != nullptr;
 
 	if (GLExt::IsSupportedVertexArray())
 	{
@@ -497,6 +605,21 @@ bool RendererImplemented::Initialize()
 		shader_ad_unlit_->SetIsTransposeEnabled(true);
 		shader_ad_lit_->SetIsTransposeEnabled(true);
 		shader_ad_distortion_->SetIsTransposeEnabled(true);
+
+		if (shader_unlit_instanced_ != nullptr)
+		{
+			shader_unlit_instanced_->SetIsTransposeEnabled(true);
+		}
+
+		if (shader_unlit_corners_instanced_ != nullptr)
+		{
+			shader_unlit_corners_instanced_->SetIsTransposeEnabled(true);
+		}
+
+		if (shader_ring_unlit_instanced_ != nullptr)
+		{
+			shader_ring_unlit_instanced_->SetIsTransposeEnabled(true);
+		}
 	}
 
 	return true;
@@ -873,6 +996,11 @@ void RendererImplemented::SetIndexBuffer(const Effekseer::Backend::IndexBufferRe
 {
 	auto ib = static_cast<Backend::IndexBuffer*>(indexBuffer.Get());
 	SetIndexBuffer(ib->GetBuffer());
+
+	if (m_currentVertexArray == nullptr || m_currentVertexArray->GetIndexBuffer() == nullptr)
+	{
+		indexBufferCurrentStride_ = ib->GetStrideType() == Effekseer::Backend::IndexBufferStrideType::Stride4 ? 4 : 2;
+	}
 }
 
 //----------------------------------------------------------------------------------
@@ -926,6 +1054,42 @@ void RendererImplemented::DrawSprites(int32_t spriteCount, int32_t vertexOffset)
 	GLCheckError();
 }
 
+void RendererImplemented::DrawSpritesInstanced(int32_t spriteCount, int32_t instanceOffset)
+{
+	GLCheckError();
+
+	impl->drawcallCount++;
+	impl->drawvertexCount += spriteCount * 4;
+
+	GLsizei stride = GL_UNSIGNED_SHORT;
+	if (indexBufferCurrentStride_ == 4)
+	{
+		stride = GL_UNSIGNED_INT;
+	}
+
+	// the first quad of the index buffer is drawn for each instance
+	currentShader->SetInstancedVertex(instanceOffset);
+	GLExt::glDrawElementsInstanced(GL_TRIANGLES, 6, stride, nullptr, spriteCount);
+
+	GLCheckError();
+}
+
+void RendererImplemented::DrawRingsInstanced(int32_t ringVertexCount, int32_t ringCount, int32_t instanceOffset)
+{
+	GLCheckError();
+
+	const auto& mesh = GetImpl()->GetRingMesh(this, ringVertexCount);
+
+	impl->drawcallCount++;
+	impl->drawvertexCount += mesh.VertexCount * ringCount;
+
+	SetIndexBuffer(mesh.IndexBuffer);
+	currentShader->SetInstancedVertex(instanceOffset);
+	GLExt::glDrawElementsInstanced(GL_TRIANGLES, mesh.IndexCount, GL_UNSIGNED_INT, nullptr, ringCount);
+
+	GLCheckError();
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -936,7 +1100,7 @@ void RendererImplemented::DrawPolygon(int32_t vertexCount, int32_t indexCount)
 	impl->drawcallCount++;
 	impl->drawvertexCount += vertexCount;
 
-	glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+	glDrawElements(GL_TRIANGLES, indexCount, indexBufferCurrentStride_ == 4 ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT, nullptr);
 
 	GLCheckError();
 }
@@ -948,7 +1112,7 @@ void RendererImplemented::DrawPolygonInstanced(int32_t vertexCount, int32_t inde
 	impl->drawcallCount++;
 	impl->drawvertexCount += vertexCount * instanceCount;
 
-	GLExt::glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, instanceCount);
+	GLExt::glDrawElementsInstanced(GL_TRIANGLES, indexCount, indexBufferCurrentStride_ == 4 ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT, nullptr, instanceCount);
 
 	GLCheckError();
 }
@@ -979,6 +1143,18 @@ Shader* RendererImplemented::GetShader(::EffekseerRenderer::RendererShaderType t
 	{
 		return shader_unlit_;
 	}
+	else if (type == ::EffekseerRenderer::RendererShaderType::UnlitSpriteInstanced)
+	{
+		return shader_unlit_instanced_;
+	}
+	else if (type == ::EffekseerRenderer::RendererShaderType::UnlitSpriteCornersInstanced)
+	{
+		return shader_unlit_corners_instanced_;
+	}
+	else if (type == ::EffekseerRenderer::RendererShaderType::UnlitRingInstanced)
+	{
+		return shader_ring_unlit_instanced_;
+	}
 
 	return shader_unlit_;
 }
@@ -1019,6 +1195,18 @@ void RendererImplemented::BeginShader(Shader* shader)
 	{
 		SetVertexArray(vao_ad_lit_);
 	}
+	else if (shader != nullptr && shader == shader_unlit_instanced_)
+	{
+		SetVertexArray(vao_unlit_instanced_);
+	}
+	else if (shader != nullptr && shader == shader_unlit_corners_instanced_)
+	{
+		SetVertexArray(vao_unlit_corners_instanced_);
+	}
+	else if (shader != nullptr && shader == shader_ring_unlit_instanced_)
+	{
+		SetVertexArray(vao_ring_unlit_instanced_);
+	}
 	else if (m_currentVertexArray != nullptr)
 	{
 		SetVertexArray(m_currentVertexArray);
@@ -62,6 +62,11 @@ private:
 	Shader* shader_ad_lit_ = nullptr;
 	Shader* shader_ad_distortion_ = nullptr;
 
+	//! they are nullptr when a device cannot draw sprites and rings as instances
+	Shader* shader_unlit_instanced_ = nullptr;
+	Shader* shader_unlit_corners_instanced_ = nullptr;
+	Shader* shader_ring_unlit_instanced_ = nullptr;
+
 	Shader* currentShader = nullptr;
 
 	EffekseerRenderer::StandardRenderer<RendererImplemented, Shader>* m_standardRenderer;
@@ -72,6 +77,9 @@ private:
 	VertexArray* vao_ad_unlit_ = nullptr;
 	VertexArray* vao_ad_lit_ = nullptr;
 	VertexArray* vao_ad_distortion_ = nullptr;
+	VertexArray* vao_unlit_instanced_ = nullptr;
+	VertexArray* vao_unlit_corners_instanced_ = nullptr;
+	VertexArray* vao_ring_unlit_instanced_ = nullptr;
 
 	VertexArray* m_vao_wire_frame = nullptr;
 
@@ -204,6 +212,8 @@ public:
 
 	void SetLayout(Shader* shader);
 	void DrawSprites(int32_t spriteCount, int32_t vertexOffset);
+	void DrawSpritesInstanced(int32_t spriteCount, int32_t instanceOffset);
+	void DrawRingsInstanced(int32_t ringVertexCount, int32_t ringCount, int32_t instanceOffset);
 	void DrawPolygon(int32_t vertexCount, int32_t indexCount);
 	void DrawPolygonInstanced(int32_t vertexCount, int32_t indexCount, int32_t instanceCount);
 
@@ -269,6 +279,20 @@ void AssignDistortionPixelConstantBuffer(Shader* shader);
 //
 //----------------------------------------------------------------------------------
 } // namespace EffekseerRendererGL
+
+namespace EffekseerRenderer
+{
+
+//! OpenGL 3.x draws sprites and rings as instances
+template <>
+class SupportInstancedDrawing<EffekseerRendererGL::RendererImplemented>
+{
+public:
+	static const bool Value = true;
+};
+
+} // namespace EffekseerRenderer
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
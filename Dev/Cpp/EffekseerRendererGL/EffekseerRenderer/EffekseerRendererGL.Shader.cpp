@@ -549,6 +549,25 @@ void Shader::SetVertex()
 	}
 }
 
+void Shader::SetInstancedVertex(int32_t instanceOffset)
+{
+	const auto baseOffset = static_cast<size_t>(instanceOffset) * m_vertexSize;
+
+	for (size_t i = 0; i < m_aid.size(); i++)
+	{
+		if (m_aid[i] >= 0)
+		{
+			GLExt::glVertexAttribPointer(m_aid[i],
+										 m_layout[i].count,
+										 m_layout[i].type,
+										 m_layout[i].normalized,
+										 m_vertexSize,
+										 reinterpret_cast<GLvoid*>(baseOffset + m_layout[i].offset));
+			GLExt::glVertexAttribDivisor(m_aid[i], 1);
+		}
+	}
+}
+
 //-----------------------------------------------------------------------------------
 //
 //-----------------------------------------------------------------------------------
@@ -190,6 +190,12 @@ public:
 	void DisableAttribs();
 	void SetVertex();
 
+	/**
+		@brief	specify attributes which advance once per instance
+		@param	instanceOffset	an index of the first instance in a bound vertex buffer
+	*/
+	void SetInstancedVertex(int32_t instanceOffset);
+
 	void SetVertexConstantBufferSize(int32_t size) override;
 	void SetPixelConstantBufferSize(int32_t size) override;
 
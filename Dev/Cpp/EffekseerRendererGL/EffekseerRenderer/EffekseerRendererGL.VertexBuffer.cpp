@@ -230,6 +230,62 @@ void VertexBuffer::Unlock()
 	m_ringBufferLock = false;
 }
 
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+bool VertexBuffer::RingBufferLockRest(int32_t minSize, int32_t& offset, void*& data, int32_t& size, int32_t alignment)
+{
+	assert(!m_isLock);
+	assert(!m_ringBufferLock);
+	assert(this->m_isDynamic);
+
+	if (minSize > m_size)
+		return false;
+
+	m_vertexRingOffset = (m_vertexRingOffset + alignment - 1) / alignment * alignment;
+
+#ifdef __ANDROID__
+	if (true)
+#else
+	if ((int32_t)m_vertexRingOffset + minSize > m_size)
+#endif
+	{
+		m_vertexRingOffset = 0;
+	}
+
+	// vertices are written into m_resource directly and only written ones are uploaded in UnlockRest
+	offset = m_vertexRingOffset;
+	size = m_size - offset;
+	data = m_resource;
+
+	m_vertexRingStart = offset;
+	m_offset = size;
+
+	m_ringBufferLock = true;
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+void VertexBuffer::UnlockRest(int32_t writtenSize)
+{
+	assert(m_ringBufferLock);
+	assert(writtenSize <= m_offset);
+
+	m_vertexRingOffset += writtenSize;
+	m_offset = writtenSize;
+
+	if (writtenSize == 0)
+	{
+		m_ringBufferLock = false;
+		return;
+	}
+
+	Unlock();
+}
+
 bool VertexBuffer::IsValid()
 {
 	return m_buffer != 0;
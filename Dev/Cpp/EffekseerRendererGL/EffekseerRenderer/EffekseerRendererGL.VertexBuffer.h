@@ -45,6 +45,9 @@ public:
 
 	void Unlock();
 
+	bool RingBufferLockRest(int32_t minSize, int32_t& offset, void*& data, int32_t& size, int32_t alignment) override;
+	void UnlockRest(int32_t writtenSize) override;
+
 	bool IsValid();
 };
 
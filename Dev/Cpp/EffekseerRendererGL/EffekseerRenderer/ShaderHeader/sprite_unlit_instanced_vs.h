@@ -0,0 +1,159 @@
+static const char sprite_unlit_instanced_vs_gl3[] = R"(
+#version 330
+#ifdef GL_ARB_shading_language_420pack
+#extension GL_ARB_shading_language_420pack : require
+#endif
+
+struct VS_Input
+{
+    vec3 Position;
+    vec3 AxisU;
+    vec3 AxisV;
+    vec4 Color;
+    vec4 UV;
+    uint Corner;
+};
+
+struct VS_Output
+{
+    vec4 PosVS;
+    vec4 Color;
+    vec2 UV;
+    vec4 PosP;
+};
+
+struct VS_ConstantBuffer
+{
+    mat4 mCamera;
+    mat4 mProj;
+    vec4 mUVInversed;
+    vec4 mflipbookParameter;
+};
+
+uniform VS_ConstantBuffer CBVS0;
+
+layout(location = 0) in vec3 Input_Position;
+layout(location = 1) in vec3 Input_AxisU;
+layout(location = 2) in vec3 Input_AxisV;
+layout(location = 3) in vec4 Input_Color;
+layout(location = 4) in vec4 Input_UV;
+centroid out vec4 _VSPS_Color;
+centroid out vec2 _VSPS_UV;
+out vec4 _VSPS_PosP;
+
+VS_Output _main(VS_Input Input)
+{
+    mat4 mCameraProj = CBVS0.mCamera * CBVS0.mProj;
+    VS_Output Output = VS_Output(vec4(0.0), vec4(0.0), vec2(0.0), vec4(0.0));
+    float u = float(Input.Corner & 1u);
+    float v = float(Input.Corner >> 1u);
+    vec4 worldPos = vec4(mat3(Input.AxisU, Input.AxisV, Input.Position) * vec3(u, v, 1.0), 1.0);
+    Output.PosVS = worldPos * mCameraProj;
+    Output.Color = Input.Color;
+    vec2 uv1 = vec2(Input.UV.x + (Input.UV.z * u), Input.UV.y + (Input.UV.w * (1.0 - v)));
+    uv1.y = CBVS0.mUVInversed.x + (CBVS0.mUVInversed.y * uv1.y);
+    Output.UV = uv1;
+    Output.PosP = Output.PosVS;
+    return Output;
+}
+
+void main()
+{
+    VS_Input Input;
+    Input.Position = Input_Position;
+    Input.AxisU = Input_AxisU;
+    Input.AxisV = Input_AxisV;
+    Input.Color = Input_Color;
+    Input.UV = Input_UV;
+    Input.Corner = uint(gl_VertexID) & 3u;
+    VS_Output flattenTemp = _main(Input);
+    gl_Position = flattenTemp.PosVS;
+    _VSPS_Color = flattenTemp.Color;
+    _VSPS_UV = flattenTemp.UV;
+    _VSPS_PosP = flattenTemp.PosP;
+}
+)";
+
+static const char sprite_unlit_instanced_vs_gles3[] = R"(
+#version 300 es
+
+struct VS_Input
+{
+    vec3 Position;
+    vec3 AxisU;
+    vec3 AxisV;
+    vec4 Color;
+    vec4 UV;
+    uint Corner;
+};
+
+struct VS_Output
+{
+    vec4 PosVS;
+    vec4 Color;
+    vec2 UV;
+    vec4 PosP;
+};
+
+struct VS_ConstantBuffer
+{
+    mat4 mCamera;
+    mat4 mProj;
+    vec4 mUVInversed;
+    vec4 mflipbookParameter;
+};
+
+uniform VS_ConstantBuffer CBVS0;
+
+layout(location = 0) in vec3 Input_Position;
+layout(location = 1) in vec3 Input_AxisU;
+layout(location = 2) in vec3 Input_AxisV;
+layout(location = 3) in vec4 Input_Color;
+layout(location = 4) in vec4 Input_UV;
+centroid out vec4 _VSPS_Color;
+centroid out vec2 _VSPS_UV;
+out vec4 _VSPS_PosP;
+
+VS_Output _main(VS_Input Input)
+{
+    mat4 mCameraProj = CBVS0.mCamera * CBVS0.mProj;
+    VS_Output Output = VS_Output(vec4(0.0), vec4(0.0), vec2(0.0), vec4(0.0));
+    float u = float(Input.Corner & 1u);
+    float v = float(Input.Corner >> 1u);
+    vec4 worldPos = vec4(mat3(Input.AxisU, Input.AxisV, Input.Position) * vec3(u, v, 1.0), 1.0);
+    Output.PosVS = worldPos * mCameraProj;
+    Output.Color = Input.Color;
+    vec2 uv1 = vec2(Input.UV.x + (Input.UV.z * u), Input.UV.y + (Input.UV.w * (1.0 - v)));
+    uv1.y = CBVS0.mUVInversed.x + (CBVS0.mUVInversed.y * uv1.y);
+    Output.UV = uv1;
+    Output.PosP = Output.PosVS;
+    return Output;
+}
+
+void main()
+{
+    VS_Input Input;
+    Input.Position = Input_Position;
+    Input.AxisU = Input_AxisU;
+    Input.AxisV = Input_AxisV;
+    Input.Color = Input_Color;
+    Input.UV = Input_UV;
+    Input.Corner = uint(gl_VertexID) & 3u;
+    VS_Output flattenTemp = _main(Input);
+    gl_Position = flattenTemp.PosVS;
+    _VSPS_Color = flattenTemp.Color;
+    _VSPS_UV = flattenTemp.UV;
+    _VSPS_PosP = flattenTemp.PosP;
+}
+)";
+
+
+    static const char* get_sprite_unlit_instanced_vs (EffekseerRendererGL::OpenGLDeviceType deviceType)
+    {
+        if (deviceType == EffekseerRendererGL::OpenGLDeviceType::OpenGL3)
+            return sprite_unlit_instanced_vs_gl3;
+        if (deviceType == EffekseerRendererGL::OpenGLDeviceType::OpenGLES3)
+            return sprite_unlit_instanced_vs_gles3;
+        return nullptr;
+    }
+    
\ No newline at end of file
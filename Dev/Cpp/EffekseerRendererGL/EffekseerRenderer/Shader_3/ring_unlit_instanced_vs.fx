@@ -0,0 +1,102 @@
+#version 330
+#ifdef GL_ARB_shading_language_420pack
+#extension GL_ARB_shading_language_420pack : require
+#endif
+
+struct VS_Input
+{
+    vec4 Matrix0;
+    vec4 Matrix1;
+    vec4 Matrix2;
+    vec4 Radiuses;
+    vec4 Heights;
+    vec4 Angles;
+    vec4 Color0;
+    vec4 Color1;
+    vec4 Color2;
+    vec4 UV;
+    uint Index;
+};
+
+struct VS_Output
+{
+    vec4 PosVS;
+    vec4 Color;
+    vec2 UV;
+    vec4 PosP;
+};
+
+struct VS_ConstantBuffer
+{
+    mat4 mCamera;
+    mat4 mProj;
+    vec4 mUVInversed;
+    vec4 mflipbookParameter;
+};
+
+uniform VS_ConstantBuffer CBVS0;
+
+layout(location = 0) in vec4 Input_Matrix0;
+layout(location = 1) in vec4 Input_Matrix1;
+layout(location = 2) in vec4 Input_Matrix2;
+layout(location = 3) in vec4 Input_Radiuses;
+layout(location = 4) in vec4 Input_Heights;
+layout(location = 5) in vec4 Input_Angles;
+layout(location = 6) in vec4 Input_Color0;
+layout(location = 7) in vec4 Input_Color1;
+layout(location = 8) in vec4 Input_Color2;
+layout(location = 9) in vec4 Input_UV;
+centroid out vec4 _VSPS_Color;
+centroid out vec2 _VSPS_UV;
+out vec4 _VSPS_PosP;
+
+VS_Output _main(VS_Input Input)
+{
+    mat4 mCameraProj = CBVS0.mCamera * CBVS0.mProj;
+    VS_Output Output = VS_Output(vec4(0.0), vec4(0.0), vec2(0.0), vec4(0.0));
+    vec3 weights = vec3(equal(vec3(float(Input.Index % 3u)), vec3(0.0, 1.0, 2.0)));
+    float rate = float(Input.Index / 3u) / Input.Radiuses.w;
+    float angleDegree = Input.Angles.y * rate;
+    float angle = Input.Angles.x + ((angleDegree / 180.0) * 3.141592);
+    float radius = dot(weights, Input.Radiuses.xyz);
+    vec4 localPos = vec4(cos(angle) * radius, sin(angle) * radius, dot(weights, Input.Heights.xyz), 1.0);
+    vec4 worldPos = vec4(dot(Input.Matrix0, localPos), dot(Input.Matrix1, localPos), dot(Input.Matrix2, localPos), 1.0);
+    Output.PosVS = worldPos * mCameraProj;
+    vec4 color = ((Input.Color0 * weights.x) + (Input.Color1 * weights.y)) + (Input.Color2 * weights.z);
+    if (angleDegree < Input.Angles.z)
+    {
+        color.w *= (angleDegree / Input.Angles.z);
+    }
+    else if (angleDegree > (Input.Angles.y - Input.Angles.w))
+    {
+        color.w *= (1.0 - ((angleDegree - (Input.Angles.y - Input.Angles.w)) / Input.Angles.w));
+    }
+    Output.Color = color;
+    vec2 uv1 = vec2(Input.UV.x + (Input.UV.z * rate), Input.UV.y + (Input.UV.w * dot(weights, vec3(0.0, 0.5, 1.0))));
+    uv1.y = CBVS0.mUVInversed.x + (CBVS0.mUVInversed.y * uv1.y);
+    Output.UV = uv1;
+    Output.PosP = Output.PosVS;
+    return Output;
+}
+
+void main()
+{
+    VS_Input Input;
+    Input.Matrix0 = Input_Matrix0;
+    Input.Matrix1 = Input_Matrix1;
+    Input.Matrix2 = Input_Matrix2;
+    Input.Radiuses = Input_Radiuses;
+    Input.Heights = Input_Heights;
+    Input.Angles = Input_Angles;
+    Input.Color0 = Input_Color0;
+    Input.Color1 = Input_Color1;
+    Input.Color2 = Input_Color2;
+    Input.UV = Input_UV;
+    Input.Index = uint(gl_VertexID);
+    VS_Output flattenTemp = _main(Input);
+    gl_Position = flattenTemp.PosVS;
+    _VSPS_Color = flattenTemp.Color;
+    _VSPS_UV = flattenTemp.UV;
+    _VSPS_PosP = flattenTemp.PosP;
+}
+
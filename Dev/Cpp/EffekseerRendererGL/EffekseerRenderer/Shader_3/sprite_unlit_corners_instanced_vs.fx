@@ -0,0 +1,85 @@
+#version 330
+#ifdef GL_ARB_shading_language_420pack
+#extension GL_ARB_shading_language_420pack : require
+#endif
+
+struct VS_Input
+{
+    vec3 Position;
+    vec3 AxisU;
+    vec3 AxisV;
+    vec3 AxisUV;
+    vec4 Color0;
+    vec4 Color1;
+    vec4 Color2;
+    vec4 Color3;
+    vec4 UV;
+    uint Corner;
+};
+
+struct VS_Output
+{
+    vec4 PosVS;
+    vec4 Color;
+    vec2 UV;
+    vec4 PosP;
+};
+
+struct VS_ConstantBuffer
+{
+    mat4 mCamera;
+    mat4 mProj;
+    vec4 mUVInversed;
+    vec4 mflipbookParameter;
+};
+
+uniform VS_ConstantBuffer CBVS0;
+
+layout(location = 0) in vec3 Input_Position;
+layout(location = 1) in vec3 Input_AxisU;
+layout(location = 2) in vec3 Input_AxisV;
+layout(location = 3) in vec3 Input_AxisUV;
+layout(location = 4) in vec4 Input_Color0;
+layout(location = 5) in vec4 Input_Color1;
+layout(location = 6) in vec4 Input_Color2;
+layout(location = 7) in vec4 Input_Color3;
+layout(location = 8) in vec4 Input_UV;
+centroid out vec4 _VSPS_Color;
+centroid out vec2 _VSPS_UV;
+out vec4 _VSPS_PosP;
+
+VS_Output _main(VS_Input Input)
+{
+    mat4 mCameraProj = CBVS0.mCamera * CBVS0.mProj;
+    VS_Output Output = VS_Output(vec4(0.0), vec4(0.0), vec2(0.0), vec4(0.0));
+    float u = float(Input.Corner & 1u);
+    float v = float(Input.Corner >> 1u);
+    vec4 worldPos = vec4(vec4(u, v, u * v, 1.0) * transpose(mat4x3(Input.AxisU, Input.AxisV, Input.AxisUV, Input.Position)), 1.0);
+    Output.PosVS = worldPos * mCameraProj;
+    Output.Color = mix(mix(Input.Color0, Input.Color1, u), mix(Input.Color2, Input.Color3, u), v);
+    vec2 uv1 = vec2(Input.UV.x + (Input.UV.z * u), Input.UV.y + (Input.UV.w * (1.0 - v)));
+    uv1.y = CBVS0.mUVInversed.x + (CBVS0.mUVInversed.y * uv1.y);
+    Output.UV = uv1;
+    Output.PosP = Output.PosVS;
+    return Output;
+}
+
+void main()
+{
+    VS_Input Input;
+    Input.Position = Input_Position;
+    Input.AxisU = Input_AxisU;
+    Input.AxisV = Input_AxisV;
+    Input.AxisUV = Input_AxisUV;
+    Input.Color0 = Input_Color0;
+    Input.Color1 = Input_Color1;
+    Input.Color2 = Input_Color2;
+    Input.Color3 = Input_Color3;
+    Input.UV = Input_UV;
+    Input.Corner = uint(gl_VertexID) & 3u;
+    VS_Output flattenTemp = _main(Input);
+    gl_Position = flattenTemp.PosVS;
+    _VSPS_Color = flattenTemp.Color;
+    _VSPS_UV = flattenTemp.UV;
+    _VSPS_PosP = flattenTemp.PosP;
+}
@@ -6,6 +6,9 @@ verts = ['ad_sprite_unlit_vs', 'ad_sprite_lit_vs', 'ad_sprite_distortion_vs', 'a
 
 frags = ['ad_model_unlit_ps',  'ad_model_lit_ps', 'ad_model_distortion_ps', 'model_unlit_ps',  'model_lit_ps', 'model_distortion_ps']
 
+# shaders which exist only for OpenGL3 and OpenGLES3
+verts_3 = ['sprite_unlit_instanced_vs', 'sprite_unlit_corners_instanced_vs', 'ring_unlit_instanced_vs']
+
 
 gl_2_root_path = 'Shader_2/'
 gl_3_root_path = 'Shader_3/'
@@ -83,3 +86,33 @@ for fx in verts + frags:
 
     f = open(gl_dst_path + fx + '.h', 'w')
     f.write(code)
+
+for fx in verts_3:
+    f_gl_3 = open(gl_3_root_path + fx + '.fx', 'r')
+    gl_3 = replace_3(f_gl_3.read())
+
+    f_gl_es3 = open(gl_es3_root_path + fx + '.fx', 'r')
+    gl_es3 = f_gl_es3.read()
+
+    code = ''
+    code += 'static const char {}_{}[] = R"(\n'.format(fx, 'gl3')
+    code += gl_3
+    code += ')";\n\n'
+
+    code += 'static const char {}_{}[] = R"(\n'.format(fx, 'gles3')
+    code += gl_es3
+    code += ')";\n\n'
+
+    code += r'''
+    static const char* get_{} (EffekseerRendererGL::OpenGLDeviceType deviceType)
+    {{
+        if (deviceType == EffekseerRendererGL::OpenGLDeviceType::OpenGL3)
+            return {}_{};
+        if (deviceType == EffekseerRendererGL::OpenGLDeviceType::OpenGLES3)
+            return {}_{};
+        return nullptr;
+    }}
+    '''.format(fx, fx, 'gl3', fx, 'gles3')
+
+    f = open(gl_dst_path + fx + '.h', 'w')
+    f.write(code)
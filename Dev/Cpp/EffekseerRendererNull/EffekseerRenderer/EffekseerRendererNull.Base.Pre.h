@@ -0,0 +1,15 @@
+
+#ifndef __EFFEKSEERRENDERER_NULL_BASE_PRE_H__
+#define __EFFEKSEERRENDERER_NULL_BASE_PRE_H__
+
+#include <Effekseer.h>
+#include <vector>
+
+namespace EffekseerRendererNull
+{
+
+class Renderer;
+
+} // namespace EffekseerRendererNull
+
+#endif // __EFFEKSEERRENDERER_NULL_BASE_PRE_H__
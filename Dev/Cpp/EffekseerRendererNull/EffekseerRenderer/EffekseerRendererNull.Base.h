@@ -0,0 +1,40 @@
+
+#ifndef __EFFEKSEERRENDERER_NULL_BASE_H__
+#define __EFFEKSEERRENDERER_NULL_BASE_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "EffekseerRendererNull.Base.Pre.h"
+
+#include <Effekseer.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <memory>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+namespace EffekseerRendererNull
+{
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+class RendererImplemented;
+
+class VertexBuffer;
+class Shader;
+class RenderState;
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace EffekseerRendererNull
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+#endif // __EFFEKSEERRENDERER_NULL_BASE_H__
@@ -0,0 +1,141 @@
+#include "EffekseerRendererNull.MaterialLoader.h"
+#include "EffekseerRendererNull.Shader.h"
+
+#include "../../EffekseerRendererCommon/EffekseerRenderer.CommonUtils.h"
+#include "Effekseer/Material/Effekseer.CompiledMaterial.h"
+
+#undef min
+
+namespace EffekseerRendererNull
+{
+
+//! the same as ModelRenderer
+static const int Null_InstanceCount = 10;
+
+::Effekseer::MaterialRef MaterialLoader::LoadAcutually(::Effekseer::MaterialFile& materialFile)
+{
+	auto material = ::Effekseer::MakeRefPtr<::Effekseer::Material>();
+	material->IsSimpleVertex = materialFile.GetIsSimpleVertex();
+	material->IsRefractionRequired = materialFile.GetHasRefraction();
+
+	int32_t shaderTypeCount = 1;
+
+	if (materialFile.GetHasRefraction())
+	{
+		shaderTypeCount = 2;
+	}
+
+	for (int32_t st = 0; st < shaderTypeCount; st++)
+	{
+		for (auto isModel : {false, true})
+		{
+			auto parameterGenerator = EffekseerRenderer::MaterialShaderParameterGenerator(materialFile, isModel, st, isModel ? Null_InstanceCount : 1);
+
+			auto shader = Shader::Create("CustomMaterial");
+			shader->SetVertexConstantBufferSize(parameterGenerator.VertexShaderUniformBufferSize);
+			shader->SetPixelConstantBufferSize(parameterGenerator.PixelShaderUniformBufferSize);
+
+			if (isModel)
+			{
+				(st == 0 ? material->ModelUserPtr : material->RefractionModelUserPtr) = shader;
+			}
+			else
+			{
+				(st == 0 ? material->UserPtr : material->RefractionUserPtr) = shader;
+			}
+		}
+	}
+
+	material->CustomData1 = materialFile.GetCustomData1Count();
+	material->CustomData2 = materialFile.GetCustomData2Count();
+	material->TextureCount = std::min(materialFile.GetTextureCount(), Effekseer::UserTextureSlotMax);
+	material->UniformCount = materialFile.GetUniformCount();
+	material->ShadingModel = materialFile.GetShadingModel();
+
+	for (int32_t i = 0; i < material->TextureCount; i++)
+	{
+		material->TextureWrapTypes.at(i) = materialFile.GetTextureWrap(i);
+	}
+
+	return material;
+}
+
+MaterialLoader::MaterialLoader(::Effekseer::FileInterface* fileInterface)
+	: fileInterface_(fileInterface)
+{
+	if (fileInterface == nullptr)
+	{
+		fileInterface_ = &defaultFileInterface_;
+	}
+}
+
+MaterialLoader ::~MaterialLoader()
+{
+}
+
+::Effekseer::MaterialRef MaterialLoader::Load(const char16_t* path)
+{
+	std::unique_ptr<Effekseer::FileReader> reader(fileInterface_->OpenRead(path));
+
+	if (reader.get() != nullptr)
+	{
+		size_t size = reader->GetLength();
+		std::vector<char> data;
+		data.resize(size);
+		reader->Read(data.data(), size);
+
+		return Load(data.data(), (int32_t)size, ::Effekseer::MaterialFileType::Code);
+	}
+
+	return nullptr;
+}
+
+::Effekseer::MaterialRef MaterialLoader::Load(const void* data, int32_t size, Effekseer::MaterialFileType fileType)
+{
+	Effekseer::MaterialFile materialFile;
+
+	if (fileType == Effekseer::MaterialFileType::Compiled)
+	{
+		auto compiled = Effekseer::CompiledMaterial();
+		if (!compiled.Load(static_cast<const uint8_t*>(data), size))
+		{
+			return nullptr;
+		}
+
+		if (!materialFile.Load((const uint8_t*)compiled.GetOriginalData().data(), static_cast<int32_t>(compiled.GetOriginalData().size())))
+		{
+			return nullptr;
+		}
+	}
+	else
+	{
+		if (!materialFile.Load((const uint8_t*)data, size))
+		{
+			return nullptr;
+		}
+	}
+
+	return LoadAcutually(materialFile);
+}
+
+void MaterialLoader::Unload(::Effekseer::MaterialRef data)
+{
+	if (data == nullptr)
+		return;
+	auto shader = reinterpret_cast<Shader*>(data->UserPtr);
+	auto modelShader = reinterpret_cast<Shader*>(data->ModelUserPtr);
+	auto refractionShader = reinterpret_cast<Shader*>(data->RefractionUserPtr);
+	auto refractionModelShader = reinterpret_cast<Shader*>(data->RefractionModelUserPtr);
+
+	ES_SAFE_DELETE(shader);
+	ES_SAFE_DELETE(modelShader);
+	ES_SAFE_DELETE(refractionShader);
+	ES_SAFE_DELETE(refractionModelShader);
+
+	data->UserPtr = nullptr;
+	data->ModelUserPtr = nullptr;
+	data->RefractionUserPtr = nullptr;
+	data->RefractionModelUserPtr = nullptr;
+}
+
+} // namespace EffekseerRendererNull
@@ -0,0 +1,35 @@
+#ifndef __EFFEKSEERRENDERER_NULL_MATERIALLOADER_H__
+#define __EFFEKSEERRENDERER_NULL_MATERIALLOADER_H__
+
+#include "EffekseerRendererNull.RendererImplemented.h"
+
+namespace EffekseerRendererNull
+{
+
+/**
+	@brief	a loader which creates shaders which have only constant buffers
+	@note
+	Codes of materials are not compiled because they are never executed.
+*/
+class MaterialLoader : public ::Effekseer::MaterialLoader
+{
+private:
+	::Effekseer::FileInterface* fileInterface_ = nullptr;
+	::Effekseer::DefaultFileInterface defaultFileInterface_;
+
+	::Effekseer::MaterialRef LoadAcutually(::Effekseer::MaterialFile& materialFile);
+
+public:
+	MaterialLoader(::Effekseer::FileInterface* fileInterface);
+	virtual ~MaterialLoader();
+
+	::Effekseer::MaterialRef Load(const char16_t* path) override;
+
+	::Effekseer::MaterialRef Load(const void* data, int32_t size, Effekseer::MaterialFileType fileType) override;
+
+	void Unload(::Effekseer::MaterialRef data) override;
+};
+
+} // namespace EffekseerRendererNull
+
+#endif // __EFFEKSEERRENDERER_NULL_MATERIALLOADER_H__
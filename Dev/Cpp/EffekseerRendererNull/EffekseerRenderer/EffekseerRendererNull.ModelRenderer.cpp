@@ -0,0 +1,133 @@
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "EffekseerRendererNull.ModelRenderer.h"
+#include "EffekseerRendererNull.RenderState.h"
+#include "EffekseerRendererNull.RendererImplemented.h"
+#include "EffekseerRendererNull.Shader.h"
+#include "EffekseerRendererNull.VertexBuffer.h"
+
+namespace EffekseerRendererNull
+{
+
+//! the same as OpenGL3 so that models are batched in the same way
+static const int InstanceCount = 10;
+
+ModelRenderer::ModelRenderer(RendererImplemented* renderer)
+	: m_renderer(renderer)
+{
+	graphicsDevice_ = renderer->GetGraphicsDevice().DownCast<Backend::GraphicsDevice>();
+
+	VertexType = EffekseerRenderer::ModelRendererVertexType::Instancing;
+
+	shader_ad_lit_ = Shader::Create("ModelRenderer1");
+	shader_ad_unlit_ = Shader::Create("ModelRenderer5");
+	shader_ad_distortion_ = Shader::Create("ModelRenderer7");
+	shader_lit_ = Shader::Create("ModelRenderer1");
+	shader_unlit_ = Shader::Create("ModelRenderer5");
+	shader_distortion_ = Shader::Create("ModelRenderer7");
+
+	for (auto& shader : {shader_ad_lit_, shader_ad_unlit_, shader_ad_distortion_})
+	{
+		shader->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererAdvancedVertexConstantBuffer<InstanceCount>));
+	}
+
+	for (auto& shader : {shader_lit_, shader_unlit_, shader_distortion_})
+	{
+		shader->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererVertexConstantBuffer<InstanceCount>));
+	}
+
+	for (auto& shader : {shader_ad_lit_, shader_ad_unlit_, shader_lit_, shader_unlit_})
+	{
+		shader->SetPixelConstantBufferSize(sizeof(::EffekseerRenderer::PixelConstantBuffer));
+	}
+
+	for (auto& shader : {shader_ad_distortion_, shader_distortion_})
+	{
+		shader->SetPixelConstantBufferSize(sizeof(::EffekseerRenderer::PixelConstantBufferDistortion));
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+ModelRenderer::~ModelRenderer()
+{
+	ES_SAFE_DELETE(shader_unlit_);
+	ES_SAFE_DELETE(shader_lit_);
+	ES_SAFE_DELETE(shader_distortion_);
+
+	ES_SAFE_DELETE(shader_ad_unlit_);
+	ES_SAFE_DELETE(shader_ad_lit_);
+	ES_SAFE_DELETE(shader_ad_distortion_);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+ModelRendererRef ModelRenderer::Create(RendererImplemented* renderer)
+{
+	assert(renderer != nullptr);
+
+	return ModelRendererRef(new ModelRenderer(renderer));
+}
+
+void ModelRenderer::BeginRendering(const efkModelNodeParam& parameter, int32_t count, void* userData)
+{
+	BeginRendering_(m_renderer, parameter, count, userData);
+}
+
+void ModelRenderer::Rendering(const efkModelNodeParam& parameter, const InstanceParameter& instanceParameter, void* userData)
+{
+	Rendering_<RendererImplemented>(m_renderer, parameter, instanceParameter, userData);
+}
+
+void ModelRenderer::EndRendering(const efkModelNodeParam& parameter, void* userData)
+{
+	if (parameter.ModelIndex < 0)
+	{
+		return;
+	}
+
+	Effekseer::ModelRef model = nullptr;
+
+	if (parameter.IsProcedualMode)
+	{
+		model = parameter.EffectPointer->GetProcedualModel(parameter.ModelIndex);
+	}
+	else
+	{
+		model = parameter.EffectPointer->GetModel(parameter.ModelIndex);
+	}
+
+	if (model == nullptr)
+	{
+		return;
+	}
+
+	model->StoreBufferToGPU(graphicsDevice_.Get());
+	if (!model->GetIsBufferStoredOnGPU())
+	{
+		return;
+	}
+
+	if (m_renderer->GetRenderMode() == Effekseer::RenderMode::Wireframe)
+	{
+		model->GenerateWireIndexBuffer(graphicsDevice_.Get());
+		if (!model->GetIsWireIndexBufferGenerated())
+		{
+			return;
+		}
+	}
+
+	EndRendering_<RendererImplemented, Shader, Effekseer::Model, true, InstanceCount>(
+		m_renderer, shader_ad_lit_, shader_ad_unlit_, shader_ad_distortion_, shader_lit_, shader_unlit_, shader_distortion_, parameter);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace EffekseerRendererNull
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
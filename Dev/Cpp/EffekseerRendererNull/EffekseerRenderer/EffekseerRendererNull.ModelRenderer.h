@@ -0,0 +1,61 @@
+
+#ifndef __EFFEKSEERRENDERER_NULL_MODEL_RENDERER_H__
+#define __EFFEKSEERRENDERER_NULL_MODEL_RENDERER_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "../../EffekseerRendererCommon/EffekseerRenderer.ModelRendererBase.h"
+#include "EffekseerRendererNull.RendererImplemented.h"
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+namespace EffekseerRendererNull
+{
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+typedef ::Effekseer::ModelRenderer::NodeParameter efkModelNodeParam;
+typedef ::Effekseer::ModelRenderer::InstanceParameter efkModelInstanceParam;
+
+class ModelRenderer;
+typedef ::Effekseer::RefPtr<ModelRenderer> ModelRendererRef;
+
+class ModelRenderer : public ::EffekseerRenderer::ModelRendererBase
+{
+private:
+	RendererImplemented* m_renderer;
+
+	Shader* shader_ad_lit_ = nullptr;
+	Shader* shader_ad_unlit_ = nullptr;
+	Shader* shader_ad_distortion_ = nullptr;
+
+	Shader* shader_lit_ = nullptr;
+	Shader* shader_unlit_ = nullptr;
+	Shader* shader_distortion_ = nullptr;
+
+	Backend::GraphicsDeviceRef graphicsDevice_ = nullptr;
+
+	ModelRenderer(RendererImplemented* renderer);
+
+public:
+	virtual ~ModelRenderer();
+
+	static ModelRendererRef Create(RendererImplemented* renderer);
+
+public:
+	void BeginRendering(const efkModelNodeParam& parameter, int32_t count, void* userData) override;
+
+	void Rendering(const efkModelNodeParam& parameter, const InstanceParameter& instanceParameter, void* userData) override;
+
+	void EndRendering(const efkModelNodeParam& parameter, void* userData) override;
+};
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace EffekseerRendererNull
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+#endif // __EFFEKSEERRENDERER_NULL_MODEL_RENDERER_H__
@@ -0,0 +1,57 @@
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "EffekseerRendererNull.RenderState.h"
+#include "EffekseerRendererNull.RendererImplemented.h"
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+namespace EffekseerRendererNull
+{
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+RenderState::RenderState(RendererImplemented* renderer)
+	: m_renderer(renderer)
+{
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+RenderState::~RenderState()
+{
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+void RenderState::Update(bool forced)
+{
+	// count changes which other backends send to a device
+	bool changed = forced;
+
+	changed |= m_active.DepthTest != m_next.DepthTest;
+	changed |= m_active.DepthWrite != m_next.DepthWrite;
+	changed |= m_active.CullingType != m_next.CullingType;
+	changed |= m_active.AlphaBlend != m_next.AlphaBlend;
+	changed |= m_active.TextureFilterTypes != m_next.TextureFilterTypes;
+	changed |= m_active.TextureWrapTypes != m_next.TextureWrapTypes;
+
+	if (changed)
+	{
+		m_renderer->AddStateChangeCount();
+	}
+
+	m_active = m_next;
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+} // namespace EffekseerRendererNull
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
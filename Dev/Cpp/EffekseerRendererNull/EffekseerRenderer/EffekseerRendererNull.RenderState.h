@@ -0,0 +1,38 @@
+
+#ifndef __EFFEKSEERRENDERER_NULL_RENDERSTATE_H__
+#define __EFFEKSEERRENDERER_NULL_RENDERSTATE_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "../../EffekseerRendererCommon/EffekseerRenderer.RenderStateBase.h"
+#include "EffekseerRendererNull.Base.h"
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+namespace EffekseerRendererNull
+{
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+class RenderState : public ::EffekseerRenderer::RenderStateBase
+{
+private:
+	RendererImplemented* m_renderer;
+
+public:
+	RenderState(RendererImplemented* renderer);
+	virtual ~RenderState();
+
+	void Update(bool forced) override;
+};
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+} // namespace EffekseerRendererNull
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+#endif // __EFFEKSEERRENDERER_NULL_RENDERSTATE_H__
@@ -0,0 +1,465 @@
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "EffekseerRendererNull.Renderer.h"
+#include "EffekseerRendererNull.RenderState.h"
+#include "EffekseerRendererNull.RendererImplemented.h"
+
+#include "EffekseerRendererNull.MaterialLoader.h"
+#include "EffekseerRendererNull.ModelRenderer.h"
+#include "EffekseerRendererNull.Shader.h"
+#include "EffekseerRendererNull.VertexBuffer.h"
+
+#include "../../EffekseerRendererCommon/EffekseerRenderer.Renderer_Impl.h"
+#include "../../EffekseerRendererCommon/EffekseerRenderer.RibbonRendererBase.h"
+#include "../../EffekseerRendererCommon/EffekseerRenderer.RingRendererBase.h"
+#include "../../EffekseerRendererCommon/EffekseerRenderer.SpriteRendererBase.h"
+#include "../../EffekseerRendererCommon/EffekseerRenderer.TrackRendererBase.h"
+#include "../../EffekseerRendererCommon/ModelLoader.h"
+
+#ifdef __EFFEKSEER_RENDERER_INTERNAL_LOADER__
+#include "../../EffekseerRendererCommon/TextureLoader.h"
+#endif
+
+#include "GraphicsDevice.h"
+
+namespace EffekseerRendererNull
+{
+
+::Effekseer::Backend::GraphicsDeviceRef CreateGraphicsDevice()
+{
+	return Effekseer::MakeRefPtr<Backend::GraphicsDevice>();
+}
+
+::Effekseer::TextureLoaderRef CreateTextureLoader(
+	Effekseer::Backend::GraphicsDeviceRef graphicsDevice,
+	::Effekseer::FileInterface* fileInterface,
+	::Effekseer::ColorSpaceType colorSpaceType)
+{
+#ifdef __EFFEKSEER_RENDERER_INTERNAL_LOADER__
+	return ::Effekseer::MakeRefPtr<EffekseerRenderer::TextureLoader>(graphicsDevice.Get(), fileInterface, colorSpaceType);
+#else
+	return nullptr;
+#endif
+}
+
+::Effekseer::ModelLoaderRef CreateModelLoader(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, ::Effekseer::FileInterface* fileInterface)
+{
+	return ::Effekseer::MakeRefPtr<EffekseerRenderer::ModelLoader>(graphicsDevice, fileInterface);
+}
+
+::Effekseer::MaterialLoaderRef CreateMaterialLoader(::Effekseer::Backend::GraphicsDeviceRef graphicsDevice,
+													::Effekseer::FileInterface* fileInterface)
+{
+	return ::Effekseer::MakeRefPtr<MaterialLoader>(fileInterface);
+}
+
+RendererRef Renderer::Create(int32_t squareMaxCount)
+{
+	return Create(CreateGraphicsDevice(), squareMaxCount);
+}
+
+RendererRef Renderer::Create(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, int32_t squareMaxCount)
+{
+	auto g = graphicsDevice.DownCast<Backend::GraphicsDevice>();
+
+	auto renderer = ::Effekseer::MakeRefPtr<RendererImplemented>(squareMaxCount, g);
+	if (renderer->Initialize())
+	{
+		return renderer;
+	}
+	return nullptr;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+RendererImplemented::RendererImplemented(int32_t squareMaxCount, Backend::GraphicsDeviceRef graphicsDevice)
+	: m_squareMaxCount(squareMaxCount)
+{
+	graphicsDevice_ = graphicsDevice;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+RendererImplemented::~RendererImplemented()
+{
+	GetImpl()->DeleteProxyTextures(this);
+
+	ES_SAFE_DELETE(m_distortingCallback);
+
+	ES_SAFE_DELETE(m_standardRenderer);
+	ES_SAFE_DELETE(shader_unlit_);
+	ES_SAFE_DELETE(shader_distortion_);
+	ES_SAFE_DELETE(shader_lit_);
+
+	ES_SAFE_DELETE(shader_ad_unlit_);
+	ES_SAFE_DELETE(shader_ad_lit_);
+	ES_SAFE_DELETE(shader_ad_distortion_);
+
+	ES_SAFE_DELETE(m_renderState);
+	ES_SAFE_DELETE(m_vertexBuffer);
+}
+
+void RendererImplemented::OnLostDevice()
+{
+}
+
+void RendererImplemented::OnResetDevice()
+{
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+bool RendererImplemented::Initialize()
+{
+	SetSquareMaxCount(m_squareMaxCount);
+	if (m_vertexBuffer == nullptr)
+		return false;
+
+	m_renderState = new RenderState(this);
+
+	shader_ad_unlit_ = Shader::Create("Standard Tex");
+	shader_ad_distortion_ = Shader::Create("Standard Distortion Tex");
+	shader_ad_lit_ = Shader::Create("Standard Lighting Tex");
+	shader_unlit_ = Shader::Create("Standard Tex");
+	shader_distortion_ = Shader::Create("Standard Distortion Tex");
+	shader_lit_ = Shader::Create("Standard Lighting Tex");
+
+	// sizes are the same as other backends so that the same parameters are generated
+	for (auto& shader : {shader_ad_unlit_, shader_unlit_, shader_ad_lit_, shader_lit_})
+	{
+		shader->SetVertexConstantBufferSize(sizeof(EffekseerRenderer::StandardRendererVertexBuffer));
+		shader->SetPixelConstantBufferSize(sizeof(EffekseerRenderer::PixelConstantBuffer));
+	}
+
+	for (auto& shader : {shader_ad_distortion_, shader_distortion_})
+	{
+		shader->SetVertexConstantBufferSize(sizeof(EffekseerRenderer::StandardRendererVertexBuffer));
+		shader->SetPixelConstantBufferSize(sizeof(EffekseerRenderer::PixelConstantBufferDistortion));
+	}
+
+	m_standardRenderer =
+		new EffekseerRenderer::StandardRenderer<RendererImplemented, Shader>(this);
+
+	GetImpl()->isSoftParticleEnabled = true;
+
+	GetImpl()->CreateProxyTextures(this);
+
+	return true;
+}
+
+void RendererImplemented::SetRestorationOfStatesFlag(bool flag)
+{
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+bool RendererImplemented::BeginRendering()
+{
+	impl->CalculateCameraProjectionMatrix();
+
+	currentTextures_.clear();
+	lastShader_ = nullptr;
+	m_renderState->GetActiveState().Reset();
+	m_renderState->Update(true);
+
+	// reset renderer
+	m_standardRenderer->ResetAndRenderingIfRequired();
+
+	return true;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+bool RendererImplemented::EndRendering()
+{
+	// reset renderer
+	m_standardRenderer->ResetAndRenderingIfRequired();
+
+	return true;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+VertexBuffer* RendererImplemented::GetVertexBuffer()
+{
+	return m_vertexBuffer;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+::EffekseerRenderer::IndexBufferBase* RendererImplemented::GetIndexBuffer()
+{
+	return nullptr;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+int32_t RendererImplemented::GetSquareMaxCount() const
+{
+	return m_squareMaxCount;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RendererImplemented::SetSquareMaxCount(int32_t count)
+{
+	m_squareMaxCount = count;
+
+	ES_SAFE_DELETE(m_vertexBuffer);
+
+	// generate a vertex buffer
+	m_vertexBuffer = VertexBuffer::Create(EffekseerRenderer::GetMaximumVertexSizeInAllTypes() * m_squareMaxCount * 4, true);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+::EffekseerRenderer::RenderStateBase* RendererImplemented::GetRenderState()
+{
+	return m_renderState;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+::Effekseer::SpriteRendererRef RendererImplemented::CreateSpriteRenderer()
+{
+	return ::Effekseer::SpriteRendererRef(new ::EffekseerRenderer::SpriteRendererBase<RendererImplemented, false>(this));
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+::Effekseer::RibbonRendererRef RendererImplemented::CreateRibbonRenderer()
+{
+	return ::Effekseer::RibbonRendererRef(new ::EffekseerRenderer::RibbonRendererBase<RendererImplemented, false>(this));
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+::Effekseer::RingRendererRef RendererImplemented::CreateRingRenderer()
+{
+	return ::Effekseer::RingRendererRef(new ::EffekseerRenderer::RingRendererBase<RendererImplemented, false>(this));
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+::Effekseer::ModelRendererRef RendererImplemented::CreateModelRenderer()
+{
+	return ModelRenderer::Create(this);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+::Effekseer::TrackRendererRef RendererImplemented::CreateTrackRenderer()
+{
+	return ::Effekseer::TrackRendererRef(new ::EffekseerRenderer::TrackRendererBase<RendererImplemented, false>(this));
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+::Effekseer::TextureLoaderRef RendererImplemented::CreateTextureLoader(::Effekseer::FileInterface* fileInterface)
+{
+#ifdef __EFFEKSEER_RENDERER_INTERNAL_LOADER__
+	return ::Effekseer::MakeRefPtr<EffekseerRenderer::TextureLoader>(graphicsDevice_.Get(), fileInterface);
+#else
+	return nullptr;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+::Effekseer::ModelLoaderRef RendererImplemented::CreateModelLoader(::Effekseer::FileInterface* fileInterface)
+{
+	return ::Effekseer::MakeRefPtr<EffekseerRenderer::ModelLoader>(graphicsDevice_, fileInterface);
+}
+
+::Effekseer::MaterialLoaderRef RendererImplemented::CreateMaterialLoader(::Effekseer::FileInterface* fileInterface)
+{
+	return ::Effekseer::MakeRefPtr<MaterialLoader>(fileInterface);
+}
+
+EffekseerRenderer::DistortingCallback* RendererImplemented::GetDistortingCallback()
+{
+	return m_distortingCallback;
+}
+
+void RendererImplemented::SetDistortingCallback(EffekseerRenderer::DistortingCallback* callback)
+{
+	ES_SAFE_DELETE(m_distortingCallback);
+	m_distortingCallback = callback;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RendererImplemented::SetVertexBuffer(VertexBuffer* vertexBuffer, int32_t size)
+{
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RendererImplemented::SetIndexBuffer(::EffekseerRenderer::IndexBufferBase* indexBuffer)
+{
+}
+
+void RendererImplemented::SetVertexBuffer(const Effekseer::Backend::VertexBufferRef& vertexBuffer, int32_t size)
+{
+}
+
+void RendererImplemented::SetIndexBuffer(const Effekseer::Backend::IndexBufferRef& indexBuffer)
+{
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RendererImplemented::SetLayout(Shader* shader)
+{
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RendererImplemented::DrawSprites(int32_t spriteCount, int32_t vertexOffset)
+{
+	impl->drawcallCount++;
+	impl->drawvertexCount += spriteCount * 4;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RendererImplemented::DrawPolygon(int32_t vertexCount, int32_t indexCount)
+{
+	impl->drawcallCount++;
+	impl->drawvertexCount += vertexCount;
+}
+
+void RendererImplemented::DrawPolygonInstanced(int32_t vertexCount, int32_t indexCount, int32_t instanceCount)
+{
+	impl->drawcallCount++;
+	impl->drawvertexCount += vertexCount * instanceCount;
+}
+
+Shader* RendererImplemented::GetShader(::EffekseerRenderer::RendererShaderType type) const
+{
+	if (type == ::EffekseerRenderer::RendererShaderType::AdvancedBackDistortion)
+	{
+		return shader_ad_distortion_;
+	}
+	else if (type == ::EffekseerRenderer::RendererShaderType::AdvancedLit)
+	{
+		return shader_ad_lit_;
+	}
+	else if (type == ::EffekseerRenderer::RendererShaderType::AdvancedUnlit)
+	{
+		return shader_ad_unlit_;
+	}
+	else if (type == ::EffekseerRenderer::RendererShaderType::BackDistortion)
+	{
+		return shader_distortion_;
+	}
+	else if (type == ::EffekseerRenderer::RendererShaderType::Lit)
+	{
+		return shader_lit_;
+	}
+	else if (type == ::EffekseerRenderer::RendererShaderType::Unlit)
+	{
+		return shader_unlit_;
+	}
+
+	return shader_unlit_;
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RendererImplemented::BeginShader(Shader* shader)
+{
+	assert(currentShader == nullptr);
+	currentShader = shader;
+
+	if (lastShader_ != shader)
+	{
+		lastShader_ = shader;
+		stateChangeCount_++;
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RendererImplemented::EndShader(Shader* shader)
+{
+	assert(currentShader == shader);
+	currentShader = nullptr;
+}
+
+void RendererImplemented::SetVertexBufferToShader(const void* data, int32_t size, int32_t dstOffset)
+{
+	assert(currentShader != nullptr);
+	auto p = static_cast<uint8_t*>(currentShader->GetVertexConstantBuffer()) + dstOffset;
+	memcpy(p, data, size);
+}
+
+void RendererImplemented::SetPixelBufferToShader(const void* data, int32_t size, int32_t dstOffset)
+{
+	assert(currentShader != nullptr);
+	auto p = static_cast<uint8_t*>(currentShader->GetPixelConstantBuffer()) + dstOffset;
+	memcpy(p, data, size);
+}
+
+void RendererImplemented::SetTextures(Shader* shader, Effekseer::Backend::TextureRef* textures, int32_t count)
+{
+	bool changed = static_cast<int32_t>(currentTextures_.size()) != count;
+
+	currentTextures_.resize(count);
+
+	for (int32_t i = 0; i < count; i++)
+	{
+		if (currentTextures_[i] != textures[i])
+		{
+			currentTextures_[i] = textures[i];
+			changed = true;
+		}
+	}
+
+	if (changed)
+	{
+		stateChangeCount_++;
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void RendererImplemented::ResetRenderState()
+{
+	m_renderState->GetActiveState().Reset();
+	m_renderState->Update(true);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace EffekseerRendererNull
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
@@ -0,0 +1,97 @@
+﻿
+#ifndef __EFFEKSEERRENDERER_NULL_RENDERER_H__
+#define __EFFEKSEERRENDERER_NULL_RENDERER_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "../../EffekseerRendererCommon/EffekseerRenderer.Renderer.h"
+#include "EffekseerRendererNull.Base.h"
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+namespace EffekseerRendererNull
+{
+
+::Effekseer::Backend::GraphicsDeviceRef CreateGraphicsDevice();
+
+::Effekseer::TextureLoaderRef CreateTextureLoader(
+	Effekseer::Backend::GraphicsDeviceRef graphicsDevice,
+	::Effekseer::FileInterface* fileInterface = nullptr,
+	::Effekseer::ColorSpaceType colorSpaceType = ::Effekseer::ColorSpaceType::Gamma);
+
+::Effekseer::ModelLoaderRef CreateModelLoader(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, ::Effekseer::FileInterface* fileInterface = nullptr);
+
+::Effekseer::MaterialLoaderRef CreateMaterialLoader(Effekseer::Backend::GraphicsDeviceRef graphicsDevice,
+												  ::Effekseer::FileInterface* fileInterface = nullptr);
+
+class Renderer;
+using RendererRef = ::Effekseer::RefPtr<Renderer>;
+
+/**
+	@brief
+	\~english	A renderer which generates vertices and parameters like other renderers but doesn't draw them
+	\~japanese	他のレンダラーと同様に頂点とパラメーターを生成するが描画しないレンダラー
+	@note
+	\~english	It is used to measure an update and a generation of vertices without a window and a GPU.
+	\~japanese	ウィンドウとGPUなしで更新と頂点生成を計測するために使用する。
+*/
+class Renderer : public ::EffekseerRenderer::Renderer
+{
+protected:
+	Renderer()
+	{
+	}
+	virtual ~Renderer()
+	{
+	}
+
+public:
+	/**
+	@brief
+	\~english	Create an instance
+	\~japanese	インスタンスを生成する。
+	@param	squareMaxCount
+	\~english	the number of maximum sprites
+	\~japanese	最大描画スプライト数
+	@return
+	\~english	instance
+	\~japanese	インスタンス
+	*/
+	static RendererRef Create(int32_t squareMaxCount);
+
+	static RendererRef Create(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, int32_t squareMaxCount);
+
+	/**
+		@brief	最大描画スプライト数を取得する。
+	*/
+	virtual int32_t GetSquareMaxCount() const = 0;
+
+	/**
+		@brief	最大描画スプライト数を設定する。
+		@note
+		描画している時は使用できない。
+	*/
+	virtual void SetSquareMaxCount(int32_t count) = 0;
+
+	/**
+	@brief
+	\~english	Get the number of changes of render states, shaders and textures
+	\~japanese	描画ステート、シェーダー、テクスチャの変更回数を取得する。
+	*/
+	virtual int32_t GetStateChangeCount() const = 0;
+
+	/**
+	@brief
+	\~english	Reset the number of changes of render states, shaders and textures
+	\~japanese	描画ステート、シェーダー、テクスチャの変更回数をリセットする。
+	*/
+	virtual void ResetStateChangeCount() = 0;
+};
+
+} // namespace EffekseerRendererNull
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+#endif // __EFFEKSEERRENDERER_NULL_RENDERER_H__
@@ -0,0 +1,214 @@
+#ifndef __EFFEKSEERRENDERER_NULL_RENDERER_IMPLEMENTED_H__
+#define __EFFEKSEERRENDERER_NULL_RENDERER_IMPLEMENTED_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "../../EffekseerRendererCommon/EffekseerRenderer.IndexBufferBase.h"
+#include "../../EffekseerRendererCommon/EffekseerRenderer.RenderStateBase.h"
+#include "../../EffekseerRendererCommon/EffekseerRenderer.StandardRenderer.h"
+#include "EffekseerRendererNull.Base.h"
+#include "EffekseerRendererNull.Renderer.h"
+#include "GraphicsDevice.h"
+
+namespace EffekseerRendererNull
+{
+
+/**
+	@brief	描画クラス
+	@note
+	頂点とパラメーターを生成するが、描画命令の代わりに回数を数える。
+*/
+class RendererImplemented;
+using RendererImplementedRef = ::Effekseer::RefPtr<RendererImplemented>;
+
+class RendererImplemented : public Renderer, public ::Effekseer::ReferenceObject
+{
+private:
+	Backend::GraphicsDeviceRef graphicsDevice_ = nullptr;
+
+	VertexBuffer* m_vertexBuffer = nullptr;
+	int32_t m_squareMaxCount;
+
+	Shader* shader_unlit_ = nullptr;
+	Shader* shader_distortion_ = nullptr;
+	Shader* shader_lit_ = nullptr;
+	Shader* shader_ad_unlit_ = nullptr;
+	Shader* shader_ad_lit_ = nullptr;
+	Shader* shader_ad_distortion_ = nullptr;
+
+	Shader* currentShader = nullptr;
+
+	//! a shader which was used last to count changes of shaders
+	Shader* lastShader_ = nullptr;
+
+	EffekseerRenderer::StandardRenderer<RendererImplemented, Shader>* m_standardRenderer = nullptr;
+
+	::EffekseerRenderer::RenderStateBase* m_renderState = nullptr;
+
+	EffekseerRenderer::DistortingCallback* m_distortingCallback = nullptr;
+
+	// textures which are specified currently
+	std::vector<::Effekseer::Backend::TextureRef> currentTextures_;
+
+	int32_t stateChangeCount_ = 0;
+
+public:
+	RendererImplemented(int32_t squareMaxCount, Backend::GraphicsDeviceRef graphicsDevice);
+
+	~RendererImplemented();
+
+	void OnLostDevice() override;
+	void OnResetDevice() override;
+
+	bool Initialize();
+
+	void SetRestorationOfStatesFlag(bool flag) override;
+
+	/**
+		@brief	描画開始
+	*/
+	bool BeginRendering() override;
+
+	/**
+		@brief	描画終了
+	*/
+	bool EndRendering() override;
+
+	/**
+		@brief	頂点バッファ取得
+	*/
+	VertexBuffer* GetVertexBuffer();
+
+	/**
+		@brief	インデックスバッファ取得
+		@note
+		インデックスは描画されないため、常にnullptrを返す。
+	*/
+	::EffekseerRenderer::IndexBufferBase* GetIndexBuffer();
+
+	/**
+		@brief	最大描画スプライト数
+	*/
+	int32_t GetSquareMaxCount() const override;
+
+	void SetSquareMaxCount(int32_t count) override;
+
+	int32_t GetStateChangeCount() const override
+	{
+		return stateChangeCount_;
+	}
+
+	void ResetStateChangeCount() override
+	{
+		stateChangeCount_ = 0;
+	}
+
+	void AddStateChangeCount()
+	{
+		stateChangeCount_++;
+	}
+
+	::EffekseerRenderer::RenderStateBase* GetRenderState();
+
+	/**
+		@brief	スプライトレンダラーを生成する。
+	*/
+	::Effekseer::SpriteRendererRef CreateSpriteRenderer() override;
+
+	/**
+		@brief	リボンレンダラーを生成する。
+	*/
+	::Effekseer::RibbonRendererRef CreateRibbonRenderer() override;
+
+	/**
+		@brief	リングレンダラーを生成する。
+	*/
+	::Effekseer::RingRendererRef CreateRingRenderer() override;
+
+	/**
+		@brief	モデルレンダラーを生成する。
+	*/
+	::Effekseer::ModelRendererRef CreateModelRenderer() override;
+
+	/**
+		@brief	軌跡レンダラーを生成する。
+	*/
+	::Effekseer::TrackRendererRef CreateTrackRenderer() override;
+
+	/**
+		@brief	テクスチャ読込クラスを生成する。
+	*/
+	::Effekseer::TextureLoaderRef CreateTextureLoader(::Effekseer::FileInterface* fileInterface = nullptr) override;
+
+	/**
+		@brief	モデル読込クラスを生成する。
+	*/
+	::Effekseer::ModelLoaderRef CreateModelLoader(::Effekseer::FileInterface* fileInterface = nullptr) override;
+
+	::Effekseer::MaterialLoaderRef CreateMaterialLoader(::Effekseer::FileInterface* fileInterface = nullptr) override;
+
+	EffekseerRenderer::DistortingCallback* GetDistortingCallback() override;
+
+	void SetDistortingCallback(EffekseerRenderer::DistortingCallback* callback) override;
+
+	EffekseerRenderer::StandardRenderer<RendererImplemented, Shader>* GetStandardRenderer()
+	{
+		return m_standardRenderer;
+	}
+
+	void SetVertexBuffer(VertexBuffer* vertexBuffer, int32_t size);
+	void SetIndexBuffer(::EffekseerRenderer::IndexBufferBase* indexBuffer);
+
+	void SetVertexBuffer(const Effekseer::Backend::VertexBufferRef& vertexBuffer, int32_t size);
+	void SetIndexBuffer(const Effekseer::Backend::IndexBufferRef& indexBuffer);
+
+	void SetLayout(Shader* shader);
+	void DrawSprites(int32_t spriteCount, int32_t vertexOffset);
+	void DrawPolygon(int32_t vertexCount, int32_t indexCount);
+	void DrawPolygonInstanced(int32_t vertexCount, int32_t indexCount, int32_t instanceCount);
+
+	Shader* GetShader(::EffekseerRenderer::RendererShaderType type) const;
+	void BeginShader(Shader* shader);
+	void EndShader(Shader* shader);
+
+	void SetVertexBufferToShader(const void* data, int32_t size, int32_t dstOffset);
+
+	void SetPixelBufferToShader(const void* data, int32_t size, int32_t dstOffset);
+
+	void SetTextures(Shader* shader, Effekseer::Backend::TextureRef* textures, int32_t count);
+
+	void ResetRenderState() override;
+
+	Backend::GraphicsDeviceRef& GetIntetnalGraphicsDevice()
+	{
+		return graphicsDevice_;
+	}
+
+	Effekseer::Backend::GraphicsDeviceRef GetGraphicsDevice() const override
+	{
+		return graphicsDevice_;
+	}
+
+	virtual int GetRef() override
+	{
+		return ::Effekseer::ReferenceObject::GetRef();
+	}
+	virtual int AddRef() override
+	{
+		return ::Effekseer::ReferenceObject::AddRef();
+	}
+	virtual int Release() override
+	{
+		return ::Effekseer::ReferenceObject::Release();
+	}
+};
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace EffekseerRendererNull
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+#endif // __EFFEKSEERRENDERER_NULL_RENDERER_IMPLEMENTED_H__
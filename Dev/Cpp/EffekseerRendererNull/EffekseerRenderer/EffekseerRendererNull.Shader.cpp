@@ -0,0 +1,58 @@
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+#include "EffekseerRendererNull.Shader.h"
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+namespace EffekseerRendererNull
+{
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+Shader::Shader(const char* name)
+	: name_(name)
+{
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+Shader* Shader::Create(const char* name)
+{
+	return new Shader(name);
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+void Shader::SetVertexConstantBufferSize(int32_t size)
+{
+	vertexConstantBuffer_.resize(size);
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+void Shader::SetPixelConstantBufferSize(int32_t size)
+{
+	pixelConstantBuffer_.resize(size);
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+void Shader::SetConstantBuffer()
+{
+	// constant buffers are not sent anywhere
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+} // namespace EffekseerRendererNull
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
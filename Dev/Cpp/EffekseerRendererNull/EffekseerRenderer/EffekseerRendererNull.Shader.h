@@ -0,0 +1,66 @@
+
+#ifndef __EFFEKSEERRENDERER_NULL_SHADER_H__
+#define __EFFEKSEERRENDERER_NULL_SHADER_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "../../EffekseerRendererCommon/EffekseerRenderer.ShaderBase.h"
+#include "EffekseerRendererNull.Base.h"
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+namespace EffekseerRendererNull
+{
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+/**
+	@brief	a shader which has only constant buffers
+	@note
+	Constant buffers are filled as well as other backends so that a cost to generate them is measured.
+*/
+class Shader : public ::EffekseerRenderer::ShaderBase
+{
+private:
+	std::string name_;
+	Effekseer::CustomVector<uint8_t> vertexConstantBuffer_;
+	Effekseer::CustomVector<uint8_t> pixelConstantBuffer_;
+
+	Shader(const char* name);
+
+public:
+	virtual ~Shader() = default;
+
+	static Shader* Create(const char* name);
+
+	void SetVertexConstantBufferSize(int32_t size) override;
+	void SetPixelConstantBufferSize(int32_t size) override;
+
+	void* GetVertexConstantBuffer() override
+	{
+		return vertexConstantBuffer_.data();
+	}
+
+	void* GetPixelConstantBuffer() override
+	{
+		return pixelConstantBuffer_.data();
+	}
+
+	void SetConstantBuffer() override;
+
+	const char* GetName() const
+	{
+		return name_.c_str();
+	}
+};
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+} // namespace EffekseerRendererNull
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+#endif // __EFFEKSEERRENDERER_NULL_SHADER_H__
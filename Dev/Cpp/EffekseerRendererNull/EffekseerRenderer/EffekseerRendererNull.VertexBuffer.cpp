@@ -0,0 +1,145 @@
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+#include "EffekseerRendererNull.VertexBuffer.h"
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+namespace EffekseerRendererNull
+{
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+VertexBuffer::VertexBuffer(int size, bool isDynamic)
+	: VertexBufferBase(size, isDynamic)
+{
+	buffer_.resize(size);
+	m_resource = buffer_.data();
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+VertexBuffer* VertexBuffer::Create(int size, bool isDynamic)
+{
+	return new VertexBuffer(size, isDynamic);
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+void VertexBuffer::Lock()
+{
+	assert(!m_isLock);
+
+	m_isLock = true;
+	m_offset = 0;
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+bool VertexBuffer::RingBufferLock(int32_t size, int32_t& offset, void*& data, int32_t alignment)
+{
+	assert(!m_isLock);
+	assert(!m_ringBufferLock);
+	assert(this->m_isDynamic);
+
+	if (size > m_size)
+		return false;
+
+	m_vertexRingOffset = (m_vertexRingOffset + alignment - 1) / alignment * alignment;
+
+	if (m_vertexRingOffset + size > m_size)
+	{
+		m_vertexRingOffset = 0;
+	}
+
+	offset = m_vertexRingOffset;
+	data = m_resource + offset;
+	m_vertexRingOffset += size;
+
+	m_offset = size;
+	m_ringBufferLock = true;
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+bool VertexBuffer::TryRingBufferLock(int32_t size, int32_t& offset, void*& data, int32_t alignment)
+{
+	if (m_vertexRingOffset + size > m_size)
+		return false;
+
+	return RingBufferLock(size, offset, data, alignment);
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+void VertexBuffer::Unlock()
+{
+	assert(m_isLock || m_ringBufferLock);
+
+	if (m_isLock)
+	{
+		m_vertexRingOffset += m_offset;
+	}
+
+	m_isLock = false;
+	m_ringBufferLock = false;
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+bool VertexBuffer::RingBufferLockRest(int32_t minSize, int32_t& offset, void*& data, int32_t& size, int32_t alignment)
+{
+	assert(!m_isLock);
+	assert(!m_ringBufferLock);
+	assert(this->m_isDynamic);
+
+	if (minSize > m_size)
+		return false;
+
+	m_vertexRingOffset = (m_vertexRingOffset + alignment - 1) / alignment * alignment;
+
+	if (m_vertexRingOffset + minSize > m_size)
+	{
+		m_vertexRingOffset = 0;
+	}
+
+	offset = m_vertexRingOffset;
+	size = m_size - offset;
+	data = m_resource + offset;
+
+	m_offset = size;
+	m_ringBufferLock = true;
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+void VertexBuffer::UnlockRest(int32_t writtenSize)
+{
+	assert(m_ringBufferLock);
+	assert(writtenSize <= m_offset);
+
+	m_vertexRingOffset += writtenSize;
+	m_offset = writtenSize;
+	m_ringBufferLock = false;
+}
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+} // namespace EffekseerRendererNull
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
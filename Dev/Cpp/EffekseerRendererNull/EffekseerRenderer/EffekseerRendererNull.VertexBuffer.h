@@ -0,0 +1,56 @@
+
+#ifndef __EFFEKSEERRENDERER_NULL_VERTEXBUFFER_H__
+#define __EFFEKSEERRENDERER_NULL_VERTEXBUFFER_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "../../EffekseerRendererCommon/EffekseerRenderer.VertexBufferBase.h"
+#include "EffekseerRendererNull.Base.h"
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+namespace EffekseerRendererNull
+{
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+/**
+	@brief	a ring buffer on CPU memory
+	@note
+	Vertices are written into the buffer as well as other backends, but they are never uploaded.
+*/
+class VertexBuffer : public ::EffekseerRenderer::VertexBufferBase
+{
+private:
+	Effekseer::CustomVector<uint8_t> buffer_;
+
+	int32_t m_vertexRingOffset = 0;
+	bool m_ringBufferLock = false;
+
+	VertexBuffer(int size, bool isDynamic);
+
+public:
+	virtual ~VertexBuffer() = default;
+
+	static VertexBuffer* Create(int size, bool isDynamic);
+
+	void Lock() override;
+	bool RingBufferLock(int32_t size, int32_t& offset, void*& data, int32_t alignment) override;
+	bool TryRingBufferLock(int32_t size, int32_t& offset, void*& data, int32_t alignment) override;
+
+	void Unlock() override;
+
+	bool RingBufferLockRest(int32_t minSize, int32_t& offset, void*& data, int32_t& size, int32_t alignment) override;
+	void UnlockRest(int32_t writtenSize) override;
+};
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+} // namespace EffekseerRendererNull
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+#endif // __EFFEKSEERRENDERER_NULL_VERTEXBUFFER_H__
@@ -0,0 +1,214 @@
+#include "GraphicsDevice.h"
+#include <string.h>
+
+namespace EffekseerRendererNull
+{
+namespace Backend
+{
+
+bool VertexBuffer::Init(int32_t size, bool isDynamic)
+{
+	resources_.resize(size);
+	isDynamic_ = isDynamic;
+	return true;
+}
+
+void VertexBuffer::UpdateData(const void* src, int32_t size, int32_t offset)
+{
+	assert(resources_.size() >= size + offset && offset >= 0);
+
+	if (src != nullptr)
+	{
+		memcpy(resources_.data() + offset, src, size);
+	}
+}
+
+bool IndexBuffer::Init(int32_t elementCount, int32_t stride)
+{
+	elementCount_ = elementCount;
+	stride_ = stride;
+	strideType_ = stride == 4 ? Effekseer::Backend::IndexBufferStrideType::Stride4 : Effekseer::Backend::IndexBufferStrideType::Stride2;
+	resources_.resize(elementCount_ * stride_);
+	return true;
+}
+
+void IndexBuffer::UpdateData(const void* src, int32_t size, int32_t offset)
+{
+	assert(resources_.size() >= size + offset && offset >= 0);
+
+	if (src != nullptr)
+	{
+		memcpy(resources_.data() + offset, src, size);
+	}
+}
+
+bool UniformBuffer::Init(int32_t size, const void* initialData)
+{
+	buffer_.resize(size);
+
+	if (auto data = static_cast<const uint8_t*>(initialData))
+	{
+		buffer_.assign(data, data + size);
+	}
+
+	return true;
+}
+
+void UniformBuffer::UpdateData(const void* src, int32_t size, int32_t offset)
+{
+	assert(buffer_.size() >= size + offset && offset >= 0);
+
+	if (src != nullptr)
+	{
+		memcpy(buffer_.data() + offset, src, size);
+	}
+}
+
+bool Texture::Init(const Effekseer::Backend::TextureParameter& param)
+{
+	type_ = Effekseer::Backend::TextureType::Color2D;
+	format_ = param.Format;
+	size_ = param.Size;
+	hasMipmap_ = param.GenerateMipmap;
+	return true;
+}
+
+bool Texture::Init(const Effekseer::Backend::RenderTextureParameter& param)
+{
+	type_ = Effekseer::Backend::TextureType::Render;
+	format_ = param.Format;
+	size_ = param.Size;
+	hasMipmap_ = false;
+	return true;
+}
+
+bool Texture::Init(const Effekseer::Backend::DepthTextureParameter& param)
+{
+	type_ = Effekseer::Backend::TextureType::Depth;
+	format_ = param.Format;
+	size_ = param.Size;
+	hasMipmap_ = false;
+	return true;
+}
+
+Effekseer::Backend::VertexBufferRef GraphicsDevice::CreateVertexBuffer(int32_t size, const void* initialData, bool isDynamic)
+{
+	auto ret = Effekseer::MakeRefPtr<VertexBuffer>();
+
+	if (!ret->Init(size, isDynamic))
+	{
+		return nullptr;
+	}
+
+	ret->UpdateData(initialData, size, 0);
+
+	return ret;
+}
+
+Effekseer::Backend::IndexBufferRef GraphicsDevice::CreateIndexBuffer(int32_t elementCount, const void* initialData, Effekseer::Backend::IndexBufferStrideType stride)
+{
+	auto ret = Effekseer::MakeRefPtr<IndexBuffer>();
+
+	if (!ret->Init(elementCount, stride == Effekseer::Backend::IndexBufferStrideType::Stride4 ? 4 : 2))
+	{
+		return nullptr;
+	}
+
+	ret->UpdateData(initialData, elementCount * (stride == Effekseer::Backend::IndexBufferStrideType::Stride4 ? 4 : 2), 0);
+
+	return ret;
+}
+
+bool GraphicsDevice::UpdateVertexBuffer(Effekseer::Backend::VertexBufferRef& buffer, int32_t size, int32_t offset, const void* data)
+{
+	if (buffer == nullptr)
+	{
+		return false;
+	}
+
+	auto b = static_cast<VertexBuffer*>(buffer.Get());
+
+	b->UpdateData(data, size, offset);
+
+	return true;
+}
+
+bool GraphicsDevice::UpdateIndexBuffer(Effekseer::Backend::IndexBufferRef& buffer, int32_t size, int32_t offset, const void* data)
+{
+	if (buffer == nullptr)
+	{
+		return false;
+	}
+
+	auto b = static_cast<IndexBuffer*>(buffer.Get());
+
+	b->UpdateData(data, size, offset);
+
+	return true;
+}
+
+bool GraphicsDevice::UpdateUniformBuffer(Effekseer::Backend::UniformBufferRef& buffer, int32_t size, int32_t offset, const void* data)
+{
+	if (buffer == nullptr)
+	{
+		return false;
+	}
+
+	auto b = static_cast<UniformBuffer*>(buffer.Get());
+
+	b->UpdateData(data, size, offset);
+
+	return true;
+}
+
+Effekseer::Backend::UniformBufferRef GraphicsDevice::CreateUniformBuffer(int32_t size, const void* initialData)
+{
+	auto ret = Effekseer::MakeRefPtr<UniformBuffer>();
+
+	if (!ret->Init(size, initialData))
+	{
+		return nullptr;
+	}
+
+	return ret;
+}
+
+Effekseer::Backend::TextureRef GraphicsDevice::CreateTexture(const Effekseer::Backend::TextureParameter& param)
+{
+	auto ret = Effekseer::MakeRefPtr<Texture>();
+
+	if (!ret->Init(param))
+	{
+		return nullptr;
+	}
+
+	return ret;
+}
+
+Effekseer::Backend::TextureRef GraphicsDevice::CreateRenderTexture(const Effekseer::Backend::RenderTextureParameter& param)
+{
+	auto ret = Effekseer::MakeRefPtr<Texture>();
+
+	if (!ret->Init(param))
+	{
+		return nullptr;
+	}
+
+	return ret;
+}
+
+Effekseer::Backend::TextureRef GraphicsDevice::CreateDepthTexture(const Effekseer::Backend::DepthTextureParameter& param)
+{
+	auto ret = Effekseer::MakeRefPtr<Texture>();
+
+	if (!ret->Init(param))
+	{
+		return nullptr;
+	}
+
+	return ret;
+}
+
+} // namespace Backend
+
+} // namespace EffekseerRendererNull
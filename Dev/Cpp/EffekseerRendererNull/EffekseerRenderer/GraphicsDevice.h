@@ -0,0 +1,152 @@
+#ifndef __EFFEKSEERRENDERER_NULL_GRAPHICS_DEVICE_H__
+#define __EFFEKSEERRENDERER_NULL_GRAPHICS_DEVICE_H__
+
+#include <Effekseer.h>
+#include <assert.h>
+
+namespace EffekseerRendererNull
+{
+namespace Backend
+{
+
+class GraphicsDevice;
+class VertexBuffer;
+class IndexBuffer;
+class UniformBuffer;
+class Texture;
+
+using GraphicsDeviceRef = Effekseer::RefPtr<GraphicsDevice>;
+using VertexBufferRef = Effekseer::RefPtr<VertexBuffer>;
+using IndexBufferRef = Effekseer::RefPtr<IndexBuffer>;
+using UniformBufferRef = Effekseer::RefPtr<UniformBuffer>;
+using TextureRef = Effekseer::RefPtr<Texture>;
+
+/**
+	@brief	VertexBuffer which is stored in CPU memory
+*/
+class VertexBuffer
+	: public Effekseer::Backend::VertexBuffer
+{
+private:
+	Effekseer::CustomVector<uint8_t> resources_;
+	bool isDynamic_ = false;
+
+public:
+	VertexBuffer() = default;
+	~VertexBuffer() override = default;
+
+	bool Init(int32_t size, bool isDynamic);
+
+	void UpdateData(const void* src, int32_t size, int32_t offset);
+
+	const Effekseer::CustomVector<uint8_t>& GetResources() const
+	{
+		return resources_;
+	}
+};
+
+/**
+	@brief	IndexBuffer which is stored in CPU memory
+*/
+class IndexBuffer
+	: public Effekseer::Backend::IndexBuffer
+{
+private:
+	Effekseer::CustomVector<uint8_t> resources_;
+	int32_t stride_ = 0;
+
+public:
+	IndexBuffer() = default;
+	~IndexBuffer() override = default;
+
+	bool Init(int32_t elementCount, int32_t stride);
+
+	void UpdateData(const void* src, int32_t size, int32_t offset);
+
+	const Effekseer::CustomVector<uint8_t>& GetResources() const
+	{
+		return resources_;
+	}
+};
+
+class UniformBuffer
+	: public Effekseer::Backend::UniformBuffer
+{
+private:
+	Effekseer::CustomVector<uint8_t> buffer_;
+
+public:
+	UniformBuffer() = default;
+	~UniformBuffer() override = default;
+
+	bool Init(int32_t size, const void* initialData);
+
+	const Effekseer::CustomVector<uint8_t>& GetBuffer() const
+	{
+		return buffer_;
+	}
+
+	void UpdateData(const void* src, int32_t size, int32_t offset);
+};
+
+/**
+	@brief	Texture which has only a format and a size
+	@note
+	Pixels are discarded because they are never sampled.
+*/
+class Texture
+	: public Effekseer::Backend::Texture
+{
+public:
+	Texture() = default;
+	~Texture() override = default;
+
+	bool Init(const Effekseer::Backend::TextureParameter& param);
+
+	bool Init(const Effekseer::Backend::RenderTextureParameter& param);
+
+	bool Init(const Effekseer::Backend::DepthTextureParameter& param);
+};
+
+/**
+	@brief	GraphicsDevice which doesn't use a GPU
+	@note
+	It is used to run a runtime without a window and a GPU, for example, to benchmark it on a CI.
+*/
+class GraphicsDevice
+	: public Effekseer::Backend::GraphicsDevice
+{
+public:
+	GraphicsDevice() = default;
+
+	~GraphicsDevice() override = default;
+
+	Effekseer::Backend::VertexBufferRef CreateVertexBuffer(int32_t size, const void* initialData, bool isDynamic) override;
+
+	Effekseer::Backend::IndexBufferRef CreateIndexBuffer(int32_t elementCount, const void* initialData, Effekseer::Backend::IndexBufferStrideType stride) override;
+
+	bool UpdateVertexBuffer(Effekseer::Backend::VertexBufferRef& buffer, int32_t size, int32_t offset, const void* data) override;
+
+	bool UpdateIndexBuffer(Effekseer::Backend::IndexBufferRef& buffer, int32_t size, int32_t offset, const void* data) override;
+
+	bool UpdateUniformBuffer(Effekseer::Backend::UniformBufferRef& buffer, int32_t size, int32_t offset, const void* data) override;
+
+	Effekseer::Backend::UniformBufferRef CreateUniformBuffer(int32_t size, const void* initialData) override;
+
+	Effekseer::Backend::TextureRef CreateTexture(const Effekseer::Backend::TextureParameter& param) override;
+
+	Effekseer::Backend::TextureRef CreateRenderTexture(const Effekseer::Backend::RenderTextureParameter& param) override;
+
+	Effekseer::Backend::TextureRef CreateDepthTexture(const Effekseer::Backend::DepthTextureParameter& param) override;
+
+	std::string GetDeviceName() const override
+	{
+		return "Null";
+	}
+};
+
+} // namespace Backend
+
+} // namespace EffekseerRendererNull
+
+#endif
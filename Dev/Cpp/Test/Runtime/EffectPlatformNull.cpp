@@ -0,0 +1,10 @@
+#include "EffectPlatformNull.h"
+
+EffekseerRenderer::RendererRef EffectPlatformNull::CreateRenderer()
+{
+	return EffekseerRendererNull::Renderer::Create(2000);
+}
+
+EffectPlatformNull::~EffectPlatformNull()
+{
+}
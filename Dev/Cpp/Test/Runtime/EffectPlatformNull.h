@@ -0,0 +1,24 @@
+#pragma once
+
+#include "../../EffekseerRendererNull/EffekseerRendererNull.h"
+#include "EffectPlatform.h"
+
+/**
+	@brief	a platform without a window and a GPU to measure an update and a generation of vertices
+*/
+class EffectPlatformNull final : public EffectPlatform
+{
+private:
+protected:
+	EffekseerRenderer::RendererRef CreateRenderer() override;
+
+	bool DoEvent() override
+	{
+		return true;
+	}
+
+public:
+	EffectPlatformNull() = default;
+
+	~EffectPlatformNull();
+};
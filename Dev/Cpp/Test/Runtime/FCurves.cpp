@@ -0,0 +1,87 @@
+#include <Effekseer.h>
+#include <Effekseer/Effekseer.FCurves.h>
+
+#include "../TestHelper.h"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+std::vector<uint8_t> CreateFCurveData(int32_t start, int32_t end, int32_t len, int32_t freq, const std::vector<float>& keys)
+{
+	std::vector<uint8_t> data;
+
+	auto push = [&data](const void* value, size_t size) -> void {
+		auto p = static_cast<const uint8_t*>(value);
+		data.insert(data.end(), p, p + size);
+	};
+
+	const float offsetMax = 0.0f;
+	const float offsetMin = 0.0f;
+	const int32_t offset = 0;
+	const auto count = static_cast<int32_t>(keys.size());
+
+	push(&start, sizeof(int32_t));
+	push(&end, sizeof(int32_t));
+	push(&offsetMax, sizeof(float));
+	push(&offsetMin, sizeof(float));
+	push(&offset, sizeof(int32_t));
+	push(&len, sizeof(int32_t));
+	push(&freq, sizeof(int32_t));
+	push(&count, sizeof(int32_t));
+	push(keys.data(), sizeof(float) * keys.size());
+
+	return data;
+}
+
+} // namespace
+
+void FCurves_TailTest()
+{
+	// the last segment is shorter than a frequency
+	const int32_t freq = 10;
+	const int32_t len = 45;
+	const std::vector<float> keys = {0.0f, 3.0f, -2.0f, 5.0f, 8.0f};
+
+	// frames around the last key and the end of the curve, and behind the start
+	std::vector<float> livings;
+	for (float frame = 35.0f; frame <= 60.0f; frame += 0.25f)
+	{
+		livings.push_back(frame);
+		livings.push_back(-frame);
+	}
+	livings.push_back(static_cast<float>(len));
+	livings.push_back(static_cast<float>(len) - 0.00005f);
+
+	const std::vector<float> lifes(livings.size(), 100.0f);
+
+	for (int32_t start = 0; start < 3; start++)
+	{
+		for (int32_t end = 0; end < 3; end++)
+		{
+			const auto data = CreateFCurveData(start, end, len, freq, keys);
+
+			Effekseer::FCurve curve(0.0f);
+			curve.Load(data.data(), 0);
+
+			for (auto type : {Effekseer::FCurveTimelineType::Time, Effekseer::FCurveTimelineType::Percent})
+			{
+				std::vector<float> values(livings.size());
+				curve.GetValues(livings.data(), lifes.data(), static_cast<int32_t>(livings.size()), type, values.data());
+
+				for (size_t i = 0; i < livings.size(); i++)
+				{
+					const auto expected = curve.GetValue(livings[i], lifes[i], type);
+					if (memcmp(&expected, &values[i], sizeof(float)) != 0)
+					{
+						throw "";
+					}
+				}
+			}
+		}
+	}
+}
+
+TestRegister Runtime_FCurvesTailTest("Runtime.FCurves.Tail", []() -> void { FCurves_TailTest(); });
@@ -0,0 +1,432 @@
+#include <Effekseer.h>
+#include <Effekseer/Effekseer.InternalScript.h>
+
+#include "../TestHelper.h"
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+enum
+{
+	OpConstant = 0,
+	OpAdd = 1,
+	OpSub = 2,
+	OpMul = 3,
+	OpDiv = 4,
+	OpMod = 5,
+	OpUnaryAdd = 11,
+	OpUnarySub = 12,
+	OpSine = 21,
+	OpCos = 22,
+	OpRand = 31,
+	OpRandWithSeed = 32,
+	OpStep = 50,
+};
+
+const int32_t ExternalRegister = 0x1000;
+const int32_t GlobalRegister = 0x1000 + 0x100;
+const int32_t LocalRegister = 0x1000 + 0x200;
+
+struct Operator
+{
+	int32_t Type;
+	std::vector<int32_t> Inputs;
+	std::vector<int32_t> Outputs;
+	std::vector<float> Attributes;
+};
+
+struct Script
+{
+	int32_t RegisterCount = 0;
+	std::array<int32_t, 4> OutputRegisters;
+	std::vector<Operator> Operators;
+};
+
+std::vector<uint8_t> CreateScriptData(const Script& script)
+{
+	std::vector<uint8_t> data;
+
+	auto push = [&data](const void* value, size_t size) -> void {
+		auto p = static_cast<const uint8_t*>(value);
+		data.insert(data.end(), p, p + size);
+	};
+
+	auto pushInt = [&push](int32_t value) -> void { push(&value, sizeof(int32_t)); };
+
+	pushInt(0);
+	pushInt(static_cast<int32_t>(Effekseer::InternalScript::RunningPhaseType::Local));
+	pushInt(script.RegisterCount);
+	pushInt(static_cast<int32_t>(script.Operators.size()));
+
+	for (auto outputRegister : script.OutputRegisters)
+	{
+		pushInt(outputRegister);
+	}
+
+	for (const auto& op : script.Operators)
+	{
+		pushInt(op.Type);
+		pushInt(static_cast<int32_t>(op.Inputs.size()));
+		pushInt(static_cast<int32_t>(op.Outputs.size()));
+		pushInt(static_cast<int32_t>(op.Attributes.size()));
+
+		for (auto input : op.Inputs)
+		{
+			pushInt(input);
+		}
+
+		for (auto output : op.Outputs)
+		{
+			pushInt(output);
+		}
+
+		for (auto attribute : op.Attributes)
+		{
+			push(&attribute, sizeof(float));
+		}
+	}
+
+	return data;
+}
+
+struct RandContext
+{
+	int32_t Count = 0;
+	std::vector<float> Seeds;
+};
+
+float Rand(void* userData)
+{
+	auto context = static_cast<RandContext*>(userData);
+	context->Count++;
+	context->Seeds.push_back(-1.0f);
+	return static_cast<float>(context->Count) * 0.37f;
+}
+
+float RandWithSeed(void* userData, float seed)
+{
+	auto context = static_cast<RandContext*>(userData);
+	context->Count++;
+	context->Seeds.push_back(seed);
+	return sinf(seed * 12.9898f) + static_cast<float>(context->Count);
+}
+
+/**
+	@brief	execute operators one by one in the same way as the interpreter before operators were compiled
+*/
+std::array<float, 4> ExecuteWithReference(const Script& script,
+										  const std::array<float, 4>& externals,
+										  const std::array<float, 1>& globals,
+										  const std::array<float, 5>& locals,
+										  RandContext& context)
+{
+	std::vector<float> registers(script.RegisterCount, 0.0f);
+
+	auto getRegister = [&](int32_t index) -> float {
+		if (index < script.RegisterCount)
+			return registers[index];
+		if (index < GlobalRegister)
+			return externals[index - ExternalRegister];
+		if (index < LocalRegister)
+			return globals[index - GlobalRegister];
+		return locals[index - LocalRegister];
+	};
+
+	for (const auto& op : script.Operators)
+	{
+		std::array<float, 8> inputs;
+		for (size_t j = 0; j < op.Inputs.size(); j++)
+		{
+			inputs[j] = getRegister(op.Inputs[j]);
+		}
+
+		for (size_t j = 0; j < op.Outputs.size(); j++)
+		{
+			float& output = registers[op.Outputs[j]];
+
+			switch (op.Type)
+			{
+			case OpConstant:
+				output = op.Attributes[0];
+				break;
+			case OpAdd:
+				output = inputs[0] + inputs[1];
+				break;
+			case OpSub:
+				output = inputs[0] - inputs[1];
+				break;
+			case OpMul:
+				output = inputs[0] * inputs[1];
+				break;
+			case OpDiv:
+				output = inputs[0] / inputs[1];
+				break;
+			case OpMod:
+				output = fmodf(inputs[0], inputs[1]);
+				break;
+			case OpUnaryAdd:
+				output = inputs[0];
+				break;
+			case OpUnarySub:
+				output = -inputs[0];
+				break;
+			case OpSine:
+				output = sinf(inputs[j]);
+				break;
+			case OpCos:
+				output = cosf(inputs[j]);
+				break;
+			case OpRand:
+				output = Rand(&context);
+				break;
+			case OpRandWithSeed:
+				output = RandWithSeed(&context, inputs[j]);
+				break;
+			case OpStep:
+				output = inputs[1] >= inputs[0] ? 1.0f : 0.0f;
+				break;
+			default:
+				throw "";
+			}
+		}
+	}
+
+	std::array<float, 4> ret;
+	for (size_t i = 0; i < 4; i++)
+	{
+		ret[i] = getRegister(script.OutputRegisters[i]);
+	}
+	return ret;
+}
+
+std::array<float, 4> Execute(const Effekseer::InternalScript& internalScript,
+							 const std::array<float, 4>& externals,
+							 const std::array<float, 1>& globals,
+							 const std::array<float, 5>& locals,
+							 RandContext& context)
+{
+	return internalScript.Execute(externals, globals, locals, Rand, RandWithSeed, &context);
+}
+
+bool IsSameValue(float a, float b)
+{
+	return (std::isnan(a) && std::isnan(b)) || memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+Script CreateRandomScript(std::mt19937& mt)
+{
+	const int32_t types[] = {OpConstant, OpAdd, OpSub, OpMul, OpDiv, OpMod, OpUnaryAdd, OpUnarySub, OpSine, OpCos, OpRand, OpRandWithSeed, OpStep};
+	const float constants[] = {0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 2.0f, 3.25f, -7.0f};
+
+	std::uniform_int_distribution<int32_t> typeDist(0, static_cast<int32_t>(sizeof(types) / sizeof(types[0])) - 1);
+	std::uniform_int_distribution<int32_t> constantDist(0, static_cast<int32_t>(sizeof(constants) / sizeof(constants[0])) - 1);
+	std::uniform_int_distribution<int32_t> operatorCountDist(0, 24);
+
+	Script script;
+	script.RegisterCount = std::uniform_int_distribution<int32_t>(1, 8)(mt);
+
+	auto randomRegister = [&]() -> int32_t {
+		switch (std::uniform_int_distribution<int32_t>(0, 5)(mt))
+		{
+		case 0:
+			return ExternalRegister + std::uniform_int_distribution<int32_t>(0, 3)(mt);
+		case 1:
+			return GlobalRegister;
+		case 2:
+			return LocalRegister + std::uniform_int_distribution<int32_t>(0, 4)(mt);
+		default:
+			return std::uniform_int_distribution<int32_t>(0, script.RegisterCount - 1)(mt);
+		}
+	};
+
+	auto randomOutput = [&]() -> int32_t { return std::uniform_int_distribution<int32_t>(0, script.RegisterCount - 1)(mt); };
+
+	const auto operatorCount = operatorCountDist(mt);
+	for (int32_t i = 0; i < operatorCount; i++)
+	{
+		Operator op;
+		op.Type = types[typeDist(mt)];
+
+		const int32_t outputCount = std::uniform_int_distribution<int32_t>(1, 3)(mt);
+		int32_t inputCount = 0;
+
+		switch (op.Type)
+		{
+		case OpConstant:
+		case OpRand:
+			break;
+		case OpUnaryAdd:
+		case OpUnarySub:
+			inputCount = 1;
+			break;
+		case OpSine:
+		case OpCos:
+		case OpRandWithSeed:
+			inputCount = outputCount;
+			break;
+		default:
+			inputCount = 2;
+			break;
+		}
+
+		for (int32_t j = 0; j < inputCount; j++)
+		{
+			op.Inputs.push_back(randomRegister());
+		}
+
+		for (int32_t j = 0; j < outputCount; j++)
+		{
+			op.Outputs.push_back(randomOutput());
+		}
+
+		if (op.Type == OpConstant)
+		{
+			op.Attributes.push_back(constants[constantDist(mt)]);
+		}
+
+		script.Operators.push_back(op);
+	}
+
+	for (auto& outputRegister : script.OutputRegisters)
+	{
+		outputRegister = randomRegister();
+	}
+
+	return script;
+}
+
+Effekseer::InternalScript LoadScript(const Script& script)
+{
+	auto data = CreateScriptData(script);
+
+	Effekseer::InternalScript internalScript;
+	if (!internalScript.Load(data.data(), static_cast<int32_t>(data.size())))
+	{
+		throw "";
+	}
+	return internalScript;
+}
+
+} // namespace
+
+void InternalScript_ConstantFoldingTest()
+{
+	// r3 = sin(2 * 3) and r2 = 2 * 3 are calculated when they are loaded
+	Script script;
+	script.RegisterCount = 4;
+	script.OutputRegisters = {3, 2, ExternalRegister + 1, LocalRegister + 4};
+	script.Operators.push_back({OpConstant, {}, {0}, {2.0f}});
+	script.Operators.push_back({OpConstant, {}, {1}, {3.0f}});
+	script.Operators.push_back({OpMul, {0, 1}, {2}, {}});
+	script.Operators.push_back({OpSine, {2}, {3}, {}});
+
+	const auto internalScript = LoadScript(script);
+
+	if (internalScript.GetInstructionCount() != 2)
+	{
+		throw "";
+	}
+
+	RandContext context;
+	const auto ret = Execute(internalScript, {1.0f, 2.0f, 3.0f, 4.0f}, {5.0f}, {6.0f, 7.0f, 8.0f, 9.0f, 10.0f}, context);
+	const std::array<float, 4> expected = {sinf(6.0f), 6.0f, 2.0f, 10.0f};
+
+	for (size_t i = 0; i < 4; i++)
+	{
+		if (!IsSameValue(ret[i], expected[i]))
+		{
+			throw "";
+		}
+	}
+}
+
+void InternalScript_DeadCodeTest()
+{
+	// sin(external2) is removed because it is not read. rand is not removed to keep a sequence of random numbers
+	Script script;
+	script.RegisterCount = 4;
+	script.OutputRegisters = {3, 3, 3, 3};
+	script.Operators.push_back({OpAdd, {ExternalRegister + 0, ExternalRegister + 1}, {0}, {}});
+	script.Operators.push_back({OpSine, {ExternalRegister + 2}, {1}, {}});
+	script.Operators.push_back({OpRand, {}, {2}, {}});
+	script.Operators.push_back({OpMul, {0, GlobalRegister}, {3}, {}});
+
+	const auto internalScript = LoadScript(script);
+
+	if (internalScript.GetInstructionCount() != 3)
+	{
+		throw "";
+	}
+
+	RandContext context;
+	const auto ret = Execute(internalScript, {1.0f, 2.0f, 3.0f, 4.0f}, {5.0f}, {}, context);
+
+	if (context.Count != 1 || ret[0] != 15.0f)
+	{
+		throw "";
+	}
+}
+
+void InternalScript_ReferenceTest()
+{
+	std::mt19937 mt(3);
+	std::uniform_real_distribution<float> valueDist(-4.0f, 4.0f);
+
+	for (int32_t i = 0; i < 2000; i++)
+	{
+		const auto script = CreateRandomScript(mt);
+		const auto internalScript = LoadScript(script);
+
+		for (int32_t j = 0; j < 4; j++)
+		{
+			std::array<float, 4> externals;
+			std::array<float, 1> globals;
+			std::array<float, 5> locals;
+
+			for (auto& value : externals)
+				value = valueDist(mt);
+			for (auto& value : globals)
+				value = valueDist(mt);
+			for (auto& value : locals)
+				value = valueDist(mt);
+
+			RandContext context;
+			RandContext referenceContext;
+			const auto ret = Execute(internalScript, externals, globals, locals, context);
+			const auto expected = ExecuteWithReference(script, externals, globals, locals, referenceContext);
+
+			for (size_t k = 0; k < 4; k++)
+			{
+				if (!IsSameValue(ret[k], expected[k]))
+				{
+					throw "";
+				}
+			}
+
+			// random numbers are drawn in the same order with the same seeds
+			if (context.Count != referenceContext.Count || context.Seeds.size() != referenceContext.Seeds.size())
+			{
+				throw "";
+			}
+
+			for (size_t k = 0; k < context.Seeds.size(); k++)
+			{
+				if (!IsSameValue(context.Seeds[k], referenceContext.Seeds[k]))
+				{
+					throw "";
+				}
+			}
+		}
+	}
+}
+
+TestRegister Runtime_InternalScriptConstantFoldingTest("Runtime.InternalScript.ConstantFolding", []() -> void { InternalScript_ConstantFoldingTest(); });
+
+TestRegister Runtime_InternalScriptDeadCodeTest("Runtime.InternalScript.DeadCode", []() -> void { InternalScript_DeadCodeTest(); });
+
+TestRegister Runtime_InternalScriptReferenceTest("Runtime.InternalScript.Reference", []() -> void { InternalScript_ReferenceTest(); });
@@ -19,6 +19,8 @@
 #include "EffectPlatformVulkan.h"
 #endif
 
+#include "EffectPlatformNull.h"
+
 #include "../TestHelper.h"
 #include <fstream>
 #include <iostream>
@@ -45,12 +47,17 @@ void CheckPerformancePlatform(EffectPlatform* platform, std::string baseResultPa
 
 		for (size_t i = 0; i < 300; i++)
 		{
+			platform->GetRenderer()->ResetDrawCallCount();
+			platform->GetRenderer()->ResetDrawVertexCount();
+
 			platform->Update();
 
 			int32_t updateTime = platform->GetManager()->GetUpdateTime();
 			int32_t drawTime = platform->GetManager()->GetDrawTime();
+			int32_t drawCallCount = platform->GetRenderer()->GetDrawCallCount();
+			int32_t drawVertexCount = platform->GetRenderer()->GetDrawVertexCount();
 
-			ss << updateTime << "," << drawTime << std::endl;
+			ss << updateTime << "," << drawTime << "," << drawCallCount << "," << drawVertexCount << std::endl;
 		}
 
 		platform->StopAllEffects();
@@ -64,6 +71,13 @@ void CheckPerformancePlatform(EffectPlatform* platform, std::string baseResultPa
 
 void CheckPerformance()
 {
+	// it runs without a GPU so that an update and a generation of vertices are measured stably
+	{
+		auto platform = std::make_shared<EffectPlatformNull>();
+		CheckPerformancePlatform(platform.get(), "", "_Null");
+		platform->Terminate();
+	}
+
 #ifdef _WIN32
 	{
 		auto platform = std::make_shared<EffectPlatformDX11>();
@@ -0,0 +1,207 @@
+#include "../../EffekseerRendererCommon/EffekseerRenderer.RadixSorter.h"
+
+#include "../TestHelper.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+std::vector<int32_t> SortWithReference(const std::vector<float>& keys, bool isDescending)
+{
+	std::vector<int32_t> indexes(keys.size());
+	for (size_t i = 0; i < indexes.size(); i++)
+	{
+		indexes[i] = static_cast<int32_t>(i);
+	}
+
+	std::stable_sort(indexes.begin(), indexes.end(), [&keys, isDescending](int32_t a, int32_t b) -> bool {
+		return isDescending ? keys[a] > keys[b] : keys[a] < keys[b];
+	});
+
+	return indexes;
+}
+
+std::vector<int32_t> Sort(EffekseerRenderer::RadixSorter& sorter, const std::vector<float>& keys, bool isDescending)
+{
+	sorter.Resize(static_cast<int32_t>(keys.size()));
+	for (size_t i = 0; i < keys.size(); i++)
+	{
+		sorter.SetKey(static_cast<int32_t>(i), keys[i]);
+	}
+
+	sorter.Sort(isDescending);
+
+	std::vector<int32_t> indexes(keys.size());
+	for (size_t i = 0; i < indexes.size(); i++)
+	{
+		indexes[i] = sorter.GetIndex(static_cast<int32_t>(i));
+	}
+	return indexes;
+}
+
+// indexes sorted from the previous order may not be stable, so only the order of keys is checked
+bool IsSorted(const std::vector<float>& keys, const std::vector<int32_t>& indexes, bool isDescending)
+{
+	std::vector<bool> isFound(keys.size(), false);
+	for (auto index : indexes)
+	{
+		if (index < 0 || index >= static_cast<int32_t>(keys.size()) || isFound[index])
+		{
+			return false;
+		}
+		isFound[index] = true;
+	}
+
+	for (size_t i = 1; i < indexes.size(); i++)
+	{
+		const auto prev = keys[indexes[i - 1]];
+		const auto current = keys[indexes[i]];
+		if (isDescending ? prev < current : prev > current)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+std::vector<float> CreateKeys(std::mt19937& mt, int32_t count, bool hasTies)
+{
+	std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+	std::uniform_int_distribution<int32_t> tieDist(-3, 3);
+
+	std::vector<float> keys(count);
+	for (auto& key : keys)
+	{
+		key = hasTies ? static_cast<float>(tieDist(mt)) : dist(mt);
+	}
+	return keys;
+}
+
+} // namespace
+
+void RadixSorter_SignTest()
+{
+	// negative values, signed zeros, denormals and infinities
+	const std::vector<float> values = {
+		-0.0f,
+		0.0f,
+		1.0f,
+		-1.0f,
+		-2.0f,
+		2.0f,
+		-1.0e-40f,
+		1.0e-40f,
+		std::numeric_limits<float>::max(),
+		std::numeric_limits<float>::lowest(),
+		std::numeric_limits<float>::infinity(),
+		-std::numeric_limits<float>::infinity(),
+		-0.5f,
+		0.5f,
+	};
+
+	// both the insertion sort and the radix sort
+	for (int32_t repeat : {1, 10})
+	{
+		std::vector<float> keys;
+		for (int32_t i = 0; i < repeat; i++)
+		{
+			keys.insert(keys.end(), values.begin(), values.end());
+		}
+
+		for (bool isDescending : {false, true})
+		{
+			EffekseerRenderer::RadixSorter sorter;
+			if (Sort(sorter, keys, isDescending) != SortWithReference(keys, isDescending))
+			{
+				throw "";
+			}
+		}
+	}
+}
+
+void RadixSorter_ThresholdTest()
+{
+	std::mt19937 mt(1);
+
+	// around the count where the insertion sort is switched to the radix sort
+	for (int32_t count = 0; count <= 130; count++)
+	{
+		for (bool hasTies : {false, true})
+		{
+			const auto keys = CreateKeys(mt, count, hasTies);
+
+			for (bool isDescending : {false, true})
+			{
+				EffekseerRenderer::RadixSorter sorter;
+				if (Sort(sorter, keys, isDescending) != SortWithReference(keys, isDescending))
+				{
+					throw "";
+				}
+			}
+		}
+	}
+
+	for (int32_t count : {1000, 50000})
+	{
+		const auto keys = CreateKeys(mt, count, false);
+		EffekseerRenderer::RadixSorter sorter;
+		if (Sort(sorter, keys, false) != SortWithReference(keys, false))
+		{
+			throw "";
+		}
+	}
+}
+
+void RadixSorter_PreviousOrderTest()
+{
+	std::mt19937 mt(2);
+	std::uniform_real_distribution<float> smallDist(-1.0f, 1.0f);
+
+	for (int32_t count : {10, 64, 1000})
+	{
+		EffekseerRenderer::RadixSorter sorter;
+		auto keys = CreateKeys(mt, count, false);
+
+		for (int32_t frame = 0; frame < 20; frame++)
+		{
+			const bool isDescending = frame >= 10;
+
+			if (frame % 5 == 4)
+			{
+				// far from the previous order
+				keys = CreateKeys(mt, count, frame % 2 == 0);
+			}
+			else
+			{
+				// close to the previous order
+				for (auto& key : keys)
+				{
+					key += smallDist(mt);
+				}
+			}
+
+			if (!IsSorted(keys, Sort(sorter, keys, isDescending), isDescending))
+			{
+				throw "";
+			}
+		}
+
+		// the previous order is discarded when the count is changed
+		keys.pop_back();
+		if (Sort(sorter, keys, false) != SortWithReference(keys, false))
+		{
+			throw "";
+		}
+	}
+}
+
+TestRegister Runtime_RadixSorterSignTest("Runtime.RadixSorter.Sign", []() -> void { RadixSorter_SignTest(); });
+
+TestRegister Runtime_RadixSorterThresholdTest("Runtime.RadixSorter.Threshold", []() -> void { RadixSorter_ThresholdTest(); });
+
+TestRegister Runtime_RadixSorterPreviousOrderTest("Runtime.RadixSorter.PreviousOrder", []() -> void { RadixSorter_PreviousOrderTest(); });
@@ -0,0 +1,160 @@
+#include <Effekseer.h>
+#include <Effekseer/Effekseer.SlotMap.h>
+
+#include "../TestHelper.h"
+
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+void SlotMap_ReuseTest()
+{
+	Effekseer::SlotMap<int32_t> slotMap;
+
+	std::vector<Effekseer::Handle> handles;
+	for (int32_t i = 0; i < 4; i++)
+	{
+		handles.push_back(slotMap.Add(i));
+	}
+
+	slotMap.RemoveIf([](int32_t value) -> bool { return value == 1 || value == 3; });
+
+	if (slotMap.Find(handles[1]) != nullptr || slotMap.Find(handles[3]) != nullptr || *slotMap.Find(handles[2]) != 2)
+	{
+		throw "";
+	}
+
+	// removed slots are reused in the order of removal with new generations
+	const auto handle4 = slotMap.Add(4);
+	const auto handle5 = slotMap.Add(5);
+
+	if (Effekseer::SlotMap<int32_t>::GetSlotIndex(handle4) != Effekseer::SlotMap<int32_t>::GetSlotIndex(handles[1]) ||
+		Effekseer::SlotMap<int32_t>::GetSlotIndex(handle5) != Effekseer::SlotMap<int32_t>::GetSlotIndex(handles[3]) ||
+		handle4 == handles[1] || handle5 == handles[3])
+	{
+		throw "";
+	}
+
+	if (slotMap.Find(handles[1]) != nullptr || *slotMap.Find(handle4) != 4 || slotMap.GetSlotCount() != 4)
+	{
+		throw "";
+	}
+
+	const std::vector<int32_t> expected = {0, 2, 4, 5};
+	if (std::vector<int32_t>(slotMap.begin(), slotMap.end()) != expected)
+	{
+		throw "";
+	}
+}
+
+void SlotMap_ReferenceTest()
+{
+	std::mt19937 mt(4);
+	std::uniform_int_distribution<int32_t> operationDist(0, 9);
+	std::uniform_int_distribution<int32_t> ratioDist(0, 99);
+
+	Effekseer::SlotMap<int32_t> slotMap;
+
+	// values in the order of addition and values of handles which are alive
+	std::vector<int32_t> values;
+	std::map<Effekseer::Handle, int32_t> aliveHandles;
+	std::set<Effekseer::Handle> removedHandles;
+	int32_t nextValue = 0;
+
+	for (int32_t step = 0; step < 5000; step++)
+	{
+		if (operationDist(mt) < 6)
+		{
+			const auto handle = slotMap.Add(nextValue);
+
+			// a handle is not reused until a generation wraps around
+			if (handle < 0 || aliveHandles.count(handle) > 0 || removedHandles.count(handle) > 0)
+			{
+				throw "";
+			}
+
+			aliveHandles[handle] = nextValue;
+			values.push_back(nextValue);
+			nextValue++;
+		}
+		else
+		{
+			const int32_t ratio = ratioDist(mt);
+			std::set<int32_t> removedValues;
+			for (auto value : values)
+			{
+				if (ratioDist(mt) < ratio)
+				{
+					removedValues.insert(value);
+				}
+			}
+
+			std::vector<int32_t> visitedValues;
+			slotMap.RemoveIf([&](int32_t value) -> bool {
+				visitedValues.push_back(value);
+				return removedValues.count(value) > 0;
+			});
+
+			// a predicate is called once for each value in order
+			if (visitedValues != values)
+			{
+				throw "";
+			}
+
+			std::vector<int32_t> remainingValues;
+			for (auto value : values)
+			{
+				if (removedValues.count(value) == 0)
+				{
+					remainingValues.push_back(value);
+				}
+			}
+			values = remainingValues;
+
+			for (auto it = aliveHandles.begin(); it != aliveHandles.end();)
+			{
+				if (removedValues.count(it->second) > 0)
+				{
+					removedHandles.insert(it->first);
+					it = aliveHandles.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+
+		if (slotMap.GetCount() != static_cast<int32_t>(values.size()) || std::vector<int32_t>(slotMap.begin(), slotMap.end()) != values)
+		{
+			throw "";
+		}
+
+		for (const auto& aliveHandle : aliveHandles)
+		{
+			const auto value = slotMap.Find(aliveHandle.first);
+			if (value == nullptr || *value != aliveHandle.second)
+			{
+				throw "";
+			}
+		}
+
+		for (const auto removedHandle : removedHandles)
+		{
+			if (slotMap.Find(removedHandle) != nullptr)
+			{
+				throw "";
+			}
+		}
+	}
+
+	if (slotMap.Find(-1) != nullptr || slotMap.Find(slotMap.GetSlotCount()) != nullptr)
+	{
+		throw "";
+	}
+}
+
+TestRegister Runtime_SlotMapReuseTest("Runtime.SlotMap.Reuse", []() -> void { SlotMap_ReuseTest(); });
+
+TestRegister Runtime_SlotMapReferenceTest("Runtime.SlotMap.Reference", []() -> void { SlotMap_ReferenceTest(); });
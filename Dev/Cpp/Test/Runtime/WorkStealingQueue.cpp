@@ -0,0 +1,146 @@
+#include <Effekseer.h>
+#include <Effekseer/Effekseer.WorkStealingQueue.h>
+
+#include "../TestHelper.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// every task must be popped exactly once
+void CheckTasks(const std::vector<std::vector<int32_t>>& poppedTasks, int32_t taskCount)
+{
+	std::vector<int32_t> counts(taskCount, 0);
+
+	for (const auto& tasks : poppedTasks)
+	{
+		for (auto task : tasks)
+		{
+			if (task < 0 || task >= taskCount)
+			{
+				throw "";
+			}
+			counts[task]++;
+		}
+	}
+
+	for (auto count : counts)
+	{
+		if (count != 1)
+		{
+			throw "";
+		}
+	}
+}
+
+} // namespace
+
+void WorkStealingQueue_SequentialTest()
+{
+	Effekseer::WorkStealingQueue queue;
+	int32_t task = 0;
+
+	// a single thread pops tasks in order
+	queue.Reset(100, 1);
+	for (int32_t i = 0; i < 100; i++)
+	{
+		if (!queue.Pop(0, task) || task != i)
+		{
+			throw "";
+		}
+	}
+
+	if (queue.Pop(0, task))
+	{
+		throw "";
+	}
+
+	// a thread pops its own range in order and steals the latter half of the next range
+	queue.Reset(12, 3);
+	const std::vector<int32_t> expected = {0, 1, 2, 3, 6, 7, 5, 4};
+	for (auto expectedTask : expected)
+	{
+		if (!queue.Pop(0, task) || task != expectedTask)
+		{
+			throw "";
+		}
+	}
+
+	std::vector<std::vector<int32_t>> poppedTasks(3);
+	poppedTasks[0] = expected;
+	for (int32_t threadID = 2; threadID >= 0; threadID--)
+	{
+		while (queue.Pop(threadID, task))
+		{
+			poppedTasks[threadID].push_back(task);
+		}
+	}
+	CheckTasks(poppedTasks, 12);
+
+	// ranges are extended when the number of threads increases
+	for (int32_t threadCount : {1, 2, 7, 16})
+	{
+		for (int32_t taskCount : {0, 1, 5, 33})
+		{
+			queue.Reset(taskCount, threadCount);
+
+			std::vector<std::vector<int32_t>> tasks(threadCount);
+			for (int32_t threadID = 0; threadID < threadCount; threadID++)
+			{
+				while (queue.Pop(threadID, task))
+				{
+					tasks[threadID].push_back(task);
+				}
+			}
+			CheckTasks(tasks, taskCount);
+		}
+	}
+}
+
+void WorkStealingQueue_ParallelTest()
+{
+	const int32_t threadCount = 4;
+	Effekseer::WorkStealingQueue queue;
+
+	for (int32_t taskCount : {0, 3, 100, 10000})
+	{
+		for (int32_t repeat = 0; repeat < 10; repeat++)
+		{
+			queue.Reset(taskCount, threadCount);
+
+			std::vector<std::vector<int32_t>> poppedTasks(threadCount);
+			std::vector<std::thread> threads;
+
+			for (int32_t threadID = 0; threadID < threadCount; threadID++)
+			{
+				threads.emplace_back([&, threadID]() -> void {
+					int32_t task = 0;
+					while (queue.Pop(threadID, task))
+					{
+						poppedTasks[threadID].push_back(task);
+
+						// the first thread is slow, so that other threads steal its tasks
+						if (threadID == 0 && task % 16 == 0)
+						{
+							std::this_thread::sleep_for(std::chrono::microseconds(50));
+						}
+					}
+				});
+			}
+
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+
+			CheckTasks(poppedTasks, taskCount);
+		}
+	}
+}
+
+TestRegister Runtime_WorkStealingQueueSequentialTest("Runtime.WorkStealingQueue.Sequential", []() -> void { WorkStealingQueue_SequentialTest(); });
+
+TestRegister Runtime_WorkStealingQueueParallelTest("Runtime.WorkStealingQueue.Parallel", []() -> void { WorkStealingQueue_ParallelTest(); });
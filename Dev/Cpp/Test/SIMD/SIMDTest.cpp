@@ -7,6 +7,10 @@
 #include "SIMD/Vec4f.h"
 #include "SIMD/Mat43f.h"
 #include "SIMD/Mat44f.h"
+#include "SIMD/Float8.h"
+#include "SIMD/Int8.h"
+#include "SIMD/Bridge8.h"
+#include "SIMD/Mat43f8.h"
 #include "SIMD/Utils.h"
 #include "Effekseer.Vector2D.h"
 #include "Effekseer.Vector3D.h"
@@ -513,6 +517,288 @@ void test_Int4()
 	}
 }
 
+void test_Float8()
+{
+	{
+		float a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+		Float8 ret = Float8::Load8(a);
+		ASSERT(ret == Float8(1, 2, 3, 4, 5, 6, 7, 8));
+	}
+	{
+		Float8 a(1, 2, 3, 4, 5, 6, 7, 8);
+		float ret[8];
+		Float8::Store8(ret, a);
+		ASSERT(ret[0] == 1.0f && ret[1] == 2.0f && ret[2] == 3.0f && ret[3] == 4.0f);
+		ASSERT(ret[4] == 5.0f && ret[5] == 6.0f && ret[6] == 7.0f && ret[7] == 8.0f);
+	}
+
+	{
+		Float8 a(1, 2, 3, 4, 5, 6, 7, 8), b(9, 10, 11, 12, 13, 14, 15, 16);
+		Float8 ret = a + b;
+		ASSERT(ret == Float8(10, 12, 14, 16, 18, 20, 22, 24));
+	}
+
+	{
+		Float8 a(1, 2, 3, 4, 5, 6, 7, 8), b(9, 10, 11, 12, 13, 14, 15, 16);
+		Float8 ret = a - b;
+		ASSERT(ret == Float8(-8, -8, -8, -8, -8, -8, -8, -8));
+	}
+
+	{
+		Float8 a(1, 2, 3, 4, 5, 6, 7, 8), b(9, 10, 11, 12, 13, 14, 15, 16);
+		Float8 ret = a * b;
+		ASSERT(ret == Float8(9, 20, 33, 48, 65, 84, 105, 128));
+	}
+
+	{
+		Float8 a(1, 2, 3, 4, 5, 6, 7, 8);
+		Float8 ret = a * 5;
+		ASSERT(ret == Float8(5, 10, 15, 20, 25, 30, 35, 40));
+	}
+
+	{
+		Float8 a(2, 4, 6, 8, 10, 12, 14, 16);
+		Float8 ret = a / 2;
+		ASSERT(ret == Float8(1, 2, 3, 4, 5, 6, 7, 8));
+	}
+
+	{
+		Float8 a(1, 2, 3, 4, 5, 6, 7, 8), b(5, 6, 7, 8, 1, 2, 3, 4), c(9, 10, 11, 12, 2, 3, 4, 5);
+		ASSERT(Float8::MulAdd(a, b, c) == Float8(46, 62, 80, 100, 7, 12, 19, 28));
+		ASSERT(Float8::MulSub(a, b, c) == Float8(-44, -58, -74, -92, 3, 0, -5, -12));
+	}
+
+	{
+		Float8 a(1, -2, 3, -4, 5, -6, 7, -8);
+		Float8 ret = Float8::Abs(a);
+		ASSERT(ret == Float8(1, 2, 3, 4, 5, 6, 7, 8));
+	}
+
+	{
+		Float8 a(1, 5, 3, 7, 1, 5, 3, 7), b(4, 8, 2, 6, 0, 9, 3, 8);
+		ASSERT(Float8::Min(a, b) == Float8(1, 5, 2, 6, 0, 5, 3, 7));
+		ASSERT(Float8::Max(a, b) == Float8(4, 8, 3, 7, 1, 9, 3, 8));
+	}
+
+	{
+		Float8 a(1.5f, -1.5f, 2.0f, -2.0f, 0.25f, -0.25f, 7.75f, -7.75f);
+		ASSERT(Float8::Floor(a) == Float8(1, -2, 2, -2, 0, -1, 7, -8));
+		ASSERT(Float8::Ceil(a) == Float8(2, -1, 2, -2, 1, -0.0f, 8, -7));
+	}
+
+	{
+		Float8 a(1, 2, 3, 4, 9, 16, 25, 36);
+		Float8 ret = Float8::Sqrt(a);
+		Float8 testret = Float8(1.0f, 1.4142135623730950488016887242097f, 1.7320508075688772935274463415059f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f);
+		ASSERT(Float8::MoveMask(Float8::NearEqual(ret, testret)) == 0xff);
+	}
+
+	{
+		Float8 a(1, 2, 3, 4, 9, 16, 25, 36);
+		Float8 ret = Float8::Rsqrt(a);
+		Float8 testret = Float8(1.0f, 0.70710678118654752440084436210485f, 0.57735026918962576450914878050195f, 0.5f, 1.0f / 3.0f, 0.25f, 0.2f, 1.0f / 6.0f);
+		ASSERT(Float8::MoveMask(Float8::NearEqual(ret, testret, 1e-3f)) == 0xff);
+	}
+
+	{
+		Float8 a(1, 2, 3, 4, 1, 2, 3, 4), b(5, 4, 3, 2, 1, 1, 1, 5);
+		ASSERT(Float8::MoveMask(Float8::Equal(a, b)) == 0x14);
+		ASSERT(Float8::MoveMask(Float8::NotEqual(a, b)) == 0xeb);
+		ASSERT(Float8::MoveMask(Float8::LessThan(a, b)) == 0x83);
+		ASSERT(Float8::MoveMask(Float8::LessEqual(a, b)) == 0x97);
+		ASSERT(Float8::MoveMask(Float8::GreaterThan(a, b)) == 0x68);
+		ASSERT(Float8::MoveMask(Float8::GreaterEqual(a, b)) == 0x7c);
+	}
+
+	{
+		Float8 a(1, 2, 3, 4, 5, 6, 7, 8);
+		ASSERT(a == a.Convert8i().Convert8f());
+		ASSERT(a.Convert8i() == Int8(1, 2, 3, 4, 5, 6, 7, 8));
+		ASSERT(a.Cast8i().Cast8f() == a);
+	}
+
+	{
+		Float8 a(1, 2, 3, 4, 5, 6, 7, 8), b(8, 7, 6, 5, 4, 3, 2, 1);
+		Float8 mask = Float8::LessThan(a, b);
+		Float8 ret = Float8::Select(mask, a, b);
+		ASSERT(ret == Float8(1, 2, 3, 4, 4, 3, 2, 1));
+	}
+
+	{
+		Float8 a(1, -2, 3, -4, 5, -6, 7, -8);
+		Float8 ret = a ^ Float8(-0.0f);
+		ASSERT(ret == Float8(-1, 2, -3, 4, -5, 6, -7, 8));
+		ASSERT((a & Float8(-0.0f)) == Float8(0, -0.0f, 0, -0.0f, 0, -0.0f, 0, -0.0f));
+	}
+
+	{
+		// the same results as the scalar version
+		float angles[8] = {0.0f, 0.5f, -0.5f, 3.0f, -3.0f, 12.0f, -56.0f, 100.0f};
+		Float8 s, c;
+		SinCos(Float8::Load8(angles), s, c);
+
+		float ss[8], cs[8];
+		Float8::Store8(ss, s);
+		Float8::Store8(cs, c);
+		for (int i = 0; i < 8; i++)
+		{
+			float s2, c2;
+			::Effekseer::SinCos(angles[i], s2, c2);
+			ASSERT(ss[i] == s2 && cs[i] == c2);
+		}
+	}
+}
+
+void test_Int8()
+{
+	{
+		int32_t a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+		Int8 ret = Int8::Load8(a);
+		ASSERT(ret == Int8(1, 2, 3, 4, 5, 6, 7, 8));
+	}
+	{
+		Int8 a(1, 2, 3, 4, 5, 6, 7, 8);
+		int32_t ret[8];
+		Int8::Store8(ret, a);
+		ASSERT(ret[0] == 1 && ret[1] == 2 && ret[2] == 3 && ret[3] == 4);
+		ASSERT(ret[4] == 5 && ret[5] == 6 && ret[6] == 7 && ret[7] == 8);
+	}
+
+	{
+		Int8 a(1, 2, 3, 4, 5, 6, 7, 8), b(9, 10, 11, 12, 13, 14, 15, 16);
+		ASSERT(a + b == Int8(10, 12, 14, 16, 18, 20, 22, 24));
+		ASSERT(a - b == Int8(-8, -8, -8, -8, -8, -8, -8, -8));
+		ASSERT(a * b == Int8(9, 20, 33, 48, 65, 84, 105, 128));
+		ASSERT(a * 5 == Int8(5, 10, 15, 20, 25, 30, 35, 40));
+	}
+
+	{
+		Int8 a(1, 2, 3, 4, 5, 6, 7, 8), b(5, 6, 7, 8, 1, 2, 3, 4), c(9, 10, 11, 12, 2, 3, 4, 5);
+		ASSERT(Int8::MulAdd(a, b, c) == Int8(46, 62, 80, 100, 7, 12, 19, 28));
+		ASSERT(Int8::MulSub(a, b, c) == Int8(-44, -58, -74, -92, 3, 0, -5, -12));
+	}
+
+	{
+		Int8 a(1, -2, 3, -4, 5, -6, 7, -8);
+		ASSERT(Int8::Abs(a) == Int8(1, 2, 3, 4, 5, 6, 7, 8));
+	}
+
+	{
+		Int8 a(1, 5, 3, 7, 1, 5, 3, 7), b(4, 8, 2, 6, 0, 9, 3, 8);
+		ASSERT(Int8::Min(a, b) == Int8(1, 5, 2, 6, 0, 5, 3, 7));
+		ASSERT(Int8::Max(a, b) == Int8(4, 8, 3, 7, 1, 9, 3, 8));
+	}
+
+	{
+		Int8 a(1, -2, 4, -8, 16, -32, 64, -128);
+		ASSERT(Int8::ShiftL<2>(a) == Int8(4, -8, 16, -32, 64, -128, 256, -512));
+		ASSERT(Int8::ShiftRA<1>(a) == Int8(0, -1, 2, -4, 8, -16, 32, -64));
+		ASSERT(Int8::ShiftR<1>(Int8(2, 4, 6, 8, 10, 12, 14, -1)) == Int8(1, 2, 3, 4, 5, 6, 7, 0x7fffffff));
+	}
+
+	{
+		Int8 a(1, 2, 3, 4, 1, 2, 3, 4), b(5, 4, 3, 2, 1, 1, 1, 5);
+		ASSERT(Int8::MoveMask(Int8::Equal(a, b)) == 0x14);
+		ASSERT(Int8::MoveMask(Int8::NotEqual(a, b)) == 0xeb);
+		ASSERT(Int8::MoveMask(Int8::LessThan(a, b)) == 0x83);
+		ASSERT(Int8::MoveMask(Int8::LessEqual(a, b)) == 0x97);
+		ASSERT(Int8::MoveMask(Int8::GreaterThan(a, b)) == 0x68);
+		ASSERT(Int8::MoveMask(Int8::GreaterEqual(a, b)) == 0x7c);
+	}
+
+	{
+		Int8 a(1, 2, 3, 4, 5, 6, 7, 8), b(8, 7, 6, 5, 4, 3, 2, 1);
+		ASSERT(Int8::Select(Int8::LessThan(a, b), a, b) == Int8(1, 2, 3, 4, 4, 3, 2, 1));
+		ASSERT(a.Convert8f() == Float8(1, 2, 3, 4, 5, 6, 7, 8));
+	}
+}
+
+void test_Mat43f8()
+{
+	// 8 lanes version should be the same as Mat43f in each lane
+	auto getLane = [](const Mat43f8& m, int lane) -> Mat43f {
+		Matrix43 mats[8];
+		Mat43f8::StoreMatrix43(mats, m);
+		return Mat43f(mats[lane]);
+	};
+
+	Matrix43 as[8];
+	Matrix43 bs[8];
+	for (int i = 0; i < 8; i++)
+	{
+		for (int r = 0; r < 4; r++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				as[i].Value[r][c] = (float)(r * 3 + c + i);
+				bs[i].Value[r][c] = (float)(12 - r * 3 - c + i);
+			}
+		}
+	}
+
+	Mat43f8 a = Mat43f8::LoadMatrix43(as);
+	Mat43f8 b = Mat43f8::LoadMatrix43(bs);
+
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			ASSERT(getLane(a, i) == Mat43f(as[i]));
+		}
+	}
+
+	{
+		Mat43f8 ret = a * b;
+		for (int i = 0; i < 8; i++)
+		{
+			ASSERT(getLane(ret, i) == Mat43f(as[i]) * Mat43f(bs[i]));
+		}
+	}
+
+	{
+		Vec3f8 v(Float8(1, 2, 3, 4, 5, 6, 7, 8), Float8(2), Float8(3, 2, 1, 0, -1, -2, -3, -4));
+		Vec3f8 ret = Vec3f8::Transform(v, a);
+
+		float xs[8], ys[8], zs[8], vx[8], vz[8];
+		Float8::Store8(xs, ret.X);
+		Float8::Store8(ys, ret.Y);
+		Float8::Store8(zs, ret.Z);
+		Float8::Store8(vx, v.X);
+		Float8::Store8(vz, v.Z);
+		for (int i = 0; i < 8; i++)
+		{
+			ASSERT(Vec3f(xs[i], ys[i], zs[i]) == Vec3f::Transform(Vec3f(vx[i], 2, vz[i]), Mat43f(as[i])));
+		}
+	}
+
+	{
+		Mat43f8 ret = Mat43f8::Identity();
+		for (int i = 0; i < 8; i++)
+		{
+			ASSERT(getLane(ret, i) == Mat43f::Identity);
+		}
+	}
+
+	{
+		float rz[8] = {0, 12, -3, 0.5f, 0, 7, -56, 100};
+		float rx[8] = {34, 0, 2, -0.5f, 0, 1, 3, -5};
+		float ry[8] = {56, 78, 0, 1.5f, 0, -9, 0.25f, 6};
+		Mat43f8 ret = Mat43f8::RotationZXY(Float8::Load8(rz), Float8::Load8(rx), Float8::Load8(ry));
+		for (int i = 0; i < 8; i++)
+		{
+			ASSERT(Mat43f::Equal(getLane(ret, i), Mat43f::RotationZXY(rz[i], rx[i], ry[i]), 1e-4f));
+		}
+
+		Vec3f8 s(Float8(1, 2, 3, 4, 5, 6, 7, 8), Float8(2), Float8(0.5f));
+		Vec3f8 t(Float8(3), Float8(1, 2, 3, 4, 5, 6, 7, 8), Float8(-1));
+		Mat43f8 srt = Mat43f8::SRT(s, ret, t);
+		for (int i = 0; i < 8; i++)
+		{
+			Mat43f expected = Mat43f::SRT(Vec3f((float)(i + 1), 2, 0.5f), getLane(ret, i), Vec3f(3, (float)(i + 1), -1));
+			ASSERT(getLane(srt, i) == expected);
+		}
+	}
+}
+
 int main(int argc, char *argv[])
 {
 	test_Float4();
@@ -522,6 +808,9 @@ int main(int argc, char *argv[])
 	test_Mat43f();
 	test_Mat44f();
 	test_Int4();
+	test_Float8();
+	test_Int8();
+	test_Mat43f8();
 
 	return 0;
 }